@@ -0,0 +1,57 @@
+"""
+Creates "mw_com_precompiled_config" rule which validates a mw_com JSON configuration against the mw_com config schema
+and converts it into the precompiled (binary) configuration format, which is loaded by the mw_com runtime without JSON
+parsing.
+"""
+
+def _impl(ctx):
+    output = ctx.actions.declare_file(ctx.attr.out if ctx.attr.out else ctx.label.name + ".bin")
+
+    ctx.actions.run_shell(
+        inputs = [ctx.file.json, ctx.file.schema],
+        outputs = [output],
+        tools = [ctx.executable._validator, ctx.executable._precompiler],
+        command = """
+        set -e
+        '{validator}' '{schema}' < '{json}'
+        '{precompiler}' '{json}' '{output}'
+        """.format(
+            validator = ctx.executable._validator.path,
+            precompiler = ctx.executable._precompiler.path,
+            schema = ctx.file.schema.path,
+            json = ctx.file.json.path,
+            output = output.path,
+        ),
+        mnemonic = "MwComPrecompileConfig",
+        progress_message = "Precompiling mw_com configuration %s" % ctx.file.json.short_path,
+    )
+
+    return [DefaultInfo(files = depset([output]), runfiles = ctx.runfiles(files = [output]))]
+
+mw_com_precompiled_config = rule(
+    implementation = _impl,
+    attrs = {
+        "json": attr.label(
+            allow_single_file = [".json"],
+            mandatory = True,
+        ),
+        "out": attr.string(
+            doc = "Name of the generated file. Has to end with .bin. Defaults to <name>.bin",
+        ),
+        "schema": attr.label(
+            allow_single_file = True,
+            default = Label("//score/mw/com/impl/configuration:mw_com_config_schema"),
+        ),
+        "_precompiler": attr.label(
+            default = Label("//score/mw/com/impl/configuration/precompiler:mw_com_config_precompiler"),
+            executable = True,
+            cfg = "exec",
+        ),
+        "_validator": attr.label(
+            default = Label("@json_schema_validator"),
+            allow_single_file = True,
+            executable = True,
+            cfg = "exec",
+        ),
+    },
+)
@@ -0,0 +1,379 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/message_passing/client_factory.h"
+#include "score/message_passing/engine.h"
+#include "score/message_passing/i_server_connection.h"
+#include "score/message_passing/server_factory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace score::message_passing
+{
+namespace
+{
+
+// The maximum payload size supported by all the engines (limited by the 16-bit size field of the Unix Domain
+// engine protocol header)
+constexpr std::uint32_t kMaxMessageSize = 65535U;
+
+constexpr std::chrono::seconds kWaitTimeout{10};
+
+using ReplyExpected = score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error>;
+
+/// \brief The engine variants the benchmarks are run for
+/// \details New engine implementations or configurations shall be added here, so that all the benchmarks are
+///          automatically run for them as well.
+enum class EngineKind : std::int64_t
+{
+    kDefault = 0,
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+    kFourThreads = 1,
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+};
+
+std::shared_ptr<Engine> MakeEngine(const EngineKind kind)
+{
+    auto* const resource = score::cpp::pmr::get_default_resource();
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+    if (kind == EngineKind::kFourThreads)
+    {
+        return std::make_shared<Engine>(resource, std::size_t{4U});
+    }
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+    score::cpp::ignore = kind;
+    return std::make_shared<Engine>(resource);
+}
+
+void ReportLatencyPercentiles(benchmark::State& state, std::vector<double>& latencies_ns)
+{
+    if (latencies_ns.empty())
+    {
+        return;
+    }
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    const auto percentile = [&latencies_ns](const double fraction) {
+        const auto index = static_cast<std::size_t>(fraction * static_cast<double>(latencies_ns.size() - 1U));
+        return latencies_ns[index];
+    };
+    state.counters["p50_ns"] = percentile(0.50);
+    state.counters["p90_ns"] = percentile(0.90);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.counters["max_ns"] = latencies_ns.back();
+}
+
+/// \brief Sets up one server and a number of client connections to it, each side with its own engine
+/// \details Benchmark arguments: {engine kind, message size, number of client connections}
+class MessagePassingFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(benchmark::State& state) override
+    {
+        const auto kind = static_cast<EngineKind>(state.range(0));
+        message_.assign(static_cast<std::size_t>(state.range(1)), std::uint8_t{0x5AU});
+        reply_buffer_.resize(kMaxMessageSize);
+        const auto client_count = static_cast<std::size_t>(state.range(2));
+
+        identifier_ = "mp_benchmark_" + std::to_string(::getpid());
+        const ServiceProtocolConfig protocol_config{identifier_, kMaxMessageSize, kMaxMessageSize, kMaxMessageSize};
+
+        server_factory_.emplace(MakeEngine(kind));
+        client_factory_.emplace(MakeEngine(kind));
+
+        server_ = server_factory_->Create(protocol_config, IServerFactory::ServerConfig{1U, 0U, 1U, 0U});
+        StartServer();
+
+        std::vector<std::future<void>> ready_futures{};
+        ready_promises_ = std::vector<std::promise<void>>(client_count);
+        for (std::size_t i = 0U; i < client_count; ++i)
+        {
+            auto client =
+                client_factory_->Create(protocol_config, IClientFactory::ClientConfig{1U, 1U, false, false, false});
+            auto& ready_promise = ready_promises_[i];
+            ready_futures.push_back(ready_promise.get_future());
+            client->Start(
+                [&ready_promise](IClientConnection::State client_state) noexcept {
+                    if (client_state == IClientConnection::State::kReady)
+                    {
+                        ready_promise.set_value();
+                    }
+                },
+                [this](score::cpp::span<const std::uint8_t>) noexcept {
+                    CountReceived();
+                });
+            clients_.push_back(std::move(client));
+        }
+        for (auto& future : ready_futures)
+        {
+            if (future.wait_for(kWaitTimeout) != std::future_status::ready)
+            {
+                state.SkipWithError("client connection could not be established");
+                return;
+            }
+        }
+        WaitForServerConnections(client_count);
+    }
+
+    void TearDown(benchmark::State&) override
+    {
+        clients_.clear();
+        if (server_)
+        {
+            server_->StopListening();
+            server_.reset();
+        }
+        server_connections_.clear();
+        client_factory_.reset();
+        server_factory_.reset();
+    }
+
+  protected:
+    void CountReceived() noexcept
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        ++received_count_;
+        condition_.notify_all();
+    }
+
+    bool WaitForReceived(const std::uint64_t expected_count)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        return condition_.wait_for(lock, kWaitTimeout, [this, expected_count]() {
+            return received_count_ >= expected_count;
+        });
+    }
+
+    void ResetReceived()
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        received_count_ = 0U;
+    }
+
+    void ReportThroughput(benchmark::State& state, const std::uint64_t messages)
+    {
+        state.SetItemsProcessed(static_cast<std::int64_t>(messages));
+        state.SetBytesProcessed(static_cast<std::int64_t>(messages * message_.size()));
+    }
+
+    std::vector<std::uint8_t> message_{};
+    std::vector<std::uint8_t> reply_buffer_{};
+    std::vector<score::cpp::pmr::unique_ptr<IClientConnection>> clients_{};
+    std::vector<IServerConnection*> server_connections_{};
+    std::mutex mutex_{};
+
+  private:
+    void StartServer()
+    {
+        auto connect_callback = [this](IServerConnection& connection) noexcept -> void* {
+            std::lock_guard<std::mutex> guard{mutex_};
+            server_connections_.push_back(&connection);
+            condition_.notify_all();
+            return nullptr;
+        };
+        auto disconnect_callback = [this](IServerConnection& connection) noexcept {
+            std::lock_guard<std::mutex> guard{mutex_};
+            server_connections_.erase(
+                std::remove(server_connections_.begin(), server_connections_.end(), &connection),
+                server_connections_.end());
+        };
+        auto sent_callback = [this](IServerConnection&, score::cpp::span<const std::uint8_t>) noexcept
+            -> score::cpp::expected_blank<score::os::Error> {
+            CountReceived();
+            return {};
+        };
+        auto sent_with_reply_callback = [](IServerConnection& connection,
+                                           score::cpp::span<const std::uint8_t> message) noexcept
+            -> score::cpp::expected_blank<score::os::Error> {
+            return connection.Reply(message);
+        };
+        score::cpp::ignore =
+            server_->StartListening(connect_callback, disconnect_callback, sent_callback, sent_with_reply_callback);
+    }
+
+    void WaitForServerConnections(const std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        score::cpp::ignore = condition_.wait_for(lock, kWaitTimeout, [this, count]() {
+            return server_connections_.size() >= count;
+        });
+    }
+
+    std::string identifier_{};
+    std::optional<ServerFactory> server_factory_{};
+    std::optional<ClientFactory> client_factory_{};
+    score::cpp::pmr::unique_ptr<IServer> server_{};
+    std::vector<std::promise<void>> ready_promises_{};
+    std::condition_variable condition_{};
+    std::uint64_t received_count_{0U};
+};
+
+// Fire-and-forget throughput: the clients send in round-robin order; the measurement includes the delivery of all
+// the sent messages to the server
+BENCHMARK_DEFINE_F(MessagePassingFixture, Send)(benchmark::State& state)
+{
+    ResetReceived();
+    std::uint64_t sent_count{0U};
+    for (auto _ : state)
+    {
+        auto& client = *clients_[sent_count % clients_.size()];
+        if (!client.Send(message_).has_value())
+        {
+            state.SkipWithError("Send failed");
+            break;
+        }
+        ++sent_count;
+    }
+    if (!WaitForReceived(sent_count))
+    {
+        state.SkipWithError("not all the messages were delivered");
+    }
+    ReportThroughput(state, sent_count);
+}
+
+// Request-reply round trip latency, one outstanding request at a time
+BENCHMARK_DEFINE_F(MessagePassingFixture, SendWaitReply)(benchmark::State& state)
+{
+    std::vector<double> latencies_ns{};
+    std::uint64_t sent_count{0U};
+    for (auto _ : state)
+    {
+        auto& client = *clients_[sent_count % clients_.size()];
+        const auto start = std::chrono::steady_clock::now();
+        const auto reply_expected = client.SendWaitReply(message_, reply_buffer_);
+        const auto end = std::chrono::steady_clock::now();
+        if (!reply_expected.has_value())
+        {
+            state.SkipWithError("SendWaitReply failed");
+            break;
+        }
+        latencies_ns.push_back(static_cast<double>(std::chrono::nanoseconds{end - start}.count()));
+        ++sent_count;
+    }
+    ReportLatencyPercentiles(state, latencies_ns);
+    ReportThroughput(state, sent_count);
+}
+
+// Asynchronous requests: each iteration issues one request per client connection and waits for all the replies
+BENCHMARK_DEFINE_F(MessagePassingFixture, SendWithCallback)(benchmark::State& state)
+{
+    std::vector<double> latencies_ns{};
+    std::uint64_t expected_count{0U};
+    ResetReceived();
+    for (auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto& client : clients_)
+        {
+            const auto result =
+                client->SendWithCallback(message_, [this](ReplyExpected) noexcept {
+                    CountReceived();
+                });
+            if (!result.has_value())
+            {
+                state.SkipWithError("SendWithCallback failed");
+                break;
+            }
+        }
+        expected_count += clients_.size();
+        if (!WaitForReceived(expected_count))
+        {
+            state.SkipWithError("not all the replies were received");
+            break;
+        }
+        const auto end = std::chrono::steady_clock::now();
+        latencies_ns.push_back(static_cast<double>(std::chrono::nanoseconds{end - start}.count()));
+    }
+    ReportLatencyPercentiles(state, latencies_ns);
+    ReportThroughput(state, expected_count);
+}
+
+// Notification fan-out: each iteration notifies all the client connections and waits until all of them receive it
+BENCHMARK_DEFINE_F(MessagePassingFixture, Notify)(benchmark::State& state)
+{
+    std::vector<double> latencies_ns{};
+    std::uint64_t expected_count{0U};
+    ResetReceived();
+    std::vector<IServerConnection*> connections{};
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        connections = server_connections_;
+    }
+    for (auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (auto* const connection : connections)
+        {
+            score::cpp::ignore = connection->Notify(message_);
+        }
+        expected_count += connections.size();
+        if (!WaitForReceived(expected_count))
+        {
+            state.SkipWithError("not all the notifications were received");
+            break;
+        }
+        const auto end = std::chrono::steady_clock::now();
+        latencies_ns.push_back(static_cast<double>(std::chrono::nanoseconds{end - start}.count()));
+    }
+    ReportLatencyPercentiles(state, latencies_ns);
+    ReportThroughput(state, expected_count);
+}
+
+void EngineSizeAndClientArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"engine", "size", "clients"});
+    std::vector<std::int64_t> engines{static_cast<std::int64_t>(EngineKind::kDefault)};
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+    engines.push_back(static_cast<std::int64_t>(EngineKind::kFourThreads));
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+    for (const auto engine : engines)
+    {
+        for (const std::int64_t size : {0, 64, 1024, 16384, static_cast<std::int64_t>(kMaxMessageSize)})
+        {
+            for (const std::int64_t clients : {1, 16, 256})
+            {
+                benchmark->Args({engine, size, clients});
+            }
+        }
+    }
+    benchmark->UseRealTime();
+}
+
+BENCHMARK_REGISTER_F(MessagePassingFixture, Send)->Apply(EngineSizeAndClientArguments);
+BENCHMARK_REGISTER_F(MessagePassingFixture, SendWaitReply)->Apply(EngineSizeAndClientArguments);
+BENCHMARK_REGISTER_F(MessagePassingFixture, SendWithCallback)->Apply(EngineSizeAndClientArguments);
+BENCHMARK_REGISTER_F(MessagePassingFixture, Notify)->Apply(EngineSizeAndClientArguments);
+
+}  // namespace
+}  // namespace score::message_passing
+
+// Run the benchmark (must be at global scope)
+BENCHMARK_MAIN();
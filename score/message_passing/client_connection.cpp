@@ -38,6 +38,12 @@ constexpr std::int32_t kConnectRetryT = 3;  // new_delay = prev_delay * (1 + 1/T
 constexpr std::int32_t kConnectRetryMsMax = 5000;
 
 constexpr std::chrono::milliseconds kConnectIpcWarningDelay{20};
+
+std::uint8_t ToProtocolCode(const ClientToServer code, const IClientConnection::Priority priority) noexcept
+{
+    const std::uint8_t flag = (priority == IClientConnection::Priority::kLow) ? kLowPriorityFlag : std::uint8_t{0U};
+    return static_cast<std::uint8_t>(score::cpp::to_underlying(code) | flag);
+}
 }  // namespace
 
 ClientConnection::ClientConnection(std::shared_ptr<ISharedResourceEngine> engine,
@@ -95,7 +101,9 @@ ClientConnection::~ClientConnection() noexcept
     send_pool_.clear();
 }
 
-bool ClientConnection::TryQueueMessage(score::cpp::span<const std::uint8_t> message, ReplyCallback callback) noexcept
+bool ClientConnection::TryQueueMessage(score::cpp::span<const std::uint8_t> message,
+                                       ReplyCallback callback,
+                                       const Priority priority) noexcept
 {
     if (send_pool_.empty())
     {
@@ -105,12 +113,20 @@ bool ClientConnection::TryQueueMessage(score::cpp::span<const std::uint8_t> mess
     send_pool_.pop_front();
     send_command.message.assign(message.begin(), message.end());
     send_command.callback = std::move(callback);
+    send_command.priority = priority;
     send_queue_.push_back(send_command);
     return true;
 }
 
 score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
     score::cpp::span<const std::uint8_t> message) noexcept
+{
+    return SendWithPriority(message, Priority::kHigh);
+}
+
+score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithPriority(
+    score::cpp::span<const std::uint8_t> message,
+    const Priority priority) noexcept
 {
     if (message.size() > max_send_size_)
     {
@@ -122,14 +138,14 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
     }
     if (!client_config_.fully_ordered && !client_config_.truly_async)
     {
-        return engine_->SendProtocolMessage(client_fd_, score::cpp::to_underlying(ClientToServer::SEND), message);
+        return engine_->SendProtocolMessage(client_fd_, ToProtocolCode(ClientToServer::SEND, priority), message);
     }
     std::lock_guard<std::mutex> guard{send_mutex_};
     if (!waiting_for_reply_.has_value())
     {
         if (client_config_.truly_async)
         {
-            if (!TryQueueMessage(message, ReplyCallback{}))
+            if (!TryQueueMessage(message, ReplyCallback{}, priority))
             {
                 return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
             }
@@ -137,12 +153,12 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
         }
         else
         {
-            return engine_->SendProtocolMessage(client_fd_, score::cpp::to_underlying(ClientToServer::SEND), message);
+            return engine_->SendProtocolMessage(client_fd_, ToProtocolCode(ClientToServer::SEND, priority), message);
         }
     }
     else
     {
-        if (!TryQueueMessage(message, ReplyCallback{}))
+        if (!TryQueueMessage(message, ReplyCallback{}, priority))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -153,6 +169,14 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
 score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ClientConnection::SendWaitReply(
     score::cpp::span<const std::uint8_t> message,
     score::cpp::span<std::uint8_t> reply) noexcept
+{
+    return SendWaitReplyWithPriority(message, reply, Priority::kHigh);
+}
+
+score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error>
+ClientConnection::SendWaitReplyWithPriority(score::cpp::span<const std::uint8_t> message,
+                                            score::cpp::span<std::uint8_t> reply,
+                                            const Priority priority) noexcept
 {
     if (IsInCallback())
     {
@@ -201,7 +225,7 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Cli
         // unblocking the send_condition_ while holding send_mutex_. We don't access the referenced values after
         // the send_condition_ is unblocked and we don't leave the SendWaitReply function scope before it's unblocked.
         // coverity[autosar_cpp14_a5_1_4_violation]
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), priority))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -211,7 +235,7 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Cli
         waiting_for_reply_ = std::move(callback);
         lock.unlock();
         const auto expected =
-            engine_->SendProtocolMessage(client_fd_, score::cpp::to_underlying(ClientToServer::REQUEST), message);
+            engine_->SendProtocolMessage(client_fd_, ToProtocolCode(ClientToServer::REQUEST, priority), message);
         lock.lock();
         if (!expected.has_value())
         {
@@ -249,7 +273,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithCallback(
     std::lock_guard<std::mutex> guard(send_mutex_);
     if (waiting_for_reply_.has_value())
     {
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), Priority::kHigh))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -257,7 +281,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithCallback(
     }
     if (client_config_.truly_async)
     {
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), Priority::kHigh))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -276,6 +300,37 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithCallback(
     return {};
 }
 
+score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithHandle(
+    score::cpp::span<const std::uint8_t> message,
+    std::int32_t handle) noexcept
+{
+    if (message.size() > max_send_size_)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EMSGSIZE));
+    }
+    if (handle < 0)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EBADF));
+    }
+    if (state_ != State::kReady)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EINVAL));
+    }
+    if (!client_config_.fully_ordered && !client_config_.truly_async)
+    {
+        return engine_->SendProtocolMessageWithHandle(
+            client_fd_, score::cpp::to_underlying(ClientToServer::SEND_WITH_HANDLE), message, handle);
+    }
+    // The handle is not queued: we would need to keep it open beyond the lifetime guaranteed by the caller
+    std::lock_guard<std::mutex> guard{send_mutex_};
+    if (waiting_for_reply_.has_value())
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN));
+    }
+    return engine_->SendProtocolMessageWithHandle(
+        client_fd_, score::cpp::to_underlying(ClientToServer::SEND_WITH_HANDLE), message, handle);
+}
+
 IClientConnection::State ClientConnection::GetState() const noexcept
 {
     return state_;
@@ -299,7 +354,7 @@ void ClientConnection::Stop() noexcept
     if (TrySetStopReason(StopReason::kUserRequested))
     {
         ProcessStateChange(State::kStopping);
-        if (IsInCallback())
+        if (IsInOwnCallback())
         {
             SwitchToStopState();
         }
@@ -421,7 +476,7 @@ void ClientConnection::TryConnect() noexcept
     posix_endpoint_.disconnect = [this]() noexcept {
         SwitchToStopState();
     };
-    if (IsInCallback())
+    if (IsInOwnCallback())
     {
         engine_->RegisterPosixEndpoint(posix_endpoint_);
     }
@@ -529,7 +584,7 @@ void ClientConnection::ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& l
             // indefinite delay.
             lock.unlock();
             const auto expected = engine_->SendProtocolMessage(
-                client_fd_, score::cpp::to_underlying(ClientToServer::REQUEST), send.message);
+                client_fd_, ToProtocolCode(ClientToServer::REQUEST, send.priority), send.message);
             lock.lock();
             if (expected.has_value())
             {
@@ -551,8 +606,8 @@ void ClientConnection::ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& l
             waiting_for_reply_ = ReplyCallback{};
             lock.unlock();
             // nowhere to return the potential error
-            score::cpp::ignore =
-                engine_->SendProtocolMessage(client_fd_, score::cpp::to_underlying(ClientToServer::SEND), send.message);
+            score::cpp::ignore = engine_->SendProtocolMessage(
+                client_fd_, ToProtocolCode(ClientToServer::SEND, send.priority), send.message);
             lock.lock();
             waiting_for_reply_.reset();
         }
@@ -563,7 +618,7 @@ void ClientConnection::SwitchToStopState() noexcept
 {
     SCORE_LANGUAGE_FUTURECPP_ASSERT_DBG(state_ == State::kStopping);
     SCORE_LANGUAGE_FUTURECPP_ASSERT_DBG(stop_reason_ != StopReason::kNone);
-    SCORE_LANGUAGE_FUTURECPP_ASSERT_DBG(IsInCallback());
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_DBG(IsInOwnCallback());
     posix_endpoint_.disconnect = {};  // no need to trigger the cleanup once more
     engine_->CleanUpOwner(this);
     if (client_fd_ != -1)
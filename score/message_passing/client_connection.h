@@ -51,9 +51,20 @@ class ClientConnection final : public IClientConnection
         score::cpp::span<const std::uint8_t> message,
         score::cpp::span<std::uint8_t> reply) noexcept override;
 
+    score::cpp::expected_blank<score::os::Error> SendWithPriority(score::cpp::span<const std::uint8_t> message,
+                                                                  Priority priority) noexcept override;
+
+    score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> SendWaitReplyWithPriority(
+        score::cpp::span<const std::uint8_t> message,
+        score::cpp::span<std::uint8_t> reply,
+        Priority priority) noexcept override;
+
     score::cpp::expected_blank<score::os::Error> SendWithCallback(score::cpp::span<const std::uint8_t> message,
                                                                   ReplyCallback callback) noexcept override;
 
+    score::cpp::expected_blank<score::os::Error> SendWithHandle(score::cpp::span<const std::uint8_t> message,
+                                                                std::int32_t handle) noexcept override;
+
     State GetState() const noexcept override;
 
     StopReason GetStopReason() const noexcept override;
@@ -66,7 +77,9 @@ class ClientConnection final : public IClientConnection
 
   private:
     void TryConnect() noexcept;
-    bool TryQueueMessage(score::cpp::span<const std::uint8_t> message, ReplyCallback callback) noexcept;
+    bool TryQueueMessage(score::cpp::span<const std::uint8_t> message,
+                         ReplyCallback callback,
+                         Priority priority) noexcept;
     StopReason ProcessInputEvent() noexcept;
 
     // The lock shall be already taken.
@@ -85,6 +98,12 @@ class ClientConnection final : public IClientConnection
         return engine_->IsOnCallbackThread();
     }
 
+    // unlike IsInCallback(), only true on the thread serializing the callbacks of this connection
+    bool IsInOwnCallback() const noexcept
+    {
+        return engine_->IsOnOwnerCallbackThread(this);
+    }
+
     void DoRestart() noexcept;
 
     const std::shared_ptr<ISharedResourceEngine> engine_;
@@ -124,12 +143,13 @@ class ClientConnection final : public IClientConnection
       public:
         using allocator_type = score::cpp::pmr::polymorphic_allocator<SendCommand>;
         explicit SendCommand(const allocator_type& allocator)
-            : score::containers::intrusive_list_element<>{}, message(allocator), callback{}
+            : score::containers::intrusive_list_element<>{}, message(allocator), callback{}, priority{Priority::kHigh}
         {
         }
 
         score::cpp::pmr::vector<std::uint8_t> message;
         ReplyCallback callback;
+        Priority priority;
     };
     score::cpp::pmr::vector<SendCommand> send_storage_;
     score::containers::intrusive_list<SendCommand> send_pool_;
@@ -25,9 +25,14 @@ namespace detail
 enum class ClientToServer : std::uint8_t
 {
     SEND,
-    REQUEST
+    REQUEST,
+    SEND_WITH_HANDLE
 };
 
+// The most significant bit of a ClientToServer code marks a low-priority message (see IClientConnection::Priority)
+constexpr std::uint8_t kLowPriorityFlag{0x80U};
+constexpr std::uint8_t kClientToServerCodeMask{0x7FU};
+
 enum class ServerToClient : std::uint8_t
 {
     REPLY,
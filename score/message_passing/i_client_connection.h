@@ -63,6 +63,61 @@ class IClientConnection
         score::cpp::span<const std::uint8_t> message,
         score::cpp::span<std::uint8_t> reply) noexcept = 0;
 
+    /// \brief Priority class of a message sent to the server
+    /// \details Servers supporting priority lanes dispatch the pending high-priority messages before the low-priority
+    ///          ones, while still guaranteeing the progress of the low-priority messages. The messages of the same
+    ///          priority sent over the same connection keep their order; a high-priority message may overtake the
+    ///          low-priority messages sent earlier over the same connection.
+    enum class Priority : std::uint8_t
+    {
+        kHigh,  ///< Data-path messages; the default for the methods without an explicit priority
+        kLow    ///< Control messages (e.g. registrations) that may be delayed in favour of high-priority ones
+    };
+
+    /// \brief Send a binary message with the given priority to the respective server, don't expect a reply
+    /// \details Same as Send(), but allows the server to delay the dispatch of a low-priority message. The default
+    ///          implementation ignores the priority, which is what the transports without priority lanes do.
+    /// \param message The memory span containing the message to send
+    /// \param priority The priority class of the message
+    /// \return error if fails
+    virtual score::cpp::expected_blank<score::os::Error> SendWithPriority(score::cpp::span<const std::uint8_t> message,
+                                                                          Priority /*priority*/) noexcept
+    {
+        return Send(message);
+    }
+
+    /// \brief Send a binary message with the given priority to the respective server, wait for reply
+    /// \details Same as SendWaitReply(), but allows the server to delay the dispatch of a low-priority message. The
+    ///          default implementation ignores the priority.
+    /// \param message The memory span containing the message to send
+    /// \param reply The memory span designating the buffer for the reply message
+    /// \param priority The priority class of the message
+    /// \return the reply span trimmed to the actual size of the reply message if succeeds, error if fails
+    virtual score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> SendWaitReplyWithPriority(
+        score::cpp::span<const std::uint8_t> message,
+        score::cpp::span<std::uint8_t> reply,
+        Priority /*priority*/) noexcept
+    {
+        return SendWaitReply(message, reply);
+    }
+
+    /// \brief Send a binary message together with an OS handle to the respective server, don't expect a reply
+    /// \details The call is intended for one-off transfers of large payloads (such as a sealed memfd containing a bulk
+    ///          configuration or a diagnostic dump) that shall not be copied through the message passing channel.
+    ///          The handle is duplicated into the server process; the caller keeps the ownership of its own handle and
+    ///          may close it as soon as the call returns. The server takes the ownership of its copy of the handle
+    ///          via IServerConnection::ReceiveHandle() from inside its sent message callback.
+    ///          The message itself is subject to the same restrictions as the one sent with Send(). The call never
+    ///          uses the client-side asynchronous send queue; if the queue is currently in use, the call fails with
+    ///          EAGAIN.
+    ///          Handle passing is only supported by the Unix Domain Socket transport. With the QNX native messaging
+    ///          transport, the call always fails with ENOTSUP.
+    /// \param message The memory span containing the message to send
+    /// \param handle The OS handle (file descriptor) to pass to the server
+    /// \return error if fails
+    virtual score::cpp::expected_blank<score::os::Error> SendWithHandle(score::cpp::span<const std::uint8_t> message,
+                                                                        std::int32_t handle) noexcept = 0;
+
     /// \brief The type for the callback to be called when a reply (or an error) from the server is received
     /// \details The callback is called on an unspecified thread.
     ///          It is allowed to call asynchronous send methods from inside the callback.
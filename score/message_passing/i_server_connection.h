@@ -39,6 +39,15 @@ class IServerConnection
         score::cpp::span<const std::uint8_t> message) noexcept = 0;
     virtual void RequestDisconnect() noexcept = 0;
 
+    /// \brief Take the ownership of the OS handle that arrived together with the message being processed
+    /// \details Only valid from inside the sent message callback for a message sent with
+    ///          IClientConnection::SendWithHandle(). The caller becomes responsible for closing the returned handle.
+    ///          If the handle is not taken during the callback, it is closed by the server after the callback returns.
+    ///          Handle passing is only supported by the Unix Domain Socket transport. With the QNX native messaging
+    ///          transport, the call always fails with ENOTSUP.
+    /// \return the received handle if succeeds, error if no handle is available or handle passing is not supported
+    virtual score::cpp::expected<std::int32_t, score::os::Error> ReceiveHandle() noexcept = 0;
+
   protected:
     ~IServerConnection() noexcept = default;
 
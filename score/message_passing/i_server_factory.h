@@ -37,6 +37,9 @@ class IServerFactory
                                               ///< but bad for monotonic memory allocation)
         std::uint32_t max_queued_notifies;    ///< Maximum number of Notify messages per connection queued on server
                                               ///< side. 0 if there is no Notify messages, otherwise at least 1
+        std::uint32_t max_queued_low_priority_sends;  ///< Maximum number of low-priority Send messages by clients
+                                                      ///< deferred on server side. 0 if there is no low-priority lane
+                                                      ///< (low-priority messages are dispatched right away)
     };
 
     virtual score::cpp::pmr::unique_ptr<IServer> Create(const ServiceProtocolConfig& protocol_config,
@@ -39,6 +39,14 @@ class ISharedResourceEngine
 
     virtual bool IsOnCallbackThread() const noexcept = 0;
 
+    /// \brief Checks if the current thread is the one serializing the callbacks of the given owner
+    /// \details Engines running more than one callback thread need to override this method; by default, all the
+    ///          owners share the same callback thread.
+    virtual bool IsOnOwnerCallbackThread(const void* const /*owner*/) const noexcept
+    {
+        return IsOnCallbackThread();
+    }
+
     virtual score::cpp::expected<std::int32_t, score::os::Error> TryOpenClientConnection(
         std::string_view identifier) noexcept = 0;
 
@@ -51,6 +59,12 @@ class ISharedResourceEngine
     virtual score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ReceiveProtocolMessage(
         const std::int32_t fd,
         std::uint8_t& code) noexcept = 0;
+    /// Only supported by the Unix Domain Socket engine; other engines fail with ENOTSUP.
+    virtual score::cpp::expected_blank<score::os::Error> SendProtocolMessageWithHandle(
+        const std::int32_t fd,
+        std::uint8_t code,
+        const score::cpp::span<const std::uint8_t> message,
+        const std::int32_t handle) noexcept = 0;
 
     using Clock = detail::TimedCommandQueueEntry::Clock;
     using TimePoint = detail::TimedCommandQueueEntry::TimePoint;
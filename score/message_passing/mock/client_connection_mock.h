@@ -37,6 +37,10 @@ class ClientConnectionMock : public IClientConnection
                 SendWithCallback,
                 (score::cpp::span<const std::uint8_t>, ReplyCallback),
                 (noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                SendWithHandle,
+                (score::cpp::span<const std::uint8_t>, std::int32_t),
+                (noexcept, override));
     MOCK_METHOD(State, GetState, (), (const, noexcept, override));
     MOCK_METHOD(StopReason, GetStopReason, (), (const, noexcept, override));
     MOCK_METHOD(void, Start, (StateCallback, NotifyCallback), (noexcept, override));
@@ -85,6 +89,12 @@ class ClientConnectionMockFacade : public IClientConnection
         return client_connection_mock_.SendWithCallback(message, std::move(callback));
     }
 
+    score::cpp::expected_blank<score::os::Error> SendWithHandle(score::cpp::span<const std::uint8_t> message,
+                                                                std::int32_t handle) noexcept override
+    {
+        return client_connection_mock_.SendWithHandle(message, handle);
+    }
+
     State GetState() const noexcept override
     {
         return client_connection_mock_.GetState();
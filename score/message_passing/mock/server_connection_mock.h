@@ -36,6 +36,7 @@ class ServerConnectionMock : public IServerConnection
                 (score::cpp::span<const std::uint8_t>),
                 (noexcept, override));
     MOCK_METHOD(void, RequestDisconnect, (), (noexcept, override));
+    MOCK_METHOD((score::cpp::expected<std::int32_t, score::os::Error>), ReceiveHandle, (), (noexcept, override));
 
     virtual ~ServerConnectionMock() = default;  // virtual to make compiler happy
 };
@@ -41,6 +41,13 @@ class SharedResourceEngineMock : public ISharedResourceEngine
                 ReceiveProtocolMessage,
                 (const std::int32_t fd, std::uint8_t& code),
                 (noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                SendProtocolMessageWithHandle,
+                (const std::int32_t fd,
+                 std::uint8_t code,
+                 const score::cpp::span<const std::uint8_t> message,
+                 const std::int32_t handle),
+                (noexcept, override));
     MOCK_METHOD(void,
                 EnqueueCommand,
                 (CommandQueueEntry & entry, const TimePoint until, CommandCallback callback, const void* const owner),
@@ -578,6 +578,17 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Qnx
     return score::cpp::span<const std::uint8_t>{&posix_receive_buffer_[1], span_size};
 }
 
+// coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
+score::cpp::expected_blank<score::os::Error> QnxDispatchEngine::SendProtocolMessageWithHandle(
+    const std::int32_t /*fd*/,
+    std::uint8_t /*code*/,
+    const score::cpp::span<const std::uint8_t> /*message*/,
+    const std::int32_t /*handle*/) noexcept
+{
+    // handle passing is a Unix Domain Socket only feature, see IClientConnection::SendWithHandle()
+    return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOTSUP));
+}
+
 void QnxDispatchEngine::SendPulseEvent(const PulseEvent pulse_event) noexcept
 {
     // NOLINTNEXTLINE(score-banned-function) implementing FFI wrapper
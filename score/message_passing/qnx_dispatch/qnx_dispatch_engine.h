@@ -236,6 +236,12 @@ class QnxDispatchEngine final : public ISharedResourceEngine
     score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ReceiveProtocolMessage(
         const std::int32_t fd,
         std::uint8_t& code) noexcept override;
+    // coverity[autosar_cpp14_m7_3_1_violation] false-positive: class method (Ticket-234468)
+    score::cpp::expected_blank<score::os::Error> SendProtocolMessageWithHandle(
+        const std::int32_t fd,
+        std::uint8_t code,
+        const score::cpp::span<const std::uint8_t> message,
+        const std::int32_t handle) noexcept override;
 
     static score::cpp::expected_blank<std::int32_t> AttachConnection(resmgr_context_t* const ctp,
                                                                      io_open_t* const msg,
@@ -141,6 +141,12 @@ void QnxDispatchServer::ServerConnection::RequestDisconnect() noexcept
     // TODO: implement as ionotify for zero-read (once this functionality is demanded)
 }
 
+score::cpp::expected<std::int32_t, score::os::Error> QnxDispatchServer::ServerConnection::ReceiveHandle() noexcept
+{
+    // handle passing is a Unix Domain Socket only feature, see IServerConnection::ReceiveHandle()
+    return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOTSUP));
+}
+
 // Suppress AUTOSAR C++14 A15-5-3 violation for variant access in ProcessInput
 // Rationale: std::get<HandlerPointerT>(user_data) is preceded by std::holds_alternative check,
 // guaranteeing the variant contains the correct type. No std::bad_variant_access can be thrown.
@@ -154,7 +160,9 @@ bool QnxDispatchServer::ServerConnection::ProcessInput(const std::uint8_t code,
     using HandlerPointerT = score::cpp::pmr::unique_ptr<IConnectionHandler>;
     bool result = false;
 
-    switch (code)
+    // The resource manager already serves the clients according to their thread priorities, so the message priority
+    // flag is not used for dispatching here
+    switch (static_cast<std::uint8_t>(code & kClientToServerCodeMask))
     {
         case score::cpp::to_underlying(ClientToServer::REQUEST):
         {
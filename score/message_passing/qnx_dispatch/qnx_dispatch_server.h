@@ -49,6 +49,7 @@ class QnxDispatchServer final : public IServer, private QnxDispatchEngine::Resou
         score::cpp::expected_blank<score::os::Error> Notify(
             score::cpp::span<const std::uint8_t> message) noexcept override;
         void RequestDisconnect() noexcept override;
+        score::cpp::expected<std::int32_t, score::os::Error> ReceiveHandle() noexcept override;
 
         // ResourceManagerConnection methods
         bool ProcessInput(const std::uint8_t code,
@@ -14,23 +14,58 @@
 
 #include "score/message_passing/unix_domain/unix_domain_socket_address.h"
 
-#include <future>
+#include <algorithm>
+#include <functional>
+#include <utility>
 
 namespace score
 {
 namespace message_passing
 {
 
+namespace
+{
+
+/// Up to this many handles are received with a single message. Any of them besides the first one are closed, any
+/// further ones are discarded (i.e. closed) by the kernel.
+constexpr std::size_t kMaxReceivedHandleCount{4U};
+
+/// recvmsg() flags for a message, which may carry a handle. The received handle must not leak into exec'd children.
+::score::os::Socket::MessageFlag GetReceiveWithHandleFlags() noexcept
+{
+#if defined(MSG_CMSG_CLOEXEC)
+    // the MessageFlag values are the native flags; MSG_CMSG_CLOEXEC has no enumerator of its own
+    return static_cast<::score::os::Socket::MessageFlag>(
+        static_cast<std::int32_t>(::score::os::Socket::MessageFlag::kWaitAll) | MSG_CMSG_CLOEXEC);
+#else
+    return ::score::os::Socket::MessageFlag::kWaitAll;
+#endif
+}
+
+}  // namespace
+
 UnixDomainEngine::UnixDomainEngine(score::cpp::pmr::memory_resource* memory_resource, LoggingCallback logger) noexcept
+    : UnixDomainEngine{memory_resource, 1U, std::move(logger)}
+{
+}
+
+UnixDomainEngine::UnixDomainEngine(score::cpp::pmr::memory_resource* memory_resource,
+                                   const std::size_t thread_count,
+                                   LoggingCallback logger) noexcept
     : memory_resource_{memory_resource},
       os_resources_{GetDefaultOsResources(memory_resource)},
       logger_{std::move(logger)},
-      quit_flag_{false},
-      poll_fds_{memory_resource},
-      poll_endpoints_{memory_resource},
-      posix_receive_buffer_{memory_resource}
+      event_loops_{memory_resource},
+      assignment_count_{0U},
+      owner_assignments_{memory_resource}
 {
-    os_resources_.unistd->pipe(pipe_fds_.data());
+    const std::size_t loop_count = std::max(thread_count, std::size_t{1U});
+    event_loops_.reserve(loop_count);
+    for (std::size_t i = 0U; i < loop_count; ++i)
+    {
+        event_loops_.emplace_back(score::cpp::pmr::make_unique<EventLoop>(memory_resource, memory_resource));
+        os_resources_.unistd->pipe(event_loops_.back()->pipe_fds.data());
+    }
 
     // Normally, during the application lifecycle initialization, LifeCycleManager blocks the SIGTERM on the main
     // thread and creates a separate thread that catches all the SIGTERM signals coming to the process. The other
@@ -47,23 +82,101 @@ UnixDomainEngine::UnixDomainEngine(score::cpp::pmr::memory_resource* memory_reso
     score::cpp::ignore = os_resources_.signal->AddTerminationSignal(new_set);
     score::cpp::ignore = os_resources_.signal->PthreadSigMask(SIG_BLOCK, new_set, old_set);
     {
-        std::lock_guard acquire{thread_mutex_};  // postpone RunOnThread() till we assign thread_
-        thread_ = std::thread([this]() noexcept {
-            {
-                std::lock_guard release{thread_mutex_};  // guarantees that this->thread_ is already assigned
-            }
-            RunOnThread();
-        });
+        std::lock_guard acquire{thread_mutex_};  // postpone RunOnThread() till we assign all the threads
+        for (auto& loop : event_loops_)
+        {
+            EventLoop& loop_ref = *loop;
+            loop_ref.thread = std::thread([this, &loop_ref]() noexcept {
+                {
+                    std::lock_guard release{thread_mutex_};  // guarantees that all the threads are already assigned
+                }
+                RunOnThread(loop_ref);
+            });
+        }
     }
     score::cpp::ignore = os_resources_.signal->PthreadSigMask(SIG_SETMASK, old_set);
 }
 
 UnixDomainEngine::~UnixDomainEngine() noexcept
 {
-    SendPipeEvent(PipeEvent::QUIT);
-    thread_.join();
-    os_resources_.unistd->close(pipe_fds_[0]);
-    os_resources_.unistd->close(pipe_fds_[1]);
+    for (auto& loop : event_loops_)
+    {
+        SendPipeEvent(*loop, PipeEvent::QUIT);
+    }
+    for (auto& loop : event_loops_)
+    {
+        loop->thread.join();
+        os_resources_.unistd->close(loop->pipe_fds[0]);
+        os_resources_.unistd->close(loop->pipe_fds[1]);
+    }
+}
+
+void UnixDomainEngine::AssignOwnerToThread(const void* const owner, const std::size_t thread_index) noexcept
+{
+    std::lock_guard<std::mutex> guard{assignment_mutex_};
+    const auto found = std::find_if(owner_assignments_.begin(), owner_assignments_.end(), [owner](const auto& entry) {
+        return entry.first == owner;
+    });
+    if (found != owner_assignments_.end())
+    {
+        found->second = thread_index % event_loops_.size();
+        return;
+    }
+    owner_assignments_.emplace_back(owner, thread_index % event_loops_.size());
+    assignment_count_ = owner_assignments_.size();
+}
+
+void UnixDomainEngine::ReleaseOwnerAssignment(const void* const owner) noexcept
+{
+    std::lock_guard<std::mutex> guard{assignment_mutex_};
+    const auto found = std::find_if(owner_assignments_.begin(), owner_assignments_.end(), [owner](const auto& entry) {
+        return entry.first == owner;
+    });
+    if (found != owner_assignments_.end())
+    {
+        *found = owner_assignments_.back();
+        owner_assignments_.pop_back();
+        assignment_count_ = owner_assignments_.size();
+    }
+}
+
+UnixDomainEngine::EventLoop& UnixDomainEngine::GetEventLoop(const void* const owner) const noexcept
+{
+    if (event_loops_.size() == 1U)
+    {
+        return *event_loops_.front();
+    }
+    if (assignment_count_ != 0U)
+    {
+        std::lock_guard<std::mutex> guard{assignment_mutex_};
+        const auto found =
+            std::find_if(owner_assignments_.cbegin(), owner_assignments_.cend(), [owner](const auto& entry) {
+                return entry.first == owner;
+            });
+        if (found != owner_assignments_.cend())
+        {
+            return *event_loops_[found->second];
+        }
+    }
+    // pointer hashes are typically identity functions; mix the bits to spread the aligned addresses between loops
+    std::uint64_t key = static_cast<std::uint64_t>(std::hash<const void*>{}(owner));
+    key ^= key >> 33U;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33U;
+    return *event_loops_[static_cast<std::size_t>(key % static_cast<std::uint64_t>(event_loops_.size()))];
+}
+
+UnixDomainEngine::EventLoop* UnixDomainEngine::FindCurrentEventLoop() const noexcept
+{
+    const auto this_thread_id = std::this_thread::get_id();
+    for (const auto& loop : event_loops_)
+    {
+        if (loop->thread.get_id() == this_thread_id)
+        {
+            return loop.get();
+        }
+    }
+    return nullptr;
 }
 
 score::cpp::expected<std::int32_t, score::os::Error> UnixDomainEngine::TryOpenClientConnection(
@@ -94,11 +207,21 @@ void UnixDomainEngine::CloseClientConnection(std::int32_t client_fd) noexcept
 
 void UnixDomainEngine::RegisterPosixEndpoint(PosixEndpointEntry& endpoint) noexcept
 {
-    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(IsOnCallbackThread());
+    RegisterPosixEndpoint(GetEventLoop(endpoint.owner), endpoint);
+}
+
+void UnixDomainEngine::UnregisterPosixEndpoint(PosixEndpointEntry& endpoint) noexcept
+{
+    UnregisterPosixEndpoint(GetEventLoop(endpoint.owner), endpoint);
+}
 
-    if (posix_receive_buffer_.size() < endpoint.max_receive_size)
+void UnixDomainEngine::RegisterPosixEndpoint(EventLoop& loop, PosixEndpointEntry& endpoint) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(std::this_thread::get_id() == loop.thread.get_id());
+
+    if (loop.posix_receive_buffer.size() < endpoint.max_receive_size)
     {
-        posix_receive_buffer_.resize(endpoint.max_receive_size);
+        loop.posix_receive_buffer.resize(endpoint.max_receive_size);
     }
 
     std::int16_t events = 0;
@@ -111,42 +234,42 @@ void UnixDomainEngine::RegisterPosixEndpoint(PosixEndpointEntry& endpoint) noexc
         // TODO: not used/not supported yet
         events |= POLLOUT;
     }
-    const auto found = std::find_if(poll_fds_.begin(), poll_fds_.end(), [](pollfd& poll) noexcept {
+    const auto found = std::find_if(loop.poll_fds.begin(), loop.poll_fds.end(), [](pollfd& poll) noexcept {
         return poll.fd < 0;
     });
-    if (found != poll_fds_.end())
+    if (found != loop.poll_fds.end())
     {
         *found = {endpoint.fd, events, 0};
-        std::size_t i = static_cast<std::size_t>(std::distance(poll_fds_.begin(), found));
-        poll_endpoints_[i] = &endpoint;
+        std::size_t i = static_cast<std::size_t>(std::distance(loop.poll_fds.begin(), found));
+        loop.poll_endpoints[i] = &endpoint;
     }
     else
     {
-        poll_fds_.emplace_back(pollfd{endpoint.fd, events, 0});
-        poll_endpoints_.emplace_back(&endpoint);
+        loop.poll_fds.emplace_back(pollfd{endpoint.fd, events, 0});
+        loop.poll_endpoints.emplace_back(&endpoint);
     }
-    posix_endpoint_list_.push_back(endpoint);
+    loop.posix_endpoint_list.push_back(endpoint);
 }
 
-void UnixDomainEngine::UnregisterPosixEndpoint(PosixEndpointEntry& endpoint) noexcept
+void UnixDomainEngine::UnregisterPosixEndpoint(EventLoop& loop, PosixEndpointEntry& endpoint) noexcept
 {
-    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(IsOnCallbackThread());
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(std::this_thread::get_id() == loop.thread.get_id());
 
-    const auto found = std::find(poll_endpoints_.begin(), poll_endpoints_.end(), &endpoint);
-    if (found != poll_endpoints_.end())
+    const auto found = std::find(loop.poll_endpoints.begin(), loop.poll_endpoints.end(), &endpoint);
+    if (found != loop.poll_endpoints.end())
     {
-        std::size_t i = static_cast<std::size_t>(std::distance(poll_endpoints_.begin(), found));
-        UnpollEndpoint(i);
+        std::size_t i = static_cast<std::size_t>(std::distance(loop.poll_endpoints.begin(), found));
+        UnpollEndpoint(loop, i);
     }
 }
 
-void UnixDomainEngine::UnpollEndpoint(const std::size_t index) noexcept
+void UnixDomainEngine::UnpollEndpoint(EventLoop& loop, const std::size_t index) noexcept
 {
-    PosixEndpointEntry& endpoint = *poll_endpoints_[index];
-    posix_endpoint_list_.erase(posix_endpoint_list_.iterator_to(endpoint));
-    poll_endpoints_[index] = nullptr;
-    poll_fds_[index].fd = -1;
-    poll_fds_[index].revents = 0;
+    PosixEndpointEntry& endpoint = *loop.poll_endpoints[index];
+    loop.posix_endpoint_list.erase(loop.posix_endpoint_list.iterator_to(endpoint));
+    loop.poll_endpoints[index] = nullptr;
+    loop.poll_fds[index].fd = -1;
+    loop.poll_fds[index].revents = 0;
     if (!endpoint.disconnect.empty())
     {
         endpoint.disconnect();
@@ -158,8 +281,13 @@ void UnixDomainEngine::EnqueueCommand(CommandQueueEntry& entry,
                                       CommandCallback callback,
                                       const void* const owner) noexcept
 {
-    timer_queue_.RegisterTimedEntry(entry, until, std::move(callback), owner);
-    SendPipeEvent(PipeEvent::TIMER);
+    EventLoop& loop = GetEventLoop(owner);
+    loop.timer_queue.RegisterTimedEntry(entry, until, std::move(callback), owner);
+    if (std::this_thread::get_id() != loop.thread.get_id())
+    {
+        // on the loop's own thread, the poll timeout is recalculated anyway before the next poll() call
+        SendPipeEvent(loop, PipeEvent::TIMER);
+    }
 }
 
 void UnixDomainEngine::CleanUpOwner(const void* const owner) noexcept
@@ -168,23 +296,43 @@ void UnixDomainEngine::CleanUpOwner(const void* const owner) noexcept
     {
         return;
     }
-    if (IsOnCallbackThread())
+    EventLoop& loop = GetEventLoop(owner);
+    if (std::this_thread::get_id() == loop.thread.get_id())
     {
-        ProcessCleanup(owner);
+        ProcessCleanup(loop, owner);
     }
     else
     {
-        std::promise<void> done;  // TODO: maybe switch to NonAllocatingFuture
-        detail::TimedCommandQueue::Entry cleanup_command;
-        timer_queue_.RegisterImmediateEntry(
-            cleanup_command,
-            [this, owner, &done](auto) noexcept {
-                ProcessCleanup(owner);
-                done.set_value();
-            },
-            owner);
-        SendPipeEvent(PipeEvent::TIMER);
-        done.get_future().wait();
+        // The owner may be destroyed right after this call, so we have to wait until its thread has done the clean-up.
+        // If we are running on another background thread of the engine, the owner's thread may in turn be waiting
+        // for a clean-up on our thread (e.g. two connections on different threads closing each other from their
+        // callbacks). To avoid such a deadlock, a waiting background thread keeps processing the clean-up requests
+        // queued for its own loop, as it would do for a clean-up of one of its own owners.
+        EventLoop* const current_loop = FindCurrentEventLoop();
+        CleanupRequest request{owner, false, nullptr};
+        {
+            std::lock_guard<std::mutex> guard{cleanup_mutex_};
+            request.next = loop.pending_cleanups.load();
+            loop.pending_cleanups = &request;
+        }
+        // wakes up the owner's thread both in poll() and while it waits for a clean-up itself
+        cleanup_condition_.notify_all();
+        SendPipeEvent(loop, PipeEvent::TIMER);
+
+        std::unique_lock<std::mutex> lock{cleanup_mutex_};
+        while (!request.done)
+        {
+            if ((current_loop != nullptr) && (current_loop->pending_cleanups.load() != nullptr))
+            {
+                lock.unlock();
+                ProcessPendingCleanups(*current_loop);
+                lock.lock();
+            }
+            else
+            {
+                cleanup_condition_.wait(lock);
+            }
+        }
     }
 }
 
@@ -192,6 +340,28 @@ score::cpp::expected_blank<score::os::Error> UnixDomainEngine::SendProtocolMessa
     const std::int32_t fd,
     std::uint8_t code,
     const score::cpp::span<const std::uint8_t> message) noexcept
+{
+    return SendProtocolMessageImpl(fd, code, message, -1);
+}
+
+score::cpp::expected_blank<score::os::Error> UnixDomainEngine::SendProtocolMessageWithHandle(
+    const std::int32_t fd,
+    std::uint8_t code,
+    const score::cpp::span<const std::uint8_t> message,
+    const std::int32_t handle) noexcept
+{
+    if (handle < 0)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EBADF));
+    }
+    return SendProtocolMessageImpl(fd, code, message, handle);
+}
+
+score::cpp::expected_blank<score::os::Error> UnixDomainEngine::SendProtocolMessageImpl(
+    const std::int32_t fd,
+    std::uint8_t code,
+    const score::cpp::span<const std::uint8_t> message,
+    const std::int32_t handle) noexcept
 {
     struct msghdr msg;
     std::memset(static_cast<void*>(&msg), 0, sizeof(msg));
@@ -207,6 +377,20 @@ score::cpp::expected_blank<score::os::Error> UnixDomainEngine::SendProtocolMessa
     msg.msg_iov = io.data();
     msg.msg_iovlen = kVectorCount;
 
+    // the handle travels as ancillary data attached to the first byte of the message
+    alignas(cmsghdr) std::array<std::uint8_t, CMSG_SPACE(sizeof(std::int32_t))> control{};
+    if (handle >= 0)
+    {
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+        cmsghdr* const cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(std::int32_t));
+        // NOLINTNEXTLINE(score-banned-function) copying handle into ancillary data
+        score::cpp::ignore = std::memcpy(CMSG_DATA(cmsg), &handle, sizeof(handle));
+    }
+
     const auto result_expected = os_resources_.socket->sendmsg(fd, &msg, ::score::os::Socket::MessageFlag::kWaitAll);
     if (result_expected.has_value())
     {
@@ -218,6 +402,22 @@ score::cpp::expected_blank<score::os::Error> UnixDomainEngine::SendProtocolMessa
 score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> UnixDomainEngine::ReceiveProtocolMessage(
     const std::int32_t fd,
     std::uint8_t& code) noexcept
+{
+    return ReceiveProtocolMessageImpl(fd, code, nullptr);
+}
+
+score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> UnixDomainEngine::ReceiveProtocolMessage(
+    const std::int32_t fd,
+    std::uint8_t& code,
+    std::int32_t& handle) noexcept
+{
+    return ReceiveProtocolMessageImpl(fd, code, &handle);
+}
+
+score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error>
+UnixDomainEngine::ReceiveProtocolMessageImpl(const std::int32_t fd,
+                                             std::uint8_t& code,
+                                             std::int32_t* const handle) noexcept
 {
     struct msghdr msg;
     std::memset(static_cast<void*>(&msg), 0, sizeof(msg));
@@ -231,11 +431,28 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Uni
     msg.msg_iov = io.data();
     msg.msg_iovlen = kVectorCount;
 
-    auto size_expected = os_resources_.socket->recvmsg(fd, &msg, ::score::os::Socket::MessageFlag::kWaitAll);
+    // Without the control buffer, the kernel discards (closes) any handles attached to the message
+    alignas(cmsghdr) std::array<std::uint8_t, CMSG_SPACE(sizeof(std::int32_t) * kMaxReceivedHandleCount)> control{};
+    if (handle != nullptr)
+    {
+        *handle = -1;
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+    }
+
+    auto size_expected = os_resources_.socket->recvmsg(
+        fd, &msg, (handle != nullptr) ? GetReceiveWithHandleFlags() : ::score::os::Socket::MessageFlag::kWaitAll);
     if (!size_expected.has_value())
     {
         return score::cpp::make_unexpected(size_expected.error());
     }
+    if (handle != nullptr)
+    {
+        *handle = TakeFirstReceivedHandle(msg);
+        // the payload doesn't carry any handles; if a misbehaving peer attaches some, the kernel discards them
+        msg.msg_control = nullptr;
+        msg.msg_controllen = 0U;
+    }
     if (size_expected.value() == 0)
     {
         // other side disconnected
@@ -245,12 +462,16 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Uni
     {
         return {};
     }
-    if (size > static_cast<std::uint16_t>(posix_receive_buffer_.size()))
+    // the messages are only received from the input callbacks, i.e. on one of our background threads
+    EventLoop* const loop = FindCurrentEventLoop();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(loop != nullptr);
+    auto& posix_receive_buffer = loop->posix_receive_buffer;
+    if (size > static_cast<std::uint16_t>(posix_receive_buffer.size()))
     {
         return score::cpp::make_unexpected(score::os::Error::createFromErrno(EMSGSIZE));
     }
 
-    io[0].iov_base = posix_receive_buffer_.data();
+    io[0].iov_base = posix_receive_buffer.data();
     io[0].iov_len = static_cast<std::size_t>(size);
     msg.msg_iovlen = 1UL;
 
@@ -263,84 +484,171 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Uni
     {
         return score::cpp::make_unexpected(score::os::Error::createFromErrno(EIO));
     }
-    return score::cpp::span<const std::uint8_t>{posix_receive_buffer_.data(), size};
+    return score::cpp::span<const std::uint8_t>{posix_receive_buffer.data(), size};
 }
 
-void UnixDomainEngine::SendPipeEvent(PipeEvent pipe_event) noexcept
+std::int32_t UnixDomainEngine::TakeFirstReceivedHandle(msghdr& msg) noexcept
 {
-    os_resources_.unistd->write(pipe_fds_[1], &pipe_event, sizeof(pipe_event));
+    // exactly one handle is accepted per message; any others are closed so that a peer can't exhaust our fd table
+    std::int32_t first_handle{-1};
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if ((cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS))
+        {
+            continue;
+        }
+        const std::size_t handle_count{(cmsg->cmsg_len - CMSG_LEN(0U)) / sizeof(std::int32_t)};
+        for (std::size_t i = 0U; i < handle_count; ++i)
+        {
+            std::int32_t received_handle{-1};
+            // NOLINTNEXTLINE(score-banned-function) copying handle from ancillary data
+            score::cpp::ignore = std::memcpy(
+                &received_handle, CMSG_DATA(cmsg) + (i * sizeof(std::int32_t)), sizeof(std::int32_t));
+            if (first_handle < 0)
+            {
+                first_handle = received_handle;
+            }
+            else
+            {
+                os_resources_.unistd->close(received_handle);
+            }
+        }
+    }
+    return first_handle;
 }
 
-void UnixDomainEngine::ProcessPipeEvent() noexcept
+void UnixDomainEngine::SendPipeEvent(EventLoop& loop, PipeEvent pipe_event) noexcept
 {
-    PipeEvent pipe_event;
-    os_resources_.unistd->read(pipe_fds_[0], &pipe_event, sizeof(pipe_event));
-    if (pipe_event == PipeEvent::TIMER)
+    // A TIMER event only needs to wake up the loop once: all the commands queued before the loop has consumed the
+    // pending event will be processed by the same loop iteration, so we skip the write syscall for them
+    if ((pipe_event == PipeEvent::TIMER) && loop.wakeup_pending.exchange(true))
     {
-        // Intentionally empty. Just wake up to recalculate poll timeout.
+        return;
     }
-    else
+    os_resources_.unistd->write(loop.pipe_fds[1], &pipe_event, sizeof(pipe_event));
+}
+
+void UnixDomainEngine::ProcessPipeEvent(EventLoop& loop) noexcept
+{
+    // drain all the accumulated events with a single syscall
+    constexpr std::size_t kMaxPipeEvents = 16U;
+    std::array<PipeEvent, kMaxPipeEvents> pipe_events{};
+    const auto size_expected =
+        os_resources_.unistd->read(loop.pipe_fds[0], pipe_events.data(), sizeof(PipeEvent) * pipe_events.size());
+
+    // shall be reset after draining the pipe, but before we process the timer queue, see SendPipeEvent(). If it was
+    // reset before, the read above could consume the event of a concurrent sender while the flag stays set, and no
+    // sender would wake up the loop anymore
+    loop.wakeup_pending = false;
+    if (!size_expected.has_value())
+    {
+        return;
+    }
+    const auto event_count = static_cast<std::size_t>(size_expected.value()) / sizeof(PipeEvent);
+    for (std::size_t i = 0U; i < event_count; ++i)
     {
-        quit_flag_ = true;
+        if (pipe_events[i] == PipeEvent::TIMER)
+        {
+            // Intentionally empty. Just wake up to recalculate poll timeout.
+        }
+        else
+        {
+            loop.quit_flag = true;
+        }
     }
 }
 
-void UnixDomainEngine::ProcessCleanup(const void* const owner) noexcept
+void UnixDomainEngine::ProcessCleanup(EventLoop& loop, const void* const owner) noexcept
 {
-    for (std::size_t i = 0; i < poll_fds_.size(); ++i)
+    for (std::size_t i = 0; i < loop.poll_fds.size(); ++i)
     {
-        if (poll_fds_[i].fd == -1)
+        if (loop.poll_fds[i].fd == -1)
         {
             continue;
         }
-        if (poll_endpoints_[i]->owner == owner)
+        if (loop.poll_endpoints[i]->owner == owner)
         {
-            UnpollEndpoint(i);
+            UnpollEndpoint(loop, i);
         }
     }
-    timer_queue_.CleanUpOwner(owner);
+    loop.timer_queue.CleanUpOwner(owner);
 }
 
-void UnixDomainEngine::RunOnThread() noexcept
+void UnixDomainEngine::ProcessPendingCleanups(EventLoop& loop) noexcept
 {
-    command_endpoint_.owner = this;
-    command_endpoint_.fd = pipe_fds_[0];
-    command_endpoint_.input = [this]() noexcept {
-        ProcessPipeEvent();
+    if (loop.pending_cleanups.load() == nullptr)
+    {
+        return;
+    }
+    CleanupRequest* requests{nullptr};
+    {
+        std::lock_guard<std::mutex> guard{cleanup_mutex_};
+        requests = loop.pending_cleanups.exchange(nullptr);
+    }
+    for (CleanupRequest* request = requests; request != nullptr; request = request->next)
+    {
+        ProcessCleanup(loop, request->owner);
+    }
+    {
+        std::lock_guard<std::mutex> guard{cleanup_mutex_};
+        while (requests != nullptr)
+        {
+            // the request lives on the stack of its waiter, which may return as soon as it sees it done
+            CleanupRequest* const next = requests->next;
+            requests->done = true;
+            requests = next;
+        }
+    }
+    cleanup_condition_.notify_all();
+}
+
+void UnixDomainEngine::RunOnThread(EventLoop& loop) noexcept
+{
+    loop.command_endpoint.owner = this;
+    loop.command_endpoint.fd = loop.pipe_fds[0];
+    loop.command_endpoint.input = [this, &loop]() noexcept {
+        ProcessPipeEvent(loop);
     };
-    command_endpoint_.output = {};
-    command_endpoint_.disconnect = {};
-    RegisterPosixEndpoint(command_endpoint_);
+    loop.command_endpoint.output = {};
+    loop.command_endpoint.disconnect = {};
+    RegisterPosixEndpoint(loop, loop.command_endpoint);
 
-    while (!quit_flag_)
+    while (!loop.quit_flag)
     {
-        std::int32_t timeout = ProcessTimerQueue();
-        const auto num_expected = os_resources_.poll->poll(poll_fds_.data(), poll_fds_.size(), timeout);
+        ProcessPendingCleanups(loop);
+        std::int32_t timeout = ProcessTimerQueue(loop);
+        const auto num_expected = os_resources_.poll->poll(loop.poll_fds.data(), loop.poll_fds.size(), timeout);
         if (num_expected.has_value() && num_expected.value() > 0)
         {
-            for (std::size_t i = 0; i < poll_fds_.size(); ++i)
+            for (std::size_t i = 0; i < loop.poll_fds.size(); ++i)
             {
-                if (poll_fds_[i].revents != 0)
+                if (loop.poll_fds[i].revents != 0)
                 {
-                    PosixEndpointEntry& endpoint = *poll_endpoints_[i];
+                    PosixEndpointEntry& endpoint = *loop.poll_endpoints[i];
                     endpoint.input();
                 }
             }
         }
     }
 
-    UnregisterPosixEndpoint(command_endpoint_);
+    UnregisterPosixEndpoint(loop, loop.command_endpoint);
 }
 
-std::int32_t UnixDomainEngine::ProcessTimerQueue() noexcept
+std::int32_t UnixDomainEngine::ProcessTimerQueue(EventLoop& loop) noexcept
 {
     const auto now = Clock::now();
-    const auto then = timer_queue_.ProcessQueue(now);
+    const auto then = loop.timer_queue.ProcessQueue(now);
     if (then == TimePoint{})
     {
         return -1;
     }
-    const auto distance = std::chrono::duration_cast<std::chrono::milliseconds>(then - Clock::now()).count() + 1;
+    const auto remaining = then - Clock::now();
+    if (remaining <= Clock::duration::zero())
+    {
+        // already due (e.g. a command deferred until after the pending input); only check the input, don't wait
+        return 0;
+    }
+    const auto distance = std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count() + 1;
     if (distance > INT32_MAX)
     {
         return INT32_MAX;
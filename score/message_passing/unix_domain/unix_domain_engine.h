@@ -25,9 +25,12 @@
 #include "score/os/unistd.h"
 #include "score/os/utils/signal_impl.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <string_view>
 #include <thread>
+#include <utility>
 
 #include <poll.h>
 
@@ -44,6 +47,11 @@ namespace message_passing
 ///          server objects, client and server connections).
 ///          One or more instances of this class, with separate background threads and potentially separate memory
 ///          resources, can co-exist in the same process, if needed.
+///          An instance can also run several background threads, each with its own poll loop and timer queue. The
+///          owners (client connections, servers together with all their server connections) are distributed between
+///          the threads by the hash of the owner address or explicitly by AssignOwnerToThread(). All the callbacks of
+///          the same owner are serialized on its thread, so the per-connection ordering guarantees are the same as for
+///          a single-threaded engine.
 class UnixDomainEngine final : public ISharedResourceEngine
 {
   public:
@@ -57,6 +65,9 @@ class UnixDomainEngine final : public ISharedResourceEngine
 
     UnixDomainEngine(score::cpp::pmr::memory_resource* memory_resource,
                      LoggingCallback logger = GetCerrLogger()) noexcept;
+    UnixDomainEngine(score::cpp::pmr::memory_resource* memory_resource,
+                     const std::size_t thread_count,
+                     LoggingCallback logger = GetCerrLogger()) noexcept;
     ~UnixDomainEngine() noexcept override;
 
     UnixDomainEngine(const UnixDomainEngine&) = delete;
@@ -98,7 +109,7 @@ class UnixDomainEngine final : public ISharedResourceEngine
                         CommandCallback callback,
                         const void* const owner = nullptr) noexcept override;
 
-    // this call is blocking
+    // this call is blocking; see the implementation for the calls from another background thread of the engine
     void CleanUpOwner(const void* const owner) noexcept override;
 
     score::cpp::expected_blank<score::os::Error> SendProtocolMessage(
@@ -108,12 +119,40 @@ class UnixDomainEngine final : public ISharedResourceEngine
     score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ReceiveProtocolMessage(
         const std::int32_t fd,
         std::uint8_t& code) noexcept override;
+    score::cpp::expected_blank<score::os::Error> SendProtocolMessageWithHandle(
+        const std::int32_t fd,
+        std::uint8_t code,
+        const score::cpp::span<const std::uint8_t> message,
+        const std::int32_t handle) noexcept override;
+
+    /// \brief Receives a protocol message together with an optional SCM_RIGHTS handle attached to it
+    /// \details If no handle is attached, handle is set to -1. Otherwise, the caller owns the received handle.
+    score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ReceiveProtocolMessage(
+        const std::int32_t fd,
+        std::uint8_t& code,
+        std::int32_t& handle) noexcept;
 
     bool IsOnCallbackThread() const noexcept override
     {
-        return std::this_thread::get_id() == thread_.get_id();
+        return FindCurrentEventLoop() != nullptr;
     }
 
+    bool IsOnOwnerCallbackThread(const void* const owner) const noexcept override
+    {
+        return std::this_thread::get_id() == GetEventLoop(owner).thread.get_id();
+    }
+
+    std::size_t GetThreadCount() const noexcept
+    {
+        return event_loops_.size();
+    }
+
+    /// \brief Explicitly binds all the activities of the owner to the background thread with the given index
+    /// \details Shall be called before the first use of the owner with the engine, and the binding shall be released
+    ///          by ReleaseOwnerAssignment() after the last use. The index is taken modulo the number of threads.
+    void AssignOwnerToThread(const void* const owner, const std::size_t thread_index) noexcept;
+    void ReleaseOwnerAssignment(const void* const owner) noexcept;
+
   private:
     enum class PipeEvent : uint8_t
     {
@@ -127,29 +166,89 @@ class UnixDomainEngine final : public ISharedResourceEngine
         const void* owner;
     };
 
-    void UnpollEndpoint(const std::size_t index) noexcept;
-    void SendPipeEvent(PipeEvent pipe_event) noexcept;
-    void ProcessPipeEvent() noexcept;
-    void ProcessCleanup(const void* const owner) noexcept;
-    void RunOnThread() noexcept;
-    std::int32_t ProcessTimerQueue() noexcept;
+    // a clean-up of an owner, requested by another thread, which waits for its completion in CleanUpOwner()
+    struct CleanupRequest
+    {
+        const void* owner;
+        bool done;  // guarded by cleanup_mutex_
+        CleanupRequest* next;
+    };
+
+    // the state of a single background thread with its own poll loop
+    struct EventLoop
+    {
+        explicit EventLoop(score::cpp::pmr::memory_resource* const memory_resource) noexcept
+            : pipe_fds{-1, -1},
+              quit_flag{false},
+              wakeup_pending{false},
+              thread{},
+              command_endpoint{},
+              poll_fds{memory_resource},
+              poll_endpoints{memory_resource},
+              timer_queue{},
+              posix_endpoint_list{},
+              posix_receive_buffer{memory_resource},
+              pending_cleanups{nullptr}
+        {
+        }
+
+        std::array<std::int32_t, 2> pipe_fds;
+        bool quit_flag;
+        std::atomic<bool> wakeup_pending;
+        std::thread thread;
+        ISharedResourceEngine::PosixEndpointEntry command_endpoint;
+
+        score::cpp::pmr::vector<pollfd> poll_fds;
+        score::cpp::pmr::vector<PosixEndpointEntry*> poll_endpoints;
+
+        detail::TimedCommandQueue timer_queue;
+        score::containers::intrusive_list<PosixEndpointEntry> posix_endpoint_list;
+        score::cpp::pmr::vector<std::uint8_t> posix_receive_buffer;
+
+        // stack of the clean-up requests for this loop; only modified under cleanup_mutex_, but checked without it
+        std::atomic<CleanupRequest*> pending_cleanups;
+    };
+
+    EventLoop& GetEventLoop(const void* const owner) const noexcept;
+    EventLoop* FindCurrentEventLoop() const noexcept;
+
+    score::cpp::expected_blank<score::os::Error> SendProtocolMessageImpl(
+        const std::int32_t fd,
+        std::uint8_t code,
+        const score::cpp::span<const std::uint8_t> message,
+        const std::int32_t handle) noexcept;
+    score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> ReceiveProtocolMessageImpl(
+        const std::int32_t fd,
+        std::uint8_t& code,
+        std::int32_t* const handle) noexcept;
+    /// Returns the first handle received with msg (or -1) and closes all others.
+    std::int32_t TakeFirstReceivedHandle(msghdr& msg) noexcept;
+
+    void RegisterPosixEndpoint(EventLoop& loop, PosixEndpointEntry& endpoint) noexcept;
+    void UnregisterPosixEndpoint(EventLoop& loop, PosixEndpointEntry& endpoint) noexcept;
+    void UnpollEndpoint(EventLoop& loop, const std::size_t index) noexcept;
+    void SendPipeEvent(EventLoop& loop, PipeEvent pipe_event) noexcept;
+    void ProcessPipeEvent(EventLoop& loop) noexcept;
+    void ProcessCleanup(EventLoop& loop, const void* const owner) noexcept;
+    void ProcessPendingCleanups(EventLoop& loop) noexcept;
+    void RunOnThread(EventLoop& loop) noexcept;
+    std::int32_t ProcessTimerQueue(EventLoop& loop) noexcept;
 
     score::cpp::pmr::memory_resource* const memory_resource_;
     OsResources os_resources_;
     LoggingCallback logger_;
 
-    std::array<std::int32_t, 2> pipe_fds_;
-    bool quit_flag_;
-    std::thread thread_;
     std::mutex thread_mutex_;
-    ISharedResourceEngine::PosixEndpointEntry command_endpoint_;
 
-    score::cpp::pmr::vector<pollfd> poll_fds_;
-    score::cpp::pmr::vector<PosixEndpointEntry*> poll_endpoints_;
+    // signalled whenever a clean-up request is queued or completed on any of the loops
+    std::mutex cleanup_mutex_;
+    std::condition_variable cleanup_condition_;
+    score::cpp::pmr::vector<score::cpp::pmr::unique_ptr<EventLoop>> event_loops_;
 
-    detail::TimedCommandQueue timer_queue_;
-    score::containers::intrusive_list<PosixEndpointEntry> posix_endpoint_list_;
-    score::cpp::pmr::vector<std::uint8_t> posix_receive_buffer_;
+    // explicit owner to thread assignments; the lookup is skipped while there are none
+    mutable std::mutex assignment_mutex_;
+    std::atomic<std::size_t> assignment_count_;
+    score::cpp::pmr::vector<std::pair<const void*, std::size_t>> owner_assignments_;
 };
 
 }  // namespace message_passing
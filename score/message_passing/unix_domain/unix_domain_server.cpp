@@ -18,6 +18,9 @@
 
 #include <score/utility.hpp>
 
+#include <chrono>
+#include <cstddef>
+
 namespace score
 {
 namespace message_passing
@@ -32,12 +35,16 @@ namespace
 // into the connection backlog queue, it will try to reconnect after some delay again.
 constexpr std::int32_t kSocketListenBacklog = 20;
 
+// The number of low-priority messages dispatched per engine loop iteration once the pending input has been served.
+// Bounds the delay a burst of low-priority messages adds to the high-priority ones, while guaranteeing progress.
+constexpr std::size_t kDeferredMessagesPerIteration = 4U;
+
 }  // namespace
 
 UnixDomainServer::ServerConnection::ServerConnection(UnixDomainServer& server,
                                                      std::int32_t fd,
                                                      ClientIdentity client_identity) noexcept
-    : server_{server}, user_data_{}, client_identity_{client_identity}, fd_{fd}
+    : server_{server}, user_data_{}, client_identity_{client_identity}, fd_{fd}, received_handle_{-1}
 {
 }
 
@@ -101,17 +108,47 @@ void UnixDomainServer::ServerConnection::RequestDisconnect() noexcept
     server_.engine_->UnregisterPosixEndpoint(endpoint_);
 }
 
+score::cpp::expected<std::int32_t, score::os::Error> UnixDomainServer::ServerConnection::ReceiveHandle() noexcept
+{
+    if (received_handle_ < 0)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOENT));
+    }
+    const std::int32_t handle = received_handle_;
+    received_handle_ = -1;
+    return handle;
+}
+
 bool UnixDomainServer::ServerConnection::ProcessInput() noexcept
 {
     std::uint8_t code;
-    auto& user_data = *user_data_;
-    using HandlerPointerT = score::cpp::pmr::unique_ptr<IConnectionHandler>;
-    auto message_expected = server_.engine_->ReceiveProtocolMessage(endpoint_.fd, code);
+    auto message_expected = server_.engine_->ReceiveProtocolMessage(endpoint_.fd, code, received_handle_);
     if (!message_expected.has_value())
     {
+        server_.CloseReceivedHandle(received_handle_);
+        return false;
+    }
+    const bool low_priority = (code & kLowPriorityFlag) != 0U;
+    code = static_cast<std::uint8_t>(code & kClientToServerCodeMask);
+    if ((received_handle_ >= 0) && (code != score::cpp::to_underlying(ClientToServer::SEND_WITH_HANDLE)))
+    {
+        // a handle attached to a message that is not supposed to carry one; drop connection
+        server_.CloseReceivedHandle(received_handle_);
         return false;
     }
     auto message = message_expected.value();
+    if (low_priority && server_.IsDeferrable(code))
+    {
+        return server_.DeferMessage(*this, code, message);
+    }
+    return DispatchMessage(code, message);
+}
+
+bool UnixDomainServer::ServerConnection::DispatchMessage(const std::uint8_t code,
+                                                         const score::cpp::span<const std::uint8_t> message) noexcept
+{
+    auto& user_data = *user_data_;
+    using HandlerPointerT = score::cpp::pmr::unique_ptr<IConnectionHandler>;
     switch (code)
     {
         case score::cpp::to_underlying(ClientToServer::REQUEST):
@@ -126,6 +163,17 @@ bool UnixDomainServer::ServerConnection::ProcessInput() noexcept
                         : server_.sent_callback_(*this, message))
                 .has_value();
 
+        case score::cpp::to_underlying(ClientToServer::SEND_WITH_HANDLE):
+        {
+            const bool result = (std::holds_alternative<HandlerPointerT>(user_data)
+                                     ? std::get<HandlerPointerT>(user_data)->OnMessageSent(*this, message)
+                                     : server_.sent_callback_(*this, message))
+                                    .has_value();
+            // the handle not taken by the callback is not needed anymore
+            server_.CloseReceivedHandle(received_handle_);
+            return result;
+        }
+
         default:
             // unrecognised message; drop connection
             return false;
@@ -135,6 +183,7 @@ bool UnixDomainServer::ServerConnection::ProcessInput() noexcept
 
 UnixDomainServer::ServerConnection::~ServerConnection() noexcept
 {
+    server_.DropDeferredMessages(*this);
     if (user_data_.has_value())
     {
         auto& user_data = *user_data_;
@@ -153,19 +202,43 @@ UnixDomainServer::ServerConnection::~ServerConnection() noexcept
 
 UnixDomainServer::UnixDomainServer(std::shared_ptr<UnixDomainEngine> engine,
                                    const ServiceProtocolConfig& protocol_config,
-                                   const IServerFactory::ServerConfig& /*server_config*/) noexcept
+                                   const IServerFactory::ServerConfig& server_config,
+                                   std::optional<std::size_t> thread_index) noexcept
     : engine_{std::move(engine)},
       identifier_{protocol_config.identifier.data(), protocol_config.identifier.size(), engine_->GetMemoryResource()},
       max_request_size_{protocol_config.max_send_size},
       max_reply_size_{protocol_config.max_reply_size},
       max_notify_size_{protocol_config.max_notify_size},
-      server_fd_{-1}
+      server_fd_{-1},
+      thread_assigned_{thread_index.has_value()},
+      deferred_storage_{static_cast<std::size_t>(server_config.max_queued_low_priority_sends),
+                        score::cpp::pmr::polymorphic_allocator<>(engine_->GetMemoryResource())},
+      deferred_pool_{},
+      deferred_queue_{},
+      deferred_command_armed_{false},
+      deferred_command_{}
 {
+    for (auto& deferred : deferred_storage_)
+    {
+        deferred.message.reserve(static_cast<std::size_t>(max_request_size_));
+    }
+    deferred_pool_.assign(deferred_storage_.begin(), deferred_storage_.end());
+
+    if (thread_assigned_)
+    {
+        // the server connections use the server as their owner, so they will be served by the same thread
+        engine_->AssignOwnerToThread(this, thread_index.value());
+    }
 }
 
 UnixDomainServer::~UnixDomainServer() noexcept
 {
     StopListening();
+    if (thread_assigned_)
+    {
+        engine_->ReleaseOwnerAssignment(this);
+    }
+    deferred_pool_.clear();
 }
 
 score::cpp::expected_blank<score::os::Error> UnixDomainServer::StartListening(
@@ -232,7 +305,110 @@ void UnixDomainServer::StopListening() noexcept
         engine_->CleanUpOwner(this);
         engine_->GetOsResources().unistd->close(server_fd_);
         server_fd_ = -1;
+        // the connections are gone now, and so are their deferred messages
+        deferred_command_armed_ = false;
+    }
+}
+
+void UnixDomainServer::CloseReceivedHandle(std::int32_t& handle) noexcept
+{
+    if (handle >= 0)
+    {
+        engine_->GetOsResources().unistd->close(handle);
+        handle = -1;
+    }
+}
+
+bool UnixDomainServer::IsDeferrable(const std::uint8_t code) const noexcept
+{
+    // only fire-and-forget messages are deferred: the client of a request is blocked until its reply, and the received
+    // handles are never kept beyond the dispatch of their message
+    return (!deferred_storage_.empty()) && (code == score::cpp::to_underlying(ClientToServer::SEND));
+}
+
+bool UnixDomainServer::DeferMessage(ServerConnection& connection,
+                                    const std::uint8_t code,
+                                    const score::cpp::span<const std::uint8_t> message) noexcept
+{
+    if (deferred_pool_.empty())
+    {
+        // The lane is full: make room by dispatching the oldest low-priority message right away, which keeps the
+        // order of the messages from the same connection and bounds the queuing delay of the low-priority lane
+        if (!DispatchFirstDeferredMessage(&connection))
+        {
+            return false;
+        }
+    }
+    auto& deferred = deferred_pool_.front();
+    deferred_pool_.pop_front();
+    deferred.connection = &connection;
+    deferred.code = code;
+    deferred.message.assign(message.begin(), message.end());
+    deferred_queue_.push_back(deferred);
+    if (!deferred_command_armed_)
+    {
+        // processed at the start of the next engine loop iteration, after the input of the current one
+        ArmDeferredCommand(ISharedResourceEngine::TimePoint{});
+    }
+    return true;
+}
+
+bool UnixDomainServer::DispatchFirstDeferredMessage(const ServerConnection* const current_connection) noexcept
+{
+    auto& deferred = deferred_queue_.front();
+    deferred_queue_.pop_front();
+    ServerConnection& connection = *deferred.connection;
+    const bool result = connection.DispatchMessage(deferred.code, deferred.message);
+    deferred_pool_.push_front(deferred);  // LIFO for better cache locality
+    if (result)
+    {
+        return true;
+    }
+    if (&connection == current_connection)
+    {
+        // the caller is going to drop the connection
+        DropDeferredMessages(connection);
+        return false;
     }
+    connection.RequestDisconnect();
+    return true;
+}
+
+void UnixDomainServer::ProcessDeferredMessages(const ISharedResourceEngine::TimePoint now) noexcept
+{
+    deferred_command_armed_ = false;
+    for (std::size_t i = 0U; (i < kDeferredMessagesPerIteration) && (!deferred_queue_.empty()); ++i)
+    {
+        score::cpp::ignore = DispatchFirstDeferredMessage(nullptr);
+    }
+    if (!deferred_queue_.empty())
+    {
+        // Scheduling past the current time lets the engine poll for the pending input before the next batch
+        ArmDeferredCommand(now + std::chrono::nanoseconds{1});
+    }
+}
+
+void UnixDomainServer::ArmDeferredCommand(const ISharedResourceEngine::TimePoint until) noexcept
+{
+    deferred_command_armed_ = true;
+    engine_->EnqueueCommand(
+        deferred_command_,
+        until,
+        [this](auto now) noexcept {
+            ProcessDeferredMessages(now);
+        },
+        this);
+}
+
+void UnixDomainServer::DropDeferredMessages(const ServerConnection& connection) noexcept
+{
+    deferred_queue_.remove_and_dispose_if(
+        [&connection](const DeferredMessage& deferred) {
+            return deferred.connection == &connection;
+        },
+        [this](DeferredMessage* const deferred) noexcept {
+            deferred_pool_.push_front(*deferred);
+        });
 }
 
 void UnixDomainServer::ProcessConnect() noexcept
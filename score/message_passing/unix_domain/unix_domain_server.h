@@ -19,7 +19,10 @@
 #include "score/message_passing/unix_domain/unix_domain_engine.h"
 #include "score/message_passing/unix_domain/unix_domain_server_factory.h"
 
+#include "score/containers/intrusive_list.h"
+
 #include <score/string.hpp>
+#include <score/vector.hpp>
 
 #include <optional>
 
@@ -47,10 +50,12 @@ class UnixDomainServer final : public IServer
         score::cpp::expected_blank<score::os::Error> Notify(
             score::cpp::span<const std::uint8_t> message) noexcept override;
         void RequestDisconnect() noexcept override;
+        score::cpp::expected<std::int32_t, score::os::Error> ReceiveHandle() noexcept override;
 
         // Server methods
         void AcceptConnection(UserData&& data, score::cpp::pmr::unique_ptr<ServerConnection>&& self) noexcept;
         bool ProcessInput() noexcept;
+        bool DispatchMessage(std::uint8_t code, score::cpp::span<const std::uint8_t> message) noexcept;
 
         ~ServerConnection() noexcept;
 
@@ -59,13 +64,15 @@ class UnixDomainServer final : public IServer
         std::optional<UserData> user_data_;
         ClientIdentity client_identity_;
         std::int32_t fd_;
+        std::int32_t received_handle_;
         ISharedResourceEngine::PosixEndpointEntry endpoint_;
         score::cpp::pmr::unique_ptr<ServerConnection> self_;
     };
 
     UnixDomainServer(std::shared_ptr<UnixDomainEngine> engine,
                      const ServiceProtocolConfig& protocol_config,
-                     const IServerFactory::ServerConfig& server_config) noexcept;
+                     const IServerFactory::ServerConfig& server_config,
+                     std::optional<std::size_t> thread_index = std::nullopt) noexcept;
     ~UnixDomainServer() noexcept override;
 
     score::cpp::expected_blank<score::os::Error> StartListening(
@@ -77,7 +84,32 @@ class UnixDomainServer final : public IServer
     void StopListening() noexcept override;
 
   private:
+    // A low-priority message received from a client, waiting to be dispatched after the high-priority input
+    class DeferredMessage : public score::containers::intrusive_list_element<>
+    {
+      public:
+        using allocator_type = score::cpp::pmr::polymorphic_allocator<DeferredMessage>;
+        explicit DeferredMessage(const allocator_type& allocator)
+            : score::containers::intrusive_list_element<>{}, connection{nullptr}, code{0U}, message(allocator)
+        {
+        }
+
+        ServerConnection* connection;
+        std::uint8_t code;
+        score::cpp::pmr::vector<std::uint8_t> message;
+    };
+
     void ProcessConnect() noexcept;
+    void CloseReceivedHandle(std::int32_t& handle) noexcept;
+
+    bool IsDeferrable(std::uint8_t code) const noexcept;
+    bool DeferMessage(ServerConnection& connection,
+                      std::uint8_t code,
+                      score::cpp::span<const std::uint8_t> message) noexcept;
+    bool DispatchFirstDeferredMessage(const ServerConnection* current_connection) noexcept;
+    void ProcessDeferredMessages(ISharedResourceEngine::TimePoint now) noexcept;
+    void ArmDeferredCommand(ISharedResourceEngine::TimePoint until) noexcept;
+    void DropDeferredMessages(const ServerConnection& connection) noexcept;
 
     std::shared_ptr<UnixDomainEngine> engine_;
     const score::cpp::pmr::string identifier_;
@@ -86,6 +118,7 @@ class UnixDomainServer final : public IServer
     const std::uint32_t max_notify_size_;
 
     std::int32_t server_fd_;
+    const bool thread_assigned_;
     std::recursive_mutex connection_setup_mutex_;
 
     ConnectCallback connect_callback_;
@@ -95,6 +128,15 @@ class UnixDomainServer final : public IServer
 
     ISharedResourceEngine::CommandQueueEntry listener_command_;
     ISharedResourceEngine::PosixEndpointEntry listener_endpoint_;
+
+    // Low-priority lane: the storage is preallocated for ServerConfig::max_queued_low_priority_sends messages (none by
+    // default), the same way as the send queue of ClientConnection. All the members below are only accessed from the
+    // server's engine thread.
+    score::cpp::pmr::vector<DeferredMessage> deferred_storage_;
+    score::containers::intrusive_list<DeferredMessage> deferred_pool_;
+    score::containers::intrusive_list<DeferredMessage> deferred_queue_;
+    bool deferred_command_armed_;
+    ISharedResourceEngine::CommandQueueEntry deferred_command_;
 };
 
 }  // namespace detail
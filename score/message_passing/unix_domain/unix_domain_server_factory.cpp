@@ -39,5 +39,13 @@ score::cpp::pmr::unique_ptr<IServer> UnixDomainServerFactory::Create(const Servi
         engine_->GetMemoryResource(), engine_, protocol_config, server_config);
 }
 
+score::cpp::pmr::unique_ptr<IServer> UnixDomainServerFactory::Create(const ServiceProtocolConfig& protocol_config,
+                                                                     const ServerConfig& server_config,
+                                                                     const std::size_t thread_index) noexcept
+{
+    return score::cpp::pmr::make_unique<detail::UnixDomainServer>(
+        engine_->GetMemoryResource(), engine_, protocol_config, server_config, thread_index);
+}
+
 }  // namespace message_passing
 }  // namespace score
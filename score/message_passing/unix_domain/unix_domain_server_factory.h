@@ -15,6 +15,8 @@
 
 #include "score/message_passing/i_server_factory.h"
 
+#include <cstddef>
+
 namespace score
 {
 namespace message_passing
@@ -33,6 +35,12 @@ class UnixDomainServerFactory final : public IServerFactory
     score::cpp::pmr::unique_ptr<IServer> Create(const ServiceProtocolConfig& protocol_config,
                                                 const ServerConfig& server_config) noexcept override;
 
+    /// \brief Creates a server with all its connections served by the given background thread of the engine
+    /// \details Only makes a difference for an engine running more than one background thread.
+    score::cpp::pmr::unique_ptr<IServer> Create(const ServiceProtocolConfig& protocol_config,
+                                                const ServerConfig& server_config,
+                                                const std::size_t thread_index) noexcept;
+
     std::shared_ptr<UnixDomainEngine> GetEngine() const noexcept
     {
         return engine_;
@@ -0,0 +1,201 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include <gtest/gtest.h>
+
+#include "score/message_passing/unix_domain/unix_domain_engine.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace message_passing
+{
+namespace
+{
+
+using namespace ::testing;
+
+constexpr std::chrono::seconds kFutureWaitTimeout{5};
+
+class UnixDomainEngineTest : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<UnixDomainEngine> engine_{
+        std::make_unique<UnixDomainEngine>(score::cpp::pmr::get_default_resource())};
+};
+
+TEST_F(UnixDomainEngineTest, CommandsEnqueuedConcurrentlyFromSeveralThreadsAreAllExecuted)
+{
+    constexpr std::size_t kThreadCount{4U};
+    constexpr std::size_t kCommandsPerThread{1000U};
+
+    // Each thread waits for the execution of its command before enqueuing the next one, so that the commands are
+    // enqueued while the background thread is busy with draining the wakeup events of the other threads
+    std::atomic<std::size_t> lost_command_count{0U};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kThreadCount; ++thread_index)
+    {
+        threads.emplace_back([this, &lost_command_count]() {
+            for (std::size_t command_index = 0U; command_index < kCommandsPerThread; ++command_index)
+            {
+                ISharedResourceEngine::CommandQueueEntry command{};
+                std::promise<void> executed{};
+                engine_->EnqueueCommand(
+                    command,
+                    ISharedResourceEngine::TimePoint{},
+                    [&executed](auto) noexcept {
+                        executed.set_value();
+                    },
+                    this);
+                if (executed.get_future().wait_for(kFutureWaitTimeout) != std::future_status::ready)
+                {
+                    ++lost_command_count;
+                    engine_->CleanUpOwner(this);
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(lost_command_count, 0U);
+}
+
+TEST_F(UnixDomainEngineTest, CommandsEnqueuedInABurstAreAllExecuted)
+{
+    constexpr std::size_t kCommandCount{1000U};
+
+    std::vector<ISharedResourceEngine::CommandQueueEntry> commands(kCommandCount);
+    std::atomic<std::size_t> executed_count{0U};
+    std::promise<void> all_executed{};
+    for (auto& command : commands)
+    {
+        engine_->EnqueueCommand(
+            command,
+            ISharedResourceEngine::TimePoint{},
+            [&executed_count, &all_executed](auto) noexcept {
+                if (++executed_count == kCommandCount)
+                {
+                    all_executed.set_value();
+                }
+            },
+            this);
+    }
+
+    EXPECT_EQ(all_executed.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    EXPECT_EQ(executed_count, kCommandCount);
+    engine_->CleanUpOwner(this);
+}
+
+TEST_F(UnixDomainEngineTest, CommandsEnqueuedOnTheBackgroundThreadAreExecuted)
+{
+    // the commands enqueued on the background thread don't wake it up
+    ISharedResourceEngine::CommandQueueEntry command{};
+    ISharedResourceEngine::CommandQueueEntry immediate_command{};
+    ISharedResourceEngine::CommandQueueEntry delayed_command{};
+    std::promise<void> immediate_executed{};
+    std::promise<void> delayed_executed{};
+    engine_->EnqueueCommand(
+        command,
+        ISharedResourceEngine::TimePoint{},
+        [this, &immediate_command, &delayed_command, &immediate_executed, &delayed_executed](auto) noexcept {
+            engine_->EnqueueCommand(
+                immediate_command,
+                ISharedResourceEngine::TimePoint{},
+                [&immediate_executed](auto) noexcept {
+                    immediate_executed.set_value();
+                },
+                this);
+            engine_->EnqueueCommand(
+                delayed_command,
+                ISharedResourceEngine::FromNow(std::chrono::milliseconds{10}),
+                [&delayed_executed](auto) noexcept {
+                    delayed_executed.set_value();
+                },
+                this);
+        },
+        this);
+
+    EXPECT_EQ(immediate_executed.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    EXPECT_EQ(delayed_executed.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    engine_->CleanUpOwner(this);
+}
+
+TEST(UnixDomainEngineMultiThreadTest, OwnersOnDifferentThreadsCanCleanUpEachOtherFromTheirCallbacks)
+{
+    // Given an engine with two threads and an owner bound to each of them
+    UnixDomainEngine engine{score::cpp::pmr::get_default_resource(), 2U};
+    const std::array<int, 2> owners{};
+    engine.AssignOwnerToThread(&owners[0], 0U);
+    engine.AssignOwnerToThread(&owners[1], 1U);
+
+    // and a pending delayed command of each owner
+    std::array<ISharedResourceEngine::CommandQueueEntry, 2> delayed_commands{};
+    std::atomic<std::size_t> delayed_executed_count{0U};
+    for (std::size_t index = 0U; index < owners.size(); ++index)
+    {
+        engine.EnqueueCommand(
+            delayed_commands[index],
+            ISharedResourceEngine::FromNow(std::chrono::seconds{1}),
+            [&delayed_executed_count](auto) noexcept {
+                ++delayed_executed_count;
+            },
+            &owners[index]);
+    }
+
+    // When the callbacks of both owners run at the same time and each of them cleans up the other owner
+    std::array<ISharedResourceEngine::CommandQueueEntry, 2> commands{};
+    std::array<std::promise<void>, 2> cleaned_up{};
+    std::atomic<std::size_t> running_count{0U};
+    for (std::size_t index = 0U; index < owners.size(); ++index)
+    {
+        const void* const other_owner = &owners[1U - index];
+        engine.EnqueueCommand(
+            commands[index],
+            ISharedResourceEngine::TimePoint{},
+            [&engine, &running_count, &cleaned_up, other_owner, index](auto) noexcept {
+                ++running_count;
+                while (running_count < 2U)
+                {
+                    std::this_thread::yield();
+                }
+                engine.CleanUpOwner(other_owner);
+                cleaned_up[index].set_value();
+            },
+            &owners[index]);
+    }
+
+    // Then both clean-ups complete instead of waiting for each other
+    EXPECT_EQ(cleaned_up[0].get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    EXPECT_EQ(cleaned_up[1].get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+
+    // and the pending commands of both owners are removed
+    std::this_thread::sleep_for(std::chrono::milliseconds{1100});
+    EXPECT_EQ(delayed_executed_count, 0U);
+
+    engine.ReleaseOwnerAssignment(&owners[0]);
+    engine.ReleaseOwnerAssignment(&owners[1]);
+}
+
+}  // namespace
+}  // namespace message_passing
+}  // namespace score
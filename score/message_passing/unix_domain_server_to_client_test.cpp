@@ -16,8 +16,19 @@
 #include "score/message_passing/unix_domain/unix_domain_server_factory.h"
 
 #include "score/message_passing/i_server_connection.h"
+#include "score/message_passing/unix_domain/unix_domain_engine.h"
+#include "score/message_passing/unix_domain/unix_domain_server.h"
 
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace score
 {
@@ -162,6 +173,40 @@ class ServerToClientTestFixtureUnix : public ::testing::Test, public testing::Wi
                 .has_value());
     }
 
+    void WhenHandleServerStartsListening()
+    {
+        auto connect_callback = [this](IServerConnection&) -> void* {
+            ++server_connections_started_;
+            return nullptr;
+        };
+        auto disconnect_callback = [this](IServerConnection&) {
+            ++server_connections_finished_;
+        };
+        auto sent_callback = [this](IServerConnection& connection,
+                                    score::cpp::span<const std::uint8_t> message) -> score::cpp::blank {
+            auto handle_expected = connection.ReceiveHandle();
+            if (!handle_expected.has_value())
+            {
+                handle_content_promise_.set_value({});
+                return {};
+            }
+            const std::int32_t handle = handle_expected.value();
+            // the message is a header carrying the number of bytes to read from the handle
+            std::uint32_t content_size{0U};
+            if (message.size() == sizeof(content_size))
+            {
+                std::memcpy(&content_size, message.data(), sizeof(content_size));
+            }
+            std::vector<std::uint8_t> content(content_size);
+            const auto size = ::pread(handle, content.data(), content.size(), 0);
+            ::close(handle);
+            content.resize(size < 0 ? 0U : static_cast<std::size_t>(size));
+            handle_content_promise_.set_value(std::move(content));
+            return {};
+        };
+        EXPECT_TRUE(server_->StartListening(connect_callback, disconnect_callback, sent_callback).has_value());
+    }
+
     void WhenClientStarted(bool delete_on_stop = false)
     {
         delete_on_stop_ = delete_on_stop;
@@ -317,6 +362,7 @@ class ServerToClientTestFixtureUnix : public ::testing::Test, public testing::Wi
 
     Promises promises_;
     Futures futures_;
+    std::promise<std::vector<std::uint8_t>> handle_content_promise_;
 
     IServerFactory::ServerConfig server_config_{};
     IClientFactory::ClientConfig client_config_{};
@@ -432,8 +478,335 @@ TEST_P(ServerToClientTestFixtureUnix, EchoServerClientRestart)
     WaitClientStoppedExpectStatusStopped();
 }
 
+TEST_P(ServerToClientTestFixtureUnix, HandleServerReceivesMemfdContent)
+{
+    WhenServerAndClientFactoriesConstructed(true, GetParam());
+    WhenServerCreated();
+    WhenHandleServerStartsListening();
+    WhenClientStarted();
+    WaitClientConnected();
+
+    // the payload is passed via the memfd and exceeds max_send_size; the message itself only carries the payload size
+    const std::vector<std::uint8_t> payload(4096U, 0xA5U);
+    ASSERT_GT(payload.size(), protocol_config_.max_send_size);
+    const std::int32_t memfd = ::memfd_create("handle_test", MFD_CLOEXEC);
+    ASSERT_GE(memfd, 0);
+    ASSERT_EQ(::write(memfd, payload.data(), payload.size()), static_cast<ssize_t>(payload.size()));
+
+    const auto payload_size = static_cast<std::uint32_t>(payload.size());
+    std::array<std::uint8_t, sizeof(payload_size)> message{};
+    std::memcpy(message.data(), &payload_size, sizeof(payload_size));
+    EXPECT_TRUE(client_->SendWithHandle(message, memfd).has_value());
+    ::close(memfd);
+
+    auto future = handle_content_promise_.get_future();
+    ASSERT_EQ(future.wait_for(kFutureWaitTimeout), std::future_status::ready);
+    EXPECT_EQ(future.get(), payload);
+
+    client_->Stop();
+    WaitClientStoppedExpectStatusStopped();
+}
+
+TEST_P(ServerToClientTestFixtureUnix, SendWithInvalidHandleFails)
+{
+    WithStandardEchoServerSetup();
+
+    const std::array<std::uint8_t, 1> message{1};
+    const auto result = client_->SendWithHandle(message, -1);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), EBADF);
+
+    client_->Stop();
+    WaitClientStoppedExpectStatusStopped();
+}
+
 INSTANTIATE_TEST_SUITE_P(UnixDomain, ServerToClientTestFixtureUnix, testing::Values(false, true));
 
+TEST(ServerToClientMultiThreadedEngineUnix, EchoServersOnSeparateThreads)
+{
+    constexpr std::size_t kThreadCount{4U};
+    constexpr std::size_t kClientsPerServer{3U};
+
+    auto engine = std::make_shared<UnixDomainEngine>(score::cpp::pmr::get_default_resource(), kThreadCount);
+    EXPECT_EQ(engine->GetThreadCount(), kThreadCount);
+    UnixDomainServerFactory server_factory{engine};
+    UnixDomainClientFactory client_factory{engine};
+
+    std::string test_prefix{"test_prefix_mt_"};
+    test_prefix += std::to_string(::getpid()) + "_";
+    std::vector<std::string> identifiers;
+    std::vector<score::cpp::pmr::unique_ptr<IServer>> servers;
+    std::atomic<std::uint32_t> wrong_thread_count{0U};
+    for (std::size_t i = 0U; i < kThreadCount; ++i)
+    {
+        identifiers.push_back(test_prefix + std::to_string(i));
+    }
+    for (std::size_t i = 0U; i < kThreadCount; ++i)
+    {
+        ServiceProtocolConfig protocol_config{identifiers[i], 64, 64, 64};
+        auto server = server_factory.Create(protocol_config, IServerFactory::ServerConfig{}, i);
+        ASSERT_TRUE(server);
+        const IServer* const server_address = server.get();
+        auto connect_callback = [](IServerConnection&) -> void* {
+            return nullptr;
+        };
+        auto sent_with_reply_callback = [&engine, &wrong_thread_count, server_address](
+                                            IServerConnection& connection,
+                                            score::cpp::span<const std::uint8_t> message) -> score::cpp::blank {
+            // all the callbacks of a server are serialized on the thread the server is assigned to
+            if (!engine->IsOnOwnerCallbackThread(static_cast<const detail::UnixDomainServer*>(server_address)))
+            {
+                ++wrong_thread_count;
+            }
+            connection.Reply(message);
+            return {};
+        };
+        auto disconnect_callback = [](IServerConnection&) noexcept {};
+        EXPECT_TRUE(
+            server->StartListening(connect_callback, disconnect_callback, {}, sent_with_reply_callback).has_value());
+        servers.push_back(std::move(server));
+    }
+
+    std::vector<score::cpp::pmr::unique_ptr<IClientConnection>> clients;
+    std::vector<std::promise<void>> ready_promises(kThreadCount * kClientsPerServer);
+    for (std::size_t i = 0U; i < kThreadCount * kClientsPerServer; ++i)
+    {
+        ServiceProtocolConfig protocol_config{identifiers[i % kThreadCount], 64, 64, 64};
+        auto client = client_factory.Create(protocol_config, IClientFactory::ClientConfig{1, 1, false, false, false});
+        ASSERT_TRUE(client);
+        auto& ready_promise = ready_promises[i];
+        client->Start(
+            [&ready_promise](IClientConnection::State state) {
+                if (state == IClientConnection::State::kReady)
+                {
+                    ready_promise.set_value();
+                }
+            },
+            IClientConnection::NotifyCallback{});
+        clients.push_back(std::move(client));
+    }
+
+    for (std::size_t i = 0U; i < clients.size(); ++i)
+    {
+        ASSERT_EQ(ready_promises[i].get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+        const std::array<std::uint8_t, 4> message{1, 2, 3, static_cast<std::uint8_t>(i)};
+        std::array<std::uint8_t, 64> reply_buffer{};
+        const auto reply_expected = clients[i]->SendWaitReply(message, reply_buffer);
+        ASSERT_TRUE(reply_expected.has_value());
+        EXPECT_EQ(reply_expected.value().size(), message.size());
+        EXPECT_EQ(reply_buffer[3], static_cast<std::uint8_t>(i));
+    }
+    EXPECT_EQ(wrong_thread_count, 0U);
+
+    clients.clear();
+    for (auto& server : servers)
+    {
+        server->StopListening();
+    }
+}
+
+class ServerToClientPriorityLanesUnix : public ::testing::Test
+{
+  protected:
+    static constexpr std::uint8_t kBlocker{0U};
+    static constexpr std::uint8_t kLow{1U};
+    static constexpr std::uint8_t kHigh{2U};
+
+    void TearDown() override
+    {
+        if (!released_)
+        {
+            release_promise_.set_value();
+        }
+        clients_.clear();
+        if (server_)
+        {
+            server_->StopListening();
+        }
+    }
+
+    void StartServer(const IServerFactory::ServerConfig& server_config, const std::size_t message_count)
+    {
+        message_count_ = message_count;
+        server_ = server_factory_.Create(protocol_config_, server_config);
+        ASSERT_TRUE(server_);
+        auto connect_callback = [this](IServerConnection&) -> void* {
+            ++connected_count_;
+            return nullptr;
+        };
+        auto sent_callback = [this](IServerConnection&,
+                                    score::cpp::span<const std::uint8_t> message) -> score::cpp::blank {
+            Receive(message);
+            return {};
+        };
+        auto sent_with_reply_callback = [this](IServerConnection& connection,
+                                               score::cpp::span<const std::uint8_t> message) -> score::cpp::blank {
+            Receive(message);
+            connection.Reply(message);
+            return {};
+        };
+        auto disconnect_callback = [](IServerConnection&) noexcept {};
+        const auto listen_result =
+            server_->StartListening(connect_callback, disconnect_callback, sent_callback, sent_with_reply_callback);
+        ASSERT_TRUE(listen_result.has_value());
+    }
+
+    // the clients are connected one after the other, so that the server polls their connections in this order
+    void ConnectClients(const std::size_t client_count)
+    {
+        ready_promises_ = std::vector<std::promise<void>>(client_count);
+        for (std::size_t i = 0U; i < client_count; ++i)
+        {
+            auto client =
+                client_factory_.Create(protocol_config_, IClientFactory::ClientConfig{1, 1, false, false, false});
+            ASSERT_TRUE(client);
+            auto& ready_promise = ready_promises_[i];
+            client->Start(
+                [&ready_promise](IClientConnection::State state) {
+                    if (state == IClientConnection::State::kReady)
+                    {
+                        ready_promise.set_value();
+                    }
+                },
+                IClientConnection::NotifyCallback{});
+            clients_.push_back(std::move(client));
+            ASSERT_EQ(ready_promise.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+            while (connected_count_ < i + 1U)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    // keeps the server thread busy in the callback of the blocker message until ReleaseServer() is called
+    void BlockServer()
+    {
+        const std::array<std::uint8_t, 1> blocker_message{kBlocker};
+        ASSERT_TRUE(clients_[0]->Send(blocker_message).has_value());
+        ASSERT_EQ(blocked_promise_.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    }
+
+    void ReleaseServer()
+    {
+        released_ = true;
+        release_promise_.set_value();
+        ASSERT_EQ(all_received_promise_.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+    }
+
+    std::vector<std::uint8_t> GetReceived()
+    {
+        std::lock_guard<std::mutex> guard{received_mutex_};
+        return received_;
+    }
+
+    std::string identifier_{"test_prefix_prio_" + std::to_string(::getpid())};
+    ServiceProtocolConfig protocol_config_{identifier_, 64, 64, 64};
+    std::promise<void> blocked_promise_;
+    std::promise<void> release_promise_;
+    std::shared_future<void> release_future_{release_promise_.get_future().share()};
+    bool released_{false};
+    std::promise<void> all_received_promise_;
+    std::atomic<std::size_t> connected_count_{0U};
+    std::size_t message_count_{0U};
+    std::mutex received_mutex_;
+    std::vector<std::uint8_t> received_;
+    std::vector<std::promise<void>> ready_promises_;
+
+    UnixDomainServerFactory server_factory_{};
+    UnixDomainClientFactory client_factory_{};
+    score::cpp::pmr::unique_ptr<IServer> server_;
+    std::vector<score::cpp::pmr::unique_ptr<IClientConnection>> clients_;
+
+  private:
+    void Receive(const score::cpp::span<const std::uint8_t> message)
+    {
+        if (message.front() == kBlocker)
+        {
+            blocked_promise_.set_value();
+            release_future_.wait();
+        }
+        std::lock_guard<std::mutex> guard{received_mutex_};
+        received_.push_back(message.front());
+        if (received_.size() == message_count_)
+        {
+            all_received_promise_.set_value();
+        }
+    }
+};
+
+TEST_F(ServerToClientPriorityLanesUnix, HighPriorityMessageOvertakesLowPriorityMessages)
+{
+    constexpr std::size_t kLowClients{3U};
+    constexpr std::size_t kClientCount{kLowClients + 2U};
+
+    // Given a server with a low-priority lane, which is blocked in the callback of a message
+    StartServer(IServerFactory::ServerConfig{0U, 0U, 0U, 8U}, kClientCount);
+    ConnectClients(kClientCount);
+    BlockServer();
+
+    // When low-priority messages are sent before a high-priority message
+    const std::array<std::uint8_t, 1> low_message{kLow};
+    for (std::size_t i = 1U; i <= kLowClients; ++i)
+    {
+        ASSERT_TRUE(clients_[i]->SendWithPriority(low_message, IClientConnection::Priority::kLow).has_value());
+    }
+    const std::array<std::uint8_t, 1> high_message{kHigh};
+    ASSERT_TRUE(clients_[kClientCount - 1U]->Send(high_message).has_value());
+    ReleaseServer();
+
+    // Then the high-priority message is dispatched first
+    const std::vector<std::uint8_t> expected{kBlocker, kHigh, kLow, kLow, kLow};
+    EXPECT_EQ(GetReceived(), expected);
+}
+
+TEST_F(ServerToClientPriorityLanesUnix, LowPriorityMessagesAreNotDeferredWithoutLowPriorityLane)
+{
+    // Given a server without a low-priority lane, which is blocked in the callback of a message
+    StartServer(IServerFactory::ServerConfig{}, 3U);
+    ConnectClients(3U);
+    BlockServer();
+
+    // When a low-priority message is sent before a high-priority message
+    const std::array<std::uint8_t, 1> low_message{kLow};
+    ASSERT_TRUE(clients_[1]->SendWithPriority(low_message, IClientConnection::Priority::kLow).has_value());
+    const std::array<std::uint8_t, 1> high_message{kHigh};
+    ASSERT_TRUE(clients_[2]->Send(high_message).has_value());
+    ReleaseServer();
+
+    // Then the messages are dispatched in the order in which their connections are polled
+    const std::vector<std::uint8_t> expected{kBlocker, kLow, kHigh};
+    EXPECT_EQ(GetReceived(), expected);
+}
+
+TEST_F(ServerToClientPriorityLanesUnix, LowPriorityRequestIsNotDeferred)
+{
+    constexpr std::uint8_t kRequest{3U};
+
+    // Given a server with a low-priority lane, which is blocked in the callback of a message
+    StartServer(IServerFactory::ServerConfig{0U, 0U, 0U, 8U}, 3U);
+    ConnectClients(3U);
+    BlockServer();
+
+    // When a low-priority message is sent before a low-priority request
+    const std::array<std::uint8_t, 1> low_message{kLow};
+    ASSERT_TRUE(clients_[1]->SendWithPriority(low_message, IClientConnection::Priority::kLow).has_value());
+    auto reply_future = std::async(std::launch::async, [this]() {
+        const std::array<std::uint8_t, 1> request_message{kRequest};
+        std::array<std::uint8_t, 64> reply_buffer{};
+        return clients_[2]->SendWaitReplyWithPriority(request_message, reply_buffer, IClientConnection::Priority::kLow)
+            .has_value();
+    });
+    // the request is sent by another thread, as it blocks until the reply; give it time to reach the server
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ReleaseServer();
+
+    // Then the request is dispatched right away, while the low-priority message is deferred
+    ASSERT_EQ(reply_future.wait_for(kFutureWaitTimeout), std::future_status::ready);
+    EXPECT_TRUE(reply_future.get());
+    const std::vector<std::uint8_t> expected{kBlocker, kRequest, kLow};
+    EXPECT_EQ(GetReceived(), expected);
+}
+
 }  // namespace
 }  // namespace message_passing
 }  // namespace score
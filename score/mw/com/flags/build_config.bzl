@@ -0,0 +1,31 @@
+# *******************************************************************************
+# Copyright (c) 2025 Contributors to the Eclipse Foundation
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+# *******************************************************************************
+
+def build_config_defines(config_setting, define):
+    """Returns the `defines` of a cc_library, whose compile-time configuration is selected by a flag of this package.
+
+    The define is set via `defines` (unlike `local_defines`), since these are propagated to all dependents of the
+    library. So every translation unit, which includes the header of the library, sees the same value of the
+    compile-time constant derived from the define.
+
+    Args:
+        config_setting: label of the config_setting (see BUILD of this package), under which the define is set.
+        define: the preprocessor define, which is set if config_setting matches.
+
+    Returns:
+        A select, which can be assigned to the `defines` attribute of a cc_library.
+    """
+    return select({
+        config_setting: [define],
+        "//conditions:default": [],
+    })
@@ -0,0 +1,378 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/consumer_event_data_control_local_view.h"
+#include "score/mw/com/impl/bindings/lola/event_data_control.h"
+#include "score/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "score/mw/com/impl/bindings/lola/provider_event_data_control_local_view.h"
+#include "score/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_local_view.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_registration_guard.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_rollback_executor.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_set.h"
+
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+#include <score/span.hpp>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola::test
+{
+namespace
+{
+
+/// \brief Time, for which the waiting thread gets to block, before the dereference transaction is committed.
+constexpr std::chrono::microseconds kBlockingTime{200};
+
+/// \brief Number of sample slots of each event in the restart benchmarks of a service instance with many events.
+constexpr SlotIndexType kNumberOfSlotsPerEvent{16U};
+
+/// \brief Number of threads of the executor, which rolls back events concurrently to the calling thread.
+constexpr std::size_t kNumberOfRollbackExecutorThreads{3U};
+
+/// \brief TransactionLogId of the restarted proxy process. The other proxies get the subsequent ids.
+constexpr TransactionLogId kRestartedTransactionLogId{1000U};
+
+/// \brief The control structures of an event and of one consumer of the event, which has referenced all samples.
+///
+/// The TransactionLog of the consumer isn't registered in a TransactionLogSet, so that the benchmarks only measure the
+/// recording and rollback of the transactions.
+class EventWithConsumer
+{
+  public:
+    explicit EventWithConsumer(const SlotIndexType number_of_slots) noexcept
+        : memory_resource_{},
+          event_data_control_{number_of_slots, memory_resource_},
+          transaction_log_{number_of_slots, memory_resource_},
+          provider_{event_data_control_},
+          consumer_{event_data_control_, TransactionLogLocalView{transaction_log_}},
+          slot_indices_(number_of_slots),
+          time_stamps_(number_of_slots)
+    {
+        for (SlotIndexType slot = 0U; slot < number_of_slots; ++slot)
+        {
+            const auto slot_index = provider_.AllocateNextSlot();
+            SCORE_LANGUAGE_FUTURECPP_ASSERT(slot_index.has_value());
+            provider_.EventReady(slot_index.value(), static_cast<EventSlotStatus::EventTimeStamp>(slot + 1U));
+        }
+    }
+
+    /// \brief Subscribes and references all samples, like the first GetNewSamples() call of a proxy does.
+    /// \return The number of referenced samples.
+    std::size_t SubscribeAndReferenceAllSamples() noexcept
+    {
+        TransactionLogLocalView transaction_log_local_view{transaction_log_};
+        transaction_log_local_view.SubscribeTransactionBegin(slot_indices_.size());
+        transaction_log_local_view.SubscribeTransactionCommit();
+        return consumer_.ReferenceNextEvents(
+            0U,
+            score::cpp::span<SlotIndexType>{slot_indices_.data(), slot_indices_.size()},
+            score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps_.data(), time_stamps_.size()});
+    }
+
+    /// \brief Rolls back the TransactionLog, as a restarted proxy does for the log of its crashed predecessor.
+    bool Rollback() noexcept
+    {
+        TransactionLogLocalView transaction_log_local_view{transaction_log_};
+        const auto rollback_result = transaction_log_local_view.RollbackProxyElementLog(
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                consumer_.DereferenceEventWithoutTransactionLogging(slot_index);
+            },
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                return consumer_.IsEventReferenced(slot_index);
+            },
+            [](const TransactionLog::MaxSampleCountType) noexcept {});
+        return rollback_result.has_value();
+    }
+
+    TransactionLog& GetTransactionLog() noexcept
+    {
+        return transaction_log_;
+    }
+
+  private:
+    FakeMemoryResource memory_resource_;
+    EventDataControl event_data_control_;
+    TransactionLog transaction_log_;
+    ProviderEventDataControlLocalView<> provider_;
+    ConsumerEventDataControlLocalView<> consumer_;
+    std::vector<SlotIndexType> slot_indices_;
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps_;
+};
+
+/// \brief The control structures of an event of a service instance, to which a number of proxies (of different
+/// processes) are connected. Each of them has registered a TransactionLog in the TransactionLogSet of the event.
+class EventWithProxies
+{
+  public:
+    explicit EventWithProxies(const TransactionLogIndex number_of_proxies) noexcept
+        : memory_resource_{},
+          event_data_control_{kNumberOfSlotsPerEvent, memory_resource_},
+          transaction_log_set_{number_of_proxies, kNumberOfSlotsPerEvent, memory_resource_},
+          provider_{event_data_control_},
+          proxy_consumer_{event_data_control_},
+          tracing_consumer_{event_data_control_},
+          last_time_stamp_{0U}
+    {
+        // All proxies but the restarted one belong to other processes, which keep running.
+        for (TransactionLogIndex proxy = 1U; proxy < number_of_proxies; ++proxy)
+        {
+            ConnectProxy(kRestartedTransactionLogId + static_cast<TransactionLogId>(proxy));
+        }
+        SendSample();
+    }
+
+    /// \brief Connects the proxy, which crashes afterwards, while being subscribed and holding a sample.
+    void ConnectProxyOfRestartedProcess() noexcept
+    {
+        ConnectProxy(kRestartedTransactionLogId);
+        const auto slot_index = proxy_consumer_.ReferenceNextEvent(0U);
+        SCORE_LANGUAGE_FUTURECPP_ASSERT(slot_index.has_value());
+    }
+
+    /// \brief Rolls back the TransactionLog of the crashed proxy, as the TransactionLogRollbackExecutor does.
+    Result<void> RollbackProxyOfRestartedProcess() noexcept
+    {
+        transaction_log_set_.MarkTransactionLogsNeedRollback(kRestartedTransactionLogId);
+        return transaction_log_set_.RollbackProxyTransactions(
+            kRestartedTransactionLogId,
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                proxy_consumer_.DereferenceEventWithoutTransactionLogging(slot_index);
+            },
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                return proxy_consumer_.IsEventReferenced(slot_index);
+            },
+            [](const TransactionLog::MaxSampleCountType) noexcept {});
+    }
+
+    /// \brief Lets the provider crash while sending a sample with tracing enabled: The previous sample is still
+    /// referenced for tracing and the next slot is allocated for writing.
+    void CrashProviderWhileSending() noexcept
+    {
+        score::cpp::ignore = transaction_log_set_.RegisterSkeletonTracingElement(tracing_consumer_);
+        tracing_consumer_.ReferenceSpecificEvent(SendSample());
+        const auto slot_index = provider_.AllocateNextSlot();
+        SCORE_LANGUAGE_FUTURECPP_ASSERT(slot_index.has_value());
+    }
+
+    /// \brief Rolls back the tracing TransactionLog and the slot allocated for writing, as the restarted provider does
+    /// for each event before offering the service again.
+    bool RollbackProvider() noexcept
+    {
+        const auto rollback_result = transaction_log_set_.RollbackSkeletonTracingTransactions(
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                tracing_consumer_.DereferenceEventWithoutTransactionLogging(slot_index);
+            });
+        provider_.RemoveAllocationsForWriting();
+        return rollback_result.has_value();
+    }
+
+  private:
+    void ConnectProxy(const TransactionLogId transaction_log_id) noexcept
+    {
+        auto registration_guard = transaction_log_set_.RegisterProxyElement(transaction_log_id, proxy_consumer_);
+        SCORE_LANGUAGE_FUTURECPP_ASSERT(registration_guard.has_value());
+        TransactionLogLocalView transaction_log_local_view{
+            transaction_log_set_.GetTransactionLog(registration_guard.value().GetTransactionLogIndex())};
+        transaction_log_local_view.SubscribeTransactionBegin(1U);
+        transaction_log_local_view.SubscribeTransactionCommit();
+    }
+
+    SlotIndexType SendSample() noexcept
+    {
+        const auto slot_index = provider_.AllocateNextSlot();
+        SCORE_LANGUAGE_FUTURECPP_ASSERT(slot_index.has_value());
+        ++last_time_stamp_;
+        provider_.EventReady(slot_index.value(), last_time_stamp_);
+        return slot_index.value();
+    }
+
+    FakeMemoryResource memory_resource_;
+    EventDataControl event_data_control_;
+    TransactionLogSet transaction_log_set_;
+    ProviderEventDataControlLocalView<> provider_;
+    ConsumerEventDataControlLocalView<> proxy_consumer_;
+    ConsumerEventDataControlLocalView<> tracing_consumer_;
+    EventSlotStatus::EventTimeStamp last_time_stamp_;
+};
+
+/// \brief Creates the events of a service instance. The proxies (and the provider) don't unregister their
+/// TransactionLogs, as they are considered to be crashed.
+std::vector<std::unique_ptr<EventWithProxies>> CreateEvents(const std::size_t number_of_events,
+                                                            const TransactionLogIndex number_of_proxies)
+{
+    SetDeactiveDestructionOperation(true);
+    std::vector<std::unique_ptr<EventWithProxies>> events{};
+    events.reserve(number_of_events);
+    for (std::size_t event = 0U; event < number_of_events; ++event)
+    {
+        events.push_back(std::make_unique<EventWithProxies>(number_of_proxies));
+    }
+    return events;
+}
+
+/// \brief Restart of a consumer, which crashed while holding references to all samples: Rolling back the
+/// TransactionLog of the crashed consumer, subscribing again and referencing all samples again.
+void BM_ConsumerRestart(benchmark::State& state)
+{
+    const auto number_of_slots = static_cast<SlotIndexType>(state.range(0));
+    EventWithConsumer event{number_of_slots};
+    // The consumer crashes with all samples referenced, i.e. all of them are in-flight when it is restarted.
+    score::cpp::ignore = event.SubscribeAndReferenceAllSamples();
+
+    std::size_t number_of_failed_restarts{0U};
+    for (auto _ : state)
+    {
+        if (!event.Rollback())
+        {
+            ++number_of_failed_restarts;
+        }
+        // The restarted consumer ends up in the same state as the crashed one, which is rolled back in the next
+        // iteration.
+        benchmark::DoNotOptimize(event.SubscribeAndReferenceAllSamples());
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.counters["in_flight_references"] = static_cast<double>(number_of_slots);
+    state.counters["failed_restarts"] = static_cast<double>(number_of_failed_restarts);
+}
+
+/// \brief Time from committing a dereference transaction until another thread, which waits to reference the same slot
+/// in ReferenceTransactionBegin(), continues.
+void BM_WakeUpOnDereferenceCommit(benchmark::State& state)
+{
+    constexpr SlotIndexType kSlotIndex{0U};
+    EventWithConsumer event{1U};
+    TransactionLogLocalView transaction_log_local_view{event.GetTransactionLog()};
+    const auto& number_of_waiters = event.GetTransactionLog().number_of_transaction_end_waiters_;
+
+    for (auto _ : state)
+    {
+        // A thread is dereferencing the slot and has decremented the refcount, but hasn't committed the transaction.
+        transaction_log_local_view.ReferenceTransactionBegin(kSlotIndex);
+        transaction_log_local_view.ReferenceTransactionCommit(kSlotIndex);
+        transaction_log_local_view.DereferenceTransactionBegin(kSlotIndex);
+
+        std::atomic<std::chrono::steady_clock::time_point::rep> continued_at{0};
+        std::thread referencing_thread{[&transaction_log_local_view, &continued_at]() {
+            transaction_log_local_view.ReferenceTransactionBegin(kSlotIndex);
+            continued_at = std::chrono::steady_clock::now().time_since_epoch().count();
+        }};
+        while (static_cast<std::uint32_t>(number_of_waiters) == 0U)
+        {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(kBlockingTime);
+
+        const auto committed_at = std::chrono::steady_clock::now();
+        transaction_log_local_view.DereferenceTransactionCommit(kSlotIndex);
+        referencing_thread.join();
+
+        const std::chrono::steady_clock::duration wake_up_latency{continued_at.load() -
+                                                                  committed_at.time_since_epoch().count()};
+        state.SetIterationTime(std::chrono::duration<double>(wake_up_latency).count());
+        transaction_log_local_view.ReferenceTransactionAbort(kSlotIndex);
+    }
+}
+
+/// \brief Rollback of the TransactionLogs of a restarted proxy process, which was connected to all events of a service
+/// instance, to each of which many other proxies are connected as well.
+void BM_ProxyRestartRollback(benchmark::State& state)
+{
+    const auto number_of_events = static_cast<std::size_t>(state.range(0));
+    const auto events = CreateEvents(number_of_events, static_cast<TransactionLogIndex>(state.range(1)));
+    // The rollback is done sequentially, unless the benchmark opts in to the parallel rollback by an executor.
+    std::unique_ptr<concurrency::ThreadPool> rollback_executor{};
+    if (state.range(2) != 0)
+    {
+        rollback_executor = std::make_unique<concurrency::ThreadPool>(kNumberOfRollbackExecutorThreads);
+    }
+
+    std::size_t number_of_failed_restarts{0U};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (auto& event : events)
+        {
+            event->ConnectProxyOfRestartedProcess();
+        }
+        state.ResumeTiming();
+
+        const auto rollback_result = RollbackEvents(
+            number_of_events, rollback_executor.get(), [&events](const std::size_t event_index) noexcept {
+                return events.at(event_index)->RollbackProxyOfRestartedProcess();
+            });
+        if (!rollback_result.has_value())
+        {
+            ++number_of_failed_restarts;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.counters["failed_restarts"] = static_cast<double>(number_of_failed_restarts);
+}
+
+/// \brief Rollback, which a restarted provider does for all events of its service instance, before offering it again.
+void BM_ProviderRestartToOffer(benchmark::State& state)
+{
+    const auto events = CreateEvents(static_cast<std::size_t>(state.range(0)),
+                                     static_cast<TransactionLogIndex>(state.range(1)));
+
+    std::size_t number_of_failed_restarts{0U};
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (auto& event : events)
+        {
+            event->CrashProviderWhileSending();
+        }
+        state.ResumeTiming();
+
+        for (auto& event : events)
+        {
+            if (!event->RollbackProvider())
+            {
+                ++number_of_failed_restarts;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.counters["failed_restarts"] = static_cast<double>(number_of_failed_restarts);
+}
+
+BENCHMARK(BM_ConsumerRestart)->ArgName("slots")->RangeMultiplier(8)->Range(8, 4096)->Unit(benchmark::kMicrosecond);
+// Every iteration blocks the waiting thread for kBlockingTime, which isn't measured. So the number of iterations is
+// fixed, as the minimum benchmark time would otherwise take minutes to accumulate.
+BENCHMARK(BM_WakeUpOnDereferenceCommit)->UseManualTime()->Iterations(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ProxyRestartRollback)
+    ->ArgNames({"events", "proxies", "executor"})
+    ->ArgsProduct({{1, 16, 64}, {8, 64}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ProviderRestartToOffer)
+    ->ArgNames({"events", "proxies"})
+    ->ArgsProduct({{1, 16, 64}, {8, 64}})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::test
@@ -14,11 +14,12 @@
 
 #include "score/mw/com/impl/bindings/lola/control_slot_types.h"
 #include "score/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
 
 #include <score/assert.hpp>
 
+#include <algorithm>
 #include <atomic>
-#include <iostream>
 #include <limits>
 
 namespace score::mw::com::impl::lola
@@ -29,12 +30,48 @@ namespace
 
 constexpr auto MAX_REFERENCE_RETRIES = 100U;
 
+/// \brief Only uses the publish times of the provider, if there is one for each slot.
+score::cpp::span<const EventDataControl::EventPublishTimeSlotType> GetPublishTimeSlots(
+    const EventDataControl& event_data_control) noexcept
+{
+    if (event_data_control.publish_time_slots_.size() != event_data_control.state_slots_.size())
+    {
+        return {};
+    }
+    return {event_data_control.publish_time_slots_.begin(), event_data_control.publish_time_slots_.size()};
+}
+
+/// \brief Sorts the given slots from the newest event (largest timestamp) to the oldest one.
+void SortByDescendingTimeStamp(const score::cpp::span<SlotIndexType> slot_indices,
+                               const score::cpp::span<EventSlotStatus::EventTimeStamp> time_stamps) noexcept
+{
+    // Insertion sort, since there are only a few slots, which are mostly sorted already.
+    for (std::size_t sorted_end = 1U; sorted_end < slot_indices.size(); ++sorted_end)
+    {
+        const auto slot_index = slot_indices[sorted_end];
+        const auto time_stamp = time_stamps[sorted_end];
+        std::size_t position = sorted_end;
+        while ((position > 0U) && (time_stamps[position - 1U] < time_stamp))
+        {
+            slot_indices[position] = slot_indices[position - 1U];
+            time_stamps[position] = time_stamps[position - 1U];
+            --position;
+        }
+        slot_indices[position] = slot_index;
+        time_stamps[position] = time_stamp;
+    }
+}
+
 }  // namespace
 
 template <template <class> class AtomicIndirectorType>
 ConsumerEventDataControlLocalView<AtomicIndirectorType>::ConsumerEventDataControlLocalView(
     EventDataControl& event_data_control_shared) noexcept
-    : state_slots_{event_data_control_shared.state_slots_.begin(), event_data_control_shared.state_slots_.size()}
+    : state_slots_{event_data_control_shared.state_slots_.begin(), event_data_control_shared.state_slots_.size()},
+      publish_time_slots_{GetPublishTimeSlots(event_data_control_shared)},
+      transaction_log_local_view_{},
+      performance_counters_{nullptr},
+      traced_element_fq_id_{}
 {
 }
 
@@ -95,6 +132,7 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvent
 
         if (!possible_index.has_value())
         {
+            CountReference(counter, false);
             return {};  // no sample within searched timestamp range exists.
         }
 
@@ -127,24 +165,209 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvent
                 slot_value, candidate_slot_status_value, status_new_val, std::memory_order_acq_rel))
         {
             transaction_log_local_view_->ReferenceTransactionCommit(possible_index_value);
+            TraceReference(possible_index_value);
             break;
         }
         transaction_log_local_view_->ReferenceTransactionAbort(possible_index_value);
+        if (performance_counters_ != nullptr)
+        {
+            performance_counters_->CountReferenceCollision();
+        }
     }
 
-    num_ref_retries += counter;
+    const bool reference_failed{counter >= MAX_REFERENCE_RETRIES};
+    CountReference(counter, reference_failed);
 
-    if (counter < MAX_REFERENCE_RETRIES)
+    if (!reference_failed)
     {
         return possible_index;
     }
 
-    ++num_ref_misses;
-
     // if this happens it means we have a wrong configuration in the system, see doc-string
     return {};
 }
 
+template <template <class> class AtomicIndirectorType>
+auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvents(
+    const EventSlotStatus::EventTimeStamp last_search_time,
+    const score::cpp::span<SlotIndexType> slot_indices,
+    const score::cpp::span<EventSlotStatus::EventTimeStamp> time_stamps) noexcept -> std::size_t
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(slot_indices.size() == time_stamps.size());
+
+    // The referenced slots are compacted to the front of slot_indices / time_stamps and the candidates of a search are
+    // stored behind them. Within a search, this keeps their order, since a slot is never moved behind a candidate,
+    // which hasn't been processed yet.
+    std::size_t number_of_referenced_slots{0U};
+    // The batch is only begun, once there is a candidate, so that a pass without new events doesn't write the log.
+    bool is_reference_batch_open{false};
+    std::uint64_t search = 0U;
+    for (; search < MAX_REFERENCE_RETRIES; search++)
+    {
+        const std::size_t number_of_candidates =
+            FindNewestEvents(last_search_time,
+                             time_stamps.first(number_of_referenced_slots),
+                             slot_indices.subspan(number_of_referenced_slots),
+                             time_stamps.subspan(number_of_referenced_slots));
+        if (number_of_candidates == 0U)
+        {
+            break;
+        }
+
+        if (!is_reference_batch_open)
+        {
+            transaction_log_local_view_->ReferenceBatchTransactionBegin();
+            is_reference_batch_open = true;
+        }
+        // The candidates are marked before any of them is incremented, so that a rollback after a crash knows all the
+        // slots, which might have been incremented by this pass.
+        transaction_log_local_view_->ReferenceBatchTransactionAddSlots(
+            slot_indices.subspan(number_of_referenced_slots, number_of_candidates));
+
+        bool was_candidate_replaced{false};
+        const std::size_t candidates_end{number_of_referenced_slots + number_of_candidates};
+        for (std::size_t candidate = number_of_referenced_slots; candidate < candidates_end; ++candidate)
+        {
+            const auto slot_index = slot_indices[candidate];
+            const auto time_stamp = time_stamps[candidate];
+            const auto reference_result = TryReferenceSlot(slot_index, time_stamp);
+            if (reference_result == SlotReferenceResult::kReferenced)
+            {
+                slot_indices[number_of_referenced_slots] = slot_index;
+                time_stamps[number_of_referenced_slots] = time_stamp;
+                ++number_of_referenced_slots;
+            }
+            else if (reference_result == SlotReferenceResult::kEventReplaced)
+            {
+                was_candidate_replaced = true;
+            }
+        }
+
+        // A replaced candidate holds a newer event now (or will hold it, once the provider finished writing it) and
+        // there might be an older event, which didn't fit into slot_indices before. So we search again for the events,
+        // which haven't been referenced yet.
+        if ((!was_candidate_replaced) || (number_of_referenced_slots == slot_indices.size()))
+        {
+            break;
+        }
+    }
+
+    if (is_reference_batch_open)
+    {
+        transaction_log_local_view_->ReferenceBatchTransactionCommit(slot_indices.first(number_of_referenced_slots));
+    }
+
+    if (search > 0U)
+    {
+        SortByDescendingTimeStamp(slot_indices.first(number_of_referenced_slots),
+                                  time_stamps.first(number_of_referenced_slots));
+    }
+    return number_of_referenced_slots;
+}
+
+template <template <class> class AtomicIndirectorType>
+auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::FindNewestEvents(
+    const EventSlotStatus::EventTimeStamp last_search_time,
+    const score::cpp::span<const EventSlotStatus::EventTimeStamp> excluded_time_stamps,
+    const score::cpp::span<SlotIndexType> slot_indices,
+    const score::cpp::span<EventSlotStatus::EventTimeStamp> time_stamps) const noexcept -> std::size_t
+{
+    const std::size_t max_number_of_events = slot_indices.size();
+    if (max_number_of_events == 0U)
+    {
+        return 0U;
+    }
+
+    std::size_t number_of_events{0U};
+    SlotIndexType current_index = 0U;
+    // Suppres "AUTOSAR C++14 A5-3-2" finding rule. This rule states: "Null pointers shall not be dereferenced.".
+    // The "slot" variable must never be a null pointer, since DynamicArray allocates its elements when it is
+    // created.
+    // coverity[autosar_cpp14_a5_3_2_violation]
+    for (const auto& slot : state_slots_)
+    {
+        // coverity[autosar_cpp14_a5_3_2_violation]
+        const EventSlotStatus slot_status{slot.load(std::memory_order_relaxed)};
+        const auto time_stamp = slot_status.GetTimeStamp();
+        const bool is_newer_than_oldest_event =
+            (number_of_events < max_number_of_events) || (time_stamp > time_stamps[number_of_events - 1U]);
+        if (slot_status.IsTimeStampBetween(last_search_time, EventSlotStatus::TIMESTAMP_MAX) &&
+            is_newer_than_oldest_event &&
+            (std::find(excluded_time_stamps.begin(), excluded_time_stamps.end(), time_stamp) ==
+             excluded_time_stamps.end()))
+        {
+            // Insertion into the events sorted by descending time stamp. If all events are taken already, the oldest
+            // one is dropped.
+            std::size_t position = std::min(number_of_events, max_number_of_events - 1U);
+            while ((position > 0U) && (time_stamps[position - 1U] < time_stamp))
+            {
+                slot_indices[position] = slot_indices[position - 1U];
+                time_stamps[position] = time_stamps[position - 1U];
+                --position;
+            }
+            slot_indices[position] = current_index;
+            time_stamps[position] = time_stamp;
+            number_of_events = std::min(number_of_events + 1U, max_number_of_events);
+        }
+
+        // Suppress "AUTOSAR C++14 A4-7-1" rule finding. This rule states: "An integer expression shall
+        // not lead to data loss.".
+        // On construction of state_slots_, it is already assured, that the number of slots/size can never
+        // be larger than a SlotIndexType, so no way an overflow can happen.
+        // coverity[autosar_cpp14_a4_7_1_violation : FALSE]
+        ++current_index;
+    }
+    return number_of_events;
+}
+
+template <template <class> class AtomicIndirectorType>
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from 'state_slots_[]' which might leds to a segmentation fault
+// in case the index goes outside the range. As we already do an index check before accessing, so no way for
+// segmentation fault which leds to calling std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::TryReferenceSlot(
+    const SlotIndexType slot_index,
+    const EventSlotStatus::EventTimeStamp time_stamp) noexcept -> SlotReferenceResult
+{
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(static_cast<std::size_t>(slot_index) < state_slots_.size());
+    auto& slot_value = state_slots_[slot_index];
+    auto expected_value =
+        AtomicIndirectorType<EventSlotStatus::value_type>::load(slot_value, std::memory_order_relaxed);
+
+    std::uint64_t counter = 0U;
+    for (; counter < MAX_REFERENCE_RETRIES; counter++)
+    {
+        // The event might have been replaced by the provider since it has been found by FindNewestEvents().
+        const EventSlotStatus expected_status{expected_value};
+        if (expected_status.IsInWriting() || expected_status.IsInvalid() ||
+            (expected_status.GetTimeStamp() != time_stamp))
+        {
+            CountReference(counter, false);
+            return SlotReferenceResult::kEventReplaced;
+        }
+
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+            expected_value != std::numeric_limits<EventSlotStatus::value_type>::max(),
+            "EventDataControl::TryReferenceSlot failed: slot value reached the maximum value, an overflow dangerous");
+        // On failure, compare_exchange_weak updates expected_value with the current value of the slot.
+        if (AtomicIndirectorType<EventSlotStatus::value_type>::compare_exchange_weak(
+                slot_value, expected_value, expected_value + 1U, std::memory_order_acq_rel))
+        {
+            TraceReference(slot_index);
+            CountReference(counter, false);
+            return SlotReferenceResult::kReferenced;
+        }
+        if (performance_counters_ != nullptr)
+        {
+            performance_counters_->CountReferenceCollision();
+        }
+    }
+
+    CountReference(counter, true);
+    return SlotReferenceResult::kRetriesExhausted;
+}
+
 template <template <class> class AtomicIndirectorType>
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". std::terminate() is implicitly called from 'state_slots_[]' which might leds to a segmentation fault
@@ -252,24 +475,43 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::operator[](const S
 }
 
 template <template <class> class AtomicIndirectorType>
-auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::DumpPerformanceCounters() -> void
+auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::IsEventReferenced(
+    const SlotIndexType slot_index) const noexcept -> bool
+{
+    const EventSlotStatus slot_status{operator[](slot_index)};
+    return (!slot_status.IsInWriting()) && (!slot_status.IsInvalid()) && (slot_status.GetReferenceCount() != 0U);
+}
+
+template <template <class> class AtomicIndirectorType>
+auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::GetPublishTime(
+    const SlotIndexType slot_index) const noexcept -> std::optional<EventPublishTime>
 {
-    std::cout << "EventDataControl performance breakdown\n"
-              << "======================================\n"
-              << "\nnum_ref_misses     " << num_ref_misses << "\nnum_ref_retries:   "
-              << num_ref_retries
-              // Suppress AUTOSAR C++14 M8-4-4, rule finding: "A function identifier shall either be used to call the
-              // function or it shall be preceded by &". Passing std::endl to std::cout object with the stream operator
-              // follows the idiomatic way that both features in conjunction were designed in the C++ standard.
-              // coverity[autosar_cpp14_m8_4_4_violation : FALSE]
-              << std::endl;
+    if (static_cast<std::size_t>(slot_index) >= publish_time_slots_.size())
+    {
+        return {};
+    }
+    return publish_time_slots_[slot_index].load(std::memory_order_relaxed);
 }
 
 template <template <class> class AtomicIndirectorType>
-auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ResetPerformanceCounters() -> void
+void ConsumerEventDataControlLocalView<AtomicIndirectorType>::CountReference(const std::uint64_t retry_counter,
+                                                                             const bool reference_failed) noexcept
 {
-    num_ref_misses.store(0U);
-    num_ref_retries.store(0U);
+    if (performance_counters_ != nullptr)
+    {
+        performance_counters_->CountReference(retry_counter, reference_failed);
+    }
+}
+
+template <template <class> class AtomicIndirectorType>
+void ConsumerEventDataControlLocalView<AtomicIndirectorType>::TraceReference(
+    const SlotIndexType slot_index) const noexcept
+{
+    if (traced_element_fq_id_.has_value())
+    {
+        tracing::TraceRecorder::Record(
+            tracing::TracePointType::kProxyEventSampleCollected, traced_element_fq_id_.value(), slot_index);
+    }
 }
 
 template class ConsumerEventDataControlLocalView<memory::shared::AtomicIndirectorReal>;
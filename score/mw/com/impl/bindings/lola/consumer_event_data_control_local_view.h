@@ -14,7 +14,9 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_CONSUMER_EVENT_DATA_CONTROL_LOCAL_VIEW_H
 
 #include "score/mw/com/impl/bindings/lola/control_slot_types.h"
+#include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/event_data_control.h"
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
 #include "score/mw/com/impl/bindings/lola/event_slot_status.h"
 
 #include "score/memory/shared/atomic_indirector.h"
@@ -53,6 +55,7 @@ class ConsumerEventDataControlLocalView final
 
   public:
     using LocalEventControlSlots = score::cpp::span<ControlSlotType>;
+    using LocalEventPublishTimeSlots = score::cpp::span<const EventDataControl::EventPublishTimeSlotType>;
 
     ConsumerEventDataControlLocalView(EventDataControl& event_data_control_shared) noexcept;
 
@@ -87,6 +90,26 @@ class ConsumerEventDataControlLocalView final
         const EventSlotStatus::EventTimeStamp last_search_time,
         const EventSlotStatus::EventTimeStamp upper_limit = EventSlotStatus::TIMESTAMP_MAX) noexcept;
 
+    /// \brief Batched variant of ReferenceNextEvent(): References the newest events with a timestamp larger than
+    ///        last_search_time, up to the size of slot_indices.
+    ///
+    /// \details The candidate slots are searched in a single scan first, without modifying anything. Afterwards they
+    /// are referenced within one reference batch transaction of the TransactionLog: The batch is begun and the
+    /// candidates are marked in it, then their reference counts are incremented without recording anything per slot
+    /// and finally the batch is committed once for all referenced slots. If a candidate can't be referenced, e.g.
+    /// since the provider replaced its event in the meantime, the slots are searched again for the events, which
+    /// haven't been referenced yet, within the same batch. Like ReferenceNextEvent(), retries are made (bounded) on
+    /// data-races.
+    ///
+    /// \param last_search_time The time stamp of the newest event, which has already been referenced before.
+    /// \param slot_indices Receives the indices of the referenced slots, newest/youngest event first.
+    /// \param time_stamps Receives the time stamps of the referenced slots. Must have the same size as slot_indices.
+    /// \return The number of referenced slots, i.e. of the valid elements at the front of slot_indices / time_stamps.
+    /// \post DereferenceEvent() is invoked for each referenced slot to withdraw read-ownership
+    std::size_t ReferenceNextEvents(const EventSlotStatus::EventTimeStamp last_search_time,
+                                    const score::cpp::span<SlotIndexType> slot_indices,
+                                    const score::cpp::span<EventSlotStatus::EventTimeStamp> time_stamps) noexcept;
+
     /// \brief Increments refcount of given slot by one (given it is in the correct state i.e. being accessible/
     ///        readable)
     /// \details This is a specific feature - not used by the standard proxy/consumer, which is using
@@ -121,18 +144,45 @@ class ConsumerEventDataControlLocalView final
     /// TransactionLog::RollbackIncrementTransactions resp. RollbackSubscribeTransactions before calling the callback.
     void DereferenceEventWithoutTransactionLogging(const SlotIndexType event_slot_index) noexcept;
 
+    /// \brief Returns whether the given slot contains an event, which is referenced by any consumer.
+    /// \details Used by the rollback of a reference batch transaction, see
+    ///          TransactionLogLocalView::RollbackProxyElementLog().
+    bool IsEventReferenced(const SlotIndexType slot_index) const noexcept;
+
     /// \brief Directly access EventSlotStatus for one specific slot
     EventSlotStatus operator[](const SlotIndexType slot_index) const noexcept;
 
+    /// \brief Returns the publish time of the sample in the given slot, if the provider records publish times.
+    /// \pre The slot is referenced by the caller, i.e. its sample can't be replaced concurrently.
+    std::optional<EventPublishTime> GetPublishTime(const SlotIndexType slot_index) const noexcept;
+
+    /// \brief Returns whether the provider records the publish times of its samples.
+    bool HasPublishTimes() const noexcept
+    {
+        return !publish_time_slots_.empty();
+    }
+
     /// \brief Returns the max sample slots set on creation of EventDataControl
     std::size_t GetMaxSampleSlots() const noexcept
     {
         return state_slots_.size();
     }
 
-    // helper for performance indication (no production usage)
-    static void DumpPerformanceCounters();
-    static void ResetPerformanceCounters();
+    /// \brief Sets the counters of the ProxyEvent using this view, which are updated by ReferenceNextEvent().
+    ///
+    /// \details Has to be called before the first call to ReferenceNextEvent() (i.e. before subscribing) and the
+    /// counters have to outlive this view or be unset by calling this function with a nullptr.
+    void SetPerformanceCounters(ProxyEventPerformanceCounters* const performance_counters) noexcept
+    {
+        performance_counters_ = performance_counters;
+    }
+
+    /// \brief Sets the id of the event, under which ReferenceNextEvent() and ReferenceNextEvents() record each
+    /// referenced slot with the tracing::TraceRecorder. Nothing is recorded, as long as no id has been set.
+    void SetTracedElementFqId(const ElementFqId element_fq_id) noexcept
+    {
+        traced_element_fq_id_ = element_fq_id;
+    }
 
   private:
     /// \brief Sets the cached TransactionLogLocalView which is used to avoid looking up the log directly in shared
@@ -152,8 +202,37 @@ class ConsumerEventDataControlLocalView final
         transaction_log_local_view_.reset();
     }
 
+    /// \brief Stores the indices and time stamps of the newest events with a timestamp larger than last_search_time, up
+    ///        to the size of slot_indices, newest first. Events with one of the excluded_time_stamps are ignored.
+    /// \return The number of stored events.
+    std::size_t FindNewestEvents(const EventSlotStatus::EventTimeStamp last_search_time,
+                                 const score::cpp::span<const EventSlotStatus::EventTimeStamp> excluded_time_stamps,
+                                 const score::cpp::span<SlotIndexType> slot_indices,
+                                 const score::cpp::span<EventSlotStatus::EventTimeStamp> time_stamps) const noexcept;
+
+    enum class SlotReferenceResult : std::uint8_t
+    {
+        kReferenced,
+        kEventReplaced,
+        kRetriesExhausted,
+    };
+
+    /// \brief Increments the refcount of the given slot, as long as it still contains the event with the given time
+    ///        stamp. Doesn't record anything in the TransactionLog.
+    SlotReferenceResult TryReferenceSlot(const SlotIndexType slot_index,
+                                         const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
+
+    /// \brief Updates the performance counters (if any) for a slot reference attempt.
+    void CountReference(const std::uint64_t retry_counter, const bool reference_failed) noexcept;
+
+    /// \brief Records the referenced slot with the tracing::TraceRecorder, if a traced id has been set.
+    void TraceReference(const SlotIndexType slot_index) const noexcept;
+
     LocalEventControlSlots state_slots_;
 
+    /// \brief Publish times of the slots. Empty, if the provider doesn't record publish times.
+    LocalEventPublishTimeSlots publish_time_slots_;
+
     /// \brief Cached TransactionLogLocalView used by a ProxyEvent (and SkeletonEvent when tracing is enabled) to avoid
     /// looking up the log in the TransactionLogSet.
     ///
@@ -163,9 +242,9 @@ class ConsumerEventDataControlLocalView final
     /// construction.
     std::optional<TransactionLogLocalView> transaction_log_local_view_;
 
-    // helper variables to calculated performance indicators
-    static inline std::atomic_uint_fast64_t num_ref_misses{0U};
-    static inline std::atomic_uint_fast64_t num_ref_retries{0U};
+    ProxyEventPerformanceCounters* performance_counters_;
+
+    std::optional<ElementFqId> traced_element_fq_id_;
 };
 
 }  // namespace score::mw::com::impl::lola
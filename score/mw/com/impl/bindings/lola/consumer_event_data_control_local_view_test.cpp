@@ -16,6 +16,8 @@
 #include "score/mw/com/impl/bindings/lola/event_slot_status.h"
 #include "score/mw/com/impl/bindings/lola/provider_event_data_control_local_view.h"
 #include "score/mw/com/impl/bindings/lola/test_doubles/fake_memory_resource.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recording_decoder.h"
 #include "score/mw/com/impl/configuration/lola_event_instance_deployment.h"
 
 #include "score/memory/shared/atomic_indirector.h"
@@ -26,10 +28,12 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cstdio>
 #include <limits>
 #include <mutex>
 #include <random>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace score::mw::com::impl::lola
@@ -71,6 +75,17 @@ class AtomicIndirectorMockGuard final
     }
 };
 
+/// \brief State of the control slots and the TransactionLog in shared memory, which a crashing consumer leaves behind.
+struct CrashState
+{
+    std::vector<EventSlotStatus::value_type> slot_values;
+    std::vector<std::pair<bool, bool>> log_slot_transactions;
+    std::pair<bool, bool> subscribe_transactions;
+    score::cpp::optional<TransactionLog::MaxSampleCountType> subscription_max_sample_count;
+    bool is_reference_batch_open;
+    std::vector<TransactionLog::ReferenceBatchWord> reference_batch_words;
+};
+
 class ConsumerEventDataControlLocalViewFixture : public ::testing::Test
 {
   public:
@@ -91,10 +106,11 @@ class ConsumerEventDataControlLocalViewFixture : public ::testing::Test
     }
 
     ConsumerEventDataControlLocalViewFixture& GivenAConsumerEventDataControlLocalViewUsingRealAtomics(
-        const SlotIndexType max_slots)
+        const SlotIndexType max_slots,
+        const bool with_publish_times = false)
     {
         auto& transaction_log = transaction_log_.emplace(max_slots, memory_);
-        event_data_control_ = std::make_unique<EventDataControl>(max_slots, memory_);
+        event_data_control_ = std::make_unique<EventDataControl>(max_slots, memory_, with_publish_times);
         unit_ = std::make_unique<ConsumerEventDataControlLocalView<>>(*event_data_control_, transaction_log);
         provider_event_data_control_local_ =
             std::make_unique<ProviderEventDataControlLocalView<>>(*event_data_control_);
@@ -129,6 +145,52 @@ class ConsumerEventDataControlLocalViewFixture : public ::testing::Test
         return slot_index.value();
     }
 
+    CrashState TakeCrashState() const
+    {
+        CrashState crash_state{};
+        for (const auto& slot : event_data_control_->state_slots_)
+        {
+            crash_state.slot_values.push_back(slot.load());
+        }
+        for (const auto& log_slot : transaction_log_->reference_count_slots_)
+        {
+            crash_state.log_slot_transactions.emplace_back(log_slot.GetTransactionBegin(),
+                                                           log_slot.GetTransactionEnd());
+        }
+        crash_state.subscribe_transactions = {transaction_log_->subscribe_transactions_.GetTransactionBegin(),
+                                              transaction_log_->subscribe_transactions_.GetTransactionEnd()};
+        crash_state.subscription_max_sample_count = transaction_log_->subscription_max_sample_count_;
+        crash_state.is_reference_batch_open = transaction_log_->reference_batch_transaction_.GetTransactionBegin();
+        for (const auto& word : transaction_log_->reference_batch_slots_)
+        {
+            crash_state.reference_batch_words.push_back(word.GetUnderlying().load());
+        }
+        return crash_state;
+    }
+
+    void RestoreCrashState(const CrashState& crash_state)
+    {
+        for (std::size_t slot_index = 0U; slot_index < crash_state.slot_values.size(); ++slot_index)
+        {
+            event_data_control_->state_slots_.at(slot_index).store(crash_state.slot_values.at(slot_index));
+        }
+        for (std::size_t slot_index = 0U; slot_index < crash_state.log_slot_transactions.size(); ++slot_index)
+        {
+            auto& log_slot = transaction_log_->reference_count_slots_.at(slot_index);
+            log_slot.SetTransactionBegin(crash_state.log_slot_transactions.at(slot_index).first);
+            log_slot.SetTransactionEnd(crash_state.log_slot_transactions.at(slot_index).second);
+        }
+        transaction_log_->subscribe_transactions_.SetTransactionBegin(crash_state.subscribe_transactions.first);
+        transaction_log_->subscribe_transactions_.SetTransactionEnd(crash_state.subscribe_transactions.second);
+        transaction_log_->subscription_max_sample_count_ = crash_state.subscription_max_sample_count;
+        transaction_log_->reference_batch_transaction_.SetTransactionBegin(crash_state.is_reference_batch_open);
+        for (std::size_t word_index = 0U; word_index < crash_state.reference_batch_words.size(); ++word_index)
+        {
+            transaction_log_->reference_batch_slots_.at(word_index).GetUnderlying().store(
+                crash_state.reference_batch_words.at(word_index));
+        }
+    }
+
     FakeMemoryResource memory_{};
     std::unique_ptr<memory::shared::AtomicMock<EventSlotStatus::value_type>> atomic_mock_{nullptr};
 
@@ -155,6 +217,46 @@ TEST_F(ConsumerEventDataControlLocalViewFixture, FindNextSlotBlocksAllocation)
     ASSERT_FALSE(provider_event_data_control_local_->AllocateNextSlot().has_value());
 }
 
+TEST_F(ConsumerEventDataControlLocalViewFixture, ReturnsThePublishTimeOfAReferencedSlot)
+{
+    // Given an EventDataControl with publish time slots and one ready slot
+    const auto time_before_event_ready = GetCurrentEventPublishTime();
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(2, true).WithAnAllocatedSlot(1);
+
+    // When referencing the slot
+    const auto slot = unit_->ReferenceNextEvent(0);
+    ASSERT_TRUE(slot.has_value());
+
+    // Then the view has publish times
+    EXPECT_TRUE(unit_->HasPublishTimes());
+
+    // and the publish time of the slot is the time, at which the provider marked it as ready
+    const auto publish_time = unit_->GetPublishTime(slot.value());
+    ASSERT_TRUE(publish_time.has_value());
+    EXPECT_GE(publish_time.value(), time_before_event_ready);
+    EXPECT_LE(publish_time.value(), GetCurrentEventPublishTime());
+
+    unit_->DereferenceEvent(slot.value());
+}
+
+TEST_F(ConsumerEventDataControlLocalViewFixture, ReturnsNoPublishTimeIfTheProviderDoesNotRecordPublishTimes)
+{
+    // Given an EventDataControl without publish time slots and one ready slot
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(2, false).WithAnAllocatedSlot(1);
+
+    // When referencing the slot
+    const auto slot = unit_->ReferenceNextEvent(0);
+    ASSERT_TRUE(slot.has_value());
+
+    // Then the view has no publish times
+    EXPECT_FALSE(unit_->HasPublishTimes());
+
+    // and the slot has no publish time
+    EXPECT_FALSE(unit_->GetPublishTime(slot.value()).has_value());
+
+    unit_->DereferenceEvent(slot.value());
+}
+
 // Re-enable when the test is fixed in Ticket-128552
 TEST_F(ConsumerEventDataControlLocalViewFixture, DISABLED_MultipleReceiverRefCountCheck)
 {
@@ -216,6 +318,381 @@ TEST_F(ConsumerEventDataControlLocalViewFixture, FailingToUpdateSlotValueCausesR
     // No event will be found
     ASSERT_FALSE(event.has_value());
 }
+
+TEST_F(ConsumerEventDataControlLocalViewFixture, FailingToUpdateSlotValueIsCountedAsCollisionsAndFailedReference)
+{
+    constexpr auto max_reference_retries{100U};
+
+    GivenAConsumerEventDataControlLocalViewUsingMockedAtomics(1);
+    ProxyEventPerformanceCounters performance_counters{};
+    unit_with_mock_atomics_->SetPerformanceCounters(&performance_counters);
+
+    // Given the operation to update the slot value always fails
+    EXPECT_CALL(*atomic_mock_, compare_exchange_weak(_, _, _)).WillRepeatedly(Return(false));
+
+    // and a EventDataControlUnit with one ready slot
+    auto slot = provider_event_data_control_local_->AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+    provider_event_data_control_local_->EventReady(slot.value(), 1);
+
+    // When finding the next slot
+    score::cpp::ignore = unit_with_mock_atomics_->ReferenceNextEvent(0);
+
+    // Then every retry is counted as collision and the reference is counted as failed
+    const auto values = performance_counters.GetValues();
+    EXPECT_EQ(values.number_of_reference_retries, kEventPerformanceCountersCompiledIn ? max_reference_retries : 0U);
+    EXPECT_EQ(values.number_of_reference_collisions, kEventPerformanceCountersCompiledIn ? max_reference_retries : 0U);
+    EXPECT_EQ(values.number_of_reference_failures, kEventPerformanceCountersCompiledIn ? 1U : 0U);
+}
+
+TEST_F(ConsumerEventDataControlLocalViewFixture, SuccessfulReferenceIsNotCountedAsFailed)
+{
+    // Given an EventDataControl with one ready slot and performance counters
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(1).WithAnAllocatedSlot(1);
+    ProxyEventPerformanceCounters performance_counters{};
+    unit_->SetPerformanceCounters(&performance_counters);
+
+    // When finding the next slot twice, where the second search doesn't find a newer slot
+    ASSERT_TRUE(unit_->ReferenceNextEvent(0).has_value());
+    ASSERT_FALSE(unit_->ReferenceNextEvent(1).has_value());
+
+    // Then neither retries, collisions nor failures are counted
+    const auto values = performance_counters.GetValues();
+    EXPECT_EQ(values.number_of_reference_retries, 0U);
+    EXPECT_EQ(values.number_of_reference_collisions, 0U);
+    EXPECT_EQ(values.number_of_reference_failures, 0U);
+}
+
+using ConsumerEventDataControlLocalViewReferenceNextEventsFixture = ConsumerEventDataControlLocalViewFixture;
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture, ReferencesTheNewestEventsNewestFirst)
+{
+    // Given an EventDataControl with four ready slots
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(5);
+    const std::vector<SlotIndexType> slots{
+        WithAnAllocatedSlot(1), WithAnAllocatedSlot(2), WithAnAllocatedSlot(3), WithAnAllocatedSlot(4)};
+
+    // When referencing at most three new events
+    std::vector<SlotIndexType> slot_indices(3U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(3U);
+    const auto number_of_referenced_slots = unit_->ReferenceNextEvents(
+        0U,
+        score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()});
+
+    // Then the three newest events are referenced, newest first
+    ASSERT_EQ(number_of_referenced_slots, 3U);
+    EXPECT_EQ(time_stamps, (std::vector<EventSlotStatus::EventTimeStamp>{4U, 3U, 2U}));
+    EXPECT_EQ(slot_indices, (std::vector<SlotIndexType>{slots.at(3U), slots.at(2U), slots.at(1U)}));
+    for (const auto slot_index : slot_indices)
+    {
+        EXPECT_EQ((*unit_)[slot_index].GetReferenceCount(), 1U);
+    }
+
+    // and the oldest event is not referenced
+    EXPECT_EQ((*unit_)[slots.at(0U)].GetReferenceCount(), 0U);
+
+    for (const auto slot_index : slot_indices)
+    {
+        unit_->DereferenceEvent(slot_index);
+    }
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture, DoesNotReferenceEventsFromThePast)
+{
+    // Given an EventDataControl with two ready slots
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(3);
+    const auto older_slot = WithAnAllocatedSlot(1);
+    const auto newer_slot = WithAnAllocatedSlot(2);
+
+    // When referencing new events, which are newer than the older event
+    std::vector<SlotIndexType> slot_indices(3U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(3U);
+    const auto number_of_referenced_slots = unit_->ReferenceNextEvents(
+        1U,
+        score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()});
+
+    // Then only the newer event is referenced
+    ASSERT_EQ(number_of_referenced_slots, 1U);
+    EXPECT_EQ(slot_indices.at(0U), newer_slot);
+    EXPECT_EQ(time_stamps.at(0U), 2U);
+    EXPECT_EQ((*unit_)[older_slot].GetReferenceCount(), 0U);
+
+    // and when referencing new events, which are newer than the newer event
+    // Then no event is referenced
+    EXPECT_EQ(unit_->ReferenceNextEvents(
+                  2U,
+                  score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+                  score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()}),
+              0U);
+
+    unit_->DereferenceEvent(newer_slot);
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture,
+       SearchesAgainIfAnEventIsReplacedBeforeItIsReferenced)
+{
+    GivenAConsumerEventDataControlLocalViewUsingMockedAtomics(1);
+
+    // Given a EventDataControlUnit with one ready slot
+    const auto slot = WithAnAllocatedSlot(1);
+
+    // and given that the provider seems to replace the event before the slot is referenced for the first time
+    EXPECT_CALL(*atomic_mock_, load(_))
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{2U, 0U})))
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{1U, 0U})));
+
+    // Expecting that the slot is only tried to be referenced after searching it again
+    EXPECT_CALL(*atomic_mock_, compare_exchange_weak(_, _, _)).WillOnce(Return(true));
+
+    // When referencing new events
+    std::vector<SlotIndexType> slot_indices(1U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(1U);
+    const auto number_of_referenced_slots = unit_with_mock_atomics_->ReferenceNextEvents(
+        0U,
+        score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()});
+
+    // Then the event is referenced
+    ASSERT_EQ(number_of_referenced_slots, 1U);
+    EXPECT_EQ(slot_indices.at(0U), slot);
+    EXPECT_EQ(time_stamps.at(0U), 1U);
+
+    // and the transaction log records the reference
+    EXPECT_TRUE(transaction_log_->reference_count_slots_.at(slot).GetTransactionBegin());
+    EXPECT_TRUE(transaction_log_->reference_count_slots_.at(slot).GetTransactionEnd());
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture,
+       ReferencesTheNewerEventsFoundBySearchingAgainNewestFirst)
+{
+    GivenAConsumerEventDataControlLocalViewUsingMockedAtomics(3);
+
+    // Given a EventDataControlUnit with two ready slots
+    const auto older_slot = WithAnAllocatedSlot(1);
+    const auto newer_slot = WithAnAllocatedSlot(2);
+
+    // and given that the newer event seems to be replaced before it is referenced, while the provider sends a third
+    // event
+    SlotIndexType newest_slot{};
+    EXPECT_CALL(*atomic_mock_, load(_))
+        .WillOnce([this, &newest_slot](auto) {
+            newest_slot = WithAnAllocatedSlot(3);
+            return static_cast<EventSlotStatus::value_type>(EventSlotStatus{4U, 0U});
+        })
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{1U, 0U})))
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{3U, 0U})))
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{2U, 0U})));
+    EXPECT_CALL(*atomic_mock_, compare_exchange_weak(_, _, _)).Times(3).WillRepeatedly(Return(true));
+
+    // When referencing at most three new events
+    std::vector<SlotIndexType> slot_indices(3U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(3U);
+    const auto number_of_referenced_slots = unit_with_mock_atomics_->ReferenceNextEvents(
+        0U,
+        score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()});
+
+    // Then all three events are referenced, newest first
+    ASSERT_EQ(number_of_referenced_slots, 3U);
+    EXPECT_EQ(time_stamps, (std::vector<EventSlotStatus::EventTimeStamp>{3U, 2U, 1U}));
+    EXPECT_EQ(slot_indices, (std::vector<SlotIndexType>{newest_slot, newer_slot, older_slot}));
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture,
+       FailingToUpdateSlotValueIsCountedAsCollisionsAndFailedReference)
+{
+    constexpr auto max_reference_retries{100U};
+
+    GivenAConsumerEventDataControlLocalViewUsingMockedAtomics(1);
+    ProxyEventPerformanceCounters performance_counters{};
+    unit_with_mock_atomics_->SetPerformanceCounters(&performance_counters);
+
+    // Given a EventDataControlUnit with one ready slot
+    auto slot = provider_event_data_control_local_->AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+    provider_event_data_control_local_->EventReady(slot.value(), 1);
+    EXPECT_CALL(*atomic_mock_, load(_))
+        .WillOnce(Return(static_cast<EventSlotStatus::value_type>(EventSlotStatus{1U, 0U})));
+
+    // and given the operation to update the slot value always fails
+    EXPECT_CALL(*atomic_mock_, compare_exchange_weak(_, _, _))
+        .Times(max_reference_retries)
+        .WillRepeatedly(Return(false));
+
+    // When referencing new events
+    std::vector<SlotIndexType> slot_indices(1U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(1U);
+    const auto number_of_referenced_slots = unit_with_mock_atomics_->ReferenceNextEvents(
+        0U,
+        score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()});
+
+    // Then no event is referenced
+    EXPECT_EQ(number_of_referenced_slots, 0U);
+
+    // and every retry is counted as collision and the reference is counted as failed
+    const auto values = performance_counters.GetValues();
+    EXPECT_EQ(values.number_of_reference_retries, kEventPerformanceCountersCompiledIn ? max_reference_retries : 0U);
+    EXPECT_EQ(values.number_of_reference_collisions, kEventPerformanceCountersCompiledIn ? max_reference_retries : 0U);
+    EXPECT_EQ(values.number_of_reference_failures, kEventPerformanceCountersCompiledIn ? 1U : 0U);
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture, RecordsEachReferencedSlotWithTheTraceRecorder)
+{
+    const std::string recording_path{"/tmp/lola_consumer_event_data_control_local_view_test.bin"};
+    const ElementFqId element_fq_id{1U, 2U, 3U, ServiceElementType::EVENT};
+
+    // Given an EventDataControl with three ready slots, whose view traces its references, and a started TraceRecorder
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(4);
+    const std::vector<SlotIndexType> slots{WithAnAllocatedSlot(1), WithAnAllocatedSlot(2), WithAnAllocatedSlot(3)};
+    unit_->SetTracedElementFqId(element_fq_id);
+    ASSERT_TRUE(tracing::TraceRecorder::Instance()
+                    .Start(recording_path, tracing::TraceRecorder::Settings{16U, std::chrono::milliseconds{1000}})
+                    .has_value());
+
+    // When referencing the two newest events in one pass and the oldest one by a single reference
+    std::vector<SlotIndexType> slot_indices(2U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(2U);
+    ASSERT_EQ(unit_->ReferenceNextEvents(
+                  0U,
+                  score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+                  score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()}),
+              2U);
+    const auto oldest_slot_index = unit_->ReferenceNextEvent(0U, 2U);
+    ASSERT_TRUE(oldest_slot_index.has_value());
+    tracing::TraceRecorder::Instance().Stop();
+
+    // Then each referenced slot has been recorded as collected sample of the event in the order of the references
+    const auto recording = tracing::ReadTraceRecording(recording_path);
+    score::cpp::ignore = std::remove(recording_path.c_str());
+    ASSERT_TRUE(recording.has_value());
+    std::vector<SlotIndexType> recorded_slot_indices{};
+    for (const auto& record : recording.value().records)
+    {
+        EXPECT_EQ(record.trace_point_type,
+                  static_cast<std::uint8_t>(tracing::TracePointType::kProxyEventSampleCollected));
+        EXPECT_EQ(record.service_id, element_fq_id.service_id_);
+        EXPECT_EQ(record.element_id, element_fq_id.element_id_);
+        recorded_slot_indices.push_back(record.slot_index);
+    }
+    EXPECT_EQ(recorded_slot_indices, (std::vector<SlotIndexType>{slots.at(2U), slots.at(1U), slots.at(0U)}));
+
+    for (const auto slot_index : slot_indices)
+    {
+        unit_->DereferenceEvent(slot_index);
+    }
+    unit_->DereferenceEvent(oldest_slot_index.value());
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture, RollbackAfterACrashAtAnyStepOfThePassIsSafe)
+{
+    GivenAConsumerEventDataControlLocalViewUsingMockedAtomics(3);
+
+    // Given an EventDataControl with three ready slots
+    const std::vector<SlotIndexType> slots{WithAnAllocatedSlot(1), WithAnAllocatedSlot(2), WithAnAllocatedSlot(3)};
+
+    // and a consumer with a recorded subscription
+    TransactionLogLocalView transaction_log_local_view{*transaction_log_};
+    transaction_log_local_view.SubscribeTransactionBegin(slots.size());
+    transaction_log_local_view.SubscribeTransactionCommit();
+
+    // and given that the shared memory state is recorded at every step of the pass: after the batch is begun (i.e.
+    // when the first candidate is loaded for referencing it) and after each slot increment
+    const std::vector<SlotIndexType> reference_order{slots.at(2U), slots.at(1U), slots.at(0U)};
+    std::vector<CrashState> crash_states{};
+    std::size_t number_of_loads{0U};
+    std::size_t number_of_increments{0U};
+    EXPECT_CALL(*atomic_mock_, load(_)).Times(3).WillRepeatedly([&, this](std::memory_order) {
+        if (number_of_loads == 0U)
+        {
+            crash_states.push_back(TakeCrashState());
+        }
+        return event_data_control_->state_slots_.at(reference_order.at(number_of_loads++)).load();
+    });
+    EXPECT_CALL(*atomic_mock_, compare_exchange_weak(_, _, _))
+        .Times(3)
+        .WillRepeatedly([&, this](EventSlotStatus::value_type& expected,
+                                  const EventSlotStatus::value_type desired,
+                                  std::memory_order) {
+            const bool is_exchanged = event_data_control_->state_slots_.at(reference_order.at(number_of_increments++))
+                                          .compare_exchange_strong(expected, desired);
+            crash_states.push_back(TakeCrashState());
+            return is_exchanged;
+        });
+
+    // When referencing the new events
+    std::vector<SlotIndexType> slot_indices(3U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(3U);
+    ASSERT_EQ(unit_with_mock_atomics_->ReferenceNextEvents(
+                  0U,
+                  score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+                  score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()}),
+              3U);
+
+    // and recording the state after the batch is committed
+    crash_states.push_back(TakeCrashState());
+    ASSERT_EQ(crash_states.size(), 5U);
+
+    for (std::size_t crash_step = 0U; crash_step < crash_states.size(); ++crash_step)
+    {
+        // and when the consumer crashes at the given step and its log is rolled back by the restarted consumer
+        const auto& crash_state = crash_states.at(crash_step);
+        RestoreCrashState(crash_state);
+        const auto rollback_result = TransactionLogLocalView{*transaction_log_}.RollbackProxyElementLog(
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                unit_with_mock_atomics_->DereferenceEventWithoutTransactionLogging(slot_index);
+            },
+            [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+                return unit_with_mock_atomics_->IsEventReferenced(slot_index);
+            },
+            [](const TransactionLog::MaxSampleCountType) noexcept {});
+
+        // Then the rollback succeeds before the first increment and after the commit, while it fails in between,
+        // since an incremented slot of the open batch can't be attributed to the crashed consumer
+        const bool has_unrecorded_increment{(crash_step > 0U) && (crash_step < (crash_states.size() - 1U))};
+        EXPECT_EQ(rollback_result.has_value(), !has_unrecorded_increment) << "crash step: " << crash_step;
+
+        if (rollback_result.has_value())
+        {
+            // and a successful rollback leaves no slot referenced and no transaction in the log
+            for (const auto slot : slots)
+            {
+                EXPECT_EQ((*unit_with_mock_atomics_)[slot].GetReferenceCount(), 0U) << "crash step: " << crash_step;
+            }
+            EXPECT_FALSE(TransactionLogLocalView{*transaction_log_}.ContainsTransactions())
+                << "crash step: " << crash_step;
+        }
+        else
+        {
+            // and a failed rollback doesn't dereference any slot
+            for (const auto slot : slots)
+            {
+                EXPECT_EQ(event_data_control_->state_slots_.at(slot).load(), crash_state.slot_values.at(slot))
+                    << "crash step: " << crash_step;
+            }
+        }
+    }
+}
+
+TEST_F(ConsumerEventDataControlLocalViewReferenceNextEventsFixture, PassWithoutNewEventsDoesNotWriteTheLog)
+{
+    // Given an EventDataControl with one ready slot
+    GivenAConsumerEventDataControlLocalViewUsingRealAtomics(2).WithAnAllocatedSlot(1);
+
+    // When referencing events, which are newer than the only event
+    std::vector<SlotIndexType> slot_indices(2U);
+    std::vector<EventSlotStatus::EventTimeStamp> time_stamps(2U);
+    EXPECT_EQ(unit_->ReferenceNextEvents(
+                  1U,
+                  score::cpp::span<SlotIndexType>{slot_indices.data(), slot_indices.size()},
+                  score::cpp::span<EventSlotStatus::EventTimeStamp>{time_stamps.data(), time_stamps.size()}),
+              0U);
+
+    // Then no reference batch transaction has been recorded
+    EXPECT_FALSE(TransactionLogLocalView{*transaction_log_}.ContainsTransactions());
+}
+
 using EventDataControlReferenceSpecificEventFixture = ConsumerEventDataControlLocalViewFixture;
 TEST_F(EventDataControlReferenceSpecificEventFixture, ReferenceSpecificEvents)
 {
@@ -338,17 +815,17 @@ struct MultiSenderMultiReceiverParams
 
 class MultiSenderMultiReceiverTest : public ::testing::TestWithParam<MultiSenderMultiReceiverParams>
 {
-  public:
-    MultiSenderMultiReceiverTest()
-    {
-        ConsumerEventDataControlLocalView<>::ResetPerformanceCounters();
-    }
-    ~MultiSenderMultiReceiverTest() override
+  protected:
+    void TearDown() override
     {
-        ConsumerEventDataControlLocalView<>::DumpPerformanceCounters();
+        const auto skeleton_values = skeleton_event_performance_counters_.GetValues();
+        RecordProperty("number_of_allocation_retries", skeleton_values.number_of_allocation_retries);
+        RecordProperty("number_of_allocation_failures", skeleton_values.number_of_allocation_failures);
+        const auto proxy_values = proxy_event_performance_counters_.GetValues();
+        RecordProperty("number_of_reference_retries", proxy_values.number_of_reference_retries);
+        RecordProperty("number_of_reference_failures", proxy_values.number_of_reference_failures);
     }
 
-  protected:
     // Protected by lock_
     std::mutex lock_{};
     EventSlotStatus::EventTimeStamp next_ts_{1};
@@ -357,7 +834,10 @@ class MultiSenderMultiReceiverTest : public ::testing::TestWithParam<MultiSender
     // Unprotected
     FakeMemoryResource memory_{};
     EventDataControl event_data_control_{GetParam().num_slots, memory_};
-    ProviderEventDataControlLocalView<> provider_event_data_control_local_{event_data_control_};
+    SkeletonEventPerformanceCounters skeleton_event_performance_counters_{};
+    ProxyEventPerformanceCounters proxy_event_performance_counters_{};
+    ProviderEventDataControlLocalView<> provider_event_data_control_local_{event_data_control_,
+                                                                           &skeleton_event_performance_counters_};
 };
 
 TEST_P(MultiSenderMultiReceiverTest, MultiSenderMultiReceiver)
@@ -386,6 +866,7 @@ TEST_P(MultiSenderMultiReceiverTest, MultiSenderMultiReceiver)
         // replicate that here by creating one of each per receiver thread.
         TransactionLog transaction_log{GetParam().num_slots, memory_};
         ConsumerEventDataControlLocalView<> consumer_event_data_control_local{event_data_control_, transaction_log};
+        consumer_event_data_control_local.SetPerformanceCounters(&proxy_event_performance_counters_);
         std::vector<SlotIndexType> used_slots{};
         EventSlotStatus::EventTimeStamp start_ts{1};
 
@@ -447,7 +928,6 @@ TEST_P(MultiSenderMultiReceiverTest, DISABLED_MultiSenderMultiReceiverMaxReceive
             ASSERT_NE(ts, std::numeric_limits<std::uint32_t>::max());
             if (!slot.has_value())
             {
-                ConsumerEventDataControlLocalView<>::DumpPerformanceCounters();
                 std::terminate();
             }
             else
@@ -466,6 +946,7 @@ TEST_P(MultiSenderMultiReceiverTest, DISABLED_MultiSenderMultiReceiverMaxReceive
         // replicate that here by creating one of each per receiver thread.
         TransactionLog transaction_log{GetParam().num_slots, memory_};
         ConsumerEventDataControlLocalView<> consumer_event_data_control_local{event_data_control_, transaction_log};
+        consumer_event_data_control_local.SetPerformanceCounters(&proxy_event_performance_counters_);
         std::vector<SlotIndexType> used_slots{};
         EventSlotStatus::EventTimeStamp start_ts{0};
 
@@ -18,8 +18,9 @@ namespace score::mw::com::impl::lola
 EventControl::EventControl(const SlotIndexType number_of_slots,
                            const SubscriberCountType max_subscribers,
                            const bool enforce_max_samples,
-                           score::memory::shared::ManagedMemoryResource& resource) noexcept
-    : data_control{number_of_slots, resource},
+                           score::memory::shared::ManagedMemoryResource& resource,
+                           const bool with_publish_times) noexcept
+    : data_control{number_of_slots, resource, with_publish_times},
       subscription_control{number_of_slots, max_subscribers, enforce_max_samples},
       transaction_log_set_{max_subscribers, number_of_slots, resource}
 {
@@ -18,9 +18,34 @@
 #include "score/containers/dynamic_array.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
 namespace score::mw::com::impl::lola
 {
 
+/// \brief Whether SkeletonEvents store the publish time of their samples in EventDataControl::publish_time_slots_.
+/// \details Controlled by the build setting //score/mw/com/flags:event_publish_times (default: false). If it is true,
+///          SCORE_MW_COM_EVENT_PUBLISH_TIMES_ENABLED is defined for all dependents. Consumers don't depend on this
+///          setting: They use the publish times, whenever the provider created them.
+#ifdef SCORE_MW_COM_EVENT_PUBLISH_TIMES_ENABLED
+constexpr bool kEventPublishTimesEnabled{true};
+#else
+constexpr bool kEventPublishTimesEnabled{false};
+#endif
+
+/// \brief Publish time of a sample in nanoseconds of CLOCK_MONOTONIC (std::chrono::steady_clock), which is shared by
+///        all processes on the same host.
+using EventPublishTime = std::uint64_t;
+
+inline EventPublishTime GetCurrentEventPublishTime() noexcept
+{
+    return static_cast<EventPublishTime>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
 /// \brief EventDataControl encapsulates the overall control information for one event. It is stored in Shared Memory.
 ///
 /// \details EventDataControl holds a dynamic array of multiple slots, which hold EventSlotStatus. The
@@ -34,19 +59,32 @@ namespace score::mw::com::impl::lola
 /// / opened once during Skeleton / Proxy creation, and then is accessed during runtime via ProxyEventDataControlLocal /
 /// SkeletonEventDataControlLocal.
 ///
+/// Optionally, EventDataControl holds a second array of the same size with the publish time of the sample in each slot
+/// (see kEventPublishTimesEnabled). It is empty, if the provider doesn't record publish times.
+///
 /// It is one of the corner stone elements of our LoLa IPC for Events!
 class EventDataControl
 {
   public:
     using EventControlSlots =
         containers::DynamicArray<ControlSlotType, memory::shared::PolymorphicOffsetPtrAllocator<ControlSlotType>>;
+    using EventPublishTimeSlotType = std::atomic<EventPublishTime>;
+    using EventPublishTimeSlots =
+        containers::DynamicArray<EventPublishTimeSlotType,
+                                 memory::shared::PolymorphicOffsetPtrAllocator<EventPublishTimeSlotType>>;
 
-    EventDataControl(const SlotIndexType max_slots, score::memory::shared::ManagedMemoryResource& resource) noexcept
-        : state_slots_{max_slots, resource}
+    EventDataControl(const SlotIndexType max_slots,
+                     score::memory::shared::ManagedMemoryResource& resource,
+                     const bool with_publish_times = kEventPublishTimesEnabled) noexcept
+        : state_slots_{max_slots, resource},
+          publish_time_slots_{with_publish_times ? max_slots : SlotIndexType{0U}, resource}
     {
     }
 
     EventControlSlots state_slots_;
+
+    /// \brief Publish time of the sample in each slot, written by the provider before the slot is marked as ready.
+    EventPublishTimeSlots publish_time_slots_;
 };
 
 }  // namespace score::mw::com::impl::lola
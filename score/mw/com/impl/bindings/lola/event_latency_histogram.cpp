@@ -0,0 +1,154 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/event_latency_histogram.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+using Values = EventLatencyHistogramValues;
+
+constexpr std::size_t kOverflowBucketIndex{Values::kNumberOfBuckets - 1U};
+
+void UpdateMin(std::atomic<std::uint64_t>& current_min, const std::uint64_t value) noexcept
+{
+    auto current_value = current_min.load(std::memory_order_relaxed);
+    while ((value < current_value) &&
+           (!current_min.compare_exchange_weak(
+               current_value, value, std::memory_order_relaxed, std::memory_order_relaxed)))
+    {
+    }
+}
+
+void UpdateMax(std::atomic<std::uint64_t>& current_max, const std::uint64_t value) noexcept
+{
+    auto current_value = current_max.load(std::memory_order_relaxed);
+    while ((value > current_value) &&
+           (!current_max.compare_exchange_weak(
+               current_value, value, std::memory_order_relaxed, std::memory_order_relaxed)))
+    {
+    }
+}
+
+}  // namespace
+
+std::size_t GetLatencyBucketIndex(const std::uint64_t latency_ns) noexcept
+{
+    if (latency_ns < Values::kNumberOfSubBuckets)
+    {
+        return static_cast<std::size_t>(latency_ns);
+    }
+
+    // Position of the highest set bit, which is at least kSubBucketBits as latency_ns >= kNumberOfSubBuckets.
+    std::size_t magnitude{Values::kSubBucketBits};
+    while ((latency_ns >> magnitude) > 1U)
+    {
+        ++magnitude;
+    }
+    if (magnitude >= Values::kMaxLatencyMagnitude)
+    {
+        return kOverflowBucketIndex;
+    }
+
+    // The kSubBucketBits bits below the highest set bit select the sub bucket.
+    const auto sub_bucket_bits = static_cast<std::size_t>(latency_ns >> (magnitude - Values::kSubBucketBits));
+    const std::size_t sub_bucket = sub_bucket_bits & (Values::kNumberOfSubBuckets - 1U);
+    return ((magnitude - Values::kSubBucketBits + 1U) * Values::kNumberOfSubBuckets) + sub_bucket;
+}
+
+std::uint64_t GetLatencyBucketLowerBound(const std::size_t bucket_index) noexcept
+{
+    if (bucket_index < Values::kNumberOfSubBuckets)
+    {
+        return static_cast<std::uint64_t>(bucket_index);
+    }
+    if (bucket_index >= kOverflowBucketIndex)
+    {
+        return std::uint64_t{1U} << Values::kMaxLatencyMagnitude;
+    }
+
+    const std::size_t group = bucket_index / Values::kNumberOfSubBuckets;
+    const std::size_t sub_bucket = bucket_index % Values::kNumberOfSubBuckets;
+    return static_cast<std::uint64_t>(Values::kNumberOfSubBuckets + sub_bucket) << (group - 1U);
+}
+
+std::uint64_t GetLatencyAtPercentile(const EventLatencyHistogramValues& values, const double percentile) noexcept
+{
+    if (values.number_of_samples == 0U)
+    {
+        return 0U;
+    }
+
+    const double bounded_percentile = std::clamp(percentile, 0.0, 100.0);
+    const auto total = static_cast<double>(values.number_of_samples);
+    const auto rank = std::clamp(static_cast<std::uint64_t>(std::ceil((bounded_percentile / 100.0) * total)),
+                                 std::uint64_t{1U},
+                                 values.number_of_samples);
+
+    std::uint64_t number_of_samples_up_to_bucket{0U};
+    for (std::size_t bucket_index = 0U; bucket_index < kOverflowBucketIndex; ++bucket_index)
+    {
+        number_of_samples_up_to_bucket += values.buckets.at(bucket_index);
+        if (number_of_samples_up_to_bucket >= rank)
+        {
+            const auto bucket_upper_bound = GetLatencyBucketLowerBound(bucket_index + 1U) - 1U;
+            // Not std::clamp, as min_latency_ns may exceed max_latency_ns in a snapshot taken during recording.
+            return std::min(std::max(bucket_upper_bound, values.min_latency_ns), values.max_latency_ns);
+        }
+    }
+    return values.max_latency_ns;
+}
+
+void EventLatencyHistogram::Record(const std::uint64_t latency_ns) noexcept
+{
+    score::cpp::ignore = number_of_samples_.fetch_add(1U, std::memory_order_relaxed);
+    score::cpp::ignore = sum_of_latencies_ns_.fetch_add(latency_ns, std::memory_order_relaxed);
+    score::cpp::ignore = buckets_.at(GetLatencyBucketIndex(latency_ns)).fetch_add(1U, std::memory_order_relaxed);
+    UpdateMin(min_latency_ns_, latency_ns);
+    UpdateMax(max_latency_ns_, latency_ns);
+}
+
+EventLatencyHistogramValues EventLatencyHistogram::GetValues() const noexcept
+{
+    EventLatencyHistogramValues values{};
+    values.number_of_samples = number_of_samples_.load(std::memory_order_relaxed);
+    values.sum_of_latencies_ns = sum_of_latencies_ns_.load(std::memory_order_relaxed);
+    values.min_latency_ns = (values.number_of_samples == 0U) ? 0U : min_latency_ns_.load(std::memory_order_relaxed);
+    values.max_latency_ns = max_latency_ns_.load(std::memory_order_relaxed);
+    for (std::size_t bucket = 0U; bucket < buckets_.size(); ++bucket)
+    {
+        values.buckets.at(bucket) = buckets_.at(bucket).load(std::memory_order_relaxed);
+    }
+    return values;
+}
+
+void EventLatencyHistogram::Reset() noexcept
+{
+    number_of_samples_.store(0U, std::memory_order_relaxed);
+    sum_of_latencies_ns_.store(0U, std::memory_order_relaxed);
+    min_latency_ns_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    max_latency_ns_.store(0U, std::memory_order_relaxed);
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace score::mw::com::impl::lola
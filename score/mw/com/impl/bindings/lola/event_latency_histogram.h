@@ -0,0 +1,93 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_LATENCY_HISTOGRAM_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Snapshot of an EventLatencyHistogram.
+///
+/// The buckets follow the HDR histogram layout with a fixed precision: Latencies below kNumberOfSubBuckets ns have a
+/// bucket each. Every larger power of two range [2^m, 2^(m+1)) is split into kNumberOfSubBuckets equally wide buckets,
+/// so the bucket width is at most 1/kNumberOfSubBuckets (12.5%) of the latencies it contains. The last bucket counts
+/// all latencies of at least 2^kMaxLatencyMagnitude ns (~18 minutes).
+struct EventLatencyHistogramValues
+{
+    static constexpr std::size_t kSubBucketBits{3U};
+    static constexpr std::size_t kNumberOfSubBuckets{std::size_t{1U} << kSubBucketBits};
+    static constexpr std::size_t kMaxLatencyMagnitude{40U};
+    static constexpr std::size_t kNumberOfBuckets{
+        ((kMaxLatencyMagnitude - kSubBucketBits + 1U) * kNumberOfSubBuckets) + 1U};
+
+    /// \brief Number of recorded latencies.
+    std::uint64_t number_of_samples;
+    /// \brief Sum of all recorded latencies in ns.
+    std::uint64_t sum_of_latencies_ns;
+    /// \brief Smallest recorded latency in ns (0, if no latency was recorded).
+    std::uint64_t min_latency_ns;
+    /// \brief Largest recorded latency in ns.
+    std::uint64_t max_latency_ns;
+    /// \brief Number of recorded latencies per bucket, see GetLatencyBucketIndex().
+    std::array<std::uint64_t, kNumberOfBuckets> buckets;
+};
+
+/// \brief Returns the index of the bucket, which counts the given latency.
+std::size_t GetLatencyBucketIndex(const std::uint64_t latency_ns) noexcept;
+
+/// \brief Returns the smallest latency in ns, which is counted by the given bucket.
+std::uint64_t GetLatencyBucketLowerBound(const std::size_t bucket_index) noexcept;
+
+/// \brief Returns the latency in ns, which is not exceeded by the given percentile (within [0.0, 100.0]) of the
+///        recorded latencies.
+/// \details Like HDR histograms, the result is the largest latency of the bucket, in which the percentile lies, but
+///          not larger than max_latency_ns. Returns 0, if no latency was recorded.
+std::uint64_t GetLatencyAtPercentile(const EventLatencyHistogramValues& values, const double percentile) noexcept;
+
+/// \brief Histogram of the publish-to-receive latencies of the samples of a ProxyEvent.
+///
+/// All counters are relaxed atomics, like the ones of ProxyEventPerformanceCounters. Reading them while the ProxyEvent
+/// is in use therefore gives a consistent value for every single counter but not necessarily across counters.
+class EventLatencyHistogram final
+{
+  public:
+    EventLatencyHistogram() noexcept = default;
+    ~EventLatencyHistogram() noexcept = default;
+
+    EventLatencyHistogram(const EventLatencyHistogram&) = delete;
+    EventLatencyHistogram(EventLatencyHistogram&&) noexcept = delete;
+    EventLatencyHistogram& operator=(const EventLatencyHistogram&) = delete;
+    EventLatencyHistogram& operator=(EventLatencyHistogram&&) noexcept = delete;
+
+    void Record(const std::uint64_t latency_ns) noexcept;
+
+    EventLatencyHistogramValues GetValues() const noexcept;
+    void Reset() noexcept;
+
+  private:
+    std::atomic<std::uint64_t> number_of_samples_{0U};
+    std::atomic<std::uint64_t> sum_of_latencies_ns_{0U};
+    std::atomic<std::uint64_t> min_latency_ns_{std::numeric_limits<std::uint64_t>::max()};
+    std::atomic<std::uint64_t> max_latency_ns_{0U};
+    std::array<std::atomic<std::uint64_t>, EventLatencyHistogramValues::kNumberOfBuckets> buckets_{};
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_LATENCY_HISTOGRAM_H
@@ -0,0 +1,188 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/event_latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using Values = EventLatencyHistogramValues;
+
+TEST(EventLatencyHistogramBucketTest, SmallLatenciesHaveABucketEach)
+{
+    // When getting the buckets of latencies below the number of sub buckets
+    // Then each latency has its own bucket
+    for (std::uint64_t latency_ns = 0U; latency_ns < Values::kNumberOfSubBuckets; ++latency_ns)
+    {
+        EXPECT_EQ(GetLatencyBucketIndex(latency_ns), static_cast<std::size_t>(latency_ns));
+        EXPECT_EQ(GetLatencyBucketLowerBound(static_cast<std::size_t>(latency_ns)), latency_ns);
+    }
+}
+
+TEST(EventLatencyHistogramBucketTest, LargerLatenciesShareBucketsOfBoundedRelativeWidth)
+{
+    // Given the latencies 1000 ns and 1100 ns, which differ by less than the precision of the buckets
+    // When getting their buckets
+    // Then 1000 ns (0b1111101000) falls into the bucket [960, 1024) and 1100 ns into the bucket [1024, 1152)
+    const auto bucket_1000 = GetLatencyBucketIndex(1000U);
+    EXPECT_EQ(GetLatencyBucketLowerBound(bucket_1000), 960U);
+    EXPECT_EQ(GetLatencyBucketLowerBound(bucket_1000 + 1U), 1024U);
+
+    const auto bucket_1100 = GetLatencyBucketIndex(1100U);
+    EXPECT_EQ(bucket_1100, bucket_1000 + 1U);
+    EXPECT_EQ(GetLatencyBucketLowerBound(bucket_1100 + 1U), 1152U);
+}
+
+TEST(EventLatencyHistogramBucketTest, EachBucketStartsWhereThePreviousOneEnds)
+{
+    // When getting the lower bounds of all buckets
+    // Then they are strictly increasing and each lower bound and the largest latency of the bucket map to the bucket
+    for (std::size_t bucket_index = 1U; bucket_index < Values::kNumberOfBuckets; ++bucket_index)
+    {
+        const auto lower_bound = GetLatencyBucketLowerBound(bucket_index);
+        EXPECT_GT(lower_bound, GetLatencyBucketLowerBound(bucket_index - 1U));
+        EXPECT_EQ(GetLatencyBucketIndex(lower_bound), bucket_index);
+        EXPECT_EQ(GetLatencyBucketIndex(lower_bound - 1U), bucket_index - 1U);
+    }
+}
+
+TEST(EventLatencyHistogramBucketTest, HugeLatenciesAreCountedInTheLastBucket)
+{
+    // When getting the bucket of latencies beyond the largest magnitude
+    // Then it is the last bucket
+    EXPECT_EQ(GetLatencyBucketIndex(std::uint64_t{1U} << Values::kMaxLatencyMagnitude), Values::kNumberOfBuckets - 1U);
+    EXPECT_EQ(GetLatencyBucketIndex(std::numeric_limits<std::uint64_t>::max()), Values::kNumberOfBuckets - 1U);
+}
+
+TEST(EventLatencyHistogramTest, RecordedLatenciesAreReturnedAsValues)
+{
+    // Given an event latency histogram
+    EventLatencyHistogram unit{};
+
+    // When recording the latencies 5 ns, 1000 ns and 1100 ns
+    unit.Record(5U);
+    unit.Record(1000U);
+    unit.Record(1100U);
+
+    // Then the values contain the number, sum, min and max of the latencies and their buckets
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_samples, 3U);
+    EXPECT_EQ(values.sum_of_latencies_ns, 2105U);
+    EXPECT_EQ(values.min_latency_ns, 5U);
+    EXPECT_EQ(values.max_latency_ns, 1100U);
+    EXPECT_EQ(values.buckets.at(5U), 1U);
+    EXPECT_EQ(values.buckets.at(GetLatencyBucketIndex(1000U)), 1U);
+    EXPECT_EQ(values.buckets.at(GetLatencyBucketIndex(1100U)), 1U);
+}
+
+TEST(EventLatencyHistogramTest, ResetClearsAllValues)
+{
+    // Given an event latency histogram with recorded latencies
+    EventLatencyHistogram unit{};
+    unit.Record(5U);
+    unit.Record(1000U);
+
+    // When resetting it
+    unit.Reset();
+
+    // Then all values are 0
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_samples, 0U);
+    EXPECT_EQ(values.sum_of_latencies_ns, 0U);
+    EXPECT_EQ(values.min_latency_ns, 0U);
+    EXPECT_EQ(values.max_latency_ns, 0U);
+    for (const auto bucket : values.buckets)
+    {
+        EXPECT_EQ(bucket, 0U);
+    }
+
+    // and the minimum is tracked again afterwards
+    unit.Record(1000U);
+    EXPECT_EQ(unit.GetValues().min_latency_ns, 1000U);
+}
+
+TEST(EventLatencyHistogramTest, PercentilesAreTheLargestLatencyOfTheirBucket)
+{
+    // Given an event latency histogram with 99 latencies of 1000 ns and one latency of 100000 ns
+    EventLatencyHistogram unit{};
+    for (std::size_t i = 0U; i < 99U; ++i)
+    {
+        unit.Record(1000U);
+    }
+    unit.Record(100000U);
+    const auto values = unit.GetValues();
+
+    // When getting percentiles
+    // Then the median and the 99th percentile are the largest latency of the bucket [960, 1024), but not less than
+    // the min latency
+    EXPECT_EQ(GetLatencyAtPercentile(values, 50.0), 1023U);
+    EXPECT_EQ(GetLatencyAtPercentile(values, 99.0), 1023U);
+    EXPECT_EQ(GetLatencyAtPercentile(values, 0.0), 1023U);
+
+    // and the 99.9th and 100th percentiles are bounded by the max latency
+    EXPECT_EQ(GetLatencyAtPercentile(values, 99.9), 100000U);
+    EXPECT_EQ(GetLatencyAtPercentile(values, 100.0), 100000U);
+}
+
+TEST(EventLatencyHistogramTest, PercentileOfEmptyHistogramIsZero)
+{
+    // Given an event latency histogram without recorded latencies
+    EventLatencyHistogram unit{};
+
+    // When getting a percentile
+    // Then it is 0
+    EXPECT_EQ(GetLatencyAtPercentile(unit.GetValues(), 50.0), 0U);
+}
+
+TEST(EventLatencyHistogramTest, ConcurrentRecordingsAreNotLost)
+{
+    constexpr std::size_t kNumberOfThreads{4U};
+    constexpr std::uint64_t kNumberOfRecordings{1000U};
+
+    // Given an event latency histogram
+    EventLatencyHistogram unit{};
+
+    // When recording latencies from several threads concurrently
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([&unit, thread_index]() {
+            for (std::uint64_t recording = 0U; recording < kNumberOfRecordings; ++recording)
+            {
+                unit.Record(thread_index + 1U);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then all recordings are counted
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_samples, kNumberOfThreads * kNumberOfRecordings);
+    EXPECT_EQ(values.min_latency_ns, 1U);
+    EXPECT_EQ(values.max_latency_ns, kNumberOfThreads);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+std::size_t GetBatchSizeBucket(std::size_t batch_size) noexcept
+{
+    std::size_t bucket{0U};
+    while ((batch_size != 0U) && (bucket < (ProxyEventPerformanceCounterValues::kNumberOfBatchSizeBuckets - 1U)))
+    {
+        batch_size >>= 1U;
+        ++bucket;
+    }
+    return bucket;
+}
+
+}  // namespace
+
+SkeletonEventPerformanceCounterValues SkeletonEventPerformanceCounters::GetValues() const noexcept
+{
+    return SkeletonEventPerformanceCounterValues{number_of_allocations_.load(std::memory_order_relaxed),
+                                                 number_of_allocation_retries_.load(std::memory_order_relaxed),
+                                                 number_of_allocation_failures_.load(std::memory_order_relaxed),
+                                                 number_of_allocation_collisions_.load(std::memory_order_relaxed),
+                                                 number_of_dropped_samples_.load(std::memory_order_relaxed),
+                                                 number_of_sent_notifications_.load(std::memory_order_relaxed)};
+}
+
+void SkeletonEventPerformanceCounters::Reset() noexcept
+{
+    number_of_allocations_.store(0U, std::memory_order_relaxed);
+    number_of_allocation_retries_.store(0U, std::memory_order_relaxed);
+    number_of_allocation_failures_.store(0U, std::memory_order_relaxed);
+    number_of_allocation_collisions_.store(0U, std::memory_order_relaxed);
+    number_of_dropped_samples_.store(0U, std::memory_order_relaxed);
+    number_of_sent_notifications_.store(0U, std::memory_order_relaxed);
+}
+
+ProxyEventPerformanceCounterValues ProxyEventPerformanceCounters::GetValues() const noexcept
+{
+    ProxyEventPerformanceCounterValues values{};
+    values.number_of_reference_retries = number_of_reference_retries_.load(std::memory_order_relaxed);
+    values.number_of_reference_failures = number_of_reference_failures_.load(std::memory_order_relaxed);
+    values.number_of_reference_collisions = number_of_reference_collisions_.load(std::memory_order_relaxed);
+    values.number_of_received_notifications = number_of_received_notifications_.load(std::memory_order_relaxed);
+    values.number_of_get_new_samples_calls = number_of_get_new_samples_calls_.load(std::memory_order_relaxed);
+    values.number_of_received_samples = number_of_received_samples_.load(std::memory_order_relaxed);
+    values.max_batch_size = max_batch_size_.load(std::memory_order_relaxed);
+    for (std::size_t bucket = 0U; bucket < batch_size_histogram_.size(); ++bucket)
+    {
+        values.batch_size_histogram.at(bucket) = batch_size_histogram_.at(bucket).load(std::memory_order_relaxed);
+    }
+    return values;
+}
+
+void ProxyEventPerformanceCounters::Reset() noexcept
+{
+    number_of_reference_retries_.store(0U, std::memory_order_relaxed);
+    number_of_reference_failures_.store(0U, std::memory_order_relaxed);
+    number_of_reference_collisions_.store(0U, std::memory_order_relaxed);
+    number_of_received_notifications_.store(0U, std::memory_order_relaxed);
+    number_of_get_new_samples_calls_.store(0U, std::memory_order_relaxed);
+    number_of_received_samples_.store(0U, std::memory_order_relaxed);
+    max_batch_size_.store(0U, std::memory_order_relaxed);
+    for (auto& bucket : batch_size_histogram_)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+void ProxyEventPerformanceCounters::CountGetNewSamplesImpl(const std::size_t batch_size) noexcept
+{
+    const auto batch_size_value = static_cast<std::uint64_t>(batch_size);
+    score::cpp::ignore = number_of_get_new_samples_calls_.fetch_add(1U, std::memory_order_relaxed);
+    score::cpp::ignore = number_of_received_samples_.fetch_add(batch_size_value, std::memory_order_relaxed);
+    score::cpp::ignore =
+        batch_size_histogram_.at(GetBatchSizeBucket(batch_size)).fetch_add(1U, std::memory_order_relaxed);
+
+    auto current_max_batch_size = max_batch_size_.load(std::memory_order_relaxed);
+    while ((batch_size_value > current_max_batch_size) &&
+           (!max_batch_size_.compare_exchange_weak(
+               current_max_batch_size, batch_size_value, std::memory_order_relaxed, std::memory_order_relaxed)))
+    {
+    }
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,216 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
+
+#include <score/utility.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Whether the event performance counters are compiled into the event hot paths.
+/// \details Controlled by the build setting //score/mw/com/flags:event_performance_counters (default: true). If it is
+///          false, SCORE_MW_COM_EVENT_PERFORMANCE_COUNTERS_DISABLED is defined for all dependents, all Count*() calls
+///          are discarded at compile time and all counter values stay 0.
+#ifdef SCORE_MW_COM_EVENT_PERFORMANCE_COUNTERS_DISABLED
+constexpr bool kEventPerformanceCountersCompiledIn{false};
+#else
+constexpr bool kEventPerformanceCountersCompiledIn{true};
+#endif
+
+/// \brief Snapshot of the SkeletonEventPerformanceCounters of a SkeletonEvent.
+struct SkeletonEventPerformanceCounterValues
+{
+    /// \brief Number of calls to ProviderEventDataControlLocalView::AllocateNextSlot().
+    std::uint64_t number_of_allocations;
+    /// \brief Number of retries within AllocateNextSlot() caused by data races or by no slot being free.
+    std::uint64_t number_of_allocation_retries;
+    /// \brief Number of calls to AllocateNextSlot(), which did not find a slot within the bounded number of retries.
+    std::uint64_t number_of_allocation_failures;
+    /// \brief Number of failed compare-and-swap operations in ProviderEventDataControlLocalView::TryAllocateSlot().
+    std::uint64_t number_of_allocation_collisions;
+    /// \brief Number of samples, which could not be allocated (and thus not be sent), because no slot was free.
+    std::uint64_t number_of_dropped_samples;
+    /// \brief Number of event update notifications sent to the consumers (one per quality level).
+    std::uint64_t number_of_sent_notifications;
+};
+
+/// \brief Snapshot of the ProxyEventPerformanceCounters of a ProxyEvent.
+struct ProxyEventPerformanceCounterValues
+{
+    /// \brief Number of buckets of the batch size histogram. Bucket 0 counts empty batches, bucket i > 0 counts
+    ///        batches with a size within [2^(i-1), 2^i - 1]. The last bucket also counts all larger batches.
+    static constexpr std::size_t kNumberOfBatchSizeBuckets{9U};
+
+    /// \brief Number of retries within ConsumerEventDataControlLocalView::ReferenceNextEvent() and
+    ///        ReferenceNextEvents().
+    std::uint64_t number_of_reference_retries;
+    /// \brief Number of slots found by ReferenceNextEvent() / ReferenceNextEvents(), which could not be referenced
+    ///        within the bounded number of retries.
+    std::uint64_t number_of_reference_failures;
+    /// \brief Number of failed compare-and-swap operations in ReferenceNextEvent() and ReferenceNextEvents().
+    std::uint64_t number_of_reference_collisions;
+    /// \brief Number of event update notifications received for the registered receive handler.
+    std::uint64_t number_of_received_notifications;
+    /// \brief Number of GetNewSamples() calls.
+    std::uint64_t number_of_get_new_samples_calls;
+    /// \brief Sum of the batch sizes (number of samples) of all GetNewSamples() calls.
+    std::uint64_t number_of_received_samples;
+    /// \brief Largest batch size of a single GetNewSamples() call.
+    std::uint64_t max_batch_size;
+    /// \brief Histogram of the batch sizes of all GetNewSamples() calls.
+    std::array<std::uint64_t, kNumberOfBatchSizeBuckets> batch_size_histogram;
+};
+
+/// \brief Performance counters of a SkeletonEvent, which are updated by the SkeletonEvent and the
+///        ProviderEventDataControlLocalViews it owns.
+///
+/// All counters are relaxed atomics: They are only statistics and don't order any other memory accesses. Reading them
+/// while the SkeletonEvent is in use therefore gives a consistent value for every single counter but not necessarily
+/// across counters.
+class SkeletonEventPerformanceCounters final
+{
+  public:
+    SkeletonEventPerformanceCounters() noexcept = default;
+    ~SkeletonEventPerformanceCounters() noexcept = default;
+
+    SkeletonEventPerformanceCounters(const SkeletonEventPerformanceCounters&) = delete;
+    SkeletonEventPerformanceCounters(SkeletonEventPerformanceCounters&&) noexcept = delete;
+    SkeletonEventPerformanceCounters& operator=(const SkeletonEventPerformanceCounters&) = delete;
+    SkeletonEventPerformanceCounters& operator=(SkeletonEventPerformanceCounters&&) noexcept = delete;
+
+    void CountAllocation(const std::uint64_t number_of_retries, const bool allocation_failed) noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_allocations_.fetch_add(1U, std::memory_order_relaxed);
+            score::cpp::ignore = number_of_allocation_retries_.fetch_add(number_of_retries, std::memory_order_relaxed);
+            if (allocation_failed)
+            {
+                score::cpp::ignore = number_of_allocation_failures_.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void CountAllocationCollision() noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_allocation_collisions_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    void CountDroppedSample() noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_dropped_samples_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    void CountSentNotification() noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_sent_notifications_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    SkeletonEventPerformanceCounterValues GetValues() const noexcept;
+    void Reset() noexcept;
+
+  private:
+    std::atomic<std::uint64_t> number_of_allocations_{0U};
+    std::atomic<std::uint64_t> number_of_allocation_retries_{0U};
+    std::atomic<std::uint64_t> number_of_allocation_failures_{0U};
+    std::atomic<std::uint64_t> number_of_allocation_collisions_{0U};
+    std::atomic<std::uint64_t> number_of_dropped_samples_{0U};
+    std::atomic<std::uint64_t> number_of_sent_notifications_{0U};
+};
+
+/// \brief Performance counters of a ProxyEvent, which are updated by the ProxyEvent and the
+///        ConsumerEventDataControlLocalView it uses.
+///
+/// All counters are relaxed atomics, see SkeletonEventPerformanceCounters.
+class ProxyEventPerformanceCounters final
+{
+  public:
+    ProxyEventPerformanceCounters() noexcept = default;
+    ~ProxyEventPerformanceCounters() noexcept = default;
+
+    ProxyEventPerformanceCounters(const ProxyEventPerformanceCounters&) = delete;
+    ProxyEventPerformanceCounters(ProxyEventPerformanceCounters&&) noexcept = delete;
+    ProxyEventPerformanceCounters& operator=(const ProxyEventPerformanceCounters&) = delete;
+    ProxyEventPerformanceCounters& operator=(ProxyEventPerformanceCounters&&) noexcept = delete;
+
+    void CountReference(const std::uint64_t number_of_retries, const bool reference_failed) noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_reference_retries_.fetch_add(number_of_retries, std::memory_order_relaxed);
+            if (reference_failed)
+            {
+                score::cpp::ignore = number_of_reference_failures_.fetch_add(1U, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void CountReferenceCollision() noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_reference_collisions_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    void CountReceivedNotification() noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            score::cpp::ignore = number_of_received_notifications_.fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    void CountGetNewSamples(const std::size_t batch_size) noexcept
+    {
+        if constexpr (kEventPerformanceCountersCompiledIn)
+        {
+            CountGetNewSamplesImpl(batch_size);
+        }
+    }
+
+    ProxyEventPerformanceCounterValues GetValues() const noexcept;
+    void Reset() noexcept;
+
+  private:
+    void CountGetNewSamplesImpl(const std::size_t batch_size) noexcept;
+
+    std::atomic<std::uint64_t> number_of_reference_retries_{0U};
+    std::atomic<std::uint64_t> number_of_reference_failures_{0U};
+    std::atomic<std::uint64_t> number_of_reference_collisions_{0U};
+    std::atomic<std::uint64_t> number_of_received_notifications_{0U};
+    std::atomic<std::uint64_t> number_of_get_new_samples_calls_{0U};
+    std::atomic<std::uint64_t> number_of_received_samples_{0U};
+    std::atomic<std::uint64_t> max_batch_size_{0U};
+    std::array<std::atomic<std::uint64_t>, ProxyEventPerformanceCounterValues::kNumberOfBatchSizeBuckets>
+        batch_size_histogram_{};
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_EVENT_PERFORMANCE_COUNTERS_H
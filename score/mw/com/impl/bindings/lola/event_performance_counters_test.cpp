@@ -0,0 +1,201 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+TEST(SkeletonEventPerformanceCountersTest, CountsAreReturnedAsValues)
+{
+    // Given skeleton event performance counters
+    SkeletonEventPerformanceCounters unit{};
+
+    // When counting a successful allocation with two retries, a failed allocation with three retries, a collision, a
+    // dropped sample and two sent notifications
+    unit.CountAllocation(2U, false);
+    unit.CountAllocation(3U, true);
+    unit.CountAllocationCollision();
+    unit.CountDroppedSample();
+    unit.CountSentNotification();
+    unit.CountSentNotification();
+
+    // Then the values reflect these counts
+    const auto values = unit.GetValues();
+    if constexpr (kEventPerformanceCountersCompiledIn)
+    {
+        EXPECT_EQ(values.number_of_allocations, 2U);
+        EXPECT_EQ(values.number_of_allocation_retries, 5U);
+        EXPECT_EQ(values.number_of_allocation_failures, 1U);
+        EXPECT_EQ(values.number_of_allocation_collisions, 1U);
+        EXPECT_EQ(values.number_of_dropped_samples, 1U);
+        EXPECT_EQ(values.number_of_sent_notifications, 2U);
+    }
+    else
+    {
+        EXPECT_EQ(values.number_of_allocations, 0U);
+        EXPECT_EQ(values.number_of_sent_notifications, 0U);
+    }
+}
+
+TEST(SkeletonEventPerformanceCountersTest, ResetSetsAllCountsToZero)
+{
+    // Given skeleton event performance counters with counts
+    SkeletonEventPerformanceCounters unit{};
+    unit.CountAllocation(2U, true);
+    unit.CountAllocationCollision();
+    unit.CountDroppedSample();
+    unit.CountSentNotification();
+
+    // When resetting them
+    unit.Reset();
+
+    // Then all values are 0
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_allocations, 0U);
+    EXPECT_EQ(values.number_of_allocation_retries, 0U);
+    EXPECT_EQ(values.number_of_allocation_failures, 0U);
+    EXPECT_EQ(values.number_of_allocation_collisions, 0U);
+    EXPECT_EQ(values.number_of_dropped_samples, 0U);
+    EXPECT_EQ(values.number_of_sent_notifications, 0U);
+}
+
+TEST(ProxyEventPerformanceCountersTest, CountsAreReturnedAsValues)
+{
+    // Given proxy event performance counters
+    ProxyEventPerformanceCounters unit{};
+
+    // When counting a successful reference with one retry, a failed reference with four retries, a collision and a
+    // received notification
+    unit.CountReference(1U, false);
+    unit.CountReference(4U, true);
+    unit.CountReferenceCollision();
+    unit.CountReceivedNotification();
+
+    // Then the values reflect these counts
+    const auto values = unit.GetValues();
+    if constexpr (kEventPerformanceCountersCompiledIn)
+    {
+        EXPECT_EQ(values.number_of_reference_retries, 5U);
+        EXPECT_EQ(values.number_of_reference_failures, 1U);
+        EXPECT_EQ(values.number_of_reference_collisions, 1U);
+        EXPECT_EQ(values.number_of_received_notifications, 1U);
+    }
+    else
+    {
+        EXPECT_EQ(values.number_of_reference_retries, 0U);
+        EXPECT_EQ(values.number_of_received_notifications, 0U);
+    }
+}
+
+TEST(ProxyEventPerformanceCountersTest, BatchSizesAreSortedIntoPowerOfTwoBuckets)
+{
+    if (!kEventPerformanceCountersCompiledIn)
+    {
+        GTEST_SKIP() << "Event performance counters are compiled out";
+    }
+
+    // Given proxy event performance counters
+    ProxyEventPerformanceCounters unit{};
+
+    // When counting GetNewSamples calls with the batch sizes 0, 1, 2, 3, 4, 255 and 1000
+    for (const std::size_t batch_size : {0U, 1U, 2U, 3U, 4U, 255U, 1000U})
+    {
+        unit.CountGetNewSamples(batch_size);
+    }
+
+    // Then the calls, the received samples and the largest batch size are counted
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_get_new_samples_calls, 7U);
+    EXPECT_EQ(values.number_of_received_samples, 1265U);
+    EXPECT_EQ(values.max_batch_size, 1000U);
+
+    // and the batch sizes are sorted into the buckets [0], [1], [2, 3], [4, 7], ... [128, 255] and larger ones into the
+    // last bucket
+    const std::array<std::uint64_t, ProxyEventPerformanceCounterValues::kNumberOfBatchSizeBuckets> expected_histogram{
+        1U, 1U, 2U, 1U, 0U, 0U, 0U, 0U, 2U};
+    EXPECT_EQ(values.batch_size_histogram, expected_histogram);
+}
+
+TEST(ProxyEventPerformanceCountersTest, MaxBatchSizeIsTheLargestOfConcurrentCalls)
+{
+    if (!kEventPerformanceCountersCompiledIn)
+    {
+        GTEST_SKIP() << "Event performance counters are compiled out";
+    }
+
+    // Given proxy event performance counters
+    ProxyEventPerformanceCounters unit{};
+
+    // When counting GetNewSamples calls with different batch sizes from several threads
+    constexpr std::size_t number_of_threads{4U};
+    constexpr std::size_t number_of_calls_per_thread{1000U};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < number_of_threads; ++thread_index)
+    {
+        threads.emplace_back([&unit, thread_index]() {
+            for (std::size_t call = 0U; call < number_of_calls_per_thread; ++call)
+            {
+                unit.CountGetNewSamples((call % 100U) + thread_index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then all calls are counted and the largest batch size wins
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_get_new_samples_calls, number_of_threads * number_of_calls_per_thread);
+    EXPECT_EQ(values.max_batch_size, 99U + (number_of_threads - 1U));
+}
+
+TEST(ProxyEventPerformanceCountersTest, ResetSetsAllCountsToZero)
+{
+    // Given proxy event performance counters with counts
+    ProxyEventPerformanceCounters unit{};
+    unit.CountReference(1U, true);
+    unit.CountReferenceCollision();
+    unit.CountReceivedNotification();
+    unit.CountGetNewSamples(3U);
+
+    // When resetting them
+    unit.Reset();
+
+    // Then all values are 0
+    const auto values = unit.GetValues();
+    EXPECT_EQ(values.number_of_reference_retries, 0U);
+    EXPECT_EQ(values.number_of_reference_failures, 0U);
+    EXPECT_EQ(values.number_of_reference_collisions, 0U);
+    EXPECT_EQ(values.number_of_received_notifications, 0U);
+    EXPECT_EQ(values.number_of_get_new_samples_calls, 0U);
+    EXPECT_EQ(values.number_of_received_samples, 0U);
+    EXPECT_EQ(values.max_batch_size, 0U);
+    for (const auto bucket : values.batch_size_histogram)
+    {
+        EXPECT_EQ(bucket, 0U);
+    }
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
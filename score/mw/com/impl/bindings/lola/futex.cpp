@@ -0,0 +1,103 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/futex.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#include <ctime>
+#else
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <thread>
+#endif
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "The futex syscall operates on the plain 32 bit word underlying the atomic");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "The futex word requires a lock-free atomic");
+
+#if !defined(__linux__)
+/// \brief Platforms without futexes poll the condition of the waiter with this interval.
+constexpr std::chrono::milliseconds kPollInterval{1};
+#endif
+
+class FutexImpl final : public Futex
+{
+  public:
+    score::cpp::expected_blank<os::Error> Wait(std::atomic<std::uint32_t>& futex_word,
+                                               const std::uint32_t expected_value,
+                                               const std::chrono::nanoseconds timeout) const noexcept override
+    {
+#if defined(__linux__)
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        const timespec relative_timeout{static_cast<std::time_t>(seconds.count()),
+                                        static_cast<long>((timeout - seconds).count())};
+        if (::syscall(SYS_futex, GetPlainWord(futex_word), FUTEX_WAIT, expected_value, &relative_timeout, nullptr, 0) ==
+            -1)
+        {
+            return score::cpp::make_unexpected(os::Error::createFromErrno());
+        }
+#else
+        if (futex_word.load(std::memory_order_seq_cst) != expected_value)
+        {
+            return score::cpp::make_unexpected(os::Error::createFromErrno(EAGAIN));
+        }
+        std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(timeout, kPollInterval));
+#endif
+        return {};
+    }
+
+    score::cpp::expected_blank<os::Error> WakeAll(std::atomic<std::uint32_t>& futex_word) const noexcept override
+    {
+#if defined(__linux__)
+        if (::syscall(SYS_futex, GetPlainWord(futex_word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0) == -1)
+        {
+            return score::cpp::make_unexpected(os::Error::createFromErrno());
+        }
+#else
+        score::cpp::ignore = futex_word;
+#endif
+        return {};
+    }
+
+  private:
+#if defined(__linux__)
+    static std::uint32_t* GetPlainWord(std::atomic<std::uint32_t>& futex_word) noexcept
+    {
+        // Suppress "AUTOSAR C++14 A5-2-4" rule finding. This rule states: "reinterpret_cast shall not be used.".
+        // The futex syscall operates on the plain 32 bit word underlying the lock-free atomic, see static_assert above.
+        // coverity[autosar_cpp14_a5_2_4_violation]
+        return reinterpret_cast<std::uint32_t*>(&futex_word);
+    }
+#endif
+};
+
+}  // namespace
+
+Futex& Futex::instance() noexcept
+{
+    static FutexImpl instance;
+    return select_instance(instance);
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,60 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_H
+
+#include "score/os/ObjectSeam.h"
+#include "score/os/errno.h"
+
+#include <score/expected.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief OSAL style wrapper of the futex operations on a 32 bit word in shared memory.
+///
+/// The futex word may be shared between processes, so the operations don't use FUTEX_PRIVATE_FLAG. Tests replace the
+/// instance via os::MockGuard<FutexMock> (see futex_mock.h). On platforms without futexes, Wait() degrades to polling
+/// with a short sleep and WakeAll() does nothing.
+class Futex : public os::ObjectSeam<Futex>
+{
+  public:
+    static Futex& instance() noexcept;
+
+    /// \brief Blocks while the futex word contains the expected value, until it gets woken up by WakeAll() or the
+    /// timeout expired. Spurious wake-ups are possible, so callers have to re-check their condition.
+    /// \return error, e.g. EAGAIN in case the futex word didn't contain the expected value, ETIMEDOUT or EINTR.
+    virtual score::cpp::expected_blank<os::Error> Wait(std::atomic<std::uint32_t>& futex_word,
+                                                       const std::uint32_t expected_value,
+                                                       const std::chrono::nanoseconds timeout) const noexcept = 0;
+
+    /// \brief Wakes up all threads of all processes blocked in Wait() on the given futex word.
+    virtual score::cpp::expected_blank<os::Error> WakeAll(std::atomic<std::uint32_t>& futex_word) const noexcept = 0;
+
+    virtual ~Futex() = default;
+
+  protected:
+    Futex() noexcept = default;
+    Futex(Futex&&) noexcept = default;
+    Futex& operator=(Futex&&) noexcept = default;
+    Futex(const Futex&) noexcept = default;
+    Futex& operator=(const Futex&) noexcept = default;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_H
@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_MOCK_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_MOCK_H
+
+#include "score/mw/com/impl/bindings/lola/futex.h"
+
+#include <gmock/gmock.h>
+
+namespace score::mw::com::impl::lola
+{
+
+class FutexMock : public Futex
+{
+  public:
+    MOCK_METHOD((score::cpp::expected_blank<os::Error>),
+                Wait,
+                (std::atomic<std::uint32_t>&, const std::uint32_t, const std::chrono::nanoseconds),
+                (const, noexcept, override));
+    MOCK_METHOD((score::cpp::expected_blank<os::Error>),
+                WakeAll,
+                (std::atomic<std::uint32_t>&),
+                (const, noexcept, override));
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_FUTEX_MOCK_H
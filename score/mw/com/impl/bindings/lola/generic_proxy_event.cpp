@@ -19,6 +19,7 @@
 
 #include "score/language/safecpp/safe_math/safe_math.h"
 #include "score/memory/shared/pointer_arithmetic_util.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 #include "score/mw/log/logging.h"
 
 #include <score/assert.hpp>
@@ -173,8 +174,13 @@ Result<std::size_t> GenericProxyEvent::GetNewSamplesImpl(Callback&& receiver, Tr
         const auto* const object_start_address = &event_slots_array[aligned_size * slot_index];
         /* NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic) deviation ends here */
 
-        const EventSlotStatus event_slot_status{event_control.data_control[slot_index]};
-        const EventSlotStatus::EventTimeStamp sample_timestamp{event_slot_status.GetTimeStamp()};
+        // The timestamp is only needed as trace point data id, so it isn't read at all, if tracing is compiled out.
+        EventSlotStatus::EventTimeStamp sample_timestamp{0U};
+        if constexpr (impl::tracing::kIpcTracingCompiledIn)
+        {
+            const EventSlotStatus event_slot_status{event_control.data_control[slot_index]};
+            sample_timestamp = event_slot_status.GetTimeStamp();
+        }
 
         SamplePtr<void> sample{object_start_address, event_control.data_control, slot_index};
 
@@ -77,6 +77,31 @@ class GenericProxyEvent final : public GenericProxyEventBinding
     }
     void NotifyServiceInstanceChangedAvailability(bool is_available, pid_t new_event_source_pid) noexcept override;
 
+    /// \brief Returns the performance counters of this event (slot references, notifications, GetNewSamples batches).
+    /// \details All values stay 0, if the counters are compiled out (see kEventPerformanceCountersCompiledIn).
+    ProxyEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return proxy_event_common_.GetPerformanceCounterValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        proxy_event_common_.ResetPerformanceCounters();
+    }
+
+    /// \brief Returns the histogram of the latencies between the publishing of the samples by the provider and their
+    ///        reception by GetNewSamples().
+    /// \details Stays empty, if the provider doesn't record publish times (see kEventPublishTimesEnabled).
+    EventLatencyHistogramValues GetPublishLatencyHistogramValues() const noexcept
+    {
+        return proxy_event_common_.GetPublishLatencyHistogramValues();
+    }
+
+    void ResetPublishLatencyHistogram() noexcept
+    {
+        proxy_event_common_.ResetPublishLatencyHistogram();
+    }
+
   private:
     Result<std::size_t> GetNewSamplesImpl(Callback&& receiver, TrackerGuardFactory& tracker) noexcept;
     Result<std::size_t> GetNumNewSamplesAvailableImpl() const noexcept;
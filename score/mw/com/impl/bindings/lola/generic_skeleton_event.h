@@ -59,6 +59,23 @@ class GenericSkeletonEvent : public GenericSkeletonEventBinding
         return size_info_.size;
     }
 
+    std::size_t GetMaxAlignment() const noexcept override
+    {
+        return size_info_.alignment;
+    }
+
+    /// \brief Returns the performance counters of this event (slot allocation, dropped samples, notifications).
+    /// \details All values stay 0, if the counters are compiled out (see kEventPerformanceCountersCompiledIn).
+    SkeletonEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return skeleton_event_common_.GetPerformanceCounterValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        skeleton_event_common_.ResetPerformanceCounters();
+    }
+
   private:
     DataTypeMetaInfo size_info_;
     std::uint8_t* event_data_storage_;
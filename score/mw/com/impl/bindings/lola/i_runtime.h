@@ -14,11 +14,15 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_I_RUNTIME_H
 
 #include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
+#include "score/mw/com/impl/bindings/lola/proxy_attachment_cache.h"
 #include "score/mw/com/impl/bindings/lola/rollback_synchronization.h"
+#include "score/mw/com/impl/bindings/lola/shm_size_cache.h"
 #include "score/mw/com/impl/configuration/global_configuration.h"
 #include "score/mw/com/impl/configuration/shm_size_calc_mode.h"
 #include "score/mw/com/impl/i_binding_runtime.h"
 
+#include "score/concurrency/executor.h"
+
 #include <cstdint>
 
 namespace score::mw::com::impl::lola
@@ -42,8 +46,24 @@ class IRuntime : public impl::IBindingRuntime
     /// \brief returns configured mode, how shm-sizes shall be calculated.
     virtual ShmSizeCalculationMode GetShmSizeCalculationMode() const noexcept = 0;
 
+    /// \brief returns the cache for shm-sizes calculated via simulation.
+    /// \return valid pointer to the cache or nullptr in case calculated shm-sizes shall not be cached.
+    virtual ShmSizeCache* GetShmSizeCache() noexcept = 0;
+
     virtual RollbackSynchronization& GetRollbackSynchronization() noexcept = 0;
 
+    /// \brief returns the cache of the attachments to service instances, which are shared by the proxies of this
+    ///        process.
+    /// \return valid pointer to the cache or nullptr in case every proxy shall attach to its service instance on its
+    ///         own.
+    virtual ProxyAttachmentCache* GetProxyAttachmentCache() noexcept = 0;
+
+    /// \brief returns the executor, which rolls back the transaction logs of different events of a service instance
+    ///        concurrently after a restart of a proxy or skeleton.
+    /// \return valid pointer to the executor or nullptr in case the transaction logs shall be rolled back sequentially
+    ///         by the restarting thread.
+    virtual concurrency::Executor* GetRollbackExecutor() noexcept = 0;
+
     /// \brief We need our PID in several locations/frequently. So the runtime shall provide/cache it.
     virtual pid_t GetPid() const noexcept = 0;
 
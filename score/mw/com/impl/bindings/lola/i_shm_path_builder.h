@@ -28,10 +28,11 @@ namespace score::mw::com::impl::lola
 
 /// Utility class to generate paths to the shm files.
 ///
-/// There are up to three files per instance:
+/// There are up to four files per instance:
 /// - The QM control file
 /// - The ASIL B control file
 /// - The data storage file
+/// - The optional statistics file
 ///
 /// This class should be used to generate the paths to the files so that they can be mapped
 /// into the processes address space for further usage.
@@ -57,6 +58,13 @@ class IShmPathBuilder
     virtual std::string GetControlChannelShmName(const LolaServiceInstanceId::InstanceId instance_id,
                                                  const QualityType channel_type) const noexcept = 0;
 
+    /// Returns the path suitable for shm_open to the statistics shared memory.
+    ///
+    /// \param instance_id InstanceId of path to be created
+    /// \return The shm file name
+    virtual std::string GetStatisticsChannelShmName(
+        const LolaServiceInstanceId::InstanceId instance_id) const noexcept = 0;
+
     /// Returns the path suitable for shm_open to the method shared memory.
     ///
     /// \param instance_id InstanceId of path to be created
@@ -18,6 +18,7 @@
 #include "score/mw/com/impl/bindings/lola/methods/proxy_method_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/proxy_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/error_serializer.h"
@@ -77,6 +78,7 @@ using MethodReplyPayload = ErrorSerializer<MethodErrc>::SerializedErrorType;
 
 constexpr std::uint32_t kMaxSendSize{32U};
 constexpr std::uint32_t kMaxReplySize{32U};
+constexpr std::uint32_t kMaxQueuedLowPriorityMessages{64U};
 
 // TODO: make proper serialization
 template <typename T>
@@ -223,7 +225,9 @@ MessagePassingServiceInstance::MessagePassingServiceInstance(
 
     auto service_identifier = MessagePassingClientCache::CreateMessagePassingName(asil_level, self_pid_);
     score::message_passing::ServiceProtocolConfig protocol_config{service_identifier, kMaxSendSize, kMaxReplySize, 0U};
-    score::message_passing::IServerFactory::ServerConfig server_config{};
+    // The control messages (registrations, outdated node ids, method subscriptions) are sent with low priority, so
+    // that a burst of them (e.g. after a consumer restart) does not delay event notifications and method calls
+    score::message_passing::IServerFactory::ServerConfig server_config{0U, 0U, 0U, kMaxQueuedLowPriorityMessages};
     server_ = server_factory.Create(protocol_config, server_config);
 
     auto connect_callback = [](score::message_passing::IServerConnection& connection) noexcept -> std::uintptr_t {
@@ -714,7 +718,8 @@ Result<void> MessagePassingServiceInstance::CallSubscribeServiceMethodRemotely(
 
     std::array<std::uint8_t, sizeof(MethodReplyPayload)> reply{};
     score::cpp::span<std::uint8_t> reply_buffer{reply.data(), reply.size()};
-    const auto method_reply_result = sender->SendWaitReply(message, reply_buffer);
+    const auto method_reply_result = sender->SendWaitReplyWithPriority(
+        message, reply_buffer, score::message_passing::IClientConnection::Priority::kLow);
     if (!method_reply_result.has_value())
     {
         score::mw::log::LogError("lola")
@@ -855,6 +860,7 @@ std::uint32_t MessagePassingServiceInstance::NotifyEventLocally(const ElementFqI
     {
         return handlers_called;
     }
+    tracing::TraceRecorder::Record(tracing::TracePointType::kProxyEventNotificationReceived, event_id);
 
     // copy handlers to tmp-storage
     // tmp-storage for all handlers (weak_ptrs), which will get filled under read-lock
@@ -907,6 +913,8 @@ std::uint32_t MessagePassingServiceInstance::NotifyEventLocally(const ElementFqI
 
 void MessagePassingServiceInstance::NotifyEvent(const ElementFqId event_id) noexcept
 {
+    tracing::TraceRecorder::Record(tracing::TracePointType::kSkeletonEventNotify, event_id);
+
     // first we forward notification of event update to other LoLa processes, which are interested in this notification.
     // we do this first as message-sending is done synchronous/within the calling thread as it has "short"/deterministic
     // runtime.
@@ -1188,7 +1196,7 @@ void MessagePassingServiceInstance::NotifyOutdatedNodeId(const pid_t outdated_no
     // The object is a shared_ptr which is allocated in the heap.
     // coverity[autosar_cpp14_a18_5_8_violation]
     auto sender = client_cache_.GetMessagePassingClient(target_node_id);
-    const auto result = sender->Send(message);
+    const auto result = sender->SendWithPriority(message, score::message_passing::IClientConnection::Priority::kLow);
     if (!result.has_value())
     {
         score::mw::log::LogError("lola") << "MessagePassingService: Sending OutdatedNodeIdMessage to node_id "
@@ -1289,7 +1297,8 @@ void MessagePassingServiceInstance::UnregisterEventNotificationRemote(
         // shall have automatic storage duration". The object is a shared_ptr which is allocated in the heap.
         // coverity[autosar_cpp14_a18_5_8_violation]
         auto sender = client_cache_.GetMessagePassingClient(target_node_id);
-        const auto result = sender->Send(message);
+        const auto result =
+            sender->SendWithPriority(message, score::message_passing::IClientConnection::Priority::kLow);
         if (!result.has_value())
         {
             score::mw::log::LogError("lola")
@@ -1308,7 +1317,7 @@ void MessagePassingServiceInstance::SendRegisterEventNotificationMessage(const E
     // The object is a shared_ptr which is allocated in the heap.
     // coverity[autosar_cpp14_a18_5_8_violation]
     auto sender = client_cache_.GetMessagePassingClient(target_node_id);
-    const auto result = sender->Send(message);
+    const auto result = sender->SendWithPriority(message, score::message_passing::IClientConnection::Priority::kLow);
     if (!result.has_value())
     {
         score::mw::log::LogError("lola")
@@ -18,7 +18,6 @@
 #include <score/assert.hpp>
 
 #include <atomic>
-#include <iostream>
 
 namespace score::mw::com::impl::lola
 {
@@ -32,8 +31,12 @@ constexpr auto MAX_ALLOCATE_RETRIES = 100U;
 
 template <template <class> class AtomicIndirectorType>
 ProviderEventDataControlLocalView<AtomicIndirectorType>::ProviderEventDataControlLocalView(
-    EventDataControl& event_data_control) noexcept
-    : state_slots_{event_data_control.state_slots_.begin(), event_data_control.state_slots_.size()}
+    EventDataControl& event_data_control,
+    SkeletonEventPerformanceCounters* const performance_counters) noexcept
+    : state_slots_{event_data_control.state_slots_.begin(), event_data_control.state_slots_.size()},
+      publish_time_slots_{event_data_control.publish_time_slots_.begin(),
+                          event_data_control.publish_time_slots_.size()},
+      performance_counters_{performance_counters}
 {
 }
 
@@ -58,11 +61,11 @@ auto ProviderEventDataControlLocalView<AtomicIndirectorType>::AllocateNextSlot()
 
         if (TryAllocateSlot(oldest_unused_slot_info_result.value()).has_value())
         {
-            LogPerformanceMetrics(retry_counter);
+            CountAllocation(retry_counter, false);
             return oldest_unused_slot_info_result.value().slot_index;
         }
     }
-    LogPerformanceMetrics(retry_counter);
+    CountAllocation(retry_counter, true);
     return {};
 }
 
@@ -120,6 +123,12 @@ auto ProviderEventDataControlLocalView<AtomicIndirectorType>::EventReady(
 {
     const EventSlotStatus initial{time_stamp, 0U};
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(static_cast<std::size_t>(slot_index) < state_slots_.size());
+    if (!publish_time_slots_.empty())
+    {
+        // Published to the consumers by the following store of the slot status, which they load with acquire semantics
+        // when referencing the slot.
+        publish_time_slots_[slot_index].store(GetCurrentEventPublishTime(), std::memory_order_relaxed);
+    }
     state_slots_[slot_index].store(
         static_cast<EventSlotStatus::value_type>(initial));  // no race-condition can happen, since event sender has
                                                              // to be single-threaded/non-concurrent per AoU
@@ -157,6 +166,10 @@ auto ProviderEventDataControlLocalView<AtomicIndirectorType>::TryAllocateSlot(co
         state_slots_[slot_info.slot_index], old_slot_value, in_writing_value, std::memory_order_acq_rel);
     if (!was_slot_allocated)
     {
+        if (performance_counters_ != nullptr)
+        {
+            performance_counters_->CountAllocationCollision();
+        }
         return {};
     }
     return old_slot_value;
@@ -209,38 +222,15 @@ auto ProviderEventDataControlLocalView<AtomicIndirectorType>::RemoveAllocationsF
 }
 
 template <template <class> class AtomicIndirectorType>
-auto ProviderEventDataControlLocalView<AtomicIndirectorType>::DumpPerformanceCounters() -> void
+void ProviderEventDataControlLocalView<AtomicIndirectorType>::CountAllocation(const std::uint64_t retry_counter,
+                                                                              const bool allocation_failed) noexcept
 {
-    std::cout << "EventDataControl performance breakdown\n"
-              << "======================================\n"
-              << "\nnum_alloc_misses:  " << num_alloc_misses << "\nnum_alloc_retries: "
-              << num_alloc_retries
-              // Suppress AUTOSAR C++14 M8-4-4, rule finding: "A function identifier shall either be used to call
-              // the function or it shall be preceded by &". Passing std::endl to std::cout object with the stream
-              // operator follows the idiomatic way that both features in conjunction were designed in the C++
-              // standard. coverity[autosar_cpp14_m8_4_4_violation : FALSE]
-              << std::endl;
-}
-
-template <template <class> class AtomicIndirectorType>
-void ProviderEventDataControlLocalView<AtomicIndirectorType>::LogPerformanceMetrics(
-    std::uint64_t retry_counter) noexcept
-{
-    score::cpp::ignore = num_alloc_retries.fetch_add(retry_counter);
-
-    if ((retry_counter >= 100U))
+    if (performance_counters_ != nullptr)
     {
-        ++num_alloc_misses;
+        performance_counters_->CountAllocation(retry_counter, allocation_failed);
     }
 }
 
-template <template <class> class AtomicIndirectorType>
-auto ProviderEventDataControlLocalView<AtomicIndirectorType>::ResetPerformanceCounters() -> void
-{
-    num_alloc_misses.store(0U);
-    num_alloc_retries.store(0U);
-}
-
 template class ProviderEventDataControlLocalView<memory::shared::AtomicIndirectorReal>;
 template class ProviderEventDataControlLocalView<memory::shared::AtomicIndirectorMock>;
 
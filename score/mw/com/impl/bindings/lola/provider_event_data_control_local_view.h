@@ -15,6 +15,7 @@
 
 #include "score/mw/com/impl/bindings/lola/control_slot_types.h"
 #include "score/mw/com/impl/bindings/lola/event_data_control.h"
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
 #include "score/mw/com/impl/bindings/lola/event_slot_status.h"
 
 #include "score/memory/shared/atomic_indirector.h"
@@ -58,8 +59,12 @@ class ProviderEventDataControlLocalView final
     };
 
     using LocalEventControlSlots = score::cpp::span<ControlSlotType>;
+    using LocalEventPublishTimeSlots = score::cpp::span<EventDataControl::EventPublishTimeSlotType>;
 
-    ProviderEventDataControlLocalView(EventDataControl& event_data_control) noexcept;
+    /// \param performance_counters optional counters of the owning SkeletonEvent, which are updated on slot allocation.
+    ///        Have to outlive this view.
+    ProviderEventDataControlLocalView(EventDataControl& event_data_control,
+                                      SkeletonEventPerformanceCounters* const performance_counters = nullptr) noexcept;
 
     ~ProviderEventDataControlLocalView() noexcept = default;
 
@@ -82,6 +87,9 @@ class ProviderEventDataControlLocalView final
 
     /// \brief Indicates that a slot is ready for reading - writing has finished. (thread-safe, wait-free)
     /// \pre AllocateNextSlot() was invoked to obtain write-ownership
+    ///
+    /// \details If the EventDataControl has publish time slots, the current time is stored as publish time of the slot
+    /// before the slot is marked as ready.
     void EventReady(const SlotIndexType slot_index, const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
 
     /// \brief Marks selected slot as invalid, if it was not yet marked as ready
@@ -101,17 +109,13 @@ class ProviderEventDataControlLocalView final
     /// \details This function shall _only_ be called on skeleton side and _only_ if a previous skeleton instance died.
     void RemoveAllocationsForWriting() noexcept;
 
-    // helper for performance indication (no production usage)
-    static void DumpPerformanceCounters();
-    static void ResetPerformanceCounters();
-
   private:
     /// \brief Finds oldest unused slot within control slots, if there is any.
     /// \return if an unused slot is found, returns its index, otherwise, an empty optional is returned.
     std::optional<ProviderEventDataControlLocalView::SlotInfo> FindOldestUnusedSlot() const noexcept;
 
-    /// \brief Logs performance metrics for slot allocation attempts.
-    void LogPerformanceMetrics(std::uint64_t retry_counter) noexcept;
+    /// \brief Updates the performance counters (if any) for a slot allocation attempt.
+    void CountAllocation(const std::uint64_t retry_counter, const bool allocation_failed) noexcept;
 
     /// \brief Sets the slot value for the given slot index.
     ///
@@ -120,10 +124,8 @@ class ProviderEventDataControlLocalView final
     void SetSlotValue(const SlotInfo slot_info) noexcept;
 
     LocalEventControlSlots state_slots_;
-
-    // helper variables to calculated performance indicators
-    static inline std::atomic_uint_fast64_t num_alloc_misses{0U};
-    static inline std::atomic_uint_fast64_t num_alloc_retries{0U};
+    LocalEventPublishTimeSlots publish_time_slots_;
+    SkeletonEventPerformanceCounters* performance_counters_;
 };
 
 }  // namespace score::mw::com::impl::lola
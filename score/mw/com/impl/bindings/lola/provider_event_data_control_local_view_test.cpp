@@ -73,10 +73,11 @@ class ProviderEventDataControlLocalViewFixture : public ::testing::Test
     }
 
     ProviderEventDataControlLocalViewFixture& GivenAProviderEventDataControlLocalViewUsingRealAtomics(
-        const SlotIndexType max_slots)
+        const SlotIndexType max_slots,
+        const bool with_publish_times = false)
     {
-        event_data_control_ = std::make_unique<EventDataControl>(max_slots, memory_);
-        unit_ = std::make_unique<ProviderEventDataControlLocalView<>>(*event_data_control_);
+        event_data_control_ = std::make_unique<EventDataControl>(max_slots, memory_, with_publish_times);
+        unit_ = std::make_unique<ProviderEventDataControlLocalView<>>(*event_data_control_, &performance_counters_);
 
         return *this;
     }
@@ -90,7 +91,7 @@ class ProviderEventDataControlLocalViewFixture : public ::testing::Test
         memory::shared::AtomicIndirectorMock<EventSlotStatus::value_type>::SetMockObject(atomic_mock_.get());
 
         unit_mock_ = std::make_unique<ProviderEventDataControlLocalView<memory::shared::AtomicIndirectorMock>>(
-            *event_data_control_);
+            *event_data_control_, &performance_counters_);
 
         return *this;
     }
@@ -106,6 +107,7 @@ class ProviderEventDataControlLocalViewFixture : public ::testing::Test
 
     FakeMemoryResource memory_{};
     std::unique_ptr<memory::shared::AtomicMock<EventSlotStatus::value_type>> atomic_mock_{nullptr};
+    SkeletonEventPerformanceCounters performance_counters_{};
 
     std::unique_ptr<EventDataControl> event_data_control_{nullptr};
     std::unique_ptr<ProviderEventDataControlLocalView<>> unit_{nullptr};
@@ -256,6 +258,36 @@ TEST_F(ProviderEventDataControlLocalViewFixture, DiscardedElementAfterWritingIsN
     EXPECT_EQ((*unit_)[slot.value()].GetReferenceCount(), 0);
 }
 
+TEST_F(ProviderEventDataControlLocalViewFixture, EventReadyStoresThePublishTimeIfPublishTimesAreRecorded)
+{
+    // Given an EventDataControl with publish time slots
+    GivenAProviderEventDataControlLocalViewUsingRealAtomics(kMaxSlots, true);
+    ASSERT_EQ(event_data_control_->publish_time_slots_.size(), kMaxSlots);
+
+    // When a slot is allocated and marked as ready
+    const auto time_before_event_ready = GetCurrentEventPublishTime();
+    const auto slot = WithAnAllocatedSlot();
+    const auto time_after_event_ready = GetCurrentEventPublishTime();
+
+    // Then the current time is stored as publish time of the slot
+    const auto publish_time = event_data_control_->publish_time_slots_[slot].load();
+    EXPECT_GE(publish_time, time_before_event_ready);
+    EXPECT_LE(publish_time, time_after_event_ready);
+}
+
+TEST_F(ProviderEventDataControlLocalViewFixture, NoPublishTimeSlotsAreCreatedIfPublishTimesAreNotRecorded)
+{
+    // Given an EventDataControl without publish time slots
+    GivenAProviderEventDataControlLocalViewUsingRealAtomics(kMaxSlots, false);
+
+    // When a slot is allocated and marked as ready
+    const auto slot = WithAnAllocatedSlot(3U);
+
+    // Then the slot is ready and there are no publish time slots
+    EXPECT_EQ((*unit_)[slot].GetTimeStamp(), 3U);
+    EXPECT_EQ(event_data_control_->publish_time_slots_.size(), 0U);
+}
+
 TEST_F(ProviderEventDataControlLocalViewFixture, CanNotAllocateSlotIfAllSlotsAllocated)
 {
     // Given an initialized EventDataControl structure where all slots are allocated
@@ -272,6 +304,56 @@ TEST_F(ProviderEventDataControlLocalViewFixture, CanNotAllocateSlotIfAllSlotsAll
     EXPECT_FALSE(slot.has_value());
 }
 
+TEST_F(ProviderEventDataControlLocalViewFixture, RetriesAndCollisionsOfAllocationAreCounted)
+{
+    // Given an initialized EventDataControl structure with performance counters
+    score::cpp::ignore = GivenAProviderEventDataControlLocalViewUsingMockedAtomics(kMaxSlots);
+
+    // Expecting that all slots are candidates for allocation
+    EXPECT_CALL(*atomic_mock_, load(_)).WillRepeatedly([] {
+        EventSlotStatus invalid_event_slot_status{};
+        return static_cast<EventSlotStatus::value_type>(invalid_event_slot_status);
+    });
+
+    // and that the first two compare-and-swap operations fail due to another thread modifying the atomic concurrently
+    EXPECT_CALL(*atomic_mock_, compare_exchange_strong(_, _, _))
+        .WillOnce(Return(false))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+
+    // When allocating a slot
+    const auto slot = unit_mock_->AllocateNextSlot();
+    ASSERT_TRUE(slot.has_value());
+
+    // Then one allocation with two retries and two collisions is counted
+    const auto values = performance_counters_.GetValues();
+    EXPECT_EQ(values.number_of_allocations, kEventPerformanceCountersCompiledIn ? 1U : 0U);
+    EXPECT_EQ(values.number_of_allocation_retries, kEventPerformanceCountersCompiledIn ? 2U : 0U);
+    EXPECT_EQ(values.number_of_allocation_collisions, kEventPerformanceCountersCompiledIn ? 2U : 0U);
+    EXPECT_EQ(values.number_of_allocation_failures, 0U);
+}
+
+TEST_F(ProviderEventDataControlLocalViewFixture, FailedAllocationIsCounted)
+{
+    // Given an initialized EventDataControl structure with performance counters, where all slots are allocated
+    GivenAProviderEventDataControlLocalViewUsingRealAtomics(kMaxSlots);
+    for (auto counter = 0; counter < 5; ++counter)
+    {
+        unit_->AllocateNextSlot();
+    }
+    performance_counters_.Reset();
+
+    // When trying to allocate another slot
+    const auto slot = unit_->AllocateNextSlot();
+    ASSERT_FALSE(slot.has_value());
+
+    // Then one failed allocation is counted
+    const auto values = performance_counters_.GetValues();
+    EXPECT_EQ(values.number_of_allocations, kEventPerformanceCountersCompiledIn ? 1U : 0U);
+    EXPECT_EQ(values.number_of_allocation_failures, kEventPerformanceCountersCompiledIn ? 1U : 0U);
+    EXPECT_EQ(values.number_of_allocation_collisions, 0U);
+}
+
 TEST_F(ProviderEventDataControlLocalViewFixture, CanAllocateSlotAfterOneSlotReady)
 {
     // Given an initialized EventDataControl structure where all slots are allocated
@@ -235,7 +235,8 @@ score::Result<void> ExecutePartialRestartLogic(const QualityType quality_type,
                                                                      skeleton_instance_identifier,
                                                                      quality_type,
                                                                      service_data_storage.skeleton_pid_,
-                                                                     transaction_log_id};
+                                                                     transaction_log_id,
+                                                                     lola_runtime.GetRollbackExecutor()};
     const auto rollback_result = transaction_log_rollback_executor.RollbackTransactionLogs();
     if (!rollback_result.has_value())
     {
@@ -246,6 +247,71 @@ score::Result<void> ExecutePartialRestartLogic(const QualityType quality_type,
     return {};
 }
 
+/// \brief Attaches to the service instance of the given handle: Places a shared flock on its usage marker file, opens
+///        its shm-objects and executes the transaction log rollback.
+/// \return the attachment or nullptr, if any of these steps failed.
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". The std::bad_optional_access could be thrown from 'service_instance_usage_marker_file.value()',
+// in case 'service_instance_usage_marker_file' doesn't have value but as we check before with 'has_value()'
+// so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+std::shared_ptr<ProxyAttachment> AttachToServiceInstance(const HandleType& handle) noexcept
+{
+    const auto& instance_deployment = GetLoLaInstanceDeployment(handle);
+    const auto& lola_service_deployment = GetLoLaServiceTypeDeployment(handle);
+
+    auto service_instance_id = handle.GetInstanceId();
+    const auto lola_service_instance_id = GetServiceInstanceIdBinding<LolaServiceInstanceId>(service_instance_id);
+
+    PartialRestartPathBuilder partial_restart_builder{lola_service_deployment.service_id_};
+    const auto service_instance_usage_marker_file_path =
+        partial_restart_builder.GetServiceInstanceUsageMarkerFilePath(lola_service_instance_id.GetId());
+
+    auto service_instance_usage_marker_file = memory::shared::LockFile::Open(service_instance_usage_marker_file_path);
+    if (!service_instance_usage_marker_file.has_value())
+    {
+        score::mw::log::LogError("lola") << "Could not open marker file: " << service_instance_usage_marker_file_path;
+        return nullptr;
+    }
+
+    constexpr std::uint8_t kMaxFlockRetries{3U};
+    auto service_instance_usage_mutex_and_lock =
+        PlaceSharedLockOnUsageMarkerFileWithRetry(service_instance_usage_marker_file.value(),
+                                                  std::string_view(service_instance_usage_marker_file_path),
+                                                  kMaxFlockRetries);
+    if (!service_instance_usage_mutex_and_lock)
+    {
+        return nullptr;
+    }
+
+    QualityType quality_type{handle.GetServiceInstanceDeployment().asilLevel_};
+
+    const auto shared_memory =
+        OpenSharedMemory(instance_deployment, quality_type, lola_service_deployment, lola_service_instance_id);
+
+    if ((shared_memory.first == nullptr) || (shared_memory.second == nullptr))
+    {
+        return nullptr;
+    }
+    const auto& control_ref = *shared_memory.first.get();
+    const auto& data_ref = *shared_memory.second.get();
+
+    const SkeletonInstanceIdentifier skeleton_instance_identifier{lola_service_deployment.service_id_,
+                                                                  lola_service_instance_id.GetId()};
+    const auto partial_restart_result =
+        ExecutePartialRestartLogic(quality_type, skeleton_instance_identifier, control_ref, data_ref);
+
+    if (!partial_restart_result.has_value())
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<ProxyAttachment>(std::move(service_instance_usage_marker_file).value(),
+                                             std::move(service_instance_usage_mutex_and_lock),
+                                             shared_memory.first,
+                                             shared_memory.second);
+}
+
 }  // namespace
 
 namespace detail_proxy
@@ -322,58 +388,32 @@ ElementFqId Proxy::EventNameToElementFqIdConverter::Convert(const std::string_vi
     return {service_id_, event_it->second, instance_id_, ServiceElementType::EVENT};
 }
 
-// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
-// implicitly". The std::bad_optional_access could be thrown from 'service_instance_usage_marker_file.value()',
-// in case 'service_instance_usage_marker_file' doesn't have value but as we check before with 'has_value()'
-// so no way for throwing std::bad_optional_access which leds to std::terminate().
-// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
 std::unique_ptr<Proxy> Proxy::Create(const HandleType handle) noexcept
 {
-    const auto& instance_deployment = GetLoLaInstanceDeployment(handle);
     const auto& lola_service_deployment = GetLoLaServiceTypeDeployment(handle);
 
     auto service_instance_id = handle.GetInstanceId();
     const auto lola_service_instance_id = GetServiceInstanceIdBinding<LolaServiceInstanceId>(service_instance_id);
 
-    PartialRestartPathBuilder partial_restart_builder{lola_service_deployment.service_id_};
-    const auto service_instance_usage_marker_file_path =
-        partial_restart_builder.GetServiceInstanceUsageMarkerFilePath(lola_service_instance_id.GetId());
-
-    auto service_instance_usage_marker_file = memory::shared::LockFile::Open(service_instance_usage_marker_file_path);
-    if (!service_instance_usage_marker_file.has_value())
-    {
-        score::mw::log::LogError("lola") << "Could not open marker file: " << service_instance_usage_marker_file_path;
-        return nullptr;
-    }
+    QualityType quality_type{handle.GetServiceInstanceDeployment().asilLevel_};
 
-    constexpr std::uint8_t kMaxFlockRetries{3U};
-    auto service_instance_usage_mutex_and_lock =
-        PlaceSharedLockOnUsageMarkerFileWithRetry(service_instance_usage_marker_file.value(),
-                                                  std::string_view(service_instance_usage_marker_file_path),
-                                                  kMaxFlockRetries);
-    if (!service_instance_usage_mutex_and_lock)
+    // Further proxies for a service instance, which is already in use by another proxy of this process, share its
+    // attachment instead of flocking, opening and rolling back again.
+    auto* const attachment_cache = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetProxyAttachmentCache();
+    std::shared_ptr<ProxyAttachment> attachment{};
+    if (attachment_cache != nullptr)
     {
-        return nullptr;
+        const SkeletonInstanceIdentifier skeleton_instance_identifier{lola_service_deployment.service_id_,
+                                                                      lola_service_instance_id.GetId()};
+        attachment = attachment_cache->GetOrCreate(skeleton_instance_identifier, quality_type, [&handle]() noexcept {
+            return AttachToServiceInstance(handle);
+        });
     }
-
-    QualityType quality_type{handle.GetServiceInstanceDeployment().asilLevel_};
-
-    const auto shared_memory =
-        OpenSharedMemory(instance_deployment, quality_type, lola_service_deployment, lola_service_instance_id);
-
-    if ((shared_memory.first == nullptr) || (shared_memory.second == nullptr))
+    else
     {
-        return nullptr;
+        attachment = AttachToServiceInstance(handle);
     }
-    const auto& control_ref = *shared_memory.first.get();
-    const auto& data_ref = *shared_memory.second.get();
-
-    const SkeletonInstanceIdentifier skeleton_instance_identifier{lola_service_deployment.service_id_,
-                                                                  lola_service_instance_id.GetId()};
-    const auto partial_restart_result =
-        ExecutePartialRestartLogic(quality_type, skeleton_instance_identifier, control_ref, data_ref);
-
-    if (!partial_restart_result.has_value())
+    if (attachment == nullptr)
     {
         return nullptr;
     }
@@ -392,17 +432,33 @@ std::unique_ptr<Proxy> Proxy::Create(const HandleType handle) noexcept
     EventNameToElementFqIdConverter event_name_to_element_fq_id_converter{lola_service_deployment,
                                                                           lola_service_instance_id.GetId()};
     const auto filesystem = filesystem::FilesystemFactory{}.CreateInstance();
-    return std::make_unique<Proxy>(shared_memory.first,
-                                   shared_memory.second,
+    return std::make_unique<Proxy>(std::move(attachment),
                                    quality_type,
                                    event_name_to_element_fq_id_converter,
                                    handle,
-                                   std::move(service_instance_usage_marker_file),
-                                   std::move(service_instance_usage_mutex_and_lock),
                                    filesystem,
                                    proxy_instance_counter_result.value());
 }
 
+Proxy::Proxy(std::shared_ptr<ProxyAttachment> attachment,
+             const QualityType quality_type,
+             EventNameToElementFqIdConverter event_name_to_element_fq_id_converter,
+             HandleType handle,
+             score::filesystem::Filesystem filesystem,
+             ProxyInstanceIdentifier::ProxyInstanceCounter proxy_instance_counter) noexcept
+    : Proxy(attachment->GetControl(),
+            attachment->GetData(),
+            quality_type,
+            std::move(event_name_to_element_fq_id_converter),
+            std::move(handle),
+            std::nullopt,
+            nullptr,
+            std::move(filesystem),
+            proxy_instance_counter)
+{
+    attachment_ = std::move(attachment);
+}
+
 Proxy::Proxy(std::shared_ptr<memory::shared::ManagedMemoryResource> control,
              std::shared_ptr<memory::shared::ManagedMemoryResource> data,
              const QualityType quality_type,
@@ -414,6 +470,7 @@ Proxy::Proxy(std::shared_ptr<memory::shared::ManagedMemoryResource> control,
              score::filesystem::Filesystem filesystem,
              ProxyInstanceIdentifier::ProxyInstanceCounter proxy_instance_counter) noexcept
     : ProxyBinding{},
+      attachment_{nullptr},
       control_{std::move(control)},
       data_{std::move(data)},
       method_shm_resource_{nullptr},
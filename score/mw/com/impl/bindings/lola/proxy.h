@@ -20,6 +20,7 @@
 #include "score/mw/com/impl/bindings/lola/methods/method_data.h"
 #include "score/mw/com/impl/bindings/lola/methods/offered_state_machine.h"
 #include "score/mw/com/impl/bindings/lola/methods/type_erased_call_queue.h"
+#include "score/mw/com/impl/bindings/lola/proxy_attachment_cache.h"
 #include "score/mw/com/impl/bindings/lola/proxy_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/proxy_method.h"
 #include "score/mw/com/impl/bindings/lola/proxy_service_data_control_local_view.h"
@@ -129,6 +130,15 @@ class Proxy : public ProxyBinding
           score::filesystem::Filesystem filesystem,
           ProxyInstanceIdentifier::ProxyInstanceCounter proxy_instance_counter) noexcept;
 
+    /// \brief Creates a Proxy, which uses an attachment to the service instance, that may be shared with other Proxy
+    ///        instances of this process (see ProxyAttachmentCache).
+    Proxy(std::shared_ptr<ProxyAttachment> attachment,
+          const QualityType quality_type,
+          EventNameToElementFqIdConverter event_name_to_element_fq_id_converter,
+          HandleType handle,
+          score::filesystem::Filesystem filesystem,
+          ProxyInstanceIdentifier::ProxyInstanceCounter proxy_instance_counter) noexcept;
+
     /// Returns the address of the control structure, for the given event ID.
     ///
     /// Terminates if the event control structure cannot be found.
@@ -216,6 +226,9 @@ class Proxy : public ProxyBinding
             enabled_method_data) const;
     std::string GetMethodChannelShmName() const;
 
+    /// \brief Attachment to the service instance, which might be shared with other Proxy instances. Empty, if this
+    ///        Proxy owns its shm-objects and usage marker file flock exclusively.
+    std::shared_ptr<ProxyAttachment> attachment_;
     std::shared_ptr<memory::shared::ManagedMemoryResource> control_;
     std::shared_ptr<memory::shared::ManagedMemoryResource> data_;
     std::shared_ptr<memory::shared::ManagedMemoryResource> method_shm_resource_;
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/proxy_attachment_cache.h"
+
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+ProxyAttachment::ProxyAttachment(memory::shared::LockFile service_instance_usage_marker_file,
+                                 std::unique_ptr<SharedFlockMutexAndLock> service_instance_usage_flock_mutex_and_lock,
+                                 std::shared_ptr<memory::shared::ManagedMemoryResource> control,
+                                 std::shared_ptr<memory::shared::ManagedMemoryResource> data) noexcept
+    : service_instance_usage_marker_file_{std::move(service_instance_usage_marker_file)},
+      service_instance_usage_flock_mutex_and_lock_{std::move(service_instance_usage_flock_mutex_and_lock)},
+      control_{std::move(control)},
+      data_{std::move(data)}
+{
+}
+
+ProxyAttachment::~ProxyAttachment() noexcept = default;
+
+std::shared_ptr<ProxyAttachment> ProxyAttachmentCache::GetOrCreate(
+    const SkeletonInstanceIdentifier skeleton_instance_identifier,
+    const QualityType quality_type,
+    CreateAttachmentCallback create_attachment) noexcept
+{
+    std::shared_ptr<std::mutex> creation_mutex{};
+    {
+        const std::lock_guard<std::mutex> lock{attachments_mutex_};
+        PruneExpiredEntries();
+        auto& cache_entry = attachments_[skeleton_instance_identifier][quality_type];
+        auto attachment = cache_entry.attachment.lock();
+        if (attachment != nullptr)
+        {
+            return attachment;
+        }
+        creation_mutex = cache_entry.creation_mutex;
+    }
+
+    // Another thread may have created the attachment, while we were waiting for the creation mutex. Since we share the
+    // creation mutex, the entry can't have been pruned in the meantime.
+    const std::lock_guard<std::mutex> creation_lock{*creation_mutex};
+    {
+        const std::lock_guard<std::mutex> lock{attachments_mutex_};
+        auto attachment = attachments_[skeleton_instance_identifier][quality_type].attachment.lock();
+        if (attachment != nullptr)
+        {
+            return attachment;
+        }
+    }
+
+    auto attachment = create_attachment();
+    if (attachment != nullptr)
+    {
+        const std::lock_guard<std::mutex> lock{attachments_mutex_};
+        attachments_[skeleton_instance_identifier][quality_type].attachment = attachment;
+    }
+    return attachment;
+}
+
+void ProxyAttachmentCache::PruneExpiredEntries() noexcept
+{
+    for (auto instance_it = attachments_.begin(); instance_it != attachments_.end();)
+    {
+        auto& quality_entries = instance_it->second;
+        for (auto quality_it = quality_entries.begin(); quality_it != quality_entries.end();)
+        {
+            const auto& cache_entry = quality_it->second;
+            // The creation mutex is only shared under attachments_mutex_, so its use count is stable here.
+            const bool is_being_created{cache_entry.creation_mutex.use_count() > 1};
+            if (cache_entry.attachment.expired() && !is_being_created)
+            {
+                quality_it = quality_entries.erase(quality_it);
+            }
+            else
+            {
+                ++quality_it;
+            }
+        }
+        if (quality_entries.empty())
+        {
+            instance_it = attachments_.erase(instance_it);
+        }
+        else
+        {
+            ++instance_it;
+        }
+    }
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,126 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_PROXY_ATTACHMENT_CACHE_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_PROXY_ATTACHMENT_CACHE_H
+
+#include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+
+#include "score/memory/shared/flock/flock_mutex_and_lock.h"
+#include "score/memory/shared/flock/shared_flock_mutex.h"
+#include "score/memory/shared/lock_file.h"
+#include "score/memory/shared/managed_memory_resource.h"
+
+#include <score/callback.hpp>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace score::mw::com::impl::lola
+{
+
+class ProxyAttachmentCacheAttorney;
+
+/// \brief Resources, with which a Proxy is attached to a provided service instance: The shared flock on the usage
+///        marker file of the service instance and the opened control (for the quality of the proxy) and data
+///        shm-objects.
+///
+/// The transaction log rollback (partial restart) has already been done for the attached service instance, when an
+/// attachment gets created. Releasing the last reference to an attachment releases the flock and the shm-objects.
+class ProxyAttachment final
+{
+  public:
+    using SharedFlockMutexAndLock = memory::shared::FlockMutexAndLock<memory::shared::SharedFlockMutex>;
+
+    ProxyAttachment(memory::shared::LockFile service_instance_usage_marker_file,
+                    std::unique_ptr<SharedFlockMutexAndLock> service_instance_usage_flock_mutex_and_lock,
+                    std::shared_ptr<memory::shared::ManagedMemoryResource> control,
+                    std::shared_ptr<memory::shared::ManagedMemoryResource> data) noexcept;
+
+    ProxyAttachment(const ProxyAttachment&) = delete;
+    ProxyAttachment& operator=(const ProxyAttachment&) = delete;
+    ProxyAttachment(ProxyAttachment&&) = delete;
+    ProxyAttachment& operator=(ProxyAttachment&&) = delete;
+    ~ProxyAttachment() noexcept;
+
+    const std::shared_ptr<memory::shared::ManagedMemoryResource>& GetControl() const noexcept
+    {
+        return control_;
+    }
+
+    const std::shared_ptr<memory::shared::ManagedMemoryResource>& GetData() const noexcept
+    {
+        return data_;
+    }
+
+  private:
+    /// \brief The flock has to be released before the lock file gets closed, therefore the lock file is declared
+    ///        first, so that it gets destroyed last.
+    memory::shared::LockFile service_instance_usage_marker_file_;
+    std::unique_ptr<SharedFlockMutexAndLock> service_instance_usage_flock_mutex_and_lock_;
+    std::shared_ptr<memory::shared::ManagedMemoryResource> control_;
+    std::shared_ptr<memory::shared::ManagedMemoryResource> data_;
+};
+
+/// \brief Process wide cache of the ProxyAttachments, which are currently in use by Proxy instances.
+///
+/// Opening the usage marker file, flocking it, opening the shm-objects and executing the transaction log rollback
+/// only has to be done by the first Proxy of a process for a given service instance and quality. All further Proxies
+/// for the same service instance and quality share its attachment as long as at least one of them is alive.
+class ProxyAttachmentCache final
+{
+    // Suppress "AUTOSAR C++14 A11-3-1", The rule declares: "Friend declarations shall not be used".
+    // The "ProxyAttachmentCacheAttorney" class is a helper, which inspects the internal state of
+    // "ProxyAttachmentCache" and is used for testing purposes only.
+    // coverity[autosar_cpp14_a11_3_1_violation]
+    friend class ProxyAttachmentCacheAttorney;
+
+  public:
+    using CreateAttachmentCallback = score::cpp::callback<std::shared_ptr<ProxyAttachment>()>;
+
+    /// \brief Returns the attachment, which is currently in use for the given service instance and quality, or
+    ///        creates it via the given callback.
+    ///
+    /// The callback is called without holding the lock of the cache, so that creating an attachment (which may block
+    /// on flocks and opens shm-objects) doesn't block Proxies of other service instances. Concurrent creations for the
+    /// same service instance and quality are serialized, so that it gets attached only once.
+    /// \param create_attachment called to create the attachment, if there is none in use. May return nullptr, if the
+    ///        attachment can't be created. In this case nothing gets cached.
+    /// \return shared attachment or nullptr, if it had to be created and creation failed.
+    std::shared_ptr<ProxyAttachment> GetOrCreate(const SkeletonInstanceIdentifier skeleton_instance_identifier,
+                                                 const QualityType quality_type,
+                                                 CreateAttachmentCallback create_attachment) noexcept;
+
+  private:
+    struct CacheEntry
+    {
+        std::weak_ptr<ProxyAttachment> attachment{};
+        /// \brief Held while the attachment of this entry gets created. The entry must not be pruned, while this
+        ///        mutex is shared with a creating thread.
+        std::shared_ptr<std::mutex> creation_mutex{std::make_shared<std::mutex>()};
+    };
+
+    /// \brief Removes the entries of all attachments, which have been released by their last user and which are not
+    ///        being created right now. Must be called with attachments_mutex_ held.
+    void PruneExpiredEntries() noexcept;
+
+    std::unordered_map<SkeletonInstanceIdentifier, std::unordered_map<QualityType, CacheEntry>> attachments_{};
+    /// \brief Protects attachments_. Only held for lookups and inserts, never while an attachment gets created.
+    std::mutex attachments_mutex_{};
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_PROXY_ATTACHMENT_CACHE_H
@@ -0,0 +1,269 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/proxy_attachment_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+class ProxyAttachmentCacheAttorney
+{
+  public:
+    explicit ProxyAttachmentCacheAttorney(ProxyAttachmentCache& proxy_attachment_cache) noexcept
+        : proxy_attachment_cache_{proxy_attachment_cache}
+    {
+    }
+
+    std::size_t GetNumberOfCacheEntries() noexcept
+    {
+        const std::lock_guard<std::mutex> lock{proxy_attachment_cache_.attachments_mutex_};
+        std::size_t number_of_cache_entries{0U};
+        for (const auto& quality_entries : proxy_attachment_cache_.attachments_)
+        {
+            number_of_cache_entries += quality_entries.second.size();
+        }
+        return number_of_cache_entries;
+    }
+
+  private:
+    ProxyAttachmentCache& proxy_attachment_cache_;
+};
+
+namespace
+{
+
+const std::string kLockFilePath{"/tmp/proxy_attachment_cache_test_lock_file"};
+constexpr SkeletonInstanceIdentifier kSkeletonInstanceIdentifier{LolaServiceId{1U}, 2U};
+constexpr SkeletonInstanceIdentifier kOtherSkeletonInstanceIdentifier{LolaServiceId{1U}, 3U};
+
+class ProxyAttachmentCacheFixture : public ::testing::Test
+{
+  protected:
+    ProxyAttachmentCache::CreateAttachmentCallback CreateAttachment() noexcept
+    {
+        return [this]() noexcept -> std::shared_ptr<ProxyAttachment> {
+            ++create_attachment_call_count_;
+            return CreateAttachmentWithLockFile();
+        };
+    }
+
+    ProxyAttachmentCache::CreateAttachmentCallback FailToCreateAttachment() noexcept
+    {
+        return [this]() noexcept -> std::shared_ptr<ProxyAttachment> {
+            ++create_attachment_call_count_;
+            return nullptr;
+        };
+    }
+
+    std::shared_ptr<ProxyAttachment> CreateAttachmentWithLockFile() noexcept
+    {
+        auto lock_file = memory::shared::LockFile::Create(kLockFilePath + std::to_string(++lock_file_count_));
+        if (!lock_file.has_value())
+        {
+            return nullptr;
+        }
+        return std::make_shared<ProxyAttachment>(std::move(lock_file).value(), nullptr, nullptr, nullptr);
+    }
+
+    ProxyAttachmentCache unit_{};
+    std::atomic<std::uint32_t> create_attachment_call_count_{0U};
+    std::atomic<std::uint32_t> lock_file_count_{0U};
+};
+
+TEST_F(ProxyAttachmentCacheFixture, CreatesAttachmentIfNoneIsInUse)
+{
+    // When getting an attachment from an empty cache
+    const auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then the attachment gets created
+    EXPECT_NE(attachment, nullptr);
+    EXPECT_EQ(create_attachment_call_count_, 1U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, ReturnsAttachmentInUseForSameServiceInstanceAndQuality)
+{
+    // Given an attachment, which is in use
+    const auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+    ASSERT_NE(attachment, nullptr);
+
+    // When getting an attachment for the same service instance and quality
+    const auto second_attachment =
+        unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then the attachment in use is returned without creating a new one
+    EXPECT_EQ(second_attachment, attachment);
+    EXPECT_EQ(create_attachment_call_count_, 1U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, CreatesSeparateAttachmentsForOtherQualityAndServiceInstance)
+{
+    // Given an attachment, which is in use
+    const auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+    ASSERT_NE(attachment, nullptr);
+
+    // When getting attachments for another quality and for another service instance
+    const auto asil_b_attachment =
+        unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_B, CreateAttachment());
+    const auto other_instance_attachment =
+        unit_.GetOrCreate(kOtherSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then new attachments get created for both
+    EXPECT_NE(asil_b_attachment, attachment);
+    EXPECT_NE(other_instance_attachment, attachment);
+    EXPECT_EQ(create_attachment_call_count_, 3U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, CreatesNewAttachmentAfterLastUserReleasedIt)
+{
+    // Given an attachment, which was in use but got released by its last user
+    auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+    ASSERT_NE(attachment, nullptr);
+    attachment.reset();
+
+    // When getting an attachment for the same service instance and quality
+    const auto new_attachment =
+        unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then a new attachment gets created
+    EXPECT_NE(new_attachment, nullptr);
+    EXPECT_EQ(create_attachment_call_count_, 2U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, FailedCreationIsNotCached)
+{
+    // Given a failed attempt to create an attachment
+    const auto failed_attachment =
+        unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, FailToCreateAttachment());
+    EXPECT_EQ(failed_attachment, nullptr);
+
+    // When getting an attachment for the same service instance and quality again
+    const auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then the creation is tried again
+    EXPECT_NE(attachment, nullptr);
+    EXPECT_EQ(create_attachment_call_count_, 2U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, CreatingAnAttachmentDoesNotBlockAttachmentsOfOtherServiceInstances)
+{
+    // Given an attachment, whose creation is in progress on another thread
+    std::promise<void> creation_started{};
+    std::promise<void> finish_creation{};
+    auto finish_creation_future = finish_creation.get_future();
+    std::thread creating_thread{[this, &creation_started, &finish_creation_future]() {
+        const auto attachment = unit_.GetOrCreate(
+            kSkeletonInstanceIdentifier,
+            QualityType::kASIL_QM,
+            [this, &creation_started, &finish_creation_future]() noexcept -> std::shared_ptr<ProxyAttachment> {
+                creation_started.set_value();
+                finish_creation_future.wait();
+                return CreateAttachmentWithLockFile();
+            });
+        EXPECT_NE(attachment, nullptr);
+    }};
+    creation_started.get_future().wait();
+
+    // When getting an attachment for another service instance
+    const auto other_instance_attachment =
+        unit_.GetOrCreate(kOtherSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then it gets created without waiting for the other creation to finish
+    EXPECT_NE(other_instance_attachment, nullptr);
+    EXPECT_EQ(create_attachment_call_count_, 1U);
+
+    finish_creation.set_value();
+    creating_thread.join();
+}
+
+TEST_F(ProxyAttachmentCacheFixture, ConcurrentlyGettingTheSameAttachmentCreatesItOnlyOnce)
+{
+    constexpr std::size_t kNumberOfThreads{8U};
+
+    // When several threads concurrently get an attachment for the same service instance and quality
+    std::promise<void> start{};
+    auto start_future = start.get_future().share();
+    std::vector<std::shared_ptr<ProxyAttachment>> attachments(kNumberOfThreads);
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([this, start_future, &attachments, thread_index]() {
+            start_future.wait();
+            attachments[thread_index] =
+                unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+        });
+    }
+    start.set_value();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then the attachment is created only once and shared by all threads
+    EXPECT_EQ(create_attachment_call_count_, 1U);
+    for (const auto& attachment : attachments)
+    {
+        EXPECT_NE(attachment, nullptr);
+        EXPECT_EQ(attachment, attachments.front());
+    }
+}
+
+TEST_F(ProxyAttachmentCacheFixture, PrunesEntriesOfReleasedAttachmentsOnLookup)
+{
+    // Given two attachments of different service instances, of which one has been released by its last user
+    auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+    const auto other_instance_attachment =
+        unit_.GetOrCreate(kOtherSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+    ASSERT_NE(attachment, nullptr);
+    ASSERT_NE(other_instance_attachment, nullptr);
+    attachment.reset();
+    ProxyAttachmentCacheAttorney attorney{unit_};
+    EXPECT_EQ(attorney.GetNumberOfCacheEntries(), 2U);
+
+    // When looking up the attachment in use
+    const auto looked_up_attachment =
+        unit_.GetOrCreate(kOtherSkeletonInstanceIdentifier, QualityType::kASIL_QM, CreateAttachment());
+
+    // Then the entry of the released attachment is removed from the cache
+    EXPECT_EQ(looked_up_attachment, other_instance_attachment);
+    EXPECT_EQ(attorney.GetNumberOfCacheEntries(), 1U);
+}
+
+TEST_F(ProxyAttachmentCacheFixture, PrunesEntriesOfFailedCreationsOnLookup)
+{
+    // Given a failed attempt to create an attachment
+    const auto failed_attachment =
+        unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_QM, FailToCreateAttachment());
+    EXPECT_EQ(failed_attachment, nullptr);
+
+    // When getting an attachment for another quality
+    const auto attachment = unit_.GetOrCreate(kSkeletonInstanceIdentifier, QualityType::kASIL_B, CreateAttachment());
+
+    // Then only the entry of the created attachment remains in the cache
+    EXPECT_NE(attachment, nullptr);
+    EXPECT_EQ(ProxyAttachmentCacheAttorney{unit_}.GetNumberOfCacheEntries(), 1U);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -19,6 +19,7 @@
 #include "score/mw/com/impl/sample_reference_tracker.h"
 #include "score/mw/com/impl/subscription_state.h"
 #include "score/mw/com/impl/tracing/i_tracing_runtime.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 
 #include "score/mw/log/logging.h"
 #include "score/result/result.h"
@@ -121,6 +122,31 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
         return proxy_event_common_.GetElementFQId();
     };
 
+    /// \brief Returns the performance counters of this event (slot references, notifications, GetNewSamples batches).
+    /// \details All values stay 0, if the counters are compiled out (see kEventPerformanceCountersCompiledIn).
+    ProxyEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return proxy_event_common_.GetPerformanceCounterValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        proxy_event_common_.ResetPerformanceCounters();
+    }
+
+    /// \brief Returns the histogram of the latencies between the publishing of the samples by the provider and their
+    ///        reception by GetNewSamples().
+    /// \details Stays empty, if the provider doesn't record publish times (see kEventPublishTimesEnabled).
+    EventLatencyHistogramValues GetPublishLatencyHistogramValues() const noexcept
+    {
+        return proxy_event_common_.GetPublishLatencyHistogramValues();
+    }
+
+    void ResetPublishLatencyHistogram() noexcept
+    {
+        proxy_event_common_.ResetPublishLatencyHistogram();
+    }
+
   private:
     Result<std::size_t> GetNewSamplesImpl(Callback&& receiver, TrackerGuardFactory& tracker) noexcept;
     Result<std::size_t> GetNumNewSamplesAvailableImpl() const noexcept;
@@ -187,23 +213,28 @@ inline Result<std::size_t> ProxyEvent<SampleType>::GetNewSamplesImpl(Callback&&
     for (auto slot_index_it = slot_indices.begin; slot_index_it != slot_indices.end; ++slot_index_it)
     {
         const SampleType& sample_data{samples_.at(static_cast<std::size_t>(*slot_index_it))};
-        const EventSlotStatus event_slot_status{event_control.data_control[*slot_index_it]};
-        const EventSlotStatus::EventTimeStamp sample_timestamp{event_slot_status.GetTimeStamp()};
+        static_assert(
+            sizeof(EventSlotStatus::EventTimeStamp) == sizeof(impl::tracing::ITracingRuntime::TracePointDataId),
+            "Event timestamp is used for the trace point data id, therefore, the types should be the same.");
+        // The timestamp is only needed as trace point data id, so it isn't read at all, if tracing is compiled out.
+        impl::tracing::ITracingRuntime::TracePointDataId trace_point_data_id{0U};
+        if constexpr (impl::tracing::kIpcTracingCompiledIn)
+        {
+            const EventSlotStatus event_slot_status{event_control.data_control[*slot_index_it]};
+            trace_point_data_id =
+                static_cast<impl::tracing::ITracingRuntime::TracePointDataId>(event_slot_status.GetTimeStamp());
+        }
 
         SamplePtr<SampleType> sample{&sample_data, event_control.data_control, *slot_index_it};
 
         auto guard = std::move(*tracker.TakeGuard());
         auto sample_binding_independent = this->MakeSamplePtr(std::move(sample), std::move(guard));
 
-        static_assert(
-            sizeof(EventSlotStatus::EventTimeStamp) == sizeof(impl::tracing::ITracingRuntime::TracePointDataId),
-            "Event timestamp is used for the trace point data id, therefore, the types should be the same.");
         // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
         // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
         // we can't add noexcept to score::cpp::callback signature.
         // coverity[autosar_cpp14_a15_4_2_violation]
-        receiver(std::move(sample_binding_independent),
-                 static_cast<impl::tracing::ITracingRuntime::TracePointDataId>(sample_timestamp));
+        receiver(std::move(sample_binding_independent), trace_point_data_id);
     }
 
     const auto num_collected_slots = static_cast<std::size_t>(std::distance(slot_indices.begin, slot_indices.end));
@@ -13,8 +13,10 @@
 #include "score/mw/com/impl/bindings/lola/proxy_event_common.h"
 
 #include "score/mw/com/impl/bindings/lola/i_runtime.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
 #include "score/mw/com/impl/runtime.h"
 
+#include <iterator>
 #include <limits>
 #include <sstream>
 
@@ -34,13 +36,20 @@ ProxyEventCommon::ProxyEventCommon(Proxy& parent, const ElementFqId element_fq_i
                                         event_fq_id_,
                                         GetEventSourcePid(),
                                         event_control_local_,
-                                        transaction_log_id_}
+                                        transaction_log_id_},
+      performance_counters_{std::make_shared<ProxyEventPerformanceCounters>()},
+      publish_latency_histogram_{},
+      counting_receive_handler_scope_{},
+      counting_receive_handler_{}
 {
+    event_control_local_.data_control.SetPerformanceCounters(performance_counters_.get());
+    event_control_local_.data_control.SetTracedElementFqId(event_fq_id_);
 }
 
 ProxyEventCommon::~ProxyEventCommon()
 {
     Unsubscribe();
+    event_control_local_.data_control.SetPerformanceCounters(nullptr);
 }
 
 Result<void> ProxyEventCommon::Subscribe(const std::size_t max_sample_count)
@@ -95,11 +104,44 @@ SlotCollector::SlotIndices ProxyEventCommon::GetNewSamplesSlotIndices(const std:
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
         slot_collector.has_value(),
         "GetNewSamplesSlotIndices must be called after the slot collector is instantiated by calling Subscribe().");
-    return slot_collector.value().GetNewSamplesSlotIndices(max_count);
+    tracing::TraceRecorder::Record(tracing::TracePointType::kProxyEventGetNewSamples, event_fq_id_);
+    const auto slot_indices = slot_collector.value().GetNewSamplesSlotIndices(max_count);
+    performance_counters_->CountGetNewSamples(
+        static_cast<std::size_t>(std::distance(slot_indices.begin, slot_indices.end)));
+    RecordPublishLatencies(slot_indices);
+    return slot_indices;
+}
+
+void ProxyEventCommon::RecordPublishLatencies(const SlotCollector::SlotIndices& slot_indices) noexcept
+{
+    // Without publish times, there is nothing to record, so the clock isn't read.
+    if ((slot_indices.begin == slot_indices.end) || (!event_control_local_.data_control.HasPublishTimes()))
+    {
+        return;
+    }
+
+    // All samples of a batch are received at the same time. The slots stay referenced until the samples are handed out,
+    // so their publish times can't change concurrently.
+    const auto receive_time = GetCurrentEventPublishTime();
+    for (auto slot_index = slot_indices.begin; slot_index != slot_indices.end; ++slot_index)
+    {
+        const auto publish_time = event_control_local_.data_control.GetPublishTime(*slot_index);
+        if (!publish_time.has_value())
+        {
+            return;
+        }
+        // Guards against a publish time in the future, which only a misbehaving provider could have written.
+        const auto latency_ns = (receive_time > publish_time.value()) ? (receive_time - publish_time.value()) : 0U;
+        publish_latency_histogram_.Record(latency_ns);
+    }
 }
 
 Result<void> ProxyEventCommon::SetReceiveHandler(std::weak_ptr<ScopedEventReceiveHandler> handler)
 {
+    if constexpr (kEventPerformanceCountersCompiledIn)
+    {
+        handler = CreateCountingReceiveHandler(std::move(handler));
+    }
     subscription_event_state_machine_.SetReceiveHandler(std::move(handler));
     return {};
 }
@@ -107,9 +149,29 @@ Result<void> ProxyEventCommon::SetReceiveHandler(std::weak_ptr<ScopedEventReceiv
 Result<void> ProxyEventCommon::UnsetReceiveHandler()
 {
     subscription_event_state_machine_.UnsetReceiveHandler();
+    counting_receive_handler_.reset();
     return {};
 }
 
+std::weak_ptr<ScopedEventReceiveHandler> ProxyEventCommon::CreateCountingReceiveHandler(
+    std::weak_ptr<ScopedEventReceiveHandler> handler)
+{
+    // The counting handler only captures what it owns, so a call, which is still running on a messaging thread, stays
+    // valid when this handler is replaced or unset. Calls of the user provided handler are still controlled by its own
+    // scope. Creating a new scope expires the scope of a previously created counting handler.
+    auto counting_handler = [performance_counters = performance_counters_, handler = std::move(handler)]() noexcept {
+        performance_counters->CountReceivedNotification();
+        if (auto current_handler = handler.lock())
+        {
+            score::cpp::ignore = (*current_handler)();
+        }
+    };
+    counting_receive_handler_scope_ = safecpp::Scope<>{};
+    counting_receive_handler_ =
+        std::make_shared<ScopedEventReceiveHandler>(counting_receive_handler_scope_, std::move(counting_handler));
+    return counting_receive_handler_;
+}
+
 pid_t ProxyEventCommon::GetEventSourcePid() const noexcept
 {
     return parent_.GetSourcePid();
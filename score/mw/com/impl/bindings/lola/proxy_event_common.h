@@ -16,7 +16,9 @@
 #include "score/mw/com/impl/bindings/lola/consumer_event_control_local_view.h"
 #include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/event_control.h"
+#include "score/mw/com/impl/bindings/lola/event_latency_histogram.h"
 #include "score/mw/com/impl/bindings/lola/event_meta_info.h"
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
 #include "score/mw/com/impl/bindings/lola/proxy.h"
 #include "score/mw/com/impl/bindings/lola/slot_collector.h"
 #include "score/mw/com/impl/bindings/lola/subscription_state_machine.h"
@@ -24,12 +26,14 @@
 #include "score/mw/com/impl/scoped_event_receive_handler.h"
 #include "score/mw/com/impl/subscription_state.h"
 
+#include "score/language/safecpp/scoped_function/scope.h"
 #include "score/result/result.h"
 
 #include <score/assert.hpp>
 #include <score/optional.hpp>
 #include <score/utility.hpp>
 
+#include <memory>
 #include <mutex>
 #include <string_view>
 
@@ -94,7 +98,36 @@ class ProxyEventCommon final
     std::optional<std::uint16_t> GetMaxSampleCount() const noexcept;
     void NotifyServiceInstanceChangedAvailability(const bool is_available, const pid_t new_event_source_pid) noexcept;
 
+    ProxyEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return performance_counters_->GetValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        performance_counters_->Reset();
+    }
+
+    EventLatencyHistogramValues GetPublishLatencyHistogramValues() const noexcept
+    {
+        return publish_latency_histogram_.GetValues();
+    }
+
+    void ResetPublishLatencyHistogram() noexcept
+    {
+        publish_latency_histogram_.Reset();
+    }
+
   private:
+    /// \brief Records the publish-to-receive latencies of the samples in the given slots, if the provider records
+    ///        publish times.
+    void RecordPublishLatencies(const SlotCollector::SlotIndices& slot_indices) noexcept;
+
+    /// \brief Wraps the user provided receive handler into a handler, which counts the received notifications before
+    ///        calling it.
+    std::weak_ptr<ScopedEventReceiveHandler> CreateCountingReceiveHandler(
+        std::weak_ptr<ScopedEventReceiveHandler> handler);
+
     /// \brief Manually insert a slot collector. Only used for tests.
     // Suppress "AUTOSAR C++14 A0-1-3" rule finding. This rule states: "Every function defined in an anonymous
     // namespace, or static function with internal linkage, or private member function shall be used.".
@@ -112,6 +145,17 @@ class ProxyEventCommon final
     TransactionLogId transaction_log_id_;
     ConsumerEventControlLocalView& event_control_local_;
     SubscriptionStateMachine subscription_event_state_machine_;
+
+    /// \brief Performance counters of this event, which are also updated by the ConsumerEventDataControlLocalView.
+    /// \details Shared with the counting receive handler, which may still run on a messaging thread after this
+    /// ProxyEventCommon has been destroyed.
+    std::shared_ptr<ProxyEventPerformanceCounters> performance_counters_;
+
+    /// \brief Latencies between the publishing of the samples by the provider and their reception in
+    ///        GetNewSamplesSlotIndices(). Stays empty, if the provider doesn't record publish times.
+    EventLatencyHistogram publish_latency_histogram_;
+    safecpp::Scope<> counting_receive_handler_scope_;
+    std::shared_ptr<ScopedEventReceiveHandler> counting_receive_handler_;
 };
 
 }  // namespace score::mw::com::impl::lola
@@ -136,6 +136,25 @@ TYPED_TEST(LolaProxyEventCommonFixture, RegisterEventHandlerAfterSubscription)
         this->proxy_event_->SetReceiveHandler(FromMockFunction(event_receive_handler_scope, this->event_handler_)));
 }
 
+TYPED_TEST(LolaProxyEventCommonFixture, ReceivedNotificationsAreCounted)
+{
+    safecpp::Scope<> event_receive_handler_scope{};
+
+    // Given a subscribed ProxyEvent
+    this->InitialiseProxyAndEvent();
+    const std::size_t max_sample_count{1U};
+    ASSERT_TRUE(this->proxy_event_->Subscribe(max_sample_count));
+
+    // When a receive handler is registered, which gets called once on registration
+    this->ExpectCallbackRegistration();
+    ASSERT_TRUE(
+        this->proxy_event_->SetReceiveHandler(FromMockFunction(event_receive_handler_scope, this->event_handler_)));
+
+    // Then one received notification is counted
+    EXPECT_EQ(this->proxy_event_->GetPerformanceCounterValues().number_of_received_notifications,
+              kEventPerformanceCountersCompiledIn ? 1U : 0U);
+}
+
 TYPED_TEST(LolaProxyEventCommonFixture, DoNotRegisterEventHandler)
 {
     this->InitialiseProxyAndEvent();
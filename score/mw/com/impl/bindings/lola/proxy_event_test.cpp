@@ -378,6 +378,67 @@ TYPED_TEST(LolaProxyEventGetNewSamplesFixture, DoNotReceiveEventsFromThePast)
     EXPECT_EQ(new_num_samples.value(), 0);
 }
 
+TYPED_TEST(LolaProxyEventGetNewSamplesFixture, BatchSizesOfGetNewSamplesAreCounted)
+{
+    // Given a ProxyEvent that has subscribed to a SkeletonEvent containing two samples
+    const std::size_t max_sample_count_subscription{5U};
+    this->GivenAProxyEvent(this->element_fq_id_, this->event_name_)
+        .ThatIsSubscribedWithMaxSamples(max_sample_count_subscription)
+        .WithSkeletonEventData(
+            {{kDummySampleValue, kDummyInputTimestamp}, {kDummySampleValue + 1U, kDummyInputTimestamp + 1U}});
+
+    // When calling GetNewSamples twice, where the second call doesn't find any new sample
+    const std::size_t max_samples{5U};
+    score::cpp::ignore = this->GetNewSamples([](auto, auto) noexcept {}, max_samples);
+    score::cpp::ignore = this->GetNewSamples([](auto, auto) noexcept {}, max_samples);
+
+    // Then both calls and their batch sizes are counted
+    const auto values = this->test_proxy_event_->GetPerformanceCounterValues();
+    if constexpr (kEventPerformanceCountersCompiledIn)
+    {
+        EXPECT_EQ(values.number_of_get_new_samples_calls, 2U);
+        EXPECT_EQ(values.number_of_received_samples, 2U);
+        EXPECT_EQ(values.max_batch_size, 2U);
+        EXPECT_EQ(values.batch_size_histogram.at(0U), 1U);
+        EXPECT_EQ(values.batch_size_histogram.at(2U), 1U);
+    }
+    else
+    {
+        EXPECT_EQ(values.number_of_get_new_samples_calls, 0U);
+    }
+
+    // and when resetting the counters
+    this->test_proxy_event_->ResetPerformanceCounters();
+
+    // Then all counters are 0 again
+    EXPECT_EQ(this->test_proxy_event_->GetPerformanceCounterValues().number_of_get_new_samples_calls, 0U);
+    EXPECT_EQ(this->test_proxy_event_->GetPerformanceCounterValues().max_batch_size, 0U);
+}
+
+TYPED_TEST(LolaProxyEventGetNewSamplesFixture, PublishLatenciesOfReceivedSamplesAreRecorded)
+{
+    // Given a ProxyEvent that has subscribed to a SkeletonEvent containing two samples
+    const std::size_t max_sample_count_subscription{5U};
+    this->GivenAProxyEvent(this->element_fq_id_, this->event_name_)
+        .ThatIsSubscribedWithMaxSamples(max_sample_count_subscription)
+        .WithSkeletonEventData(
+            {{kDummySampleValue, kDummyInputTimestamp}, {kDummySampleValue + 1U, kDummyInputTimestamp + 1U}});
+
+    // When calling GetNewSamples
+    const std::size_t max_samples{5U};
+    score::cpp::ignore = this->GetNewSamples([](auto, auto) noexcept {}, max_samples);
+
+    // Then the latencies of both samples are recorded, if the skeleton records publish times
+    const auto values = this->test_proxy_event_->GetPublishLatencyHistogramValues();
+    EXPECT_EQ(values.number_of_samples, kEventPublishTimesEnabled ? 2U : 0U);
+
+    // and when resetting the histogram
+    this->test_proxy_event_->ResetPublishLatencyHistogram();
+
+    // Then it is empty again
+    EXPECT_EQ(this->test_proxy_event_->GetPublishLatencyHistogramValues().number_of_samples, 0U);
+}
+
 TYPED_TEST(LolaProxyEventGetNewSamplesFixture, TransmitEventInShmArea)
 {
     this->RecordProperty("Verifies", "SCR-6367235");
@@ -257,6 +257,27 @@ TEST_F(ProxyCreationFixture, ProxyCreationReturnsNullPtrWhenProxyInstanceCounter
     EXPECT_EQ(proxy_result, nullptr);
 }
 
+TEST_F(ProxyCreationFixture, ProxiesForSameServiceInstanceShareAttachmentIfRuntimeProvidesCache)
+{
+    // Given a LoLa runtime, which provides a proxy attachment cache
+    ProxyAttachmentCache proxy_attachment_cache{};
+    ON_CALL(binding_runtime_, GetProxyAttachmentCache()).WillByDefault(Return(&proxy_attachment_cache));
+
+    // Expecting that the shared memory control and data regions are opened only once
+    EXPECT_CALL(shared_memory_factory_mock_guard_.mock_, Open(StartsWith(kShmControlPathPrefix), true, _))
+        .WillOnce(Return(fake_data_->control_memory));
+    EXPECT_CALL(shared_memory_factory_mock_guard_.mock_, Open(StartsWith(kShmDataPathPrefix), false, _))
+        .WillOnce(Return(fake_data_->data_memory));
+
+    // When creating two proxies for the same service instance
+    InitialiseProxyWithCreate(identifier_);
+    const auto second_proxy = Proxy::Create(make_HandleType(identifier_));
+
+    // Then both proxies are valid
+    EXPECT_NE(proxy_, nullptr);
+    EXPECT_NE(second_proxy, nullptr);
+}
+
 using ProxyCreationDeathTest = ProxyCreationFixture;
 TEST_F(ProxyCreationDeathTest, CreatingProxyWithoutLolaInstanceDeploymentTerminates)
 {
@@ -757,6 +778,28 @@ TEST_F(ProxyTransactionLogRollbackFixture, RollbackWillBeCalledOnExistingTransac
     EXPECT_FALSE(IsProxyTransactionLogIdRegistered(*transaction_log_set_, transaction_log_id_));
 }
 
+TEST_F(ProxyTransactionLogRollbackFixture, RollbackOnCreationUsesRollbackExecutorOfRuntime)
+{
+    // Given a fake Skeleton and SkeletonEvent which sets up an EventDataControl containing a TransactionLogSet
+    // with a TransactionLog which contains valid transactions
+    InsertProxyTransactionLogWithValidTransactions(*consumer_event_data_control_local_,
+                                                   event_control_->subscription_control,
+                                                   event_control_->transaction_log_set_,
+                                                   subscription_max_sample_count_,
+                                                   transaction_log_id_);
+    ON_CALL(binding_runtime_, GetApplicationId()).WillByDefault(Return(transaction_log_id_));
+
+    // Expecting that the rollback executor is retrieved from the runtime
+    EXPECT_CALL(binding_runtime_, GetRollbackExecutor()).WillOnce(Return(nullptr));
+
+    // When creating a proxy
+    InitialiseProxyWithCreate(instance_identifier_);
+    EXPECT_NE(proxy_, nullptr);
+
+    // Then the TransactionLog should be rollbacked during construction and removed
+    EXPECT_FALSE(IsProxyTransactionLogIdRegistered(*transaction_log_set_, transaction_log_id_));
+}
+
 TEST_F(ProxyTransactionLogRollbackFixture, RollbackWillBeNotBeCalledOnNonExistingTransactionLogOnCreation)
 {
     // Given a fake Skeleton and SkeletonEvent which sets up an EventDataControl containing a TransactionLogSet
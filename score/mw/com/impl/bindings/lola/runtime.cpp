@@ -25,10 +25,28 @@
 #include <vector>
 
 #include "score/mw/com/impl/bindings/lola/messaging/message_passing_service_instance_factory.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/service_discovery_client.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/shared_memory_service_discovery_client.h"
 
 namespace score::mw::com::impl::lola
 {
 
+namespace
+{
+
+std::unique_ptr<IServiceDiscoveryClient> CreateServiceDiscoveryClient(const Configuration& config,
+                                                                      concurrency::Executor& long_running_threads)
+{
+    const auto backend = config.GetGlobalConfiguration().GetServiceDiscoveryBackend();
+    if (backend == ServiceDiscoveryBackend::kSharedMemoryRegistry)
+    {
+        return std::make_unique<SharedMemoryServiceDiscoveryClient>(long_running_threads);
+    }
+    return std::make_unique<ServiceDiscoveryClient>(long_running_threads);
+}
+
+}  // namespace
+
 /// \brief Determines the unique identifier for this application instance.
 /// \details This function implements the logic to select the application identifier. It prioritizes the
 ///          explicitly configured 'applicationID' from the global configuration. If that is not present,
@@ -68,9 +86,11 @@ Runtime::Runtime(const Configuration& config,
                                   ? std::optional<AsilSpecificCfg>{Runtime::GetMessagePassingCfg(QualityType::kASIL_B)}
                                   : std::nullopt,
                               std::make_unique<MessagePassingServiceInstanceFactory>()},
-      service_discovery_client_{long_running_threads_},
+      service_discovery_client_{CreateServiceDiscoveryClient(config, long_running_threads_)},
       tracing_runtime_{std::move(lola_tracing_runtime)},
       rollback_data_{},
+      shm_size_cache_{config.GetGlobalConfiguration().GetShmSizeCacheFilePath()},
+      proxy_attachment_cache_{},
       pid_{os::Unistd::instance().getpid()},
       application_id_{DetermineApplicationIdentifier(config)}
 {
@@ -168,6 +188,21 @@ ShmSizeCalculationMode Runtime::GetShmSizeCalculationMode() const noexcept
     return configuration_.GetGlobalConfiguration().GetShmSizeCalcMode();
 }
 
+ShmSizeCache* Runtime::GetShmSizeCache() noexcept
+{
+    return &shm_size_cache_;
+}
+
+ProxyAttachmentCache* Runtime::GetProxyAttachmentCache() noexcept
+{
+    return &proxy_attachment_cache_;
+}
+
+concurrency::Executor* Runtime::GetRollbackExecutor() noexcept
+{
+    return &long_running_threads_;
+}
+
 IServiceDiscoveryClient& Runtime::GetServiceDiscoveryClient() noexcept
 {
     // Suppress "AUTOSAR C++14 A9-3-1" rule finding: "Member functions shall not return non-const “raw” pointers or
@@ -177,7 +212,7 @@ IServiceDiscoveryClient& Runtime::GetServiceDiscoveryClient() noexcept
     // holder. API callers get the reference and use it in place without leaving the scope, so the reference remains
     // valid.
     // coverity[autosar_cpp14_a9_3_1_violation]
-    return service_discovery_client_;
+    return *service_discovery_client_;
 }
 
 RollbackSynchronization& Runtime::GetRollbackSynchronization() noexcept
@@ -16,9 +16,11 @@
 #include "score/mw/com/impl/bindings/lola/i_runtime.h"
 #include "score/mw/com/impl/bindings/lola/messaging/message_passing_service.h"
 #include "score/mw/com/impl/bindings/lola/rollback_synchronization.h"
-#include "score/mw/com/impl/bindings/lola/service_discovery/client/service_discovery_client.h"
+#include "score/mw/com/impl/bindings/lola/proxy_attachment_cache.h"
+#include "score/mw/com/impl/bindings/lola/shm_size_cache.h"
 #include "score/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
 #include "score/mw/com/impl/configuration/configuration.h"
+#include "score/mw/com/impl/i_service_discovery_client.h"
 
 #include "score/concurrency/executor.h"
 
@@ -76,10 +78,16 @@ class Runtime final : public IRuntime
 
     ShmSizeCalculationMode GetShmSizeCalculationMode() const noexcept override;
 
+    ShmSizeCache* GetShmSizeCache() noexcept override;
+
     IServiceDiscoveryClient& GetServiceDiscoveryClient() noexcept override;
 
     RollbackSynchronization& GetRollbackSynchronization() noexcept override;
 
+    ProxyAttachmentCache* GetProxyAttachmentCache() noexcept override;
+
+    concurrency::Executor* GetRollbackExecutor() noexcept override;
+
     pid_t GetPid() const noexcept override;
 
     GlobalConfiguration::ApplicationId GetApplicationId() const noexcept override;
@@ -89,9 +97,13 @@ class Runtime final : public IRuntime
     concurrency::Executor& long_running_threads_;
     score::cpp::stop_source lola_messaging_stop_source_;
     MessagePassingService lola_messaging_service_;
-    ServiceDiscoveryClient service_discovery_client_;
+    /// \brief Either the flag-file based ServiceDiscoveryClient or the SharedMemoryServiceDiscoveryClient, depending on
+    ///        the configured ServiceDiscoveryBackend.
+    std::unique_ptr<IServiceDiscoveryClient> service_discovery_client_;
     std::unique_ptr<lola::tracing::TracingRuntime> tracing_runtime_;
     RollbackSynchronization rollback_data_;
+    ShmSizeCache shm_size_cache_;
+    ProxyAttachmentCache proxy_attachment_cache_;
 
     /// \brief Helper func aggregates allowed_user_ids of the given quality type into aggregated_allowed_users. If
     ///        allowed_user_ids is empty (no access restriction!), then aggregated_allowed_users is cleared!
@@ -37,11 +37,16 @@ class RuntimeMock : public IRuntime
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
+    MOCK_METHOD(ShmSizeCache*, GetShmSizeCache, (), (noexcept, override));
+    // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(impl::tracing::IBindingTracingRuntime*, GetTracingRuntime, (), (noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(RollbackSynchronization&, GetRollbackSynchronization, (), (noexcept, override));
+    MOCK_METHOD(ProxyAttachmentCache*, GetProxyAttachmentCache, (), (noexcept, override));
+    // coverity[autosar_cpp14_m3_9_1_violation]
+    MOCK_METHOD(concurrency::Executor*, GetRollbackExecutor, (), (noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(pid_t, GetPid, (), (const, noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
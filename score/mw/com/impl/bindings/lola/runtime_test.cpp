@@ -409,6 +409,33 @@ TEST_F(RuntimeFixture, CanRetrieveShmSizeCalculationMode)
     EXPECT_EQ(actual_shm_size_calc_mode, expected_shm_size_calc_mode);
 }
 
+TEST_F(RuntimeFixture, ProvidesShmSizeCache)
+{
+    // When getting the shm size cache from the runtime
+    auto* const shm_size_cache = unit_->GetShmSizeCache();
+
+    // Then a cache is returned
+    EXPECT_NE(shm_size_cache, nullptr);
+}
+
+TEST_F(RuntimeFixture, ProvidesProxyAttachmentCache)
+{
+    // When getting the proxy attachment cache from the runtime
+    auto* const proxy_attachment_cache = unit_->GetProxyAttachmentCache();
+
+    // Then a cache is returned
+    EXPECT_NE(proxy_attachment_cache, nullptr);
+}
+
+TEST_F(RuntimeFixture, RollsBackTransactionLogsOnLongRunningThreads)
+{
+    // When getting the rollback executor from the runtime
+    auto* const rollback_executor = unit_->GetRollbackExecutor();
+
+    // Then the executor of the long running threads given to the runtime is returned
+    EXPECT_EQ(rollback_executor, &long_running_threads_);
+}
+
 TEST_F(RuntimeDeathTest, CanRetrieveServiceDiscoveryClient)
 {
     EXPECT_NO_FATAL_FAILURE(unit_->GetServiceDiscoveryClient());
@@ -0,0 +1,523 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/service_discovery_client.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/shared_memory_service_discovery_client.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/flag_file.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/test/file_system_guard.h"
+#include "score/mw/com/impl/configuration/test/configuration_store.h"
+#include "score/mw/com/impl/enriched_instance_identifier.h"
+#include "score/mw/com/impl/find_service_handle.h"
+#include "score/mw/com/impl/handle_type.h"
+#include "score/mw/com/impl/i_service_discovery.h"
+#include "score/mw/com/impl/i_service_discovery_client.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+#include "score/filesystem/factory/filesystem_factory.h"
+
+#include <benchmark/benchmark.h>
+#include <score/optional.hpp>
+#include <score/utility.hpp>
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace score::mw::com::impl::lola::test
+{
+namespace
+{
+
+// Service id which is not used by any real deployment, so that the benchmarks do not interfere with running
+// applications and can remove their flag files afterwards.
+constexpr LolaServiceId kBenchmarkServiceId{0xBE00U};
+
+constexpr std::chrono::seconds kWaitTimeout{10};
+
+/// \brief The service discovery backends the benchmarks are run for
+/// \details New backends shall be added here and in MakeClient(), so that all the benchmarks are run for them as well.
+enum class Backend : std::int64_t
+{
+    kFlagFile = 0,
+    kSharedMemoryRegistry = 1,
+};
+
+std::unique_ptr<IServiceDiscoveryClient> MakeClient(const Backend backend,
+                                                    concurrency::Executor& long_running_threads)
+{
+    if (backend == Backend::kSharedMemoryRegistry)
+    {
+        return std::make_unique<SharedMemoryServiceDiscoveryClient>(long_running_threads);
+    }
+    return std::make_unique<ServiceDiscoveryClient>(long_running_threads);
+}
+
+/// \brief Configuration of one instance with id instance_id of the benchmark service, or of the find any search if no
+/// id is given.
+ConfigurationStore MakeConfigurationStore(const score::cpp::optional<LolaServiceInstanceId> instance_id)
+{
+    return ConfigurationStore{InstanceSpecifier::Create(std::string{"/bench/service_discovery"}).value(),
+                              make_ServiceIdentifierType("/bench/service_discovery/Service"),
+                              QualityType::kASIL_QM,
+                              kBenchmarkServiceId,
+                              instance_id};
+}
+
+std::vector<ConfigurationStore> MakeInstances(const std::size_t first_instance_id, const std::size_t count)
+{
+    std::vector<ConfigurationStore> instances{};
+    instances.reserve(count);
+    for (std::size_t offset = 0U; offset < count; ++offset)
+    {
+        instances.push_back(MakeConfigurationStore(
+            LolaServiceInstanceId{static_cast<LolaServiceInstanceId::InstanceId>(first_instance_id + offset)}));
+    }
+    return instances;
+}
+
+filesystem::Path GetBenchmarkServicePath()
+{
+    return GetSearchPathForIdentifier(MakeConfigurationStore({}).GetEnrichedInstanceIdentifier());
+}
+
+void ReportLatencyPercentiles(benchmark::State& state, std::vector<double>& latencies_ns)
+{
+    if (latencies_ns.empty())
+    {
+        return;
+    }
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    const auto percentile = [&latencies_ns](const double fraction) {
+        const auto index = static_cast<std::size_t>(fraction * static_cast<double>(latencies_ns.size() - 1U));
+        return latencies_ns[index];
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p90_ns"] = percentile(0.9);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["max_ns"] = latencies_ns.back();
+}
+
+/// \brief Snapshot of the process wide resource usage, to report its growth over a benchmark run.
+///
+/// procfs and inotify are Linux specific, so on other operating systems only the context switches are reported. The
+/// read / write syscall counts of /proc/self/io are the closest to a syscall count which is available without tracing
+/// (use `strace -c` or `perf trace -s` for a full breakdown).
+class ResourceUsage
+{
+  public:
+    static ResourceUsage Now()
+    {
+        ResourceUsage usage{};
+        rusage resource_usage{};
+        if (::getrusage(RUSAGE_SELF, &resource_usage) == 0)
+        {
+            usage.voluntary_context_switches_ = static_cast<double>(resource_usage.ru_nvcsw);
+        }
+        std::ifstream io_stats{"/proc/self/io"};
+        std::string key{};
+        double value{};
+        while (io_stats >> key >> value)
+        {
+            if (key == "syscr:")
+            {
+                usage.read_syscalls_ = value;
+            }
+            else if (key == "syscw:")
+            {
+                usage.write_syscalls_ = value;
+            }
+        }
+        return usage;
+    }
+
+    void ReportGrowthSince(const ResourceUsage& start, benchmark::State& state) const
+    {
+        state.counters["read_syscalls"] =
+            benchmark::Counter(read_syscalls_ - start.read_syscalls_, benchmark::Counter::kAvgIterations);
+        state.counters["write_syscalls"] =
+            benchmark::Counter(write_syscalls_ - start.write_syscalls_, benchmark::Counter::kAvgIterations);
+        state.counters["voluntary_ctx_switches"] = benchmark::Counter(
+            voluntary_context_switches_ - start.voluntary_context_switches_, benchmark::Counter::kAvgIterations);
+    }
+
+  private:
+    double read_syscalls_{};
+    double write_syscalls_{};
+    double voluntary_context_switches_{};
+};
+
+/// \brief Counts the inotify watches of this process, as listed in /proc/self/fdinfo.
+std::size_t CountInotifyWatches()
+{
+    std::size_t watches{0U};
+    DIR* const fd_info_directory = ::opendir("/proc/self/fdinfo");
+    if (fd_info_directory == nullptr)
+    {
+        return watches;
+    }
+    while (const dirent* const entry = ::readdir(fd_info_directory))
+    {
+        std::ifstream fd_info{std::string{"/proc/self/fdinfo/"} + entry->d_name};
+        std::string line{};
+        while (std::getline(fd_info, line))
+        {
+            if (line.rfind("inotify wd:", 0U) == 0U)
+            {
+                ++watches;
+            }
+        }
+    }
+    score::cpp::ignore = ::closedir(fd_info_directory);
+    return watches;
+}
+
+/// \brief Child processes, which offer a share of the given instances each until they are destroyed.
+///
+/// The processes are forked, so they have to be created before the benchmark starts any thread.
+class OfferingProcesses
+{
+  public:
+    OfferingProcesses(const Backend backend,
+                      const std::vector<ConfigurationStore>& instances,
+                      const std::size_t process_count)
+    {
+        for (std::size_t process_index = 0U; process_index < process_count; ++process_index)
+        {
+            int ready_pipe[2]{};
+            int stop_pipe[2]{};
+            if ((::pipe(ready_pipe) != 0) || (::pipe(stop_pipe) != 0))
+            {
+                std::abort();
+            }
+
+            const pid_t pid = ::fork();
+            if (pid == 0)
+            {
+                score::cpp::ignore = ::close(ready_pipe[0]);
+                score::cpp::ignore = ::close(stop_pipe[1]);
+                RunOfferingProcess(backend, instances, process_index, process_count, ready_pipe[1], stop_pipe[0]);
+            }
+
+            score::cpp::ignore = ::close(ready_pipe[1]);
+            score::cpp::ignore = ::close(stop_pipe[0]);
+            children_.push_back(Child{pid, ready_pipe[0], stop_pipe[1]});
+        }
+
+        // Wait until every process offered its share of instances
+        for (const auto& child : children_)
+        {
+            char ready{};
+            score::cpp::ignore = ::read(child.ready_fd, &ready, 1U);
+        }
+    }
+
+    OfferingProcesses(const OfferingProcesses&) = delete;
+    OfferingProcesses& operator=(const OfferingProcesses&) = delete;
+    OfferingProcesses(OfferingProcesses&&) = delete;
+    OfferingProcesses& operator=(OfferingProcesses&&) = delete;
+
+    ~OfferingProcesses()
+    {
+        for (const auto& child : children_)
+        {
+            score::cpp::ignore = ::close(child.stop_fd);
+        }
+        for (const auto& child : children_)
+        {
+            score::cpp::ignore = ::waitpid(child.pid, nullptr, 0);
+            score::cpp::ignore = ::close(child.ready_fd);
+        }
+    }
+
+  private:
+    struct Child
+    {
+        pid_t pid;
+        int ready_fd;
+        int stop_fd;
+    };
+
+    [[noreturn]] static void RunOfferingProcess(const Backend backend,
+                                                const std::vector<ConfigurationStore>& instances,
+                                                const std::size_t process_index,
+                                                const std::size_t process_count,
+                                                const int ready_fd,
+                                                const int stop_fd)
+    {
+        {
+            concurrency::LongRunningThreadsContainer long_running_threads{};
+            auto client = MakeClient(backend, long_running_threads);
+            for (std::size_t index = process_index; index < instances.size(); index += process_count)
+            {
+                score::cpp::ignore = client->OfferService(instances[index].GetInstanceIdentifier());
+            }
+
+            const char ready{1};
+            score::cpp::ignore = ::write(ready_fd, &ready, 1U);
+            // Blocks until the parent closes its end of the pipe
+            char stop{};
+            score::cpp::ignore = ::read(stop_fd, &stop, 1U);
+
+            for (std::size_t index = process_index; index < instances.size(); index += process_count)
+            {
+                score::cpp::ignore = client->StopOfferService(instances[index].GetInstanceIdentifier(),
+                                                              IServiceDiscovery::QualityTypeSelector::kBoth);
+            }
+        }
+        ::_exit(0);
+    }
+
+    std::vector<Child> children_{};
+};
+
+/// \brief Collects the changes reported to a FindServiceDeltaHandler, so that the benchmark thread can wait for them.
+class DeltaRecorder
+{
+  public:
+    FindServiceDeltaHandler<HandleType> MakeHandler()
+    {
+        return [this](ServiceHandleContainer<HandleType> added_handles,
+                      ServiceHandleContainer<HandleType> removed_handles,
+                      FindServiceHandle) noexcept {
+            std::lock_guard lock{mutex_};
+            for (const auto& handle : added_handles)
+            {
+                score::cpp::ignore = available_.insert(handle);
+            }
+            for (const auto& handle : removed_handles)
+            {
+                score::cpp::ignore = available_.erase(handle);
+            }
+            condition_variable_.notify_all();
+        };
+    }
+
+    bool WaitForAvailability(const HandleType& handle, const bool available)
+    {
+        std::unique_lock lock{mutex_};
+        return condition_variable_.wait_for(lock, kWaitTimeout, [this, &handle, available]() {
+            return (available_.count(handle) != 0U) == available;
+        });
+    }
+
+    bool WaitForCount(const std::size_t count)
+    {
+        std::unique_lock lock{mutex_};
+        return condition_variable_.wait_for(lock, kWaitTimeout, [this, count]() {
+            return available_.size() >= count;
+        });
+    }
+
+  private:
+    std::mutex mutex_{};
+    std::condition_variable condition_variable_{};
+    std::unordered_set<HandleType> available_{};
+};
+
+/// \brief Time per OfferService() call, if a single process offers `instances` instances.
+void BM_OfferService(benchmark::State& state)
+{
+    const auto backend = static_cast<Backend>(state.range(0));
+    const auto instance_count = static_cast<std::size_t>(state.range(1));
+    auto filesystem = filesystem::FilesystemFactory{}.CreateInstance();
+    const FileSystemGuard filesystem_guard{filesystem, GetBenchmarkServicePath()};
+
+    const auto instances = MakeInstances(1U, instance_count);
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+    auto client = MakeClient(backend, long_running_threads);
+
+    std::vector<double> latencies_ns{};
+    const auto start_usage = ResourceUsage::Now();
+    for (auto _ : state)
+    {
+        for (const auto& instance : instances)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const auto result = client->OfferService(instance.GetInstanceIdentifier());
+            latencies_ns.push_back(
+                std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+            if (!result.has_value())
+            {
+                state.SkipWithError("OfferService failed");
+                return;
+            }
+        }
+
+        state.PauseTiming();
+        for (const auto& instance : instances)
+        {
+            score::cpp::ignore = client->StopOfferService(instance.GetInstanceIdentifier(),
+                                                          IServiceDiscovery::QualityTypeSelector::kBoth);
+        }
+        state.ResumeTiming();
+    }
+    ResourceUsage::Now().ReportGrowthSince(start_usage, state);
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(instance_count));
+    ReportLatencyPercentiles(state, latencies_ns);
+}
+
+/// \brief Time of a find any FindService() without an ongoing search, if `instances` instances are offered by
+/// `processes` other processes.
+void BM_FindService(benchmark::State& state)
+{
+    const auto backend = static_cast<Backend>(state.range(0));
+    const auto instance_count = static_cast<std::size_t>(state.range(1));
+    const auto process_count = static_cast<std::size_t>(state.range(2));
+    auto filesystem = filesystem::FilesystemFactory{}.CreateInstance();
+    const FileSystemGuard filesystem_guard{filesystem, GetBenchmarkServicePath()};
+
+    const auto instances = MakeInstances(1U, instance_count);
+    const auto find_any = MakeConfigurationStore({});
+    const OfferingProcesses offering_processes{backend, instances, process_count};
+
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+    auto client = MakeClient(backend, long_running_threads);
+
+    const auto start_usage = ResourceUsage::Now();
+    for (auto _ : state)
+    {
+        const auto result = client->FindService(find_any.GetEnrichedInstanceIdentifier());
+        if (!result.has_value() || (result.value().size() != instance_count))
+        {
+            state.SkipWithError("FindService did not find all offered instances");
+            return;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    ResourceUsage::Now().ReportGrowthSince(start_usage, state);
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(instance_count));
+}
+
+/// \brief Time from an OfferService() until a find any search reports the new instance (or from a StopOfferService()
+/// until it reports its removal), while `instances` instances are offered by `processes` other processes.
+void MeasurePropagation(benchmark::State& state, const bool measure_stop_offer)
+{
+    const auto backend = static_cast<Backend>(state.range(0));
+    const auto instance_count = static_cast<std::size_t>(state.range(1));
+    const auto process_count = static_cast<std::size_t>(state.range(2));
+    auto filesystem = filesystem::FilesystemFactory{}.CreateInstance();
+    const FileSystemGuard filesystem_guard{filesystem, GetBenchmarkServicePath()};
+
+    const auto instances = MakeInstances(1U, instance_count);
+    const auto find_any = MakeConfigurationStore({});
+    const auto probe = MakeConfigurationStore(
+        LolaServiceInstanceId{static_cast<LolaServiceInstanceId::InstanceId>(instance_count + 1U)});
+    const OfferingProcesses offering_processes{backend, instances, process_count};
+
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+    auto searching_client = MakeClient(backend, long_running_threads);
+    auto offering_client = MakeClient(backend, long_running_threads);
+
+    DeltaRecorder delta_recorder{};
+    const auto find_service_handle = make_FindServiceHandle(1U);
+    const auto start_find_service_result = searching_client->StartFindServiceDelta(
+        find_service_handle, delta_recorder.MakeHandler(), find_any.GetEnrichedInstanceIdentifier());
+    if (!start_find_service_result.has_value() || !delta_recorder.WaitForCount(instance_count))
+    {
+        state.SkipWithError("Search did not find all offered instances");
+        return;
+    }
+    state.counters["inotify_watches"] = static_cast<double>(CountInotifyWatches());
+
+    const auto probe_handle = find_any.GetHandle(ServiceInstanceId{probe.lola_instance_id_.value()});
+    std::vector<double> latencies_ns{};
+    const auto start_usage = ResourceUsage::Now();
+    for (auto _ : state)
+    {
+        const auto offer_start = std::chrono::steady_clock::now();
+        score::cpp::ignore = offering_client->OfferService(probe.GetInstanceIdentifier());
+        const bool found = delta_recorder.WaitForAvailability(probe_handle, true);
+        const auto offer_end = std::chrono::steady_clock::now();
+
+        const auto stop_offer_start = std::chrono::steady_clock::now();
+        score::cpp::ignore = offering_client->StopOfferService(probe.GetInstanceIdentifier(),
+                                                               IServiceDiscovery::QualityTypeSelector::kBoth);
+        const bool lost = delta_recorder.WaitForAvailability(probe_handle, false);
+        const auto stop_offer_end = std::chrono::steady_clock::now();
+
+        if (!found || !lost)
+        {
+            state.SkipWithError("Search did not report the change of the offer in time");
+            break;
+        }
+
+        const auto elapsed = measure_stop_offer ? (stop_offer_end - stop_offer_start) : (offer_end - offer_start);
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+        latencies_ns.push_back(std::chrono::duration<double, std::nano>(elapsed).count());
+    }
+    ResourceUsage::Now().ReportGrowthSince(start_usage, state);
+
+    score::cpp::ignore = searching_client->StopFindService(find_service_handle);
+    ReportLatencyPercentiles(state, latencies_ns);
+}
+
+/// \brief Time from an OfferService() until the first call of the handler of an ongoing search.
+void BM_TimeToFirstCallback(benchmark::State& state)
+{
+    MeasurePropagation(state, false);
+}
+
+/// \brief Time from a StopOfferService() until the handler of an ongoing search reports the removal.
+void BM_StopOfferPropagation(benchmark::State& state)
+{
+    MeasurePropagation(state, true);
+}
+
+void OfferServiceArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"backend", "instances"});
+    for (const auto backend : {Backend::kFlagFile, Backend::kSharedMemoryRegistry})
+    {
+        for (const std::int64_t instances : {10, 100, 1000})
+        {
+            benchmark->Args({static_cast<std::int64_t>(backend), instances});
+        }
+    }
+}
+
+void ScaleArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"backend", "instances", "processes"});
+    for (const auto backend : {Backend::kFlagFile, Backend::kSharedMemoryRegistry})
+    {
+        for (const std::int64_t instances : {10, 100, 1000})
+        {
+            for (const std::int64_t processes : {1, 4})
+            {
+                benchmark->Args({static_cast<std::int64_t>(backend), instances, processes});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_OfferService)->Apply(OfferServiceArguments)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FindService)->Apply(ScaleArguments)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TimeToFirstCallback)->Apply(ScaleArguments)->UseManualTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StopOfferPropagation)->Apply(ScaleArguments)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::test
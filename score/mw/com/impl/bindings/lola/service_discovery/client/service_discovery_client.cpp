@@ -17,16 +17,23 @@
 #include "score/filesystem/filesystem.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/log/logging.h"
+#include "score/os/stat.h"
 #include "score/result/result.h"
 
 #include <score/assert.hpp>
 #include <score/expected.hpp>
 #include <score/utility.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <mutex>
+#include <string>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -42,8 +49,8 @@ auto ReadMaskSet(const os::InotifyEvent& event, const os::InotifyEvent::ReadMask
     return static_cast<underlying_type_readmask>(event.GetMask() & mask) != 0U;
 }
 
-std::vector<HandleType> GetKnownHandles(EnrichedInstanceIdentifier enriched_instance_identifier,
-                                        QualityAwareContainer<KnownInstancesContainer> known_instances) noexcept
+std::vector<HandleType> GetKnownHandles(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                        const QualityAwareContainer<KnownInstancesContainer>& known_instances) noexcept
 {
     std::vector<HandleType> known_handles{};
     // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
@@ -103,7 +110,13 @@ ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_runni
       worker_thread_result_{},
       flag_files_{},
       obsolete_search_requests_{},
-      flag_files_mutex_{}
+      flag_files_mutex_{},
+      find_service_cache_hits_{0U},
+      find_service_cache_misses_{0U},
+      directory_generations_{},
+      inotify_overflows_{0U},
+      rescanned_directories_{0U},
+      skipped_directories_{0U}
 {
     // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
     // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
@@ -165,6 +178,96 @@ auto ServiceDiscoveryClient::OfferService(const InstanceIdentifier instance_iden
         }
     }
 
+    auto flag_files = CreateFlagFiles(enriched_instance_identifier, offer_disambiguator);
+    if (!(flag_files.has_value()))
+    {
+        return MakeUnexpected<void>(flag_files.error());
+    }
+
+    {
+        // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+        // initialization.
+        // This is a false positive, we don't use auto here.
+        // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+        std::lock_guard lock{flag_files_mutex_};
+        score::cpp::ignore =
+            flag_files_.emplace(enriched_instance_identifier.GetInstanceIdentifier(), std::move(flag_files).value());
+    }
+
+    return {};
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
+// before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+auto ServiceDiscoveryClient::OfferServices(
+    const score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept -> Result<void>
+{
+    std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers{};
+    enriched_instance_identifiers.reserve(instance_identifiers.size());
+    for (const auto& instance_identifier : instance_identifiers)
+    {
+        const auto& enriched_instance_identifier = enriched_instance_identifiers.emplace_back(instance_identifier);
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+            enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>().has_value(),
+            "Instance identifier must have instance id for service offer");
+    }
+
+    // All the instances of the batch share one disambiguator, since they are offered by the same call.
+    auto offer_disambiguator = offer_disambiguator_.fetch_add(1);
+
+    {
+        // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+        // initialization.
+        // This is a false positive, we don't use auto here.
+        // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+        std::lock_guard lock{flag_files_mutex_};
+        std::unordered_set<InstanceIdentifier> batch_instance_identifiers{};
+        for (const auto& instance_identifier : instance_identifiers)
+        {
+            if ((flag_files_.find(instance_identifier) != flag_files_.cend()) ||
+                !(batch_instance_identifiers.insert(instance_identifier).second))
+            {
+                return MakeUnexpected(ComErrc::kBindingFailure, "Service is already offered");
+            }
+        }
+    }
+
+    // The offer is all or nothing: if a flag file cannot be created, the already created ones are removed again when
+    // created_flag_files goes out of scope.
+    std::vector<QualityAwareContainer<score::cpp::optional<FlagFile>>> created_flag_files{};
+    created_flag_files.reserve(enriched_instance_identifiers.size());
+    for (const auto& enriched_instance_identifier : enriched_instance_identifiers)
+    {
+        auto flag_files = CreateFlagFiles(enriched_instance_identifier, offer_disambiguator);
+        if (!(flag_files.has_value()))
+        {
+            return MakeUnexpected<void>(flag_files.error());
+        }
+        created_flag_files.push_back(std::move(flag_files).value());
+    }
+
+    {
+        // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+        // initialization.
+        // This is a false positive, we don't use auto here.
+        // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+        std::lock_guard lock{flag_files_mutex_};
+        for (std::size_t index{0U}; index < enriched_instance_identifiers.size(); ++index)
+        {
+            score::cpp::ignore = flag_files_.emplace(enriched_instance_identifiers[index].GetInstanceIdentifier(),
+                                                     std::move(created_flag_files[index]));
+        }
+    }
+
+    return {};
+}
+
+auto ServiceDiscoveryClient::CreateFlagFiles(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                             const Disambiguator offer_disambiguator) noexcept
+    -> Result<QualityAwareContainer<score::cpp::optional<FlagFile>>>
+{
     QualityAwareContainer<score::cpp::optional<FlagFile>> flag_files{};
     // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
     // a well-formed switch statement".
@@ -208,17 +311,7 @@ auto ServiceDiscoveryClient::OfferService(const InstanceIdentifier instance_iden
             return score::MakeUnexpected(ComErrc::kBindingFailure, "Unknown quality type of service");
     }
 
-    {
-        // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
-        // initialization.
-        // This is a false positive, we don't use auto here.
-        // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
-        std::lock_guard lock{flag_files_mutex_};
-        score::cpp::ignore =
-            flag_files_.emplace(enriched_instance_identifier.GetInstanceIdentifier(), std::move(flag_files));
-    }
-
-    return {};
+    return flag_files;
 }
 
 auto ServiceDiscoveryClient::StopOfferService(
@@ -289,7 +382,7 @@ auto ServiceDiscoveryClient::TransferNewSearchRequest(NewSearchRequest search_re
     -> SearchRequestsContainer::value_type&
 {
     auto& [find_service_handle,
-           instance_identifier,
+           instance_identifiers,
            watch_descriptors,
            on_service_found_callback,
            known_instances,
@@ -301,8 +394,10 @@ auto ServiceDiscoveryClient::TransferNewSearchRequest(NewSearchRequest search_re
     const auto added_search_request = search_requests_.emplace(find_service_handle,
                                                                SearchRequest{std::move(watch_descriptor_placeholder),
                                                                              std::move(on_service_found_callback),
-                                                                             instance_identifier,
-                                                                             previous_handles});
+                                                                             std::move(instance_identifiers),
+                                                                             previous_handles,
+                                                                             std::unordered_set<HandleType>{},
+                                                                             std::unordered_set<HandleType>{}});
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
         added_search_request.second, "The FindServiceHandle should be unique for every call to StartFindService");
 
@@ -393,24 +488,20 @@ auto ServiceDiscoveryClient::HandleEvents(
 
     std::vector<os::InotifyEvent> deletion_events{};
     std::vector<os::InotifyEvent> creation_events{};
+    bool inotify_queue_overflowed{false};
     for (const auto& event : events)
     {
+        if (ReadMaskSet(event, os::InotifyEvent::ReadMask::kInQOverflow))
+        {
+            inotify_queue_overflowed = true;
+            continue;
+        }
 
-        const bool inotify_queue_overflowed = ReadMaskSet(event, os::InotifyEvent::ReadMask::kInQOverflow);
         const bool search_directory_was_removed = ReadMaskSet(event, os::InotifyEvent::ReadMask::kInIgnored);
         const bool flag_file_was_removed = ReadMaskSet(event, os::InotifyEvent::ReadMask::kInDelete);
         const bool inode_was_removed = search_directory_was_removed || flag_file_was_removed;
         const bool inode_was_created = ReadMaskSet(event, os::InotifyEvent::ReadMask::kInCreate);
 
-        if (inotify_queue_overflowed)
-        {
-            mw::log::LogError("lola")
-                << "Service discovery lost at least one event and is compromised now. Bailing out!";
-            // Potential optimization: Resync the full service discovery with the file system and update all ongoing
-            // searches with potential changes.
-            std::terminate();
-        }
-
         if (inode_was_removed)
         {
             deletion_events.push_back(event);
@@ -444,6 +535,171 @@ auto ServiceDiscoveryClient::HandleEvents(
     HandleDeletionEvents(deletion_events);
 
     HandleCreationEvents(creation_events);
+
+    // The events which were not dropped are handled first, so that the resync only has to catch up with the dropped
+    // ones.
+    if (inotify_queue_overflowed)
+    {
+        ResyncAfterOverflow();
+    }
+}
+
+auto ServiceDiscoveryClient::ResyncAfterOverflow() noexcept -> void
+{
+    score::cpp::ignore = inotify_overflows_.fetch_add(1U, std::memory_order_relaxed);
+    mw::log::LogWarn("lola") << "LoLa SD: Inotify queue overflowed, events were lost. Resyncing watched directories.";
+
+    // The watches added during the resync crawl their directory on their own, so only the current ones are checked.
+    std::vector<os::InotifyWatchDescriptor> watch_descriptors{};
+    watch_descriptors.reserve(watches_.size());
+    for (const auto& watch : watches_)
+    {
+        watch_descriptors.push_back(watch.first);
+    }
+
+    std::unordered_set<FindServiceHandle> impacted_searches{};
+    for (const auto& watch_descriptor : watch_descriptors)
+    {
+        const auto watch_iterator = watches_.find(watch_descriptor);
+        // LCOV_EXCL_BR_START (Defensive programming: Watches are only erased when search requests are transferred,
+        // which doesn't happen during the resync.)
+        if (watch_iterator == watches_.end())
+        {
+            continue;
+        }
+        // LCOV_EXCL_BR_STOP
+
+        if (!(UpdateDirectoryGeneration(watch_iterator)))
+        {
+            score::cpp::ignore = skipped_directories_.fetch_add(1U, std::memory_order_relaxed);
+            continue;
+        }
+        score::cpp::ignore = rescanned_directories_.fetch_add(1U, std::memory_order_relaxed);
+
+        // Copied, since rescanning a service directory might add watches, which invalidates watch_iterator.
+        const auto search_keys = watch_iterator->second.find_service_handles;
+        if (watch_iterator->second.enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>()
+                .has_value())
+        {
+            ResyncInstanceDirectory(watch_iterator);
+        }
+        else
+        {
+            ResyncServiceDirectory(watch_iterator);
+        }
+        impacted_searches.insert(search_keys.cbegin(), search_keys.cend());
+    }
+
+    CallHandlers(impacted_searches);
+}
+
+auto ServiceDiscoveryClient::UpdateDirectoryGeneration(const WatchesContainer::iterator& watch_iterator) noexcept
+    -> bool
+{
+    // The generation is taken before the directory is scanned. Any change after it updates the modification time, so
+    // that the directory is scanned again on the next resync.
+    const auto directory_path = GetSearchPathForIdentifier(watch_iterator->second.enriched_instance_identifier);
+    os::StatBuffer stat_buffer{};
+    const auto stat_result = os::Stat::instance().stat(directory_path.Native().c_str(), stat_buffer);
+    if (!(stat_result.has_value()))
+    {
+        score::cpp::ignore = directory_generations_.erase(watch_iterator->first);
+        return true;
+    }
+
+    const DirectoryGeneration current_generation{
+        static_cast<std::int64_t>(stat_buffer.st_mtime),
+        static_cast<std::int64_t>(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()))};
+    const auto recorded_generation = directory_generations_.find(watch_iterator->first);
+
+    // The modification time only has a resolution of seconds. A change in the same second as the previous scan would
+    // not be visible, so the directory is only considered unchanged if it was not modified in this second.
+    const bool unchanged = (recorded_generation != directory_generations_.cend()) &&
+                           (recorded_generation->second.modification_time == current_generation.modification_time) &&
+                           (recorded_generation->second.modification_time < recorded_generation->second.scan_time);
+    if (unchanged)
+    {
+        return false;
+    }
+
+    directory_generations_.insert_or_assign(watch_iterator->first, current_generation);
+    return true;
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
+// before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+auto ServiceDiscoveryClient::ResyncInstanceDirectory(const WatchesContainer::iterator& watch_iterator) noexcept -> void
+{
+    const auto& [enriched_instance_identifier, search_keys] = watch_iterator->second;
+
+    auto crawler_result = FlagFileCrawler{*i_notify_}.Crawl(enriched_instance_identifier);
+    if (!(crawler_result.has_value()))
+    {
+        mw::log::LogError("lola") << "LoLa SD: Could not rescan"
+                                  << GetSearchPathForIdentifier(enriched_instance_identifier) << "after overflow.";
+        score::cpp::ignore = directory_generations_.erase(watch_iterator->first);
+        return;
+    }
+
+    // The flag files of the instance replace what is known about it, since creations and deletions might be lost.
+    auto& known_instances = crawler_result.value();
+    known_instances_.asil_b.Remove(enriched_instance_identifier);
+    known_instances_.asil_qm.Remove(enriched_instance_identifier);
+    known_instances_.asil_b.Merge(std::move(known_instances.asil_b));
+    known_instances_.asil_qm.Merge(std::move(known_instances.asil_qm));
+
+    UpdateSearchRequests(search_keys, enriched_instance_identifier.GetInstanceId().value());
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
+// before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+auto ServiceDiscoveryClient::ResyncServiceDirectory(const WatchesContainer::iterator& watch_iterator) noexcept -> void
+{
+    const auto service_watch_descriptor = watch_iterator->first;
+    const auto enriched_instance_identifier = watch_iterator->second.enriched_instance_identifier;
+
+    const auto instance_directories = FlagFileCrawler::GatherExistingInstanceDirectories(enriched_instance_identifier);
+    if (!(instance_directories.has_value()))
+    {
+        mw::log::LogError("lola") << "LoLa SD: Could not rescan"
+                                  << GetSearchPathForIdentifier(enriched_instance_identifier) << "after overflow.";
+        score::cpp::ignore = directory_generations_.erase(service_watch_descriptor);
+        return;
+    }
+
+    // Instance directories are never removed, so only the creation of instance directories can have been lost. An
+    // instance directory is skipped, if it is already watched for all searches of the service directory. Changes
+    // within it are caught up when its own watch is resynced.
+    for (const auto& instance_directory : instance_directories.value())
+    {
+        const auto service_watch_iterator = watches_.find(service_watch_descriptor);
+        const auto& service_search_keys = service_watch_iterator->second.find_service_handles;
+
+        const auto watched_identifier = watched_identifiers_.find(LolaServiceInstanceIdentifier{instance_directory});
+        if ((watched_identifier != watched_identifiers_.cend()) &&
+            watched_identifier->second.watch_descriptor.has_value())
+        {
+            const auto instance_watch = watches_.find(watched_identifier->second.watch_descriptor.value());
+            const bool watched_for_all_searches =
+                (instance_watch != watches_.cend()) &&
+                std::all_of(service_search_keys.cbegin(),
+                            service_search_keys.cend(),
+                            [&instance_watch](const FindServiceHandle& search_key) {
+                                return instance_watch->second.find_service_handles.count(search_key) != 0U;
+                            });
+            if (watched_for_all_searches)
+            {
+                continue;
+            }
+        }
+
+        const auto instance_id = instance_directory.GetBindingSpecificInstanceId<LolaServiceInstanceId>().value();
+        OnInstanceDirectoryCreated(service_watch_iterator, std::to_string(static_cast<std::uint32_t>(instance_id)));
+    }
 }
 
 auto ServiceDiscoveryClient::HandleDeletionEvents(const std::vector<os::InotifyEvent>& events) noexcept -> void
@@ -535,64 +791,97 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
             continue;
         }
 
-        const auto& enriched_instance_identifier = search_iterator->second.enriched_instance_identifier;
-        std::vector<HandleType> known_handles{};
-        // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
-        // a well-formed switch statement".
-        // We don't need a break statement at the kInvalid case as we use fallthrough.
-        // coverity[autosar_cpp14_m6_4_3_violation]
-        switch (enriched_instance_identifier.GetQualityType())
-        {
-            case QualityType::kASIL_B:
-            {
-                known_handles = known_instances_.asil_b.GetKnownHandles(enriched_instance_identifier);
-                break;
-            }
-            case QualityType::kASIL_QM:
-            {
-                known_handles = known_instances_.asil_qm.GetKnownHandles(enriched_instance_identifier);
-                break;
-            }
-                // LCOV_EXCL_START (Defensive programming: This function can only be called if a watch has been added
-                // via StartFindService. All code paths in StartFindService already check the quality type, therefore,
-                // it's impossible for the quality type to be invalid or unexpected here.)
-            case QualityType::kInvalid:
-                [[fallthrough]];
-            // coverity[autosar_cpp14_m6_4_5_violation] std::terminate will terminate this switch clause.
-            default:
-            {
-                score::mw::log::LogFatal("lola") << "Quality level not set for instance identifier. Terminating.";
-                std::terminate();
-            }
-                // LCOV_EXCL_STOP
-        }
-
-        std::unordered_set<HandleType> new_handles{known_handles.cbegin(), known_handles.cend()};
-        auto& previous_handles = search_iterator->second.handles;
-
-        if (previous_handles == new_handles)
+        auto& search_request = search_iterator->second;
+        if (search_request.added_handles.empty() && search_request.removed_handles.empty())
         {
             continue;
         }
 
-        mw::log::LogDebug("lola") << "LoLa SD: Starting asynchronous call to handler for FindServiceHandle"
-                                  << FindServiceHandleView{search_key}.getUid() << "with" << known_handles.size()
-                                  << "handles";
+        // The pending changes are taken out before calling the handler, since it might start or stop searches, which
+        // again modifies search_requests_.
+        std::vector<HandleType> added_handles{search_request.added_handles.cbegin(),
+                                              search_request.added_handles.cend()};
+        std::vector<HandleType> removed_handles{search_request.removed_handles.cbegin(),
+                                                search_request.removed_handles.cend()};
+        search_request.added_handles.clear();
+        search_request.removed_handles.clear();
 
-        previous_handles = new_handles;
+        mw::log::LogDebug("lola") << "LoLa SD: Starting asynchronous call to handler for FindServiceHandle"
+                                  << FindServiceHandleView{search_key}.getUid() << "with" << added_handles.size()
+                                  << "added and" << removed_handles.size() << "removed handles";
 
-        const auto& handler = search_iterator->second.find_service_handler;
         // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
         // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
         // we can't add noexcept to score::cpp::callback signature.
-        // coverity[autosar_cpp14_a15_4_2_violation]
-        handler(std::move(known_handles), search_key);
+        if (const auto* const delta_handler =
+                std::get_if<FindServiceDeltaHandler<HandleType>>(&search_request.find_service_handler))
+        {
+            // coverity[autosar_cpp14_a15_4_2_violation]
+            (*delta_handler)(std::move(added_handles), std::move(removed_handles), search_key);
+        }
+        else
+        {
+            const auto& handler = std::get<FindServiceHandler<HandleType>>(search_request.find_service_handler);
+            // coverity[autosar_cpp14_a15_4_2_violation]
+            handler(std::vector<HandleType>{search_request.handles.cbegin(), search_request.handles.cend()},
+                    search_key);
+        }
 
         mw::log::LogDebug("lola") << "LoLa SD: Asynchronous call to handler for FindServiceHandle"
                                   << FindServiceHandleView{search_key}.getUid() << "finished";
     }
 }
 
+auto ServiceDiscoveryClient::UpdateSearchRequests(const std::unordered_set<FindServiceHandle>& search_keys,
+                                                  const ServiceInstanceId& instance_id) noexcept -> void
+{
+    for (const auto& search_key : search_keys)
+    {
+        const auto search_iterator = search_requests_.find(search_key);
+        // LCOV_EXCL_BR_START (Defensive programming: Watches and search requests are always linked and unlinked under
+        // the same lock, so every search key of a watch has a search request.)
+        if (search_iterator == search_requests_.end())
+        {
+            continue;
+        }
+        // LCOV_EXCL_BR_STOP
+
+        auto& search_request = search_iterator->second;
+        for (const auto& search_identifier : search_request.enriched_instance_identifiers)
+        {
+            const auto& searched_instance_id = search_identifier.GetInstanceId();
+            if (searched_instance_id.has_value() && !(searched_instance_id.value() == instance_id))
+            {
+                continue;
+            }
+
+            const EnrichedInstanceIdentifier instance_identifier{
+                instance_id, search_identifier.GetQualityType(), search_identifier.GetInstanceIdentifier()};
+            const bool instance_is_known = !(GetKnownHandles(instance_identifier, known_instances_).empty());
+            const auto handle = make_HandleType(search_identifier.GetInstanceIdentifier(), instance_id);
+
+            // A change which reverts a change that was not reported yet cancels it out, so that the handler is never
+            // called with the same handle being added and removed.
+            if (instance_is_known)
+            {
+                if (search_request.handles.insert(handle).second &&
+                    (search_request.removed_handles.erase(handle) == 0U))
+                {
+                    score::cpp::ignore = search_request.added_handles.insert(handle);
+                }
+            }
+            else
+            {
+                if ((search_request.handles.erase(handle) != 0U) &&
+                    (search_request.added_handles.erase(handle) == 0U))
+                {
+                    score::cpp::ignore = search_request.removed_handles.insert(handle);
+                }
+            }
+        }
+    }
+}
+
 auto ServiceDiscoveryClient::StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
                                         const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
     -> WatchesContainer::iterator
@@ -662,6 +951,7 @@ auto ServiceDiscoveryClient::EraseWatch(const WatchesContainer::iterator& watch_
         }
         // LCOV_EXCL_BR_STOP
     }
+    score::cpp::ignore = directory_generations_.erase(watch_iterator->first);
     score::cpp::ignore = watches_.erase(watch_iterator);
 }
 
@@ -697,13 +987,29 @@ auto ServiceDiscoveryClient::UnlinkWatchWithSearchRequest(
                                                 "UnlinkWatchWithSearchRequest did not erase watch key correctly");
 }
 
+Result<void> ServiceDiscoveryClient::StartFindService(
+    const FindServiceHandle find_service_handle,
+    FindServiceHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartFindServiceImpl(find_service_handle, SearchHandler{std::move(handler)}, enriched_instance_identifier);
+}
+
+Result<void> ServiceDiscoveryClient::StartFindServiceDelta(
+    const FindServiceHandle find_service_handle,
+    FindServiceDeltaHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartFindServiceImpl(find_service_handle, SearchHandler{std::move(handler)}, enriched_instance_identifier);
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
 // before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
 // coverity[autosar_cpp14_a15_5_3_violation : FALSE]
-Result<void> ServiceDiscoveryClient::StartFindService(
+Result<void> ServiceDiscoveryClient::StartFindServiceImpl(
     const FindServiceHandle find_service_handle,
-    FindServiceHandler<HandleType> handler,
+    SearchHandler handler,
     const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
 {
     // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced initialization.
@@ -720,24 +1026,9 @@ Result<void> ServiceDiscoveryClient::StartFindService(
     QualityAwareContainer<KnownInstancesContainer> known_instances{};
     // Check if the exact same search is already in progress. If it is, we can just duplicate the search request and
     // reuse cache data.
-    const auto identifier = LolaServiceInstanceIdentifier(enriched_instance_identifier);
-    const auto watched_identifier = watched_identifiers_.find(identifier);
-    if (watched_identifier != watched_identifiers_.end() && watched_identifier->second.watch_descriptor.has_value())
+    if (CollectExistingWatches(LolaServiceInstanceIdentifier(enriched_instance_identifier), watch_descriptors))
     {
         known_handles = GetKnownHandles(enriched_instance_identifier, known_instances_);
-
-        auto add_watch = [this, &watch_descriptors](const os::InotifyWatchDescriptor& watch_descriptor) {
-            const auto matching_watch = watches_.find(watch_descriptor);
-            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(matching_watch != watches_.cend(),
-                                                        "Did not find matching watch");
-            score::cpp::ignore =
-                watch_descriptors.emplace(watch_descriptor, matching_watch->second.enriched_instance_identifier);
-        };
-
-        add_watch(watched_identifier->second.watch_descriptor.value());
-        score::cpp::ignore = std::for_each(watched_identifier->second.child_watches.cbegin(),
-                                           watched_identifier->second.child_watches.cend(),
-                                           add_watch);
     }
     else
     {
@@ -756,7 +1047,7 @@ Result<void> ServiceDiscoveryClient::StartFindService(
 
     const auto& stored_search_request =
         TransferNewSearchRequest({find_service_handle,
-                                  enriched_instance_identifier,
+                                  {enriched_instance_identifier},
                                   std::move(watch_descriptors),
                                   std::move(handler),
                                   std::move(known_instances),
@@ -767,7 +1058,119 @@ Result<void> ServiceDiscoveryClient::StartFindService(
         mw::log::LogDebug("lola") << "LoLa SD: Synchronously calling handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid();
         const auto& stored_handler = stored_search_request.second.find_service_handler;
-        stored_handler(known_handles, find_service_handle);
+        if (const auto* const delta_handler = std::get_if<FindServiceDeltaHandler<HandleType>>(&stored_handler))
+        {
+            // The first call of a delta handler reports all the instances which are available at the start of the
+            // search as added.
+            (*delta_handler)(known_handles, std::vector<HandleType>{}, find_service_handle);
+        }
+        else
+        {
+            std::get<FindServiceHandler<HandleType>>(stored_handler)(known_handles, find_service_handle);
+        }
+        mw::log::LogDebug("lola") << "LoLa SD: Synchronous call to handler for FindServiceHandle"
+                                  << FindServiceHandleView{find_service_handle}.getUid() << "finished";
+    }
+
+    return {};
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
+// before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+Result<void> ServiceDiscoveryClient::StartFindServices(
+    const FindServiceHandle find_service_handle,
+    FindServiceHandler<HandleType> handler,
+    const score::cpp::span<const EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept
+{
+    // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced initialization.
+    // This is a false positive, we don't use auto here
+    // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+    const std::lock_guard worker_lock{worker_mutex_};
+
+    mw::log::LogDebug("lola") << "LoLa SD: Starting service discovery for" << enriched_instance_identifiers.size()
+                              << "instance identifiers with FindServiceHandle"
+                              << FindServiceHandleView{find_service_handle}.getUid();
+
+    std::unordered_map<LolaServiceId, std::size_t> searched_instances_per_service{};
+    for (const auto& enriched_instance_identifier : enriched_instance_identifiers)
+    {
+        ++searched_instances_per_service[LolaServiceInstanceIdentifier{enriched_instance_identifier}.GetServiceId()];
+    }
+
+    WatchDescriptorsContainer watch_descriptors{};
+    QualityAwareContainer<KnownInstancesContainer> known_instances{};
+    std::unordered_set<LolaServiceId> crawled_services{};
+    for (const auto& enriched_instance_identifier : enriched_instance_identifiers)
+    {
+        // All the searched instances of a service are covered by a single watch on the service directory (find any),
+        // instead of crawling and watching each instance directory on its own. The instances which are not searched
+        // are filtered out when the handles are determined.
+        const auto service_id = LolaServiceInstanceIdentifier{enriched_instance_identifier}.GetServiceId();
+        const bool watch_service_directory = searched_instances_per_service[service_id] > 1U;
+        const EnrichedInstanceIdentifier watched_instance_identifier =
+            watch_service_directory
+                ? EnrichedInstanceIdentifier{score::cpp::nullopt,
+                                             enriched_instance_identifier.GetQualityType(),
+                                             enriched_instance_identifier.GetInstanceIdentifier()}
+                : enriched_instance_identifier;
+
+        if ((watch_service_directory && (crawled_services.count(service_id) != 0U)) ||
+            CollectExistingWatches(LolaServiceInstanceIdentifier{watched_instance_identifier}, watch_descriptors))
+        {
+            continue;
+        }
+
+        auto crawler_result = FlagFileCrawler{*i_notify_}.CrawlAndWatchWithRetry(watched_instance_identifier,
+                                                                                 kMaxNumberOfCrawlAndWatchRetries);
+        if (!crawler_result.has_value())
+        {
+            // The watches which were added for the previous identifiers are not referenced by any search yet.
+            for (const auto& watch_descriptor : watch_descriptors)
+            {
+                if (watches_.find(watch_descriptor.first) == watches_.cend())
+                {
+                    score::cpp::ignore = i_notify_->RemoveWatch(watch_descriptor.first);
+                }
+            }
+            return score::MakeUnexpected(ComErrc::kBindingFailure, "Failed to crawl filesystem");
+        }
+
+        auto& [found_watch_descriptors, found_known_instances] = crawler_result.value();
+        watch_descriptors.merge(found_watch_descriptors);
+        known_instances.asil_b.Merge(std::move(found_known_instances.asil_b));
+        known_instances.asil_qm.Merge(std::move(found_known_instances.asil_qm));
+        if (watch_service_directory)
+        {
+            score::cpp::ignore = crawled_services.insert(service_id);
+        }
+    }
+
+    auto& stored_search_request = TransferNewSearchRequest(
+        {find_service_handle,
+         std::vector<EnrichedInstanceIdentifier>{enriched_instance_identifiers.begin(),
+                                                 enriched_instance_identifiers.end()},
+         std::move(watch_descriptors),
+         SearchHandler{std::move(handler)},
+         std::move(known_instances),
+         std::unordered_set<HandleType>{}});
+
+    auto& search_request = stored_search_request.second;
+    for (const auto& enriched_instance_identifier : search_request.enriched_instance_identifiers)
+    {
+        const auto known_handles = GetKnownHandles(enriched_instance_identifier, known_instances_);
+        search_request.handles.insert(known_handles.cbegin(), known_handles.cend());
+    }
+
+    if (!(search_request.handles.empty()))
+    {
+        mw::log::LogDebug("lola") << "LoLa SD: Synchronously calling handler for FindServiceHandle"
+                                  << FindServiceHandleView{find_service_handle}.getUid();
+        // One call with the handles of all the searched instances, instead of one per instance.
+        const std::vector<HandleType> known_handles{search_request.handles.cbegin(), search_request.handles.cend()};
+        std::get<FindServiceHandler<HandleType>>(search_request.find_service_handler)(known_handles,
+                                                                                      find_service_handle);
         mw::log::LogDebug("lola") << "LoLa SD: Synchronous call to handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid() << "finished";
     }
@@ -775,6 +1178,30 @@ Result<void> ServiceDiscoveryClient::StartFindService(
     return {};
 }
 
+auto ServiceDiscoveryClient::CollectExistingWatches(const LolaServiceInstanceIdentifier& identifier,
+                                                    WatchDescriptorsContainer& watch_descriptors) const noexcept
+    -> bool
+{
+    const auto watched_identifier = watched_identifiers_.find(identifier);
+    if ((watched_identifier == watched_identifiers_.cend()) ||
+        !(watched_identifier->second.watch_descriptor.has_value()))
+    {
+        return false;
+    }
+
+    auto add_watch = [this, &watch_descriptors](const os::InotifyWatchDescriptor& watch_descriptor) {
+        const auto matching_watch = watches_.find(watch_descriptor);
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(matching_watch != watches_.cend(), "Did not find matching watch");
+        score::cpp::ignore =
+            watch_descriptors.emplace(watch_descriptor, matching_watch->second.enriched_instance_identifier);
+    };
+
+    add_watch(watched_identifier->second.watch_descriptor.value());
+    score::cpp::ignore = std::for_each(
+        watched_identifier->second.child_watches.cbegin(), watched_identifier->second.child_watches.cend(), add_watch);
+    return true;
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
 // before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
@@ -792,8 +1219,12 @@ auto ServiceDiscoveryClient::OnInstanceDirectoryCreated(const WatchesContainer::
     }
     const auto& instance_id = expected_instance_id.value();
 
+    // The instance id of the configuration (if any) is overridden, since the watch of a StartFindServices() search
+    // might be shared by identifiers which are configured with an instance id.
     const EnrichedInstanceIdentifier enriched_instance_identifier_with_instance_id_from_string{
-        enriched_instance_identifier.GetInstanceIdentifier(), ServiceInstanceId{instance_id}};
+        score::cpp::optional<ServiceInstanceId>{ServiceInstanceId{instance_id}},
+        enriched_instance_identifier.GetQualityType(),
+        enriched_instance_identifier.GetInstanceIdentifier()};
 
     auto crawler_result = FlagFileCrawler{*i_notify_}.CrawlAndWatchWithRetry(
         enriched_instance_identifier_with_instance_id_from_string, kMaxNumberOfCrawlAndWatchRetries);
@@ -812,6 +1243,8 @@ auto ServiceDiscoveryClient::OnInstanceDirectoryCreated(const WatchesContainer::
 
     known_instances_.asil_b.Merge(std::move(known_instances.asil_b));
     known_instances_.asil_qm.Merge(std::move(known_instances.asil_qm));
+
+    UpdateSearchRequests(search_keys, ServiceInstanceId{instance_id});
 }
 
 void ServiceDiscoveryClient::OnInstanceFlagFileCreated(const WatchesContainer::iterator& watch_iterator,
@@ -857,6 +1290,9 @@ void ServiceDiscoveryClient::OnInstanceFlagFileCreated(const WatchesContainer::i
         }
             // LCOV_EXCL_STOP
     }
+
+    UpdateSearchRequests(watch_iterator->second.find_service_handles,
+                         enriched_instance_identifier.GetInstanceId().value());
 }
 
 void ServiceDiscoveryClient::OnInstanceFlagFileRemoved(const WatchesContainer::iterator& watch_iterator,
@@ -901,6 +1337,9 @@ void ServiceDiscoveryClient::OnInstanceFlagFileRemoved(const WatchesContainer::i
         }
             // LCOV_EXCL_STOP
     }
+
+    UpdateSearchRequests(watch_iterator->second.find_service_handles,
+                         enriched_instance_identifier.GetInstanceId().value());
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
@@ -918,6 +1357,14 @@ Result<ServiceHandleContainer<HandleType>> ServiceDiscoveryClient::FindService(
     mw::log::LogDebug("lola") << "LoLa SD: find service for"
                               << GetSearchPathForIdentifier(enriched_instance_identifier);
 
+    // A live watch keeps known_instances_ up to date for the identifier, so there is no need to crawl the filesystem
+    if (IsCoveredByWatch(LolaServiceInstanceIdentifier{enriched_instance_identifier}))
+    {
+        score::cpp::ignore = find_service_cache_hits_.fetch_add(1U, std::memory_order_relaxed);
+        return GetKnownHandles(enriched_instance_identifier, known_instances_);
+    }
+    score::cpp::ignore = find_service_cache_misses_.fetch_add(1U, std::memory_order_relaxed);
+
     auto crawler_result = FlagFileCrawler{*i_notify_}.Crawl(enriched_instance_identifier);
     if (!crawler_result.has_value())
     {
@@ -927,4 +1374,37 @@ Result<ServiceHandleContainer<HandleType>> ServiceDiscoveryClient::FindService(
     auto& known_instances = crawler_result.value();
     return GetKnownHandles(enriched_instance_identifier, known_instances);
 }
+
+auto ServiceDiscoveryClient::GetFindServiceCacheStatistics() const noexcept -> FindServiceCacheStatistics
+{
+    return FindServiceCacheStatistics{find_service_cache_hits_.load(std::memory_order_relaxed),
+                                      find_service_cache_misses_.load(std::memory_order_relaxed)};
+}
+
+auto ServiceDiscoveryClient::GetInotifyResyncStatistics() const noexcept -> InotifyResyncStatistics
+{
+    return InotifyResyncStatistics{inotify_overflows_.load(std::memory_order_relaxed),
+                                   rescanned_directories_.load(std::memory_order_relaxed),
+                                   skipped_directories_.load(std::memory_order_relaxed)};
+}
+
+auto ServiceDiscoveryClient::IsCoveredByWatch(const LolaServiceInstanceIdentifier& identifier) const noexcept -> bool
+{
+    const auto watched_identifier = watched_identifiers_.find(identifier);
+    if ((watched_identifier != watched_identifiers_.cend()) && watched_identifier->second.watch_descriptor.has_value())
+    {
+        return true;
+    }
+    if (!identifier.GetInstanceId().has_value())
+    {
+        return false;
+    }
+    // A watch on the service directory (find any) reports the creation of any instance directory, so it also covers
+    // the specific instances which are not offered yet
+    const auto watched_any_identifier =
+        watched_identifiers_.find(LolaServiceInstanceIdentifier{identifier.GetServiceId()});
+    return (watched_any_identifier != watched_identifiers_.cend()) &&
+           watched_any_identifier->second.watch_descriptor.has_value();
+}
+
 }  // namespace score::mw::com::impl::lola
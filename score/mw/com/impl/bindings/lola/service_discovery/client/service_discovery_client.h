@@ -25,14 +25,18 @@
 #include "score/filesystem/filesystem.h"
 #include "score/os/utils/inotify/inotify_instance_impl.h"
 
+#include <score/span.hpp>
 #include <score/stop_token.hpp>
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <variant>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -55,6 +59,9 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
 
     [[nodiscard]] Result<void> OfferService(const InstanceIdentifier instance_identifier) noexcept override;
 
+    [[nodiscard]] Result<void> OfferServices(
+        const score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept override;
+
     [[nodiscard]] Result<void> StopOfferService(
         const InstanceIdentifier instance_identifier,
         const IServiceDiscovery::QualityTypeSelector quality_type_selector) noexcept override;
@@ -64,11 +71,45 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         FindServiceHandler<HandleType> handler,
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
 
+    [[nodiscard]] Result<void> StartFindServices(
+        const FindServiceHandle find_service_handle,
+        FindServiceHandler<HandleType> handler,
+        const score::cpp::span<const EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept override;
+
+    [[nodiscard]] Result<void> StartFindServiceDelta(
+        const FindServiceHandle find_service_handle,
+        FindServiceDeltaHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
+
     [[nodiscard]] Result<void> StopFindService(const FindServiceHandle find_service_handle) noexcept override;
     [[nodiscard]] Result<ServiceHandleContainer<HandleType>> FindService(
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
 
+    /// \brief Counters of the FindService() calls answered from the cache of a live watch (hits) and of the ones which
+    /// needed to crawl the filesystem (misses).
+    struct FindServiceCacheStatistics
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;
+    };
+
+    FindServiceCacheStatistics GetFindServiceCacheStatistics() const noexcept;
+
+    /// \brief Counters of the inotify queue overflows and of the watched directories, which were rescanned or skipped
+    /// as unchanged during the resynchronizations after them.
+    struct InotifyResyncStatistics
+    {
+        std::uint64_t overflows;
+        std::uint64_t rescanned_directories;
+        std::uint64_t skipped_directories;
+    };
+
+    InotifyResyncStatistics GetInotifyResyncStatistics() const noexcept;
+
   private:
+    /// \brief The user handler of a search, which either gets the full list of handles or only the changes.
+    using SearchHandler = std::variant<FindServiceHandler<HandleType>, FindServiceDeltaHandler<HandleType>>;
+
     class SearchRequest
     {
       public:
@@ -78,11 +119,17 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::unordered_set<os::InotifyWatchDescriptor> watch_descriptors;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        FindServiceHandler<HandleType> find_service_handler;
+        SearchHandler find_service_handler;
+        /// \brief The searched identifiers, which are more than one only for searches started with StartFindServices().
         // coverity[autosar_cpp14_m11_0_1_violation]
-        EnrichedInstanceIdentifier enriched_instance_identifier;
+        std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers;
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::unordered_set<HandleType> handles;
+        /// \brief Handles which were added to / removed from handles since the handler was called the last time.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::unordered_set<HandleType> added_handles;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::unordered_set<HandleType> removed_handles;
     };
 
     class Watch
@@ -118,11 +165,11 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         // coverity[autosar_cpp14_m11_0_1_violation]
         FindServiceHandle find_service_handle;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        EnrichedInstanceIdentifier instance_identifier;
+        std::vector<EnrichedInstanceIdentifier> instance_identifiers;
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier> watch_descriptors;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        FindServiceHandler<HandleType> on_service_found_callback;
+        SearchHandler on_service_found_callback;
         // coverity[autosar_cpp14_m11_0_1_violation]
         QualityAwareContainer<KnownInstancesContainer> known_instances;
         // coverity[autosar_cpp14_m11_0_1_violation]
@@ -133,8 +180,44 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     using WatchesContainer = std::unordered_map<os::InotifyWatchDescriptor, Watch>;
     using Disambiguator = std::uint64_t;
 
+    /// \brief Modification time of a watched directory, taken before it was scanned the last time, and the time of
+    /// this scan (both in seconds).
+    class DirectoryGeneration
+    {
+      public:
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.". There are no class invariants to maintain which could be violated by directly accessing member
+        // variables.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::int64_t modification_time;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::int64_t scan_time;
+    };
+    using WatchDescriptorsContainer = std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier>;
+
+    /// \brief Creates the flag files of all the quality levels the given instance is offered with.
+    Result<QualityAwareContainer<score::cpp::optional<FlagFile>>> CreateFlagFiles(
+        const EnrichedInstanceIdentifier& enriched_instance_identifier,
+        const Disambiguator offer_disambiguator) noexcept;
+
+    /// \brief Adds the watches which are already set up for the given identifier to watch_descriptors.
+    /// \return true if there is such a watch, false if the filesystem has to be crawled for the identifier.
+    bool CollectExistingWatches(const LolaServiceInstanceIdentifier& identifier,
+                                WatchDescriptorsContainer& watch_descriptors) const noexcept;
+
+    Result<void> StartFindServiceImpl(const FindServiceHandle find_service_handle,
+                                      SearchHandler handler,
+                                      const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept;
+
+    /// \brief Updates the handles of the given searches with the current availability of a single instance and
+    /// records the change, so that the next CallHandlers() only has to report it.
+    void UpdateSearchRequests(const std::unordered_set<FindServiceHandle>& search_keys,
+                              const ServiceInstanceId& instance_id) noexcept;
+
     void CallHandlers(const std::unordered_set<FindServiceHandle>& search_keys) noexcept;
 
+    bool IsCoveredByWatch(const LolaServiceInstanceIdentifier& identifier) const noexcept;
+
     WatchesContainer::iterator StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
                                           const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept;
 
@@ -165,6 +248,17 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     void HandleDeletionEvents(const std::vector<os::InotifyEvent>& events) noexcept;
     void HandleCreationEvents(const std::vector<os::InotifyEvent>& events) noexcept;
 
+    /// \brief Brings all ongoing searches up to date after inotify dropped events, by rescanning the watched
+    /// directories which changed since their last scan.
+    void ResyncAfterOverflow() noexcept;
+
+    /// \brief Records the current generation of the watched directory and returns whether it differs from the recorded
+    /// one. A directory without a recorded generation is always considered as changed.
+    bool UpdateDirectoryGeneration(const WatchesContainer::iterator& watch_iterator) noexcept;
+
+    void ResyncInstanceDirectory(const WatchesContainer::iterator& watch_iterator) noexcept;
+    void ResyncServiceDirectory(const WatchesContainer::iterator& watch_iterator) noexcept;
+
     std::atomic<Disambiguator> offer_disambiguator_;
 
     std::unique_ptr<os::InotifyInstance> i_notify_;
@@ -219,6 +313,17 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     std::unordered_map<InstanceIdentifier, QualityAwareContainer<score::cpp::optional<FlagFile>>> flag_files_;
     std::unordered_set<FindServiceHandle> obsolete_search_requests_;
     std::mutex flag_files_mutex_;
+
+    std::atomic<std::uint64_t> find_service_cache_hits_;
+    std::atomic<std::uint64_t> find_service_cache_misses_;
+
+    /// \brief Generations of the watched directories, which were rescanned after an inotify queue overflow. Guarded by
+    /// worker_mutex_.
+    std::unordered_map<os::InotifyWatchDescriptor, DirectoryGeneration> directory_generations_;
+
+    std::atomic<std::uint64_t> inotify_overflows_;
+    std::atomic<std::uint64_t> rescanned_directories_;
+    std::atomic<std::uint64_t> skipped_directories_;
 };
 
 }  // namespace score::mw::com::impl::lola
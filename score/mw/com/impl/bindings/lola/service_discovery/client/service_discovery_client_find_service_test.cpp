@@ -19,6 +19,7 @@
 #include "score/mw/com/impl/configuration/lola_service_instance_id.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/configuration/test/configuration_store.h"
+#include "score/mw/com/impl/find_service_handle.h"
 #include "score/mw/com/impl/handle_type.h"
 
 #include "score/filesystem/error.h"
@@ -127,6 +128,68 @@ TEST_F(ServiceDiscoveryClientFindServiceFixture, FindServiceReturnNoHandleIfServ
     EXPECT_EQ(find_service_result.value().size(), 0);
 }
 
+TEST_F(ServiceDiscoveryClientFindServiceFixture, FindServiceWithoutActiveSearchCrawlsFilesystem)
+{
+    // Given a ServiceDiscovery client which offers a service
+    WhichContainsAServiceDiscoveryClient().WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier());
+
+    // When finding a service without an active StartFindService for it
+    const auto find_service_result =
+        service_discovery_client_->FindService(kConfigStoreQm1.GetEnrichedInstanceIdentifier());
+
+    // Then the service is found by crawling the filesystem
+    ASSERT_TRUE(find_service_result.has_value());
+    ASSERT_EQ(find_service_result.value().size(), 1);
+    EXPECT_EQ(find_service_result.value()[0], kConfigStoreQm1.GetHandle());
+    const auto statistics = service_discovery_client_->GetFindServiceCacheStatistics();
+    EXPECT_EQ(statistics.hits, 0U);
+    EXPECT_EQ(statistics.misses, 1U);
+}
+
+TEST_F(ServiceDiscoveryClientFindServiceFixture, FindServiceWithActiveSearchIsServedFromCache)
+{
+    // Given a ServiceDiscovery client which offers a service and an active StartFindService for it
+    WhichContainsAServiceDiscoveryClient()
+        .WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier())
+        .WithAnActiveStartFindService(kConfigStoreQm1.GetInstanceIdentifier(), make_FindServiceHandle(1U));
+
+    // When finding the same service as one shot
+    const auto find_service_result =
+        service_discovery_client_->FindService(kConfigStoreQm1.GetEnrichedInstanceIdentifier());
+
+    // Then the service is found without crawling the filesystem
+    ASSERT_TRUE(find_service_result.has_value());
+    ASSERT_EQ(find_service_result.value().size(), 1);
+    EXPECT_EQ(find_service_result.value()[0], kConfigStoreQm1.GetHandle());
+    const auto statistics = service_discovery_client_->GetFindServiceCacheStatistics();
+    EXPECT_EQ(statistics.hits, 1U);
+    EXPECT_EQ(statistics.misses, 0U);
+}
+
+TEST_F(ServiceDiscoveryClientFindServiceFixture, FindServiceForInstanceIsServedFromCacheOfFindAnySearch)
+{
+    // Given a ServiceDiscovery client which offers a service and an active find any StartFindService
+    WhichContainsAServiceDiscoveryClient()
+        .WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier())
+        .WithAnActiveStartFindService(kConfigStoreFindAny.GetInstanceIdentifier(), make_FindServiceHandle(1U));
+
+    // When finding an offered and a not offered instance as one shot
+    const auto find_offered_result =
+        service_discovery_client_->FindService(kConfigStoreQm1.GetEnrichedInstanceIdentifier());
+    const auto find_not_offered_result =
+        service_discovery_client_->FindService(kConfigStoreQm2.GetEnrichedInstanceIdentifier());
+
+    // Then both are answered from the cache
+    ASSERT_TRUE(find_offered_result.has_value());
+    ASSERT_EQ(find_offered_result.value().size(), 1);
+    EXPECT_EQ(find_offered_result.value()[0], kConfigStoreQm1.GetHandle());
+    ASSERT_TRUE(find_not_offered_result.has_value());
+    EXPECT_EQ(find_not_offered_result.value().size(), 0);
+    const auto statistics = service_discovery_client_->GetFindServiceCacheStatistics();
+    EXPECT_EQ(statistics.hits, 2U);
+    EXPECT_EQ(statistics.misses, 0U);
+}
+
 using ServiceDiscoveryClientWithFakeFileSystemFindServiceFixture = ServiceDiscoveryClientWithFakeFileSystemFixture;
 TEST_F(ServiceDiscoveryClientWithFakeFileSystemFindServiceFixture,
        FindServiceReturnsErrorWhenFailingToGetTheStatusOfInstanceDirectory)
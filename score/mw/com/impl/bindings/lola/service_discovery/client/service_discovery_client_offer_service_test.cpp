@@ -27,6 +27,7 @@
 #include <unistd.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace score::mw::com::impl::lola::test
 {
@@ -270,5 +271,64 @@ TEST_F(ServiceDiscoveryClientWithFakeFileSystemOfferServiceFixture, OfferingServ
     EXPECT_EQ(offer_service_result.error(), ComErrc::kBindingFailure);
 }
 
+TEST_F(ServiceDiscoveryClientWithFakeFileSystemOfferServiceFixture, OfferServicesCreatesFlagFilesOfAllInstances)
+{
+    // Given a ServiceDiscoveryClient which saves the generated flag file path
+    ThatSavesTheFlagFilePath().WhichContainsAServiceDiscoveryClient();
+
+    // When offering a QM and an ASIL B service at once
+    const std::vector<InstanceIdentifier> instance_identifiers{kConfigStoreQm.GetInstanceIdentifier(),
+                                                               kConfigStoreAsilB.GetInstanceIdentifier()};
+    ASSERT_TRUE(service_discovery_client_->OfferServices(instance_identifiers).has_value());
+
+    // Then the flag files of both services will be created
+    ASSERT_EQ(flag_file_path_.size(), 3);
+    for (const auto& flag_file_path : flag_file_path_)
+    {
+        EXPECT_TRUE(filesystem_mock_.standard->Exists(flag_file_path).value());
+    }
+}
+
+TEST_F(ServiceDiscoveryClientWithFakeFileSystemOfferServiceFixture,
+       OfferServicesWithAnAlreadyOfferedServiceReturnsErrorAndOffersNone)
+{
+    // Given a ServiceDiscoveryClient which saves the generated flag file path and an already offered service
+    ThatSavesTheFlagFilePath().WhichContainsAServiceDiscoveryClient();
+    ASSERT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm.GetInstanceIdentifier()).has_value());
+
+    // When offering another service together with the already offered one
+    const std::vector<InstanceIdentifier> instance_identifiers{kConfigStoreAsilB.GetInstanceIdentifier(),
+                                                               kConfigStoreQm.GetInstanceIdentifier()};
+    const auto offer_services_result = service_discovery_client_->OfferServices(instance_identifiers);
+
+    // Then an error is returned and no flag file is created for the other service
+    ASSERT_FALSE(offer_services_result.has_value());
+    EXPECT_EQ(offer_services_result.error(), ComErrc::kBindingFailure);
+    EXPECT_EQ(flag_file_path_.size(), 1);
+}
+
+TEST_F(ServiceDiscoveryClientWithFakeFileSystemOfferServiceFixture,
+       OfferServicesRemovesCreatedFlagFilesIfFlagFileCreationFails)
+{
+    // Given a ServiceDiscoveryClient which fails to create ASIL B flag files
+    ThatSavesTheFlagFilePath();
+    const auto flag_file_asil_b_string_regex = GetServiceDiscoveryPath() / ".*asil-b.*";
+    ON_CALL(*file_factory_mock_, Open(::testing::MatchesRegex(flag_file_asil_b_string_regex), _))
+        .WillByDefault(Return(ByMove(
+            score::MakeUnexpected<std::unique_ptr<std::iostream>>(filesystem::ErrorCode::kCouldNotOpenFileStream))));
+    WhichContainsAServiceDiscoveryClient();
+
+    // When offering a QM and an ASIL B service at once
+    const std::vector<InstanceIdentifier> instance_identifiers{kConfigStoreQm.GetInstanceIdentifier(),
+                                                               kConfigStoreAsilB.GetInstanceIdentifier()};
+    const auto offer_services_result = service_discovery_client_->OfferServices(instance_identifiers);
+
+    // Then an error is returned and the flag file of the QM service is removed again
+    ASSERT_FALSE(offer_services_result.has_value());
+    EXPECT_EQ(offer_services_result.error(), ComErrc::kServiceNotOffered);
+    ASSERT_FALSE(flag_file_path_.empty());
+    EXPECT_FALSE(filesystem_mock_.standard->Exists(flag_file_path_.front()).value());
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::lola::test
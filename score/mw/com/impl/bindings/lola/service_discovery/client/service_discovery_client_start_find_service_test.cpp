@@ -31,6 +31,7 @@
 #include <atomic>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace score::mw::com::impl::lola::test
 {
@@ -42,10 +43,12 @@ using ::testing::AtLeast;
 using ::testing::ByMove;
 using ::testing::Contains;
 using ::testing::DoDefault;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::InSequence;
 using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
+using ::testing::IsEmpty;
 using ::testing::MockFunction;
 using ::testing::Return;
 using ::testing::StrictMock;
@@ -797,5 +800,164 @@ TEST_F(ServiceDiscoveryClientStartFindServiceFixture,
     barrier_worker_thread_called_read_second.get_future().wait();
 }
 
+TEST_F(ServiceDiscoveryClientStartFindServiceFixture, DeltaHandlerInitiallyReportsAllKnownInstancesAsAdded)
+{
+    std::promise<void> service_found_barrier{};
+    FindServiceHandle expected_handle{make_FindServiceHandle(1U)};
+
+    StrictMock<MockFindServiceDeltaHandler> find_service_delta_handler{};
+    EXPECT_CALL(find_service_delta_handler, Call(_, IsEmpty(), expected_handle))
+        .WillOnce(WithArg<0>(Invoke([&service_found_barrier](auto added_handles) {
+            EXPECT_EQ(added_handles.size(), 2);
+            EXPECT_THAT(added_handles, Contains(kHandleFindAnyQm1));
+            EXPECT_THAT(added_handles, Contains(kHandleFindAnyQm2));
+            service_found_barrier.set_value();
+        })));
+
+    // Given two offered instances
+    WhichContainsAServiceDiscoveryClient()
+        .WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier())
+        .WithAnOfferedService(kConfigStoreQm2.GetInstanceIdentifier());
+
+    // When starting a find any search with a delta handler
+    const auto start_find_service_result = service_discovery_client_->StartFindServiceDelta(
+        expected_handle,
+        CreateWrappedMockFindServiceDeltaHandler(find_service_delta_handler),
+        EnrichedInstanceIdentifier{kConfigStoreFindAny.GetInstanceIdentifier()});
+
+    // Then the handler is called once with both instances as added and no removed instances
+    EXPECT_TRUE(start_find_service_result.has_value());
+    service_found_barrier.get_future().wait();
+}
+
+TEST_F(ServiceDiscoveryClientStartFindServiceFixture, DeltaHandlerOnlyReportsChangedInstances)
+{
+    InSequence in_sequence{};
+
+    std::promise<void> first_instance_found_barrier{};
+    std::promise<void> second_instance_found_barrier{};
+    std::promise<void> first_instance_lost_barrier{};
+    FindServiceHandle expected_handle{make_FindServiceHandle(1U)};
+
+    StrictMock<MockFindServiceDeltaHandler> find_service_delta_handler{};
+    EXPECT_CALL(find_service_delta_handler, Call(ElementsAre(kHandleFindAnyQm1), IsEmpty(), expected_handle))
+        .WillOnce(InvokeWithoutArgs([&first_instance_found_barrier]() {
+            first_instance_found_barrier.set_value();
+        }));
+    EXPECT_CALL(find_service_delta_handler, Call(ElementsAre(kHandleFindAnyQm2), IsEmpty(), expected_handle))
+        .WillOnce(InvokeWithoutArgs([&second_instance_found_barrier]() {
+            second_instance_found_barrier.set_value();
+        }));
+    EXPECT_CALL(find_service_delta_handler, Call(IsEmpty(), ElementsAre(kHandleFindAnyQm1), expected_handle))
+        .WillOnce(InvokeWithoutArgs([&first_instance_lost_barrier]() {
+            first_instance_lost_barrier.set_value();
+        }));
+
+    // Given a find any search with a delta handler
+    WhichContainsAServiceDiscoveryClient();
+    const auto start_find_service_result = service_discovery_client_->StartFindServiceDelta(
+        expected_handle,
+        CreateWrappedMockFindServiceDeltaHandler(find_service_delta_handler),
+        EnrichedInstanceIdentifier{kConfigStoreFindAny.GetInstanceIdentifier()});
+    EXPECT_TRUE(start_find_service_result.has_value());
+
+    // When instances are offered one after the other
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm1.GetInstanceIdentifier()).has_value());
+    first_instance_found_barrier.get_future().wait();
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm2.GetInstanceIdentifier()).has_value());
+    second_instance_found_barrier.get_future().wait();
+
+    // and the first offer is stopped
+    EXPECT_TRUE(service_discovery_client_
+                    ->StopOfferService(kConfigStoreQm1.GetInstanceIdentifier(),
+                                       IServiceDiscovery::QualityTypeSelector::kBoth)
+                    .has_value());
+
+    // Then each call of the handler only contains the instance which changed
+    first_instance_lost_barrier.get_future().wait();
+}
+
+TEST_F(ServiceDiscoveryClientStartFindServiceFixture, StartFindServicesWatchesServicePathOnceForInstancesOfSameService)
+{
+    // Given a ServiceDiscoveryClient
+    WhichContainsAServiceDiscoveryClient();
+
+    // Expecting that a single watch is added to the service path and none to the instance paths
+    const auto expected_service_directory_path = GenerateExpectedServiceDirectoryPath(kServiceId).Native();
+    const auto instance_directory_path_1 =
+        GenerateExpectedInstanceDirectoryPath(kServiceId, kConfigStoreQm1.lola_instance_id_->GetId()).Native();
+    const auto instance_directory_path_2 =
+        GenerateExpectedInstanceDirectoryPath(kServiceId, kConfigStoreQm2.lola_instance_id_->GetId()).Native();
+    EXPECT_CALL(inotify_instance_mock_, AddWatch(safecpp::zstring_view{expected_service_directory_path}, _));
+    EXPECT_CALL(inotify_instance_mock_, AddWatch(safecpp::zstring_view{instance_directory_path_1}, _)).Times(0);
+    EXPECT_CALL(inotify_instance_mock_, AddWatch(safecpp::zstring_view{instance_directory_path_2}, _)).Times(0);
+
+    // When calling StartFindServices with two instances of the same service
+    const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers{
+        EnrichedInstanceIdentifier{kConfigStoreQm1.GetInstanceIdentifier()},
+        EnrichedInstanceIdentifier{kConfigStoreQm2.GetInstanceIdentifier()}};
+    const auto start_find_services_result = service_discovery_client_->StartFindServices(
+        make_FindServiceHandle(1U), [](auto, auto) noexcept {}, enriched_instance_identifiers);
+
+    // Then the result is valid
+    EXPECT_TRUE(start_find_services_result.has_value());
+}
+
+TEST_F(ServiceDiscoveryClientStartFindServiceFixture, StartFindServicesCallsHandlerOnceWithAllOfferedInstances)
+{
+    const FindServiceHandle expected_handle{make_FindServiceHandle(1U)};
+
+    // Expecting that the handler is called once with the handles of both offered instances
+    StrictMock<MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>> find_service_handler{};
+    EXPECT_CALL(find_service_handler,
+                Call(::testing::UnorderedElementsAre(kConfigStoreQm1.GetHandle(), kConfigStoreQm2.GetHandle()),
+                     expected_handle));
+
+    // Given two offered instances of a service
+    WhichContainsAServiceDiscoveryClient()
+        .WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier())
+        .WithAnOfferedService(kConfigStoreQm2.GetInstanceIdentifier());
+
+    // When calling StartFindServices for both instances
+    const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers{
+        EnrichedInstanceIdentifier{kConfigStoreQm1.GetInstanceIdentifier()},
+        EnrichedInstanceIdentifier{kConfigStoreQm2.GetInstanceIdentifier()}};
+    const auto start_find_services_result = service_discovery_client_->StartFindServices(
+        expected_handle, CreateWrappedMockFindServiceHandler(find_service_handler), enriched_instance_identifiers);
+
+    // Then the result is valid
+    EXPECT_TRUE(start_find_services_result.has_value());
+}
+
+TEST_F(ServiceDiscoveryClientStartFindServiceFixture, StartFindServicesDoesNotReportInstancesWhichAreNotSearched)
+{
+    std::promise<void> service_found_barrier{};
+    const FindServiceHandle expected_handle{make_FindServiceHandle(1U)};
+
+    // Expecting that the handler is only called with the searched instance
+    StrictMock<MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>> find_service_handler{};
+    EXPECT_CALL(find_service_handler, Call(ElementsAre(kConfigStoreQm1.GetHandle()), expected_handle))
+        .WillOnce(InvokeWithoutArgs([&service_found_barrier]() {
+            service_found_barrier.set_value();
+        }));
+
+    // Given an offered instance of a service which is not searched
+    WhichContainsAServiceDiscoveryClient().WithAnOfferedService(kConfigStoreAsilB.GetInstanceIdentifier());
+
+    // and a StartFindServices search for two other instances of the same service
+    const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers{
+        EnrichedInstanceIdentifier{kConfigStoreQm1.GetInstanceIdentifier()},
+        EnrichedInstanceIdentifier{kConfigStoreQm2.GetInstanceIdentifier()}};
+    const auto start_find_services_result = service_discovery_client_->StartFindServices(
+        expected_handle, CreateWrappedMockFindServiceHandler(find_service_handler), enriched_instance_identifiers);
+    EXPECT_TRUE(start_find_services_result.has_value());
+
+    // When one of the searched instances is offered
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm1.GetInstanceIdentifier()).has_value());
+
+    // Then the handler is called with this instance only
+    service_found_barrier.get_future().wait();
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::lola::test
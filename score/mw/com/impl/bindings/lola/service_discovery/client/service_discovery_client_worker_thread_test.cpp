@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 #include <sys/inotify.h>
 #include <unistd.h>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -147,24 +148,48 @@ TEST_F(ServiceDiscoveryClientWorkerThreadFixture, ClosesInotifyInstanceOnDestruc
     barrier.get_future().wait();
 }
 
-using ServiceDiscoveryClientWorkerThreadDeathTest = ServiceDiscoveryClientWorkerThreadFixture;
-TEST_F(ServiceDiscoveryClientWorkerThreadDeathTest, BailsOutOnInotifyQueueOverflow)
+TEST_F(ServiceDiscoveryClientWorkerThreadFixture, ResyncsWatchedDirectoriesOnInotifyQueueOverflow)
 {
-    const auto event_vector = CreateEventVectorWithEventMasks({IN_Q_OVERFLOW});
-
-    ON_CALL(inotify_instance_mock_, Read()).WillByDefault(Return(event_vector));
-
-    // Since creating a ServiceDiscoveryClient spawns a thread, it should be called within the EXPECT_DEATH context.
-    const auto test_function = [this] {
-        auto inotify_instance_facade = std::make_unique<os::InotifyInstanceFacade>(inotify_instance_mock_);
-        auto unistd = std::make_unique<os::internal::UnistdImpl>();
-        const ServiceDiscoveryClient service_discovery_client{
-            long_running_threads_container_, std::move(inotify_instance_facade), std::move(unistd), filesystem_};
-        // We expect to die in an async thread - so a timeout is fine to violate the test if we do not die.
-        std::this_thread::sleep_for(std::chrono::hours{1});
-    };
+    const auto overflow_event_vector = CreateEventVectorWithEventMasks({IN_Q_OVERFLOW});
+    std::atomic<bool> overflow_requested{false};
+    std::promise<void> handler_called_barrier{};
+    std::atomic<bool> handler_called{false};
+
+    // Expecting that INotify::Read() never returns the events of the offer, but an overflow once it is requested
+    ON_CALL(inotify_instance_mock_, Read()).WillByDefault([&overflow_requested, &overflow_event_vector]() {
+        if (overflow_requested.exchange(false))
+        {
+            return overflow_event_vector;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        return score::cpp::static_vector<os::InotifyEvent, os::InotifyInstance::max_events>{};
+    });
+
+    // Given a ServiceDiscoveryClient with an active StartFindService call
+    const FindServiceHandle handle{make_FindServiceHandle(1U)};
+    WhichContainsAServiceDiscoveryClient().WithAnActiveStartFindService(
+        kConfigStoreQm1.GetInstanceIdentifier(),
+        handle,
+        [&handler_called, &handler_called_barrier](auto service_handle_container, auto) noexcept {
+            if (!(service_handle_container.empty()) && !(handler_called.exchange(true)))
+            {
+                handler_called_barrier.set_value();
+            }
+        });
 
-    EXPECT_DEATH(test_function(), ".*");
+    // and an offer whose inotify events are lost
+    WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier());
+
+    // When INotify::Read() reports an overflow of the inotify queue
+    overflow_requested = true;
+
+    // Then the handler is called with the offered instance found by the resync
+    handler_called_barrier.get_future().wait();
+
+    // and the overflow and the rescanned instance directory are counted
+    const auto statistics = service_discovery_client_->GetInotifyResyncStatistics();
+    EXPECT_EQ(statistics.overflows, 1U);
+    EXPECT_GE(statistics.rescanned_directories, 1U);
 }
 
 TEST_F(ServiceDiscoveryClientWorkerThreadFixture,
@@ -296,6 +321,7 @@ TEST_F(ServiceDiscoveryClientWorkerThreadFixture,
     event_read_with_deletion_event_barrier.get_future().wait();
 }
 
+using ServiceDiscoveryClientWorkerThreadDeathTest = ServiceDiscoveryClientWorkerThreadFixture;
 TEST_F(ServiceDiscoveryClientWorkerThreadDeathTest, DeletingServiceSearchDirectoryCausesWorkerThreadToTerminate)
 {
     const int watch_descriptor{10U};
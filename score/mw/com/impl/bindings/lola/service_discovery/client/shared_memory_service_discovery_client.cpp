@@ -0,0 +1,489 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/shared_memory_service_discovery_client.h"
+
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/configuration/lola_service_instance_id.h"
+#include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
+
+#include "score/mw/log/logging.h"
+#include "score/os/unistd.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+std::unique_ptr<ServiceRegistry> OpenServiceRegistry() noexcept
+{
+    auto registry = ServiceRegistry::Open();
+    if (registry == nullptr)
+    {
+        score::mw::log::LogFatal("lola") << "Could not open service registry" << kServiceRegistryShmName
+                                         << ". Terminating.";
+        std::terminate();
+    }
+    return registry;
+}
+
+std::optional<LolaServiceInstanceId::InstanceId> GetInstanceId(
+    const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
+{
+    const auto instance_id = enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>();
+    if (!instance_id.has_value())
+    {
+        return std::nullopt;
+    }
+    return instance_id.value();
+}
+
+LolaServiceId GetServiceId(const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
+{
+    return enriched_instance_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>().value();
+}
+
+}  // namespace
+
+SharedMemoryServiceDiscoveryClient::SharedMemoryServiceDiscoveryClient(
+    concurrency::Executor& long_running_threads) noexcept
+    : SharedMemoryServiceDiscoveryClient(long_running_threads,
+                                         OpenServiceRegistry(),
+                                         os::Unistd::instance().getpid())
+{
+}
+
+SharedMemoryServiceDiscoveryClient::SharedMemoryServiceDiscoveryClient(concurrency::Executor& long_running_threads,
+                                                                       std::unique_ptr<ServiceRegistry> registry,
+                                                                       const pid_t pid) noexcept
+    : IServiceDiscoveryClient{},
+      long_running_threads_{long_running_threads},
+      registry_{std::move(registry)},
+      pid_{pid},
+      search_requests_{},
+      obsolete_search_requests_{},
+      worker_mutex_{},
+      offered_instances_{},
+      offered_instances_mutex_{},
+      worker_thread_result_{}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(registry_ != nullptr, "Service registry must be provided");
+
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
+    // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
+    // By design, if `long_running_threads_.Submit()` ever fails, we expect program termination.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    worker_thread_result_ = long_running_threads_.Submit([this](const auto stop_token) noexcept {
+        // Suppress "AUTOSAR C++14 M0-1-3" and "AUTOSAR C++14 M0-1-9" rule violations. The rule states
+        // "A project shall not contain unused variables." and "There shall be no dead code.", respectively.
+        // Tolerated, this is a stop callback.
+        // coverity[autosar_cpp14_m0_1_9_violation : FALSE]
+        // coverity[autosar_cpp14_m0_1_3_violation : FALSE]
+        score::cpp::stop_callback wake_up_guard{stop_token, [this]() noexcept {
+                                                    registry_->WakeWaiters();
+                                                }};
+        auto observed_generation = registry_->GetGeneration();
+        while (!stop_token.stop_requested())
+        {
+            registry_->WaitForChange(observed_generation, kWorkerWaitTimeout);
+            const auto generation = registry_->GetGeneration();
+
+            // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+            // initialization.
+            // This is a false positive, we don't use auto here.
+            // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+            std::lock_guard lock{worker_mutex_};
+            TransferObsoleteSearchRequests();
+            if (generation != observed_generation)
+            {
+                // The generation is read before the lookups, so a change racing with them triggers another round.
+                observed_generation = generation;
+                CallHandlers();
+            }
+        }
+    });
+}
+
+SharedMemoryServiceDiscoveryClient::~SharedMemoryServiceDiscoveryClient() noexcept
+{
+    // Shut down worker thread correctly to avoid concurrency issues during destruction
+    worker_thread_result_.Abort();
+    score::cpp::ignore = worker_thread_result_.Wait();
+}
+
+auto SharedMemoryServiceDiscoveryClient::OfferService(const InstanceIdentifier instance_identifier) noexcept
+    -> Result<void>
+{
+    const EnrichedInstanceIdentifier enriched_instance_identifier{instance_identifier};
+    const auto instance_id = GetInstanceId(enriched_instance_identifier);
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(instance_id.has_value(),
+                                                      "Instance identifier must have instance id for service offer");
+    const auto service_id = GetServiceId(enriched_instance_identifier);
+
+    // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+    // initialization.
+    // This is a false positive, we don't use auto here.
+    // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+    std::lock_guard lock{offered_instances_mutex_};
+    if (offered_instances_.find(instance_identifier) != offered_instances_.cend())
+    {
+        return MakeUnexpected(ComErrc::kBindingFailure, "Service is already offered");
+    }
+
+    QualityAwareContainer<bool> registered_qualities{};
+    // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
+    // a well-formed switch statement".
+    // We don't need a break statement at each case as we use fallthrough and return.
+    // coverity[autosar_cpp14_m6_4_3_violation]
+    switch (enriched_instance_identifier.GetQualityType())
+    {
+        case QualityType::kASIL_B:
+        {
+            const auto asil_b_result = registry_->Register(service_id, instance_id.value(), QualityType::kASIL_B, pid_);
+            if (!asil_b_result.has_value())
+            {
+                return score::MakeUnexpected(ComErrc::kServiceNotOffered, "Failed to register ASIL-B offer");
+            }
+            registered_qualities.asil_b = true;
+        }
+            // As a service provider if we support offering a service with ASIL_B quality level that means that
+            // this is the highest quality level we support, so we also support the lower quality levels that's why
+            // we fall through QM level.
+            [[fallthrough]];
+        case QualityType::kASIL_QM:
+        {
+            const auto asil_qm_result =
+                registry_->Register(service_id, instance_id.value(), QualityType::kASIL_QM, pid_);
+            if (!asil_qm_result.has_value())
+            {
+                if (registered_qualities.asil_b)
+                {
+                    score::cpp::ignore = Unregister(enriched_instance_identifier, QualityType::kASIL_B);
+                }
+                return score::MakeUnexpected(ComErrc::kServiceNotOffered, "Failed to register ASIL-QM offer");
+            }
+            registered_qualities.asil_qm = true;
+            break;
+        }
+        case QualityType::kInvalid:
+            [[fallthrough]];
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause.
+        default:
+            return score::MakeUnexpected(ComErrc::kBindingFailure, "Unknown quality type of service");
+    }
+
+    score::cpp::ignore = offered_instances_.emplace(instance_identifier, registered_qualities);
+    return {};
+}
+
+auto SharedMemoryServiceDiscoveryClient::OfferServices(
+    const score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept -> Result<void>
+{
+    // Registering is a memory operation on the registry, so there is nothing to batch. Only the all or nothing
+    // semantics of the bulk offer have to be provided.
+    for (auto offer_it = instance_identifiers.begin(); offer_it != instance_identifiers.end(); ++offer_it)
+    {
+        auto result = OfferService(*offer_it);
+        if (!(result.has_value()))
+        {
+            for (auto offered_it = instance_identifiers.begin(); offered_it != offer_it; ++offered_it)
+            {
+                score::cpp::ignore = StopOfferService(*offered_it, IServiceDiscovery::QualityTypeSelector::kBoth);
+            }
+            return result;
+        }
+    }
+    return {};
+}
+
+auto SharedMemoryServiceDiscoveryClient::StopOfferService(
+    const InstanceIdentifier instance_identifier,
+    const IServiceDiscovery::QualityTypeSelector quality_type_selector) noexcept -> Result<void>
+{
+    const EnrichedInstanceIdentifier enriched_instance_identifier{instance_identifier};
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+        GetInstanceId(enriched_instance_identifier).has_value(),
+        "Instance identifier must have instance id for service offer stop");
+
+    // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+    // initialization.
+    // This is a false positive, we don't use auto here.
+    // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+    std::lock_guard lock{offered_instances_mutex_};
+    const auto offered_instance_iterator = offered_instances_.find(instance_identifier);
+    if (offered_instance_iterator == offered_instances_.cend())
+    {
+        return score::MakeUnexpected(ComErrc::kBindingFailure, "Never offered or offer already stopped");
+    }
+    auto& registered_qualities = offered_instance_iterator->second;
+
+    // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
+    // a well-formed switch statement".
+    // We don't need a break statement at the end of default case as we use return.
+    // coverity[autosar_cpp14_m6_4_3_violation]
+    switch (quality_type_selector)
+    {
+        case IServiceDiscovery::QualityTypeSelector::kBoth:
+            if (registered_qualities.asil_b)
+            {
+                score::cpp::ignore = Unregister(enriched_instance_identifier, QualityType::kASIL_B);
+            }
+            if (registered_qualities.asil_qm)
+            {
+                score::cpp::ignore = Unregister(enriched_instance_identifier, QualityType::kASIL_QM);
+            }
+            score::cpp::ignore = offered_instances_.erase(offered_instance_iterator);
+            break;
+        case IServiceDiscovery::QualityTypeSelector::kAsilQm:
+            if (registered_qualities.asil_qm)
+            {
+                score::cpp::ignore = Unregister(enriched_instance_identifier, QualityType::kASIL_QM);
+                registered_qualities.asil_qm = false;
+            }
+            break;
+            // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause.
+        default:
+            return score::MakeUnexpected(ComErrc::kBindingFailure, "Unknown quality type of service");
+    }
+
+    return {};
+}
+
+Result<void> SharedMemoryServiceDiscoveryClient::StartFindService(
+    const FindServiceHandle find_service_handle,
+    FindServiceHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartFindServiceImpl(find_service_handle, SearchHandler{std::move(handler)}, {enriched_instance_identifier});
+}
+
+Result<void> SharedMemoryServiceDiscoveryClient::StartFindServices(
+    const FindServiceHandle find_service_handle,
+    FindServiceHandler<HandleType> handler,
+    const score::cpp::span<const EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept
+{
+    return StartFindServiceImpl(find_service_handle,
+                                SearchHandler{std::move(handler)},
+                                std::vector<EnrichedInstanceIdentifier>{enriched_instance_identifiers.begin(),
+                                                                        enriched_instance_identifiers.end()});
+}
+
+Result<void> SharedMemoryServiceDiscoveryClient::StartFindServiceDelta(
+    const FindServiceHandle find_service_handle,
+    FindServiceDeltaHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartFindServiceImpl(find_service_handle, SearchHandler{std::move(handler)}, {enriched_instance_identifier});
+}
+
+Result<void> SharedMemoryServiceDiscoveryClient::StartFindServiceImpl(
+    const FindServiceHandle find_service_handle,
+    SearchHandler handler,
+    std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept
+{
+    // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced initialization.
+    // This is a false positive, we don't use auto here
+    // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+    const std::lock_guard worker_lock{worker_mutex_};
+
+    mw::log::LogDebug("lola") << "LoLa SD: Starting registry based service discovery with FindServiceHandle"
+                              << FindServiceHandleView{find_service_handle}.getUid();
+
+    auto known_handles = LookupHandles(enriched_instance_identifiers);
+    const auto added_search_request = search_requests_.emplace(
+        find_service_handle,
+        SearchRequest{std::move(handler),
+                      std::move(enriched_instance_identifiers),
+                      std::unordered_set<HandleType>{known_handles.cbegin(), known_handles.cend()}});
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+        added_search_request.second, "The FindServiceHandle should be unique for every call to StartFindService");
+
+    if (!(known_handles.empty()))
+    {
+        const auto& stored_handler = added_search_request.first->second.find_service_handler;
+        if (const auto* const delta_handler = std::get_if<FindServiceDeltaHandler<HandleType>>(&stored_handler))
+        {
+            (*delta_handler)(std::move(known_handles), std::vector<HandleType>{}, find_service_handle);
+        }
+        else
+        {
+            std::get<FindServiceHandler<HandleType>>(stored_handler)(std::move(known_handles), find_service_handle);
+        }
+    }
+
+    return {};
+}
+
+auto SharedMemoryServiceDiscoveryClient::StopFindService(const FindServiceHandle find_service_handle) noexcept
+    -> Result<void>
+{
+    // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced
+    // initialization.
+    // This is a false positive, we don't use auto here.
+    // coverity[autosar_cpp14_a8_5_3_violation : FALSE]
+    std::lock_guard lock{worker_mutex_};
+    score::cpp::ignore = obsolete_search_requests_.emplace(find_service_handle);
+
+    mw::log::LogDebug("lola") << "LoLa SD: Stopped registry based service discovery for FindServiceHandle"
+                              << FindServiceHandleView{find_service_handle}.getUid();
+
+    return {};
+}
+
+Result<ServiceHandleContainer<HandleType>> SharedMemoryServiceDiscoveryClient::FindService(
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return LookupHandles(enriched_instance_identifier);
+}
+
+auto SharedMemoryServiceDiscoveryClient::LookupHandles(
+    const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept -> std::vector<HandleType>
+{
+    const auto quality_type = enriched_instance_identifier.GetQualityType();
+    if ((quality_type != QualityType::kASIL_B) && (quality_type != QualityType::kASIL_QM))
+    {
+        score::mw::log::LogFatal("lola") << "Quality level not set for instance identifier. Terminating.";
+        std::terminate();
+    }
+
+    const auto instance_ids = registry_->Lookup(
+        GetServiceId(enriched_instance_identifier), GetInstanceId(enriched_instance_identifier), quality_type);
+
+    std::vector<HandleType> handles{};
+    handles.reserve(instance_ids.size());
+    for (const auto instance_id : instance_ids)
+    {
+        handles.push_back(
+            make_HandleType(enriched_instance_identifier.GetInstanceIdentifier(), LolaServiceInstanceId{instance_id}));
+    }
+    return handles;
+}
+
+auto SharedMemoryServiceDiscoveryClient::LookupHandles(
+    const std::vector<EnrichedInstanceIdentifier>& enriched_instance_identifiers) const noexcept
+    -> std::vector<HandleType>
+{
+    std::vector<HandleType> handles{};
+    std::unordered_set<HandleType> unique_handles{};
+    for (const auto& enriched_instance_identifier : enriched_instance_identifiers)
+    {
+        for (auto& handle : LookupHandles(enriched_instance_identifier))
+        {
+            if (unique_handles.insert(handle).second)
+            {
+                handles.push_back(std::move(handle));
+            }
+        }
+    }
+    return handles;
+}
+
+auto SharedMemoryServiceDiscoveryClient::Unregister(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                                                    const QualityType quality_type) noexcept -> Result<void>
+{
+    const auto result = registry_->Unregister(GetServiceId(enriched_instance_identifier),
+                                              GetInstanceId(enriched_instance_identifier).value(),
+                                              quality_type,
+                                              pid_);
+    if (!result.has_value())
+    {
+        mw::log::LogWarn("lola") << "LoLa SD: Could not withdraw offer from service registry:" << result.error();
+    }
+    return result;
+}
+
+auto SharedMemoryServiceDiscoveryClient::TransferObsoleteSearchRequests() noexcept -> void
+{
+    for (const auto& obsolete_search_request : obsolete_search_requests_)
+    {
+        score::cpp::ignore = search_requests_.erase(obsolete_search_request);
+    }
+    obsolete_search_requests_.clear();
+}
+
+auto SharedMemoryServiceDiscoveryClient::CallHandlers() noexcept -> void
+{
+    // Handlers may start new searches, which invalidates iterators into search_requests_. So we iterate over the keys.
+    std::vector<FindServiceHandle> search_keys{};
+    search_keys.reserve(search_requests_.size());
+    for (const auto& search_request : search_requests_)
+    {
+        search_keys.push_back(search_request.first);
+    }
+
+    for (const auto& search_key : search_keys)
+    {
+        const auto search_iterator = search_requests_.find(search_key);
+        if ((search_iterator == search_requests_.end()) ||
+            (obsolete_search_requests_.find(search_key) != obsolete_search_requests_.cend()))
+        {
+            continue;
+        }
+
+        auto& search_request = search_iterator->second;
+        auto known_handles = LookupHandles(search_request.enriched_instance_identifiers);
+        std::unordered_set<HandleType> new_handles{known_handles.cbegin(), known_handles.cend()};
+        if (search_request.handles == new_handles)
+        {
+            continue;
+        }
+
+        mw::log::LogDebug("lola") << "LoLa SD: Calling handler for FindServiceHandle"
+                                  << FindServiceHandleView{search_key}.getUid() << "with" << known_handles.size()
+                                  << "handles";
+
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
+        // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
+        // we can't add noexcept to score::cpp::callback signature.
+        if (const auto* const delta_handler =
+                std::get_if<FindServiceDeltaHandler<HandleType>>(&search_request.find_service_handler))
+        {
+            // The registry has no change log, so the delta is derived from the previous and the current lookup.
+            std::vector<HandleType> added_handles{};
+            for (const auto& handle : known_handles)
+            {
+                if (search_request.handles.find(handle) == search_request.handles.cend())
+                {
+                    added_handles.push_back(handle);
+                }
+            }
+            std::vector<HandleType> removed_handles{};
+            for (const auto& handle : search_request.handles)
+            {
+                if (new_handles.find(handle) == new_handles.cend())
+                {
+                    removed_handles.push_back(handle);
+                }
+            }
+            search_request.handles = std::move(new_handles);
+            // coverity[autosar_cpp14_a15_4_2_violation]
+            (*delta_handler)(std::move(added_handles), std::move(removed_handles), search_key);
+        }
+        else
+        {
+            search_request.handles = std::move(new_handles);
+            // coverity[autosar_cpp14_a15_4_2_violation]
+            std::get<FindServiceHandler<HandleType>>(search_request.find_service_handler)(std::move(known_handles),
+                                                                                          search_key);
+        }
+    }
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,141 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SHARED_MEMORY_SERVICE_DISCOVERY_CLIENT_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SHARED_MEMORY_SERVICE_DISCOVERY_CLIENT_H
+
+#include "score/mw/com/impl/i_service_discovery_client.h"
+
+#include "score/mw/com/impl/bindings/lola/service_discovery/quality_aware_container.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+#include "score/mw/com/impl/find_service_handler.h"
+
+#include "score/concurrency/executor.h"
+
+#include <score/span.hpp>
+
+#include <sys/types.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Service discovery client backed by the ServiceRegistry in shared memory instead of flag files and inotify.
+///
+/// Offers and finds are memory operations on the registry. A worker thread blocks on the generation of the registry
+/// and re-evaluates all ongoing searches, whenever any process changed the registry.
+class SharedMemoryServiceDiscoveryClient final : public IServiceDiscoveryClient
+{
+  public:
+    /// \brief Upper bound for the worker thread to block on the registry, before it re-checks for pending stop
+    /// requests.
+    static constexpr std::chrono::milliseconds kWorkerWaitTimeout{100};
+
+    /// \brief Creates a client on the well-known registry of the system. Terminates, if the registry can't be opened.
+    explicit SharedMemoryServiceDiscoveryClient(concurrency::Executor& long_running_threads) noexcept;
+    SharedMemoryServiceDiscoveryClient(concurrency::Executor& long_running_threads,
+                                       std::unique_ptr<ServiceRegistry> registry,
+                                       const pid_t pid) noexcept;
+
+    SharedMemoryServiceDiscoveryClient(const SharedMemoryServiceDiscoveryClient&) noexcept = delete;
+    SharedMemoryServiceDiscoveryClient& operator=(const SharedMemoryServiceDiscoveryClient&) noexcept = delete;
+    SharedMemoryServiceDiscoveryClient(SharedMemoryServiceDiscoveryClient&&) noexcept = delete;
+    SharedMemoryServiceDiscoveryClient& operator=(SharedMemoryServiceDiscoveryClient&&) noexcept = delete;
+
+    ~SharedMemoryServiceDiscoveryClient() noexcept override;
+
+    [[nodiscard]] Result<void> OfferService(const InstanceIdentifier instance_identifier) noexcept override;
+
+    [[nodiscard]] Result<void> OfferServices(
+        const score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept override;
+
+    [[nodiscard]] Result<void> StopOfferService(
+        const InstanceIdentifier instance_identifier,
+        const IServiceDiscovery::QualityTypeSelector quality_type_selector) noexcept override;
+
+    [[nodiscard]] Result<void> StartFindService(
+        const FindServiceHandle find_service_handle,
+        FindServiceHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
+
+    [[nodiscard]] Result<void> StartFindServices(
+        const FindServiceHandle find_service_handle,
+        FindServiceHandler<HandleType> handler,
+        const score::cpp::span<const EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept override;
+
+    [[nodiscard]] Result<void> StartFindServiceDelta(
+        const FindServiceHandle find_service_handle,
+        FindServiceDeltaHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
+
+    [[nodiscard]] Result<void> StopFindService(const FindServiceHandle find_service_handle) noexcept override;
+    [[nodiscard]] Result<ServiceHandleContainer<HandleType>> FindService(
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
+
+  private:
+    using SearchHandler = std::variant<FindServiceHandler<HandleType>, FindServiceDeltaHandler<HandleType>>;
+
+    class SearchRequest
+    {
+      public:
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.". There are no class invariants to maintain which could be violated by directly accessing member
+        // variables.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        SearchHandler find_service_handler;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::unordered_set<HandleType> handles;
+    };
+
+    Result<void> StartFindServiceImpl(const FindServiceHandle find_service_handle,
+                                      SearchHandler handler,
+                                      std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept;
+
+    std::vector<HandleType> LookupHandles(
+        const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept;
+    /// \brief Union of the handles of all the given identifiers, without duplicates.
+    std::vector<HandleType> LookupHandles(
+        const std::vector<EnrichedInstanceIdentifier>& enriched_instance_identifiers) const noexcept;
+    Result<void> Unregister(const EnrichedInstanceIdentifier& enriched_instance_identifier,
+                            const QualityType quality_type) noexcept;
+
+    void TransferObsoleteSearchRequests() noexcept;
+    void CallHandlers() noexcept;
+
+    concurrency::Executor& long_running_threads_;
+    std::unique_ptr<ServiceRegistry> registry_;
+    pid_t pid_;
+
+    /// \brief Ongoing searches. Synchronization follows ServiceDiscoveryClient: worker_mutex_ is recursive and held
+    /// while calling handlers, StopFindService() only marks searches as obsolete, which the worker thread erases.
+    std::unordered_map<FindServiceHandle, SearchRequest> search_requests_;
+    std::unordered_set<FindServiceHandle> obsolete_search_requests_;
+    std::recursive_mutex worker_mutex_;
+
+    /// \brief Qualities, with which the instances offered by this process are registered.
+    std::unordered_map<InstanceIdentifier, QualityAwareContainer<bool>> offered_instances_;
+    std::mutex offered_instances_mutex_;
+
+    concurrency::TaskResult<void> worker_thread_result_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SHARED_MEMORY_SERVICE_DISCOVERY_CLIENT_H
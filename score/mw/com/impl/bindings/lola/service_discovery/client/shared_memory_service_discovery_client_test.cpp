@@ -0,0 +1,220 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/shared_memory_service_discovery_client.h"
+
+#include "score/mw/com/impl/configuration/service_identifier_type.h"
+#include "score/mw/com/impl/configuration/test/configuration_store.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+
+#include <score/utility.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace ::testing;
+
+constexpr pid_t kOurPid{100};
+constexpr pid_t kProviderPid{200};
+const LolaServiceId kServiceId{1U};
+const auto kInstanceSpecifier = InstanceSpecifier::Create(std::string{"/bla/blub/specifier"}).value();
+
+class SharedMemoryServiceDiscoveryClientFixture : public ::testing::Test
+{
+  protected:
+    SharedMemoryServiceDiscoveryClient& CreateClient(const pid_t pid)
+    {
+        clients_.push_back(std::make_unique<SharedMemoryServiceDiscoveryClient>(
+            long_running_threads_,
+            // the pids of the test are made up, so all of them are considered to be alive
+            std::make_unique<ServiceRegistry>(*table_, nullptr, [](const pid_t) noexcept {
+                return true;
+            }),
+            pid));
+        return *clients_.back();
+    }
+
+    ConfigurationStore config_store_qm_{kInstanceSpecifier,
+                                        make_ServiceIdentifierType("foo"),
+                                        QualityType::kASIL_QM,
+                                        kServiceId,
+                                        LolaServiceInstanceId{1U}};
+    ConfigurationStore config_store_asil_b_{kInstanceSpecifier,
+                                            make_ServiceIdentifierType("foo"),
+                                            QualityType::kASIL_B,
+                                            kServiceId,
+                                            LolaServiceInstanceId{2U}};
+    ConfigurationStore config_store_find_any_{kInstanceSpecifier,
+                                              make_ServiceIdentifierType("foo"),
+                                              QualityType::kASIL_QM,
+                                              kServiceId,
+                                              score::cpp::nullopt};
+
+    std::unique_ptr<ServiceRegistryTable> table_{std::make_unique<ServiceRegistryTable>()};
+    concurrency::LongRunningThreadsContainer long_running_threads_{};
+    std::vector<std::unique_ptr<SharedMemoryServiceDiscoveryClient>> clients_{};
+};
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, FindServiceReturnsInstanceOfferedByOtherProcess)
+{
+    auto& provider = CreateClient(kProviderPid);
+    auto& consumer = CreateClient(kOurPid);
+
+    // Given an instance offered by another process
+    ASSERT_TRUE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+
+    // When finding the service
+    const auto handles = consumer.FindService(config_store_qm_.GetEnrichedInstanceIdentifier());
+
+    // Then the instance is found
+    ASSERT_TRUE(handles.has_value());
+    EXPECT_THAT(handles.value(), ElementsAre(config_store_qm_.GetHandle()));
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, AsilBOfferIsAlsoVisibleForQmConsumers)
+{
+    auto& provider = CreateClient(kProviderPid);
+
+    // Given an ASIL-B offer
+    ASSERT_TRUE(provider.OfferService(config_store_asil_b_.GetInstanceIdentifier()).has_value());
+
+    // When finding the service with QM quality
+    const EnrichedInstanceIdentifier qm_identifier{config_store_asil_b_.GetEnrichedInstanceIdentifier(),
+                                                   QualityType::kASIL_QM};
+    const auto qm_handles = provider.FindService(qm_identifier);
+
+    // Then the instance is found
+    ASSERT_TRUE(qm_handles.has_value());
+    EXPECT_EQ(qm_handles.value().size(), 1U);
+
+    // And when the QM part of the offer is stopped, it is only found with ASIL-B quality any longer
+    ASSERT_TRUE(provider
+                    .StopOfferService(config_store_asil_b_.GetInstanceIdentifier(),
+                                      IServiceDiscovery::QualityTypeSelector::kAsilQm)
+                    .has_value());
+    EXPECT_THAT(provider.FindService(qm_identifier).value(), IsEmpty());
+    EXPECT_EQ(provider.FindService(config_store_asil_b_.GetEnrichedInstanceIdentifier()).value().size(), 1U);
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, OfferingTwiceFails)
+{
+    auto& provider = CreateClient(kProviderPid);
+    ASSERT_TRUE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+
+    EXPECT_FALSE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, StopOfferWithoutOfferFails)
+{
+    auto& provider = CreateClient(kProviderPid);
+
+    EXPECT_FALSE(provider
+                     .StopOfferService(config_store_qm_.GetInstanceIdentifier(),
+                                       IServiceDiscovery::QualityTypeSelector::kBoth)
+                     .has_value());
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, StartFindServiceCallsHandlerSynchronouslyForOfferedInstance)
+{
+    auto& provider = CreateClient(kProviderPid);
+    auto& consumer = CreateClient(kOurPid);
+    ASSERT_TRUE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+
+    // When starting a search
+    bool handler_called{false};
+    ASSERT_TRUE(consumer
+                    .StartFindService(
+                        make_FindServiceHandle(1U),
+                        [this, &handler_called](auto handles, auto) noexcept {
+                            EXPECT_THAT(handles, ElementsAre(config_store_qm_.GetHandle()));
+                            handler_called = true;
+                        },
+                        config_store_find_any_.GetEnrichedInstanceIdentifier())
+                    .has_value());
+
+    // Then the handler is called before StartFindService returns
+    EXPECT_TRUE(handler_called);
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, StartFindServiceNotifiesAboutOfferAndStopOffer)
+{
+    auto& provider = CreateClient(kProviderPid);
+    auto& consumer = CreateClient(kOurPid);
+
+    // Given a search for any instance of the service
+    std::promise<void> offer_seen{};
+    std::promise<void> stop_offer_seen{};
+    ASSERT_TRUE(consumer
+                    .StartFindService(
+                        make_FindServiceHandle(1U),
+                        [&offer_seen, &stop_offer_seen](auto handles, auto) noexcept {
+                            if (handles.empty())
+                            {
+                                stop_offer_seen.set_value();
+                            }
+                            else
+                            {
+                                offer_seen.set_value();
+                            }
+                        },
+                        config_store_find_any_.GetEnrichedInstanceIdentifier())
+                    .has_value());
+
+    // When another process offers an instance and stops the offer again
+    ASSERT_TRUE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+    offer_seen.get_future().wait();
+    ASSERT_TRUE(provider
+                    .StopOfferService(config_store_qm_.GetInstanceIdentifier(),
+                                      IServiceDiscovery::QualityTypeSelector::kBoth)
+                    .has_value());
+
+    // Then the handler gets called for both changes
+    stop_offer_seen.get_future().wait();
+}
+
+TEST_F(SharedMemoryServiceDiscoveryClientFixture, HandlerIsNotCalledAfterStopFindService)
+{
+    auto& provider = CreateClient(kProviderPid);
+    auto& consumer = CreateClient(kOurPid);
+
+    // Given a search, which has been stopped
+    const auto find_service_handle = make_FindServiceHandle(1U);
+    ASSERT_TRUE(consumer
+                    .StartFindService(
+                        find_service_handle,
+                        [](auto, auto) noexcept {
+                            FAIL() << "Handler must not be called after StopFindService";
+                        },
+                        config_store_find_any_.GetEnrichedInstanceIdentifier())
+                    .has_value());
+    ASSERT_TRUE(consumer.StopFindService(find_service_handle).has_value());
+
+    // When an instance gets offered
+    ASSERT_TRUE(provider.OfferService(config_store_qm_.GetInstanceIdentifier()).has_value());
+
+    // Then the handler is not called, also not until the client is destroyed
+    clients_.clear();
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
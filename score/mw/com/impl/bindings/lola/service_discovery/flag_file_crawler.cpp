@@ -308,9 +308,13 @@ auto FlagFileCrawler::GatherExistingInstanceDirectories(
             mw::log::LogError("lola") << "Could not parse" << entry.GetPath() << "to instance id";
             continue;
         }
+        // The configuration of the identifier might contain an instance id when the service directory is watched for
+        // a StartFindServices() search, so the found instance id is set explicitly.
         EnrichedInstanceIdentifier found_enriched_instance_identifier{
-            enriched_instance_identifier.GetInstanceIdentifier(),
-            ServiceInstanceId{LolaServiceInstanceId{instance_id_result.value().GetId()}}};
+            score::cpp::optional<ServiceInstanceId>{
+                ServiceInstanceId{LolaServiceInstanceId{instance_id_result.value().GetId()}}},
+            enriched_instance_identifier.GetQualityType(),
+            enriched_instance_identifier.GetInstanceIdentifier()};
         score::cpp::ignore = enriched_instance_identifiers.emplace_back(std::move(found_enriched_instance_identifier),
                                                                         ParseQualityTypeFromString(filename));
     }
@@ -51,16 +51,17 @@ class FlagFileCrawler
     static auto ConvertFromStringToInstanceId(std::string_view view) noexcept -> Result<LolaServiceInstanceId>;
     static auto ParseQualityTypeFromString(const std::string_view filename) noexcept -> QualityType;
 
+    /// \brief Returns an identifier with instance id for every instance directory in the directory of the service.
+    static auto GatherExistingInstanceDirectories(
+        const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
+        -> score::Result<std::vector<EnrichedInstanceIdentifier>>;
+
   private:
     auto CrawlAndWatchImpl(const EnrichedInstanceIdentifier& enriched_instance_identifier,
                            const bool add_watch) noexcept
         -> score::Result<std::tuple<std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier>,
                                     QualityAwareContainer<KnownInstancesContainer>>>;
 
-    static auto GatherExistingInstanceDirectories(
-        const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
-        -> score::Result<std::vector<EnrichedInstanceIdentifier>>;
-
     auto AddWatchToInotifyInstance(const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
         -> Result<os::InotifyWatchDescriptor>;
 
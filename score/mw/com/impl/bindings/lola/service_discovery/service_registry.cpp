@@ -0,0 +1,406 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+
+#include "score/mw/com/impl/bindings/lola/futex.h"
+#include "score/mw/com/impl/com_error.h"
+
+#include "score/memory/shared/i_shared_memory_resource.h"
+#include "score/memory/shared/shared_memory_factory.h"
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <signal.h>
+#include <cerrno>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+constexpr std::uint64_t kEmptyKey{0U};
+/// \brief Set in every valid key, so that a valid key never equals kEmptyKey.
+constexpr std::uint64_t kOccupiedMarker{std::uint64_t{1U} << 48U};
+
+/// \brief State of a slot, as held in bits 32..33 of its owner word. Bits 0..31 hold the pid of the owner and bits
+/// 34..63 the epoch, which is incremented on every change of the owner word.
+enum class SlotState : std::uint64_t
+{
+    /// \brief Empty or withdrawn. The slot may be claimed for any key.
+    kReleased = 0U,
+    /// \brief The owner writes the key of the slot. Nobody else may change the slot, unless the owner is dead.
+    kClaiming = 1U,
+    /// \brief The owner offers the service instance identified by the key of the slot.
+    kOffered = 2U,
+};
+constexpr std::uint64_t kPidMask{0xFFFF'FFFFU};
+constexpr std::uint64_t kStateShift{32U};
+constexpr std::uint64_t kStateMask{0x3U};
+constexpr std::uint64_t kEpochShift{34U};
+constexpr std::size_t kSlotIndexMask{ServiceRegistryTable::kCapacity - 1U};
+
+static_assert((ServiceRegistryTable::kCapacity & kSlotIndexMask) == 0U, "Capacity must be a power of two");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Registry requires lock-free 64 bit atomics");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Registry requires lock-free 32 bit atomics");
+
+std::uint64_t PackKey(const LolaServiceId service_id,
+                      const LolaServiceInstanceId::InstanceId instance_id,
+                      const QualityType quality_type) noexcept
+{
+    return kOccupiedMarker | (static_cast<std::uint64_t>(static_cast<std::uint8_t>(quality_type)) << 32U) |
+           (static_cast<std::uint64_t>(service_id) << 16U) | static_cast<std::uint64_t>(instance_id);
+}
+
+/// \brief Returns the key without instance id, which is used to find all instances of a service.
+std::uint64_t ServiceKeyOf(const std::uint64_t key) noexcept
+{
+    return key & ~std::uint64_t{0xFFFFU};
+}
+
+LolaServiceInstanceId::InstanceId InstanceIdOf(const std::uint64_t key) noexcept
+{
+    return static_cast<LolaServiceInstanceId::InstanceId>(key & std::uint64_t{0xFFFFU});
+}
+
+SlotState StateOf(const std::uint64_t owner) noexcept
+{
+    return static_cast<SlotState>((owner >> kStateShift) & kStateMask);
+}
+
+pid_t PidOf(const std::uint64_t owner) noexcept
+{
+    return static_cast<pid_t>(static_cast<std::uint32_t>(owner & kPidMask));
+}
+
+/// \brief Returns the owner word following the given one, i.e. with incremented epoch.
+std::uint64_t NextOwner(const std::uint64_t owner, const pid_t pid, const SlotState state) noexcept
+{
+    const std::uint64_t epoch{(owner >> kEpochShift) + 1U};
+    return (epoch << kEpochShift) | (static_cast<std::uint64_t>(state) << kStateShift) |
+           static_cast<std::uint64_t>(static_cast<std::uint32_t>(pid));
+}
+
+/// \brief Consistent (key, owner) pair of a slot.
+struct SlotSnapshot
+{
+    std::uint64_t key;
+    std::uint64_t owner;
+};
+
+/// \brief Reads key and owner of the slot. The key only changes while the slot is claimed, which changes the owner
+/// word. So the key belongs to the owner word, if the owner word didn't change while reading the key.
+SlotSnapshot ReadSlot(const ServiceRegistryTable::Slot& slot) noexcept
+{
+    auto owner = slot.owner.load(std::memory_order_acquire);
+    while (true)
+    {
+        const auto key = slot.key.load(std::memory_order_acquire);
+        const auto owner_after_key = slot.owner.load(std::memory_order_acquire);
+        if (owner_after_key == owner)
+        {
+            return SlotSnapshot{key, owner};
+        }
+        owner = owner_after_key;
+    }
+}
+
+std::size_t HomeSlotOf(const LolaServiceId service_id) noexcept
+{
+    // Fibonacci hashing spreads consecutive service ids over the table.
+    constexpr std::uint32_t kFibonacciMultiplier{2654435769U};
+    return static_cast<std::size_t>(static_cast<std::uint32_t>(service_id) * kFibonacciMultiplier >> 16U) &
+           kSlotIndexMask;
+}
+
+}  // namespace
+
+std::unique_ptr<ServiceRegistry> ServiceRegistry::Open(const std::string_view shm_name) noexcept
+{
+    const std::string path{shm_name};
+    ServiceRegistryTable* table{nullptr};
+    std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource =
+        memory::shared::SharedMemoryFactory::Create(
+            path,
+            [&table](std::shared_ptr<memory::shared::ISharedMemoryResource> memory) {
+                table = memory->construct<ServiceRegistryTable>();
+            },
+            sizeof(ServiceRegistryTable) + alignof(ServiceRegistryTable),
+            memory::shared::SharedMemoryFactory::WorldWritable{},
+            false);
+
+    if (memory_resource == nullptr)
+    {
+        // Another process created the registry already.
+        memory_resource = memory::shared::SharedMemoryFactory::Open(path, true);
+        if (memory_resource == nullptr)
+        {
+            mw::log::LogError("lola") << "Could neither create nor open service registry" << path;
+            return nullptr;
+        }
+        // Suppress "AUTOSAR C++14 M5-2-8" rule. The rule declares:
+        // An object with integer type or pointer to void type shall not be converted to an object with pointer type.
+        // The "ServiceRegistryTable" type is strongly defined as shared IPC data between all LoLa processes.
+        // coverity[autosar_cpp14_m5_2_8_violation]
+        table = static_cast<ServiceRegistryTable*>(memory_resource->getUsableBaseAddress());
+    }
+
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(table != nullptr, "Could not retrieve service registry table");
+    return std::make_unique<ServiceRegistry>(*table, std::move(memory_resource));
+}
+
+ServiceRegistry::ServiceRegistry(ServiceRegistryTable& table,
+                                 std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource,
+                                 ProcessAliveCheck is_process_alive) noexcept
+    : table_{table}, memory_resource_{std::move(memory_resource)}, is_process_alive_{std::move(is_process_alive)}
+{
+}
+
+auto ServiceRegistry::IsProcessAlive(const pid_t pid) noexcept -> bool
+{
+    // Signal 0 only checks, whether the process exists. EPERM means, that it exists, but belongs to another user.
+    return (::kill(pid, 0) == 0) || (errno == EPERM);
+}
+
+auto ServiceRegistry::Register(const LolaServiceId service_id,
+                               const LolaServiceInstanceId::InstanceId instance_id,
+                               const QualityType quality_type,
+                               const pid_t provider_pid) noexcept -> Result<void>
+{
+    const auto key = PackKey(service_id, instance_id, quality_type);
+    const auto home_slot = HomeSlotOf(service_id);
+
+    // Every failed compare-exchange means, that another process changed the slot concurrently, so the probe sequence
+    // is started over. A slot, which is being claimed by another process, is waited for.
+    while (true)
+    {
+        bool start_over{false};
+        ServiceRegistryTable::Slot* free_slot{nullptr};
+        std::uint64_t free_slot_owner{0U};
+        for (std::size_t probe = 0U; (probe < ServiceRegistryTable::kCapacity) && !start_over; ++probe)
+        {
+            auto& slot = table_.slots[(home_slot + probe) & kSlotIndexMask];
+            auto snapshot = ReadSlot(slot);
+            const auto state = StateOf(snapshot.owner);
+            if (state == SlotState::kClaiming)
+            {
+                if (!is_process_alive_(PidOf(snapshot.owner)))
+                {
+                    // The claiming process died before it finished the claim, so the slot is released on its behalf.
+                    score::cpp::ignore = slot.owner.compare_exchange_strong(
+                        snapshot.owner,
+                        NextOwner(snapshot.owner, 0, SlotState::kReleased),
+                        std::memory_order_acq_rel);
+                }
+                std::this_thread::yield();
+                start_over = true;
+            }
+            else if (snapshot.key == key)
+            {
+                if ((state == SlotState::kOffered) && (PidOf(snapshot.owner) == provider_pid))
+                {
+                    return MakeUnexpected(ComErrc::kBindingFailure, "Service is already offered");
+                }
+                // Only the offer of a provider, which terminated without withdrawing it, may be taken over.
+                if ((state == SlotState::kOffered) && is_process_alive_(PidOf(snapshot.owner)))
+                {
+                    return MakeUnexpected(ComErrc::kBindingFailure, "Service is offered by another process");
+                }
+                if (slot.owner.compare_exchange_strong(snapshot.owner,
+                                                       NextOwner(snapshot.owner, provider_pid, SlotState::kOffered),
+                                                       std::memory_order_acq_rel))
+                {
+                    if (state == SlotState::kOffered)
+                    {
+                        mw::log::LogDebug("lola") << "LoLa SD: Took over registry slot of service" << service_id
+                                                  << "instance" << instance_id << "from terminated pid"
+                                                  << PidOf(snapshot.owner);
+                    }
+                    PublishChange();
+                    return {};
+                }
+                start_over = true;
+            }
+            else if (state == SlotState::kReleased)
+            {
+                if (free_slot == nullptr)
+                {
+                    free_slot = &slot;
+                    free_slot_owner = snapshot.owner;
+                }
+                if (snapshot.key == kEmptyKey)
+                {
+                    // The key is not on the probe sequence beyond an empty slot.
+                    break;
+                }
+            }
+            else if (ReleaseOfferOfTerminatedProvider(slot, snapshot.owner))
+            {
+                if (free_slot == nullptr)
+                {
+                    free_slot = &slot;
+                    free_slot_owner = snapshot.owner;
+                }
+            }
+            else
+            {
+                // Slot of another offered service instance.
+            }
+        }
+
+        if (start_over)
+        {
+            continue;
+        }
+        if (free_slot == nullptr)
+        {
+            return MakeUnexpected(ComErrc::kBindingFailure, "Service registry is full");
+        }
+
+        // The key may only be written by the owner of the slot, while it is claiming the slot.
+        if (free_slot->owner.compare_exchange_strong(free_slot_owner,
+                                                     NextOwner(free_slot_owner, provider_pid, SlotState::kClaiming),
+                                                     std::memory_order_acq_rel))
+        {
+            const auto claiming_owner = NextOwner(free_slot_owner, provider_pid, SlotState::kClaiming);
+            free_slot->key.store(key, std::memory_order_release);
+            free_slot->owner.store(NextOwner(claiming_owner, provider_pid, SlotState::kOffered),
+                                   std::memory_order_release);
+            PublishChange();
+            return {};
+        }
+    }
+}
+
+auto ServiceRegistry::Unregister(const LolaServiceId service_id,
+                                 const LolaServiceInstanceId::InstanceId instance_id,
+                                 const QualityType quality_type,
+                                 const pid_t provider_pid) noexcept -> Result<void>
+{
+    const auto key = PackKey(service_id, instance_id, quality_type);
+    const auto home_slot = HomeSlotOf(service_id);
+    for (std::size_t probe = 0U; probe < ServiceRegistryTable::kCapacity; ++probe)
+    {
+        auto& slot = table_.slots[(home_slot + probe) & kSlotIndexMask];
+        auto snapshot = ReadSlot(slot);
+        if (snapshot.key == kEmptyKey)
+        {
+            break;
+        }
+        if (snapshot.key != key)
+        {
+            score::cpp::ignore = ReleaseOfferOfTerminatedProvider(slot, snapshot.owner);
+            continue;
+        }
+        // The slot is released with a single compare-exchange of the owner word, so that it can't release an offer,
+        // which another process took over concurrently.
+        while ((StateOf(snapshot.owner) == SlotState::kOffered) && (PidOf(snapshot.owner) == provider_pid))
+        {
+            if (slot.owner.compare_exchange_weak(snapshot.owner,
+                                                 NextOwner(snapshot.owner, 0, SlotState::kReleased),
+                                                 std::memory_order_acq_rel))
+            {
+                PublishChange();
+                return {};
+            }
+        }
+        if ((StateOf(snapshot.owner) == SlotState::kOffered) &&
+            !ReleaseOfferOfTerminatedProvider(slot, snapshot.owner))
+        {
+            return MakeUnexpected(ComErrc::kBindingFailure, "Service is offered by another process");
+        }
+        break;
+    }
+    return MakeUnexpected(ComErrc::kBindingFailure, "Never offered or offer already stopped");
+}
+
+auto ServiceRegistry::Lookup(const LolaServiceId service_id,
+                             const std::optional<LolaServiceInstanceId::InstanceId> instance_id,
+                             const QualityType quality_type) const noexcept
+    -> std::vector<LolaServiceInstanceId::InstanceId>
+{
+    std::vector<LolaServiceInstanceId::InstanceId> instance_ids{};
+    const auto key = PackKey(service_id, instance_id.value_or(0U), quality_type);
+    const auto home_slot = HomeSlotOf(service_id);
+    for (std::size_t probe = 0U; probe < ServiceRegistryTable::kCapacity; ++probe)
+    {
+        const auto snapshot = ReadSlot(table_.slots[(home_slot + probe) & kSlotIndexMask]);
+        if (snapshot.key == kEmptyKey)
+        {
+            break;
+        }
+        const bool is_matching_key = instance_id.has_value() ? (snapshot.key == key)
+                                                             : (ServiceKeyOf(snapshot.key) == ServiceKeyOf(key));
+        // Lookup is a plain read of the table. The offer of a provider, which terminated without withdrawing it, is
+        // found until the next Register() or Unregister() probing over its slot releases it.
+        if (is_matching_key && (StateOf(snapshot.owner) == SlotState::kOffered))
+        {
+            instance_ids.push_back(InstanceIdOf(snapshot.key));
+        }
+        if (is_matching_key && instance_id.has_value())
+        {
+            break;
+        }
+    }
+    return instance_ids;
+}
+
+auto ServiceRegistry::GetGeneration() const noexcept -> std::uint32_t
+{
+    return table_.generation.load(std::memory_order_acquire);
+}
+
+auto ServiceRegistry::WaitForChange(const std::uint32_t observed_generation,
+                                    const std::chrono::milliseconds timeout) const noexcept -> void
+{
+    // The result is ignored, since callers re-check the generation anyway (EAGAIN: generation changed already,
+    // ETIMEDOUT, EINTR).
+    score::cpp::ignore = Futex::instance().Wait(table_.generation, observed_generation, timeout);
+}
+
+auto ServiceRegistry::WakeWaiters() const noexcept -> void
+{
+    score::cpp::ignore = Futex::instance().WakeAll(table_.generation);
+}
+
+auto ServiceRegistry::ReleaseOfferOfTerminatedProvider(ServiceRegistryTable::Slot& slot,
+                                                       std::uint64_t& owner) noexcept -> bool
+{
+    if ((StateOf(owner) != SlotState::kOffered) || is_process_alive_(PidOf(owner)))
+    {
+        return false;
+    }
+    const auto released_owner = NextOwner(owner, 0, SlotState::kReleased);
+    if (!slot.owner.compare_exchange_strong(owner, released_owner, std::memory_order_acq_rel))
+    {
+        // Another process changed the slot concurrently, e.g. released it already or took it over.
+        return false;
+    }
+    mw::log::LogDebug("lola") << "LoLa SD: Released registry slot of terminated pid" << PidOf(owner);
+    owner = released_owner;
+    PublishChange();
+    return true;
+}
+
+auto ServiceRegistry::PublishChange() noexcept -> void
+{
+    score::cpp::ignore = table_.generation.fetch_add(1U, std::memory_order_acq_rel);
+    WakeWaiters();
+}
+
+}  // namespace score::mw::com::impl::lola
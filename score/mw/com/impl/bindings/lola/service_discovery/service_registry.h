@@ -0,0 +1,162 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
+
+#include "score/mw/com/impl/configuration/lola_service_id.h"
+#include "score/mw/com/impl/configuration/lola_service_instance_id.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+
+#include "score/memory/shared/managed_memory_resource.h"
+#include "score/result/result.h"
+
+#include <score/callback.hpp>
+
+#include <sys/types.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Name of the well-known shared-memory object, which holds the ServiceRegistryTable of the system.
+constexpr std::string_view kServiceRegistryShmName{"/lola-service-registry"};
+
+/// \brief Memory layout of the service registry, which is shared between all LoLa processes of a system.
+///
+/// The table is an open-addressed hash table with linear probing, keyed by (service id, instance id, quality). Slots
+/// are hashed by service id only, so that all instances of a service are found on the probe sequence starting at the
+/// home slot of the service. Slots are never emptied again: A withdrawn offer only releases the slot, which keeps its
+/// key, so that the probe sequences stay intact. A released slot gets reused by a later offer of any key. All members
+/// are lock-free atomics, so that the table can be accessed concurrently from several processes without locks.
+class ServiceRegistryTable final
+{
+  public:
+    /// \brief Number of slots of the table. Must be a power of two.
+    static constexpr std::size_t kCapacity{1024U};
+
+    class Slot final
+    {
+      public:
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.". There are no class invariants to maintain which could be violated by directly accessing member
+        // variables.
+        /// \brief Packed (service id, instance id, quality) key of the slot, or the empty marker.
+        ///
+        /// Only written by the process, which claims the slot, while owner is in the claiming state.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::atomic<std::uint64_t> key{0U};
+        /// \brief Packed (provider pid, state, epoch) of the slot.
+        ///
+        /// All changes of the ownership (claim, offer, take-over and withdrawal) are single compare-exchanges of this
+        /// word. Its epoch is incremented on every change, so that readers can detect a concurrent change of the key.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::atomic<std::uint64_t> owner{0U};
+    };
+
+    /// \brief Incremented on every change of the table. Used as futex word to wake up waiters in other processes.
+    // coverity[autosar_cpp14_m11_0_1_violation] See above
+    std::atomic<std::uint32_t> generation{0U};
+    // coverity[autosar_cpp14_m11_0_1_violation] See above
+    std::array<Slot, kCapacity> slots{};
+};
+
+/// \brief Registry of the offered service instances of a system, held in one well-known shared-memory object.
+///
+/// Offering, withdrawing and looking up a service instance are plain memory operations on the ServiceRegistryTable.
+/// Every change increments the generation of the table and wakes up the processes waiting in WaitForChange().
+class ServiceRegistry final
+{
+  public:
+    /// \brief Returns whether the process with the given pid is still alive.
+    using ProcessAliveCheck = score::cpp::callback<bool(pid_t)>;
+
+    /// \brief Opens the registry in the shared-memory object with the given name and creates it, if it doesn't exist
+    /// yet. The shared-memory object is readable and writable by everyone.
+    /// \return the registry or nullptr, in case the shared-memory object could neither be created nor opened.
+    static std::unique_ptr<ServiceRegistry> Open(std::string_view shm_name = kServiceRegistryShmName) noexcept;
+
+    /// \brief Creates a registry operating on the given table.
+    /// \param table table to operate on. Must outlive the registry, unless it is owned by memory_resource.
+    /// \param memory_resource optional memory resource owning the table.
+    /// \param is_process_alive check, whether a provider is still alive. Defaults to IsProcessAlive().
+    explicit ServiceRegistry(ServiceRegistryTable& table,
+                             std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource = nullptr,
+                             ProcessAliveCheck is_process_alive = &IsProcessAlive) noexcept;
+
+    /// \brief Checks via kill() with signal 0, whether a process with the given pid exists.
+    ///
+    /// A pid of a terminated process, which has been reused by another process, is considered to be alive.
+    static bool IsProcessAlive(const pid_t pid) noexcept;
+
+    /// \brief Registers the given service instance as offered by the process with the given pid.
+    ///
+    /// A slot of the same service instance, which is still held by another pid, is taken over, if that pid is no
+    /// longer alive. This is the case after a provider terminated without withdrawing its offer and has been restarted.
+    /// Offers of other terminated providers on the probe sequence are released on the way.
+    /// \return error, if the instance is already offered by the same or another living pid or if the table is full.
+    Result<void> Register(const LolaServiceId service_id,
+                          const LolaServiceInstanceId::InstanceId instance_id,
+                          const QualityType quality_type,
+                          const pid_t provider_pid) noexcept;
+
+    /// \brief Withdraws the offer of the given service instance, which has been registered by the same pid.
+    ///
+    /// Offers of terminated providers on the probe sequence are released on the way.
+    Result<void> Unregister(const LolaServiceId service_id,
+                            const LolaServiceInstanceId::InstanceId instance_id,
+                            const QualityType quality_type,
+                            const pid_t provider_pid) noexcept;
+
+    /// \brief Returns the ids of the offered instances of the given service and quality.
+    ///
+    /// Plain read of the table without any liveness checks. Offers of providers, which terminated without withdrawing
+    /// them, are returned until the next Register() or Unregister() on their probe sequence releases them.
+    /// \param instance_id if set, only this instance is looked up, otherwise all instances of the service are returned.
+    std::vector<LolaServiceInstanceId::InstanceId> Lookup(
+        const LolaServiceId service_id,
+        const std::optional<LolaServiceInstanceId::InstanceId> instance_id,
+        const QualityType quality_type) const noexcept;
+
+    /// \brief Returns the current generation of the table, which changes on every registration and withdrawal.
+    std::uint32_t GetGeneration() const noexcept;
+
+    /// \brief Blocks until the generation of the table differs from the given one, the timeout expired or the waiter
+    /// got woken up by WakeWaiters(). Spurious wake-ups are possible, so callers have to re-check the generation.
+    void WaitForChange(const std::uint32_t observed_generation, const std::chrono::milliseconds timeout) const noexcept;
+
+    /// \brief Wakes up all waiters of all processes blocked in WaitForChange().
+    void WakeWaiters() const noexcept;
+
+  private:
+    /// \brief Releases the given slot, if it is offered by a provider, which is no longer alive.
+    /// \param owner owner word read from the slot. Updated to the current owner word of the slot.
+    /// \return true, if the slot got released by this call.
+    bool ReleaseOfferOfTerminatedProvider(ServiceRegistryTable::Slot& slot, std::uint64_t& owner) noexcept;
+    void PublishChange() noexcept;
+
+    ServiceRegistryTable& table_;
+    std::shared_ptr<memory::shared::ManagedMemoryResource> memory_resource_;
+    ProcessAliveCheck is_process_alive_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_REGISTRY_H
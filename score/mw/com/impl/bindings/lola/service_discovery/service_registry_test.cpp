@@ -0,0 +1,369 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/service_registry.h"
+
+#include "score/mw/com/impl/bindings/lola/futex_mock.h"
+#include "score/mw/com/impl/com_error.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace ::testing;
+
+constexpr LolaServiceId kServiceId{1U};
+constexpr LolaServiceId kOtherServiceId{2U};
+constexpr pid_t kPid{100};
+constexpr pid_t kOtherPid{200};
+
+class ServiceRegistryFixture : public ::testing::Test
+{
+  protected:
+    std::unique_ptr<ServiceRegistryTable> table_{std::make_unique<ServiceRegistryTable>()};
+    std::set<pid_t> dead_pids_{};
+    ServiceRegistry unit_{*table_, nullptr, [this](const pid_t pid) noexcept {
+                              return dead_pids_.count(pid) == 0U;
+                          }};
+};
+
+TEST_F(ServiceRegistryFixture, RegisteredInstanceCanBeLookedUp)
+{
+    // When registering an instance
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+    // Then it is found with its instance id and quality
+    EXPECT_THAT(unit_.Lookup(kServiceId, 1U, QualityType::kASIL_QM), ElementsAre(1U));
+
+    // But not with another quality, another instance id or another service id
+    EXPECT_THAT(unit_.Lookup(kServiceId, 1U, QualityType::kASIL_B), IsEmpty());
+    EXPECT_THAT(unit_.Lookup(kServiceId, 2U, QualityType::kASIL_QM), IsEmpty());
+    EXPECT_THAT(unit_.Lookup(kOtherServiceId, 1U, QualityType::kASIL_QM), IsEmpty());
+}
+
+TEST_F(ServiceRegistryFixture, LookupWithoutInstanceIdReturnsAllInstancesOfService)
+{
+    // Given three instances of a service and one of another service
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Register(kServiceId, 2U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Register(kServiceId, 3U, QualityType::kASIL_QM, kOtherPid).has_value());
+    ASSERT_TRUE(unit_.Register(kOtherServiceId, 4U, QualityType::kASIL_QM, kPid).has_value());
+
+    // When looking up any instance of the service
+    // Then exactly its three instances are returned
+    EXPECT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), UnorderedElementsAre(1U, 2U, 3U));
+}
+
+TEST_F(ServiceRegistryFixture, UnregisteredInstanceIsNoLongerFound)
+{
+    // Given two registered instances
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Register(kServiceId, 2U, QualityType::kASIL_QM, kPid).has_value());
+
+    // When unregistering the first one
+    ASSERT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+    // Then only the second one is found, although it is on the probe sequence behind the released slot of the first one
+    EXPECT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), ElementsAre(2U));
+    EXPECT_THAT(unit_.Lookup(kServiceId, 2U, QualityType::kASIL_QM), ElementsAre(2U));
+}
+
+TEST_F(ServiceRegistryFixture, RegisteringTwiceFromSamePidFails)
+{
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+    EXPECT_FALSE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+}
+
+TEST_F(ServiceRegistryFixture, RegisteringFromOtherPidTakesOverSlot)
+{
+    // Given an instance registered by a provider, which terminated without withdrawing its offer
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    dead_pids_.insert(kPid);
+
+    // When the restarted provider registers the instance again
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+
+    // Then the instance is still found once and can only be withdrawn by the new provider
+    EXPECT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), ElementsAre(1U));
+    EXPECT_FALSE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    EXPECT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+}
+
+TEST_F(ServiceRegistryFixture, RegisteringFromOtherPidFailsWhileProviderIsAlive)
+{
+    // Given an instance registered by a provider, which is still alive
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    const auto generation = unit_.GetGeneration();
+
+    // When another provider registers the same instance
+    const auto result = unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid);
+
+    // Then the registration fails without changing the table
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kBindingFailure);
+    EXPECT_EQ(unit_.GetGeneration(), generation);
+
+    // And the offer can still be withdrawn by the original provider only
+    EXPECT_FALSE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+    EXPECT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+}
+
+TEST_F(ServiceRegistryFixture, UnregisteringUnknownInstanceFails)
+{
+    EXPECT_FALSE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+}
+
+TEST_F(ServiceRegistryFixture, ReleasedSlotsAreReused)
+{
+    // Given a table, which has been filled and emptied again
+    for (std::size_t round = 0U; round < 2U; ++round)
+    {
+        for (std::size_t instance = 0U; instance < ServiceRegistryTable::kCapacity; ++instance)
+        {
+            const auto instance_id = static_cast<LolaServiceInstanceId::InstanceId>(instance);
+            ASSERT_TRUE(unit_.Register(kServiceId, instance_id, QualityType::kASIL_QM, kPid).has_value());
+        }
+
+        // Then no further instance fits into the full table
+        EXPECT_FALSE(unit_.Register(kOtherServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+        for (std::size_t instance = 0U; instance < ServiceRegistryTable::kCapacity; ++instance)
+        {
+            const auto instance_id = static_cast<LolaServiceInstanceId::InstanceId>(instance);
+            ASSERT_TRUE(unit_.Unregister(kServiceId, instance_id, QualityType::kASIL_QM, kPid).has_value());
+        }
+    }
+
+    // When registering another service
+    // Then the released slots are reused
+    EXPECT_TRUE(unit_.Register(kOtherServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    EXPECT_THAT(unit_.Lookup(kOtherServiceId, {}, QualityType::kASIL_QM), ElementsAre(1U));
+}
+
+TEST_F(ServiceRegistryFixture, OfferOfDeadProviderIsReleasedByNextRegistration)
+{
+    // Given an instance registered by a provider, which terminated without withdrawing its offer
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    dead_pids_.insert(kPid);
+
+    // Then lookups, which are plain reads of the table, still find it
+    EXPECT_THAT(unit_.Lookup(kServiceId, 1U, QualityType::kASIL_QM), ElementsAre(1U));
+    const auto generation = unit_.GetGeneration();
+
+    // When a living provider registers another instance of the service
+    ASSERT_TRUE(unit_.Register(kServiceId, 2U, QualityType::kASIL_QM, kOtherPid).has_value());
+
+    // Then the offer of the dead provider has been released on the way, so that only the new one is found
+    EXPECT_THAT(unit_.Lookup(kServiceId, 1U, QualityType::kASIL_QM), IsEmpty());
+    EXPECT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), ElementsAre(2U));
+
+    // And both changes have been published
+    EXPECT_EQ(unit_.GetGeneration(), generation + 2U);
+}
+
+TEST_F(ServiceRegistryFixture, OfferOfDeadProviderIsReleasedByNextUnregistration)
+{
+    // Given an instance of a provider, which terminated without withdrawing its offer, on the probe sequence in front
+    // of an instance of a living provider
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Register(kServiceId, 2U, QualityType::kASIL_QM, kOtherPid).has_value());
+    dead_pids_.insert(kPid);
+
+    // When the living provider withdraws its offer
+    ASSERT_TRUE(unit_.Unregister(kServiceId, 2U, QualityType::kASIL_QM, kOtherPid).has_value());
+
+    // Then the offer of the dead provider has been released on the way as well
+    EXPECT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), IsEmpty());
+}
+
+TEST_F(ServiceRegistryFixture, UnregisteringOfferOfDeadProviderReleasesIt)
+{
+    // Given an instance registered by a provider, which terminated without withdrawing its offer
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    dead_pids_.insert(kPid);
+
+    // When another process tries to withdraw the offer
+    // Then it fails, since it never offered the instance
+    EXPECT_FALSE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+
+    // But the offer of the dead provider has been released
+    EXPECT_THAT(unit_.Lookup(kServiceId, 1U, QualityType::kASIL_QM), IsEmpty());
+}
+
+TEST_F(ServiceRegistryFixture, ConcurrentUnregisterDoesNotWithdrawTakenOverOffer)
+{
+    constexpr std::size_t kRounds{500U};
+
+    // The other provider may only take over the offer, if the provider, which withdraws it, counts as terminated
+    dead_pids_.insert(kPid);
+    for (std::size_t round = 0U; round < kRounds; ++round)
+    {
+        // Given an instance registered by a provider
+        ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+        // When the provider withdraws its offer, while another provider registers the same instance concurrently
+        std::atomic<bool> start{false};
+        std::thread unregistering_thread{[this, &start]() {
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+            score::cpp::ignore = unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid);
+        }};
+        std::thread registering_thread{[this, &start]() {
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+            EXPECT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+        }};
+        start = true;
+        unregistering_thread.join();
+        registering_thread.join();
+
+        // Then the offer of the other provider is found once, regardless of the order of both operations
+        ASSERT_THAT(unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM), ElementsAre(1U));
+
+        // And it can be withdrawn by the other provider only
+        EXPECT_FALSE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+        ASSERT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kOtherPid).has_value());
+    }
+}
+
+TEST_F(ServiceRegistryFixture, ConcurrentRegistrationsOfDifferentInstancesClaimOneSlotEach)
+{
+    constexpr std::size_t kThreads{4U};
+    constexpr std::size_t kInstancesPerThread{100U};
+
+    // Given a registered instance, which is withdrawn again, so that its released slot is claimed concurrently
+    ASSERT_TRUE(unit_.Register(kServiceId, 0U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Unregister(kServiceId, 0U, QualityType::kASIL_QM, kPid).has_value());
+
+    // When several threads register different instances of the same service concurrently
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread = 0U; thread < kThreads; ++thread)
+    {
+        threads.emplace_back([this, &start, thread]() {
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+            for (std::size_t instance = 0U; instance < kInstancesPerThread; ++instance)
+            {
+                const auto instance_id =
+                    static_cast<LolaServiceInstanceId::InstanceId>((thread * kInstancesPerThread) + instance + 1U);
+                EXPECT_TRUE(unit_.Register(kServiceId, instance_id, QualityType::kASIL_QM, kPid).has_value());
+            }
+        });
+    }
+    start = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then each of them is found exactly once
+    const auto instance_ids = unit_.Lookup(kServiceId, {}, QualityType::kASIL_QM);
+    EXPECT_EQ(instance_ids.size(), kThreads * kInstancesPerThread);
+    EXPECT_EQ(std::set<LolaServiceInstanceId::InstanceId>(instance_ids.cbegin(), instance_ids.cend()).size(),
+              kThreads * kInstancesPerThread);
+}
+
+TEST_F(ServiceRegistryFixture, EveryChangeIncrementsGeneration)
+{
+    const auto initial_generation = unit_.GetGeneration();
+
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    EXPECT_EQ(unit_.GetGeneration(), initial_generation + 1U);
+
+    // A failing registration doesn't change the table
+    EXPECT_FALSE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    EXPECT_EQ(unit_.GetGeneration(), initial_generation + 1U);
+
+    ASSERT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    EXPECT_EQ(unit_.GetGeneration(), initial_generation + 2U);
+}
+
+TEST_F(ServiceRegistryFixture, WaitForChangeReturnsImmediatelyIfGenerationChangedAlready)
+{
+    const auto observed_generation = unit_.GetGeneration();
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+    const auto start = std::chrono::steady_clock::now();
+    unit_.WaitForChange(observed_generation, std::chrono::seconds{10});
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+}
+
+TEST_F(ServiceRegistryFixture, WaiterIsWokenUpByRegistration)
+{
+    // Given a thread waiting for a change of the registry
+    const auto observed_generation = unit_.GetGeneration();
+    std::thread waiter{[this, observed_generation]() {
+        while (unit_.GetGeneration() == observed_generation)
+        {
+            unit_.WaitForChange(observed_generation, std::chrono::seconds{10});
+        }
+    }};
+
+    // When another instance gets registered
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+
+    // Then the waiter wakes up well before its timeout
+    waiter.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+}
+
+class ServiceRegistryFutexFixture : public ServiceRegistryFixture
+{
+  protected:
+    os::MockGuard<StrictMock<FutexMock>> futex_mock_{};
+};
+
+TEST_F(ServiceRegistryFutexFixture, WaitForChangeWaitsOnGenerationOfTable)
+{
+    // Expecting that the futex is waited on with the generation of the table as futex word and the given timeout
+    EXPECT_CALL(*futex_mock_, Wait(Ref(table_->generation), 5U, std::chrono::nanoseconds{std::chrono::seconds{3}}))
+        .WillOnce(Return(score::cpp::make_unexpected(os::Error::createFromErrno(ETIMEDOUT))));
+
+    // When waiting for a change of the registry
+    unit_.WaitForChange(5U, std::chrono::seconds{3});
+}
+
+TEST_F(ServiceRegistryFutexFixture, EveryChangeWakesUpWaiters)
+{
+    // Expecting that the waiters on the generation of the table are woken up once per change
+    EXPECT_CALL(*futex_mock_, WakeAll(Ref(table_->generation))).Times(2).WillRepeatedly(Return(score::cpp::blank{}));
+
+    // When registering and unregistering an instance
+    ASSERT_TRUE(unit_.Register(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+    ASSERT_TRUE(unit_.Unregister(kServiceId, 1U, QualityType::kASIL_QM, kPid).has_value());
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -48,4 +48,14 @@ score::cpp::callback<void(ServiceHandleContainer<HandleType>, FindServiceHandle)
         };
 }
 
+FindServiceDeltaHandler<HandleType> CreateWrappedMockFindServiceDeltaHandler(
+    MockFindServiceDeltaHandler& mock_find_service_delta_handler)
+{
+    return [&mock_find_service_delta_handler](ServiceHandleContainer<HandleType> added_handles,
+                                              ServiceHandleContainer<HandleType> removed_handles,
+                                              FindServiceHandle handle) noexcept {
+        mock_find_service_delta_handler.AsStdFunction()(added_handles, removed_handles, handle);
+    };
+}
+
 }  // namespace score::mw::com::impl::lola::test
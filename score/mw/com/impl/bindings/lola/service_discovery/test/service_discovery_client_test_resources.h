@@ -41,6 +41,13 @@ filesystem::Path GenerateExpectedInstanceDirectoryPath(const LolaServiceId servi
 score::cpp::callback<void(ServiceHandleContainer<HandleType>, FindServiceHandle)> CreateWrappedMockFindServiceHandler(
     ::testing::MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>& mock_find_service_handler);
 
+using MockFindServiceDeltaHandler = ::testing::MockFunction<
+    void(ServiceHandleContainer<HandleType>, ServiceHandleContainer<HandleType>, FindServiceHandle)>;
+
+// Same as CreateWrappedMockFindServiceHandler() for a FindServiceDeltaHandler.
+FindServiceDeltaHandler<HandleType> CreateWrappedMockFindServiceDeltaHandler(
+    MockFindServiceDeltaHandler& mock_find_service_delta_handler);
+
 }  // namespace score::mw::com::impl::lola::test
 
 #endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_DISCOVERY_CLIENT_TEST_RESOURCES_H
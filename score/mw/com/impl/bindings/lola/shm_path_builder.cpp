@@ -29,6 +29,7 @@ namespace
 constexpr auto kDataChannelPrefix = "lola-data-";
 constexpr auto kControlChannelPrefix = "lola-ctl-";
 constexpr auto kMethodChannelPrefix = "lola-methods-";
+constexpr auto kStatisticsChannelPrefix = "lola-stats-";
 constexpr auto kAsilBControlChannelSuffix = "-b";
 
 /// Emit file name of the control file to an ostream
@@ -90,6 +91,17 @@ void EmitDataFileName(std::ostream& out,
     AppendServiceAndInstance(out, service_id, instance_id);
 }
 
+/// Emit file name of the statistics file to an ostream
+///
+/// \param out output ostream to use
+void EmitStatisticsFileName(std::ostream& out,
+                            const std::uint16_t service_id,
+                            const LolaServiceInstanceId::InstanceId instance_id) noexcept
+{
+    out << kStatisticsChannelPrefix;
+    AppendServiceAndInstance(out, service_id, instance_id);
+}
+
 /// Emit file name of the method file to an ostream
 ///
 /// \param out output ostream to use
@@ -123,6 +135,14 @@ std::string ShmPathBuilder::GetControlChannelShmName(const LolaServiceInstanceId
     });
 }
 
+std::string ShmPathBuilder::GetStatisticsChannelShmName(
+    const LolaServiceInstanceId::InstanceId instance_id) const noexcept
+{
+    return EmitWithPrefix('/', [this, instance_id](auto& out) noexcept {
+        EmitStatisticsFileName(out, service_id_, instance_id);
+    });
+}
+
 std::string ShmPathBuilder::GetMethodChannelShmName(
     const LolaServiceInstanceId::InstanceId instance_id,
     const ProxyInstanceIdentifier& proxy_instance_identifier) const noexcept
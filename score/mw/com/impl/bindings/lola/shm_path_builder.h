@@ -36,6 +36,9 @@ class ShmPathBuilder : public IShmPathBuilder
     std::string GetControlChannelShmName(const LolaServiceInstanceId::InstanceId instance_id,
                                          const QualityType channel_type) const noexcept override;
 
+    std::string GetStatisticsChannelShmName(
+        const LolaServiceInstanceId::InstanceId instance_id) const noexcept override;
+
     std::string GetMethodChannelShmName(
         const LolaServiceInstanceId::InstanceId instance_id,
         const ProxyInstanceIdentifier& proxy_instance_identifier) const noexcept override;
@@ -32,6 +32,10 @@ class ShmPathBuilderMock : public IShmPathBuilder
                 GetControlChannelShmName,
                 (LolaServiceInstanceId::InstanceId instance_id, const QualityType),
                 (const, noexcept, override));
+    MOCK_METHOD(std::string,
+                GetStatisticsChannelShmName,
+                (LolaServiceInstanceId::InstanceId instance_id),
+                (const, noexcept, override));
     MOCK_METHOD(std::string,
                 GetMethodChannelShmName,
                 (const LolaServiceInstanceId::InstanceId instance_id,
@@ -58,6 +62,11 @@ class ShmPathBuilderFacade : public IShmPathBuilder
         return shm_path_builder_mock_.GetControlChannelShmName(instance_id, channel_type);
     }
 
+    std::string GetStatisticsChannelShmName(const LolaServiceInstanceId::InstanceId instance_id) const noexcept override
+    {
+        return shm_path_builder_mock_.GetStatisticsChannelShmName(instance_id);
+    }
+
     std::string GetMethodChannelShmName(
         const LolaServiceInstanceId::InstanceId instance_id,
         const ProxyInstanceIdentifier& proxy_instance_identifier) const noexcept override
@@ -43,6 +43,11 @@ class ShmPathBuilderDataParamaterizedTestFixture
 {
 };
 
+class ShmPathBuilderStatisticsParamaterizedTestFixture
+    : public ::testing::TestWithParam<std::tuple<LolaServiceInstanceId::InstanceId, std::string>>
+{
+};
+
 class ShmPathBuilderMethodParamaterizedTestFixture
     : public ::testing::TestWithParam<
           std::tuple<LolaServiceInstanceId::InstanceId, ProxyInstanceIdentifier, std::string>>
@@ -122,6 +127,28 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(LolaServiceInstanceId::InstanceId{std::numeric_limits<std::uint16_t>::max()},
                                       "/lola-data-0000000000004660-65535")));
 
+TEST_P(ShmPathBuilderStatisticsParamaterizedTestFixture, TestBuildingStatisticsChannelShmNamePath)
+{
+    const auto [instance_id, expected_path] = GetParam();
+
+    // Given a ShmPathBuilder
+    ShmPathBuilder builder{kServiceId};
+
+    // When creating the statistics channel shm name
+    const auto actual_path = builder.GetStatisticsChannelShmName(instance_id);
+
+    // Then the returned path should be equal to the expected path
+    EXPECT_EQ(expected_path, actual_path);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ShmPathBuilderStatisticsTests,
+    ShmPathBuilderStatisticsParamaterizedTestFixture,
+    ::testing::Values(std::make_tuple(LolaServiceInstanceId::InstanceId{1}, "/lola-stats-0000000000004660-00001"),
+                      std::make_tuple(LolaServiceInstanceId::InstanceId{43981}, "/lola-stats-0000000000004660-43981"),
+                      std::make_tuple(LolaServiceInstanceId::InstanceId{std::numeric_limits<std::uint16_t>::max()},
+                                      "/lola-stats-0000000000004660-65535")));
+
 TEST_P(ShmPathBuilderMethodParamaterizedTestFixture, TestBuildingMethodChannelShmNamePath)
 {
     const auto [instance_id, proxy_instance_identifier, expected_path] = GetParam();
@@ -0,0 +1,238 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_size_cache.h"
+
+#include "score/json/json_parser.h"
+#include "score/json/json_writer.h"
+#include "score/mw/log/logging.h"
+
+#include <score/utility.hpp>
+
+#include <charconv>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+constexpr auto kCacheFileVersionKey = "version";
+constexpr auto kCacheFileEntriesKey = "entries";
+constexpr auto kDataSizeKey = "data";
+constexpr auto kControlQmSizeKey = "control-qm";
+constexpr auto kControlAsilBSizeKey = "control-asil-b";
+
+/// \brief Version of the cache file layout. Files with a different version are ignored and get overwritten.
+constexpr std::uint32_t kCacheFileVersion{1U};
+
+std::string KeyToString(const ShmSizeCache::Key key)
+{
+    std::stringstream stream;
+    // Passing std::hex to std::stringstream object with the stream operator follows the idiomatic way that both
+    // features in conjunction were designed in the C++ standard.
+    // coverity[autosar_cpp14_m8_4_4_violation] See above
+    stream << std::setfill('0') << std::setw(16) << std::hex << key;
+    return stream.str();
+}
+
+std::optional<ShmSizeCache::Key> KeyFromString(const std::string_view key_string)
+{
+    ShmSizeCache::Key key{};
+    const auto* const end = key_string.data() + key_string.size();
+    const auto result = std::from_chars(key_string.data(), end, key, 16);
+    if ((result.ec != std::errc{}) || (result.ptr != end))
+    {
+        return std::nullopt;
+    }
+    return key;
+}
+
+std::optional<std::size_t> GetSize(const json::Object& json_object, const std::string_view key)
+{
+    const auto it = json_object.find(key);
+    if (it == json_object.cend())
+    {
+        return std::nullopt;
+    }
+    const auto size_result = it->second.As<std::size_t>();
+    if (!size_result.has_value())
+    {
+        return std::nullopt;
+    }
+    return size_result.value();
+}
+
+std::optional<ShmResourceStorageSizes> SizesFromJson(const json::Any& json_any)
+{
+    const auto json_object_result = json_any.As<json::Object>();
+    if (!json_object_result.has_value())
+    {
+        return std::nullopt;
+    }
+    const json::Object& json_object = json_object_result.value();
+
+    const auto data_size = GetSize(json_object, kDataSizeKey);
+    const auto control_qm_size = GetSize(json_object, kControlQmSizeKey);
+    if ((!data_size.has_value()) || (!control_qm_size.has_value()))
+    {
+        return std::nullopt;
+    }
+
+    score::cpp::optional<std::size_t> control_asil_b_size{};
+    if (json_object.find(kControlAsilBSizeKey) != json_object.cend())
+    {
+        const auto asil_b_size = GetSize(json_object, kControlAsilBSizeKey);
+        if (!asil_b_size.has_value())
+        {
+            return std::nullopt;
+        }
+        control_asil_b_size = asil_b_size.value();
+    }
+    return ShmResourceStorageSizes{data_size.value(), control_qm_size.value(), control_asil_b_size};
+}
+
+json::Object SizesToJson(const ShmResourceStorageSizes& sizes)
+{
+    json::Object json_object{};
+    json_object[kDataSizeKey] = json::Any{sizes.data_size};
+    json_object[kControlQmSizeKey] = json::Any{sizes.control_qm_size};
+    if (sizes.control_asil_b_size.has_value())
+    {
+        json_object[kControlAsilBSizeKey] = json::Any{sizes.control_asil_b_size.value()};
+    }
+    return json_object;
+}
+
+}  // namespace
+
+bool operator==(const ShmResourceStorageSizes& lhs, const ShmResourceStorageSizes& rhs) noexcept
+{
+    return ((lhs.data_size == rhs.data_size) && (lhs.control_qm_size == rhs.control_qm_size) &&
+            (lhs.control_asil_b_size == rhs.control_asil_b_size));
+}
+
+ShmSizeCache::ShmSizeCache(std::optional<std::string> cache_file_path) noexcept
+    : cache_file_path_{std::move(cache_file_path)}, cache_file_loaded_{false}, entries_{}, entries_mutex_{}
+{
+}
+
+std::optional<ShmResourceStorageSizes> ShmSizeCache::Find(const Key key) noexcept
+{
+    const std::lock_guard<std::mutex> lock{entries_mutex_};
+    LoadCacheFileIfNeeded();
+
+    const auto entry = entries_.find(key);
+    if (entry == entries_.cend())
+    {
+        return std::nullopt;
+    }
+    return entry->second;
+}
+
+void ShmSizeCache::Insert(const Key key, const ShmResourceStorageSizes& sizes) noexcept
+{
+    const std::lock_guard<std::mutex> lock{entries_mutex_};
+    LoadCacheFileIfNeeded();
+    entries_[key] = sizes;
+
+    if (cache_file_path_.has_value())
+    {
+        // Other processes might have added entries to the cache file since we loaded it. Take them over, so that we
+        // don't drop them when writing the file.
+        MergeCacheFile();
+        WriteCacheFile();
+    }
+}
+
+void ShmSizeCache::LoadCacheFileIfNeeded() noexcept
+{
+    if (cache_file_loaded_ || (!cache_file_path_.has_value()))
+    {
+        return;
+    }
+    cache_file_loaded_ = true;
+    MergeCacheFile();
+}
+
+void ShmSizeCache::MergeCacheFile() noexcept
+{
+    const json::JsonParser json_parser{};
+    const auto json_result = json_parser.FromFile(cache_file_path_.value());
+    if (!json_result.has_value())
+    {
+        score::mw::log::LogInfo("lola") << "No readable shm size cache file at" << cache_file_path_.value()
+                                        << ". Shm sizes will be calculated.";
+        return;
+    }
+
+    const auto json_object_result = json_result.value().As<json::Object>();
+    if (!json_object_result.has_value())
+    {
+        score::mw::log::LogWarn("lola") << "Ignoring corrupted shm size cache file" << cache_file_path_.value();
+        return;
+    }
+    const json::Object& json_object = json_object_result.value();
+
+    const auto version = GetSize(json_object, kCacheFileVersionKey);
+    const auto entries_it = json_object.find(kCacheFileEntriesKey);
+    if ((!version.has_value()) || (version.value() != kCacheFileVersion) || (entries_it == json_object.cend()) ||
+        (!entries_it->second.As<json::Object>().has_value()))
+    {
+        score::mw::log::LogWarn("lola") << "Ignoring shm size cache file" << cache_file_path_.value()
+                                        << "with unknown version or layout.";
+        return;
+    }
+
+    const json::Object& json_entries = entries_it->second.As<json::Object>().value();
+    for (const auto& json_entry : json_entries)
+    {
+        const auto key = KeyFromString(json_entry.first.GetAsStringView());
+        const auto sizes = SizesFromJson(json_entry.second);
+        if ((!key.has_value()) || (!sizes.has_value()))
+        {
+            score::mw::log::LogWarn("lola") << "Ignoring corrupted entry in shm size cache file"
+                                            << cache_file_path_.value();
+            continue;
+        }
+        // Entries we already have take precedence, as they were calculated/loaded by this process.
+        score::cpp::ignore = entries_.emplace(key.value(), sizes.value());
+    }
+}
+
+void ShmSizeCache::WriteCacheFile() const noexcept
+{
+    json::Object json_entries{};
+    for (const auto& entry : entries_)
+    {
+        json_entries[KeyToString(entry.first)] = SizesToJson(entry.second);
+    }
+
+    json::Object json_object{};
+    json_object[kCacheFileVersionKey] = json::Any{kCacheFileVersion};
+    json_object[kCacheFileEntriesKey] = std::move(json_entries);
+
+    json::JsonWriter json_writer{};
+    const auto write_result = json_writer.ToFile(json_object, cache_file_path_.value());
+    if (!write_result.has_value())
+    {
+        score::mw::log::LogWarn("lola") << "Could not write shm size cache file" << cache_file_path_.value() << ":"
+                                        << write_result.error();
+    }
+}
+
+}  // namespace score::mw::com::impl::lola
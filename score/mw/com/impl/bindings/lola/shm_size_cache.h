@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
+
+#include <score/optional.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Sizes of the shm-objects (data, control QM and optionally control ASIL-B) of a service instance.
+class ShmResourceStorageSizes
+{
+  public:
+    // Suppress "AUTOSAR C++14 M11-0-1": All non-POD class types should only have private member data.
+    // Justification: There are no class invariants to maintain which could be violated by directly accessing member
+    // variables.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t data_size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t control_qm_size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    score::cpp::optional<std::size_t> control_asil_b_size;
+};
+
+bool operator==(const ShmResourceStorageSizes& lhs, const ShmResourceStorageSizes& rhs) noexcept;
+
+/// \brief Caches the shm-object sizes of service instances, which were calculated via simulation.
+///
+/// The simulation (see SkeletonMemoryManager) builds the complete control and data layout of a service instance on a
+/// heap backed memory resource, which is costly for services with many events/slots. Its result only depends on the
+/// deployment of the service instance and on the data types of its events/fields. So it gets stored under a key
+/// calculated from exactly these inputs and re-used for later offers of the same layout.
+/// If a cache file path is given, entries are additionally loaded from and persisted to this file, so that they also
+/// survive process restarts. The cache file is a pure optimization: Any failure to read or write it is logged and
+/// otherwise ignored, which leads to the sizes being calculated again.
+class ShmSizeCache final
+{
+  public:
+    using Key = std::uint64_t;
+
+    /// \param cache_file_path path of the persistent cache file. If empty, sizes are only cached in-process.
+    explicit ShmSizeCache(std::optional<std::string> cache_file_path) noexcept;
+
+    ~ShmSizeCache() noexcept = default;
+
+    ShmSizeCache(const ShmSizeCache&) = delete;
+    ShmSizeCache& operator=(const ShmSizeCache&) = delete;
+    ShmSizeCache(ShmSizeCache&&) = delete;
+    ShmSizeCache& operator=(ShmSizeCache&&) = delete;
+
+    /// \brief Looks up the sizes stored for the given key.
+    /// \details The first lookup loads the persistent cache file (if configured).
+    /// \return stored sizes or an empty optional in case there is no entry for the key.
+    std::optional<ShmResourceStorageSizes> Find(const Key key) noexcept;
+
+    /// \brief Stores the sizes for the given key and updates the persistent cache file (if configured).
+    void Insert(const Key key, const ShmResourceStorageSizes& sizes) noexcept;
+
+  private:
+    void LoadCacheFileIfNeeded() noexcept;
+    void MergeCacheFile() noexcept;
+    void WriteCacheFile() const noexcept;
+
+    std::optional<std::string> cache_file_path_;
+    bool cache_file_loaded_;
+    std::unordered_map<Key, ShmResourceStorageSizes> entries_;
+    /// \brief mutex to synchronize access to entries_ and the cache file, as skeletons might get offered concurrently.
+    std::mutex entries_mutex_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_SIZE_CACHE_H
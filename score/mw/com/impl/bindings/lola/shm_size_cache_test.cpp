@@ -0,0 +1,180 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_size_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+const ShmSizeCache::Key kKey{0x1234'5678'9ABC'DEF0U};
+const ShmSizeCache::Key kOtherKey{42U};
+const ShmResourceStorageSizes kQmSizes{1024U, 512U, {}};
+const ShmResourceStorageSizes kAsilBSizes{4096U, 2048U, score::cpp::optional<std::size_t>{2048U}};
+
+class ShmSizeCacheFixture : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        score::cpp::ignore = std::remove(cache_file_path_.c_str());
+    }
+
+    void WriteCacheFile(const std::string& content) const
+    {
+        std::ofstream cache_file{cache_file_path_};
+        cache_file << content;
+    }
+
+    const std::string cache_file_path_{::testing::TempDir() + "shm_size_cache_test_" + std::to_string(getpid()) +
+                                       ".json"};
+};
+
+TEST_F(ShmSizeCacheFixture, FindReturnsNothingForUnknownKey)
+{
+    // Given an empty in-process cache
+    ShmSizeCache unit{std::nullopt};
+
+    // When looking up a key
+    // Then nothing is found
+    EXPECT_FALSE(unit.Find(kKey).has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, FindReturnsInsertedSizes)
+{
+    // Given an in-process cache, in which sizes for two keys were inserted
+    ShmSizeCache unit{std::nullopt};
+    unit.Insert(kKey, kQmSizes);
+    unit.Insert(kOtherKey, kAsilBSizes);
+
+    // When looking up the keys
+    // Then the inserted sizes are returned
+    EXPECT_EQ(unit.Find(kKey), kQmSizes);
+    EXPECT_EQ(unit.Find(kOtherKey), kAsilBSizes);
+}
+
+TEST_F(ShmSizeCacheFixture, InsertOverwritesExistingEntry)
+{
+    // Given an in-process cache, in which sizes for a key were inserted
+    ShmSizeCache unit{std::nullopt};
+    unit.Insert(kKey, kQmSizes);
+
+    // When inserting other sizes for the same key
+    unit.Insert(kKey, kAsilBSizes);
+
+    // Then the latest sizes are returned
+    EXPECT_EQ(unit.Find(kKey), kAsilBSizes);
+}
+
+TEST_F(ShmSizeCacheFixture, InsertedSizesSurviveInCacheFile)
+{
+    // Given a cache with a cache file, in which sizes for two keys were inserted
+    {
+        ShmSizeCache unit{cache_file_path_};
+        unit.Insert(kKey, kQmSizes);
+        unit.Insert(kOtherKey, kAsilBSizes);
+    }
+
+    // When creating a new cache with the same cache file (e.g. after a restart)
+    ShmSizeCache unit{cache_file_path_};
+
+    // Then the sizes are found
+    EXPECT_EQ(unit.Find(kKey), kQmSizes);
+    EXPECT_EQ(unit.Find(kOtherKey), kAsilBSizes);
+}
+
+TEST_F(ShmSizeCacheFixture, MissingCacheFileIsNotAnError)
+{
+    // Given a cache with a cache file, which does not exist
+    ShmSizeCache unit{cache_file_path_};
+
+    // When looking up a key
+    // Then nothing is found
+    EXPECT_FALSE(unit.Find(kKey).has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, CorruptedCacheFileIsIgnoredAndOverwritten)
+{
+    // Given a corrupted cache file
+    WriteCacheFile("{ not json");
+
+    // When creating a cache with this file
+    {
+        ShmSizeCache unit{cache_file_path_};
+
+        // Then nothing is found
+        EXPECT_FALSE(unit.Find(kKey).has_value());
+
+        // and when inserting sizes
+        unit.Insert(kKey, kQmSizes);
+    }
+
+    // Then the file is valid again and contains the sizes
+    ShmSizeCache unit{cache_file_path_};
+    EXPECT_EQ(unit.Find(kKey), kQmSizes);
+}
+
+TEST_F(ShmSizeCacheFixture, CacheFileWithUnknownVersionIsIgnored)
+{
+    // Given a cache file with an unknown version, which contains an entry for the key
+    WriteCacheFile(R"json({"version": 999, "entries": {"123456789abcdef0": {"data": 1, "control-qm": 2}}})json");
+
+    // When creating a cache with this file
+    ShmSizeCache unit{cache_file_path_};
+
+    // Then the entry is not found
+    EXPECT_FALSE(unit.Find(kKey).has_value());
+}
+
+TEST_F(ShmSizeCacheFixture, CorruptedEntriesOfCacheFileAreIgnored)
+{
+    // Given a cache file with one corrupted and one valid entry
+    WriteCacheFile(R"json({"version": 1, "entries": {
+                       "000000000000002a": {"data": 1},
+                       "123456789abcdef0": {"data": 1024, "control-qm": 512}}})json");
+
+    // When creating a cache with this file
+    ShmSizeCache unit{cache_file_path_};
+
+    // Then only the valid entry is found
+    EXPECT_FALSE(unit.Find(kOtherKey).has_value());
+    EXPECT_EQ(unit.Find(kKey), kQmSizes);
+}
+
+TEST_F(ShmSizeCacheFixture, InsertKeepsEntriesWrittenByOtherProcesses)
+{
+    // Given two caches using the same cache file, which both have loaded the (empty) file
+    ShmSizeCache unit{cache_file_path_};
+    ShmSizeCache other_process_cache{cache_file_path_};
+    EXPECT_FALSE(unit.Find(kKey).has_value());
+    EXPECT_FALSE(other_process_cache.Find(kOtherKey).has_value());
+
+    // When both insert sizes for different keys
+    other_process_cache.Insert(kOtherKey, kAsilBSizes);
+    unit.Insert(kKey, kQmSizes);
+
+    // Then the cache file contains both entries
+    ShmSizeCache restarted_cache{cache_file_path_};
+    EXPECT_EQ(restarted_cache.Find(kKey), kQmSizes);
+    EXPECT_EQ(restarted_cache.Find(kOtherKey), kAsilBSizes);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -44,7 +44,9 @@
 #include <exception>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -217,6 +219,7 @@ Skeleton::Skeleton(const InstanceIdentifier& identifier,
                       lola_service_type_deployment,
                       lola_instance_id_,
                       lola_service_id_},
+      statistics_publisher_{},
       partial_restart_path_builder_{std::move(partial_restart_path_builder)},
       service_instance_existence_marker_file_{std::move(service_instance_existence_marker_file)},
       service_instance_usage_marker_file_{},
@@ -293,8 +296,22 @@ auto Skeleton::PrepareOffer(SkeletonEventBindings& events,
             return open_result;
         }
         memory_manager_.CleanupSharedMemoryAfterCrash();
+
+        // We can have transactions in the TransactionLogs relating to tracing (QM only) or field getter logic (QM and /
+        // or ASIL-B). We try rolling back all TransactionLogSets which are found.
+        // We rollback any transactions in the TransactionLogs even if tracing is disabled in the current process. It's
+        // possible that we could have tracing disabled in this process but the crashed process had tracing enabled and
+        // therefore may have transactions that need to be rolled back. If tracing was also disabled in the previous
+        // process or if there are no transactions to rollback, RollbackSkeletonTracingTransactions will simply do
+        // nothing. All events are rolled back here at once (and not one by one on their registration), so that the
+        // rollback executor of the runtime can roll back the events of service instances with many events
+        // concurrently.
+        memory_manager_.RollbackSkeletonTracingTransactions(
+            GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetRollbackExecutor());
     }
 
+    CreateStatisticsPublisher(events.size() + fields.size());
+
     // If there are no registered SkeletonMethods, then we don't need to register a method subscribed handler and
     // can therefore exit early.
     if (skeleton_methods_.empty())
@@ -383,6 +400,9 @@ auto Skeleton::PrepareStopOffer(std::optional<UnregisterShmObjectTraceCallback>
             tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback);
     }
 
+    // The events/fields already unregistered from the statistics in their PrepareStopOffer().
+    statistics_publisher_.reset();
+
     // Unregister any MethodCallHandlers that were registered by the SkeletonMethods and destroy registration guards
     // which will destroy any registered ServiceMethodSubscribedHandlers. Expiring the scopes below will try to
     // acquire a write lock on a mutex, while any calls to handlers will try to acquire a read lock. Therefore, if
@@ -467,6 +487,33 @@ void Skeleton::DisconnectQmConsumers()
     }
 }
 
+void Skeleton::RegisterElementStatistics(const ElementFqId element_fq_id,
+                                         const std::string_view element_name,
+                                         const EventControl& event_control_qm,
+                                         const EventControl* const event_control_asil_b,
+                                         const SkeletonEventPerformanceCounters& performance_counters) noexcept
+{
+    if (statistics_publisher_ == nullptr)
+    {
+        return;
+    }
+    statistics_publisher_->RegisterElement(
+        element_fq_id, element_name, QualityType::kASIL_QM, event_control_qm, performance_counters);
+    if (event_control_asil_b != nullptr)
+    {
+        statistics_publisher_->RegisterElement(
+            element_fq_id, element_name, QualityType::kASIL_B, *event_control_asil_b, performance_counters);
+    }
+}
+
+void Skeleton::UnregisterElementStatistics(const ElementFqId element_fq_id) noexcept
+{
+    if (statistics_publisher_ != nullptr)
+    {
+        statistics_publisher_->UnregisterElement(element_fq_id);
+    }
+}
+
 void Skeleton::RegisterMethod(const UniqueMethodIdentifier method_id, SkeletonMethod& skeleton_method)
 {
     const auto [ignorable, was_inserted] = skeleton_methods_.insert({method_id, skeleton_method});
@@ -501,19 +548,6 @@ auto Skeleton::RegisterGeneric(const ElementFqId element_fq_id,
         auto [event_data_control_qm, event_data_control_asil_b] =
             memory_manager_.RetrieveEventControlsFromOpenedSharedMemory(element_fq_id);
 
-        // We can have transactions in the TransactionLogs relating to tracing (QM only) or field getter logic (QM and /
-        // or ASIL-B). We try rolling back all TransactionLogSets which are found.
-        // We rollback any transactions in the TransactionLog that correspond to the SkeletonEvent even if
-        // tracing is disabled in the current process. It's possible that we could have tracing disabled in this process
-        // but the crashed process had tracing enabled and therefore may have transactions that need to be rolled back.
-        // If tracing was also disabled in the previous process or if there are no transactions to rollback,
-        // RollbackSkeletonTracingTransactions will simply do nothing.
-        memory_manager_.RollbackSkeletonTracingTransactions(event_data_control_qm);
-        if (event_data_control_asil_b != nullptr)
-        {
-            memory_manager_.RollbackSkeletonTracingTransactions(*event_data_control_asil_b);
-        }
-
         auto& event_data_storage = memory_manager_.RetrieveEventDataFromOpenedSharedMemory<std::uint8_t>(element_fq_id);
         return {static_cast<void*>(&event_data_storage), event_data_control_qm, event_data_control_asil_b};
     }
@@ -678,6 +712,31 @@ IMessagePassingService::AllowedConsumerUids Skeleton::GetAllowedConsumers(const
     return std::set<uid_t>{allowed_consumer_vector.begin(), allowed_consumer_vector.end()};
 }
 
+void Skeleton::CreateStatisticsPublisher(const std::size_t number_of_elements) noexcept
+{
+    const auto statistics_settings = statistics::ServiceStatisticsPublisher::GetEnabledSettings();
+    if (!statistics_settings.has_value())
+    {
+        return;
+    }
+    // Each event/field gets an entry per quality level of its control segment.
+    const std::size_t number_of_quality_levels{(quality_type_ == QualityType::kASIL_B) ? 2U : 1U};
+    auto publisher_result = statistics::ServiceStatisticsPublisher::Create(
+        shm_path_builder_->GetStatisticsChannelShmName(lola_instance_id_),
+        lola_service_id_,
+        lola_instance_id_,
+        number_of_elements * number_of_quality_levels,
+        statistics_settings.value());
+    // The statistics are only a diagnostic aid, so offering the service doesn't fail without them.
+    if (!publisher_result.has_value())
+    {
+        score::mw::log::LogWarn("lola") << "Skeleton (S:" << lola_service_id_ << "I:" << lola_instance_id_
+                                        << "): Could not create statistics segment. Statistics are not published.";
+        return;
+    }
+    statistics_publisher_ = std::move(publisher_result).value();
+}
+
 MethodData& Skeleton::GetMethodData(const memory::shared::ManagedMemoryResource& resource)
 {
     auto* const method_data_storage = static_cast<MethodData*>(resource.getUsableBaseAddress());
@@ -28,6 +28,7 @@
 #include "score/mw/com/impl/bindings/lola/skeleton_event_properties.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_memory_manager.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_method.h"
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_publisher.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_set.h"
 #include "score/mw/com/impl/configuration/lola_method_id.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
@@ -44,9 +45,11 @@
 #include <score/optional.hpp>
 
 #include <sys/types.h>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 
@@ -157,6 +160,19 @@ class Skeleton final : public SkeletonBinding
     ///          an assert/termination.
     void DisconnectQmConsumers();
 
+    /// \brief Adds an event/field to the statistics segment of this skeleton.
+    /// \details Does nothing, if no statistics segment was created in PrepareOffer(), i.e. if publishing of the
+    ///          statistics was not enabled via statistics::ServiceStatisticsPublisher::Enable(). The event controls and
+    ///          performance_counters have to stay valid until UnregisterElementStatistics() is called.
+    void RegisterElementStatistics(const ElementFqId element_fq_id,
+                                   const std::string_view element_name,
+                                   const EventControl& event_control_qm,
+                                   const EventControl* const event_control_asil_b,
+                                   const SkeletonEventPerformanceCounters& performance_counters) noexcept;
+
+    /// \brief Removes an event/field from the statistics segment of this skeleton.
+    void UnregisterElementStatistics(const ElementFqId element_fq_id) noexcept;
+
     /// \brief Function allowing a SkeletonMethod to register itself with its parent skeleton.
     ///
     /// This registration is required so that the Skeleton can access its owned methods.
@@ -191,6 +207,8 @@ class Skeleton final : public SkeletonBinding
     /// \brief Gets the set of allowed proxy consumer IDs from the configuration
     IMessagePassingService::AllowedConsumerUids GetAllowedConsumers(const QualityType asil_level) const;
 
+    void CreateStatisticsPublisher(const std::size_t number_of_elements) noexcept;
+
     InstanceIdentifier identifier_;
     QualityType quality_type_;
     LolaServiceInstanceId::InstanceId lola_instance_id_;
@@ -200,6 +218,10 @@ class Skeleton final : public SkeletonBinding
 
     SkeletonMemoryManager memory_manager_;
 
+    /// \brief Publisher of the statistics segment, which is created in PrepareOffer(), if publishing of the statistics
+    ///        is enabled, and destroyed in PrepareStopOffer().
+    std::unique_ptr<statistics::ServiceStatisticsPublisher> statistics_publisher_;
+
     std::unique_ptr<IPartialRestartPathBuilder> partial_restart_path_builder_;
     std::optional<memory::shared::LockFile> service_instance_existence_marker_file_;
     std::optional<memory::shared::LockFile> service_instance_usage_marker_file_;
@@ -254,19 +276,6 @@ auto Skeleton::Register(const ElementFqId element_fq_id, SkeletonEventProperties
         auto [event_data_control_qm, event_data_control_asil_b] =
             memory_manager_.RetrieveEventControlsFromOpenedSharedMemory(element_fq_id);
 
-        // We can have transactions in the TransactionLogs relating to tracing (QM only) or field getter logic (QM and /
-        // or ASIL-B). We try rolling back all TransactionLogSets which are found.
-        // We rollback any transactions in the TransactionLog that correspond to the SkeletonEvent even if
-        // tracing is disabled in the current process. It's possible that we could have tracing disabled in this process
-        // but the crashed process had tracing enabled and therefore may have transactions that need to be rolled back.
-        // If tracing was also disabled in the previous process or if there are no transactions to rollback,
-        // RollbackSkeletonTracingTransactions will simply do nothing.
-        memory_manager_.RollbackSkeletonTracingTransactions(event_data_control_qm);
-        if (event_data_control_asil_b != nullptr)
-        {
-            memory_manager_.RollbackSkeletonTracingTransactions(*event_data_control_asil_b);
-        }
-
         auto& event_data_storage = memory_manager_.RetrieveEventDataFromOpenedSharedMemory<SampleType>(element_fq_id);
         return RegistrationResult<SampleType>{event_data_storage, event_data_control_qm, event_data_control_asil_b};
     }
@@ -102,6 +102,18 @@ class SkeletonEvent final : public SkeletonEventBinding<SampleType>
         skeleton_event_common_.SetSkeletonEventTracingData(tracing_data);
     }
 
+    /// \brief Returns the performance counters of this event (slot allocation, dropped samples, notifications).
+    /// \details All values stay 0, if the counters are compiled out (see kEventPerformanceCountersCompiledIn).
+    SkeletonEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return skeleton_event_common_.GetPerformanceCounterValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        skeleton_event_common_.ResetPerformanceCounters();
+    }
+
   private:
     EventDataStorage<SampleType>* event_data_storage_;
     SkeletonEventCommon<SampleType> skeleton_event_common_;
@@ -17,10 +17,12 @@
 #include "score/mw/com/impl/bindings/lola/control_slot_types.h"
 #include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/event_data_control_composite.h"
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
 #include "score/mw/com/impl/bindings/lola/i_runtime.h"
 #include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "score/mw/com/impl/bindings/lola/skeleton.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_event_properties.h"
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_registration_guard.h"
 #include "score/mw/com/impl/bindings/lola/type_erased_sample_ptrs_guard.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
@@ -109,12 +111,26 @@ class SkeletonEventCommon
         return consumer_control_local_view_qm_.value();
     }
 
+    SkeletonEventPerformanceCounterValues GetPerformanceCounterValues() const noexcept
+    {
+        return performance_counters_.GetValues();
+    }
+
+    void ResetPerformanceCounters() noexcept
+    {
+        performance_counters_.Reset();
+    }
+
   private:
     Skeleton& parent_;
     std::string_view event_name_;
     SkeletonEventProperties event_properties_;
     ElementFqId element_fq_id_;
 
+    /// \brief Performance counters of this event, which are also updated by the ProviderEventDataControlLocalViews.
+    /// \details Kept over PrepareStopOfferCommon() / PrepareOfferCommon(), so that they cover the whole lifetime.
+    SkeletonEventPerformanceCounters performance_counters_{};
+
     std::optional<ProviderEventDataControlLocalView<>> provider_control_local_view_qm_;
     std::optional<ProviderEventDataControlLocalView<>> provider_control_local_view_asil_b_;
     std::optional<ConsumerEventDataControlLocalView<>> consumer_control_local_view_qm_;
@@ -172,14 +188,15 @@ template <typename SampleType>
 void SkeletonEventCommon<SampleType>::PrepareOfferCommon(EventControl& event_control_qm,
                                                          EventControl* event_control_asil_b) noexcept
 {
-    auto& provider_control_local_view_qm = provider_control_local_view_qm_.emplace(event_control_qm.data_control);
+    auto& provider_control_local_view_qm =
+        provider_control_local_view_qm_.emplace(event_control_qm.data_control, &performance_counters_);
     auto& consumer_control_local_view_qm = consumer_control_local_view_qm_.emplace(event_control_qm.data_control);
 
     ProviderEventDataControlLocalView<>* provider_control_local_view_asil_b_ptr{nullptr};
     if (event_control_asil_b != nullptr)
     {
         auto& provider_control_local_view_qm =
-            provider_control_local_view_asil_b_.emplace(event_control_asil_b->data_control);
+            provider_control_local_view_asil_b_.emplace(event_control_asil_b->data_control, &performance_counters_);
         provider_control_local_view_asil_b_ptr = &provider_control_local_view_qm;
     }
     score::cpp::ignore =
@@ -206,6 +223,9 @@ void SkeletonEventCommon<SampleType>::PrepareOfferCommon(EventControl& event_con
 
     UpdateCurrentTimestamp();
 
+    parent_.RegisterElementStatistics(
+        element_fq_id_, event_name_, event_control_qm, event_control_asil_b, performance_counters_);
+
     // Register callbacks to be notified when event notification existence changes.
     // This allows us to optimise the Send() path by skipping NotifyEvent() when no handlers are registered.
     // Separate callbacks for QM and ASIL-B update their respective atomic flags for lock-free access.
@@ -230,6 +250,8 @@ void SkeletonEventCommon<SampleType>::PrepareOfferCommon(EventControl& event_con
 template <typename SampleType>
 void SkeletonEventCommon<SampleType>::PrepareStopOfferCommon() noexcept
 {
+    parent_.UnregisterElementStatistics(element_fq_id_);
+
     // Unregister event notification existence changed callbacks
     GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa)
         .GetLolaMessaging()
@@ -288,6 +310,7 @@ Result<SlotIndexType> SkeletonEventCommon<SampleType>::AllocateSlot() noexcept
     if (!allocated_slot_result.allocated_slot_index.has_value())
     {
         // we didn't get a slot, which is a sign, that too few slots have been configured.
+        performance_counters_.CountDroppedSample();
         if (!event_properties_.enforce_max_samples)
         {
             ::score::mw::log::LogError("lola")
@@ -315,6 +338,7 @@ Result<void> SkeletonEventCommon<SampleType>::Send(impl::SampleAllocateePtr<Samp
     // coverity[autosar_cpp14_a4_7_1_violation]
     ++current_timestamp_;
     event_data_control_composite_->EventReady(slot, current_timestamp_);
+    tracing::TraceRecorder::Record(tracing::TracePointType::kSkeletonEventSend, element_fq_id_, slot);
 
     // Only call NotifyEvent if there are any registered receive handlers for each quality level.
     // This avoids the expensive lock operation in the common case where no handlers are registered.
@@ -325,6 +349,7 @@ Result<void> SkeletonEventCommon<SampleType>::Send(impl::SampleAllocateePtr<Samp
         GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa)
             .GetLolaMessaging()
             .NotifyEvent(QualityType::kASIL_QM, element_fq_id_);
+        performance_counters_.CountSentNotification();
     }
     if (asil_b_event_update_notifications_registered_.load() &&
         parent_.GetInstanceQualityType() == QualityType::kASIL_B)
@@ -332,6 +357,7 @@ Result<void> SkeletonEventCommon<SampleType>::Send(impl::SampleAllocateePtr<Samp
         GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa)
             .GetLolaMessaging()
             .NotifyEvent(QualityType::kASIL_B, element_fq_id_);
+        performance_counters_.CountSentNotification();
     }
     return {};
 }
@@ -104,6 +104,40 @@ TEST_F(SkeletonEventAllocateFixture, AllocateErrorLeadsToNullptr)
     EXPECT_EQ(allocate_result.error(), ComErrc::kBindingFailure);
 }
 
+TEST_F(SkeletonEventAllocateFixture, AllocateErrorIsCountedAsDroppedSample)
+{
+    const bool enforce_max_samples{true};
+
+    // Given an offered event in an offered service, of which all slots are allocated
+    InitialiseSkeletonEvent(fake_element_fq_id_, fake_event_name_, max_samples_, max_subscribers_, enforce_max_samples);
+    std::ignore = skeleton_event_->PrepareOffer();
+    std::vector<impl::SampleAllocateePtr<test::TestSampleType>> pointer_collection{max_samples_};
+    for (std::size_t counter = 0; counter < max_samples_; ++counter)
+    {
+        auto allocate_result = skeleton_event_->Allocate();
+        ASSERT_TRUE(allocate_result.has_value());
+        pointer_collection[counter] = std::move(allocate_result).value();
+    }
+    EXPECT_CALL(service_discovery_mock_, StopOfferService(_, IServiceDiscovery::QualityTypeSelector::kAsilQm)).Times(1);
+
+    // When allocating another slot
+    auto allocate_result = skeleton_event_->Allocate();
+    ASSERT_FALSE(allocate_result.has_value());
+
+    // Then a dropped sample and a failed slot allocation are counted
+    const auto values = skeleton_event_->GetPerformanceCounterValues();
+    if constexpr (kEventPerformanceCountersCompiledIn)
+    {
+        EXPECT_EQ(values.number_of_dropped_samples, 1U);
+        EXPECT_GE(values.number_of_allocation_failures, 1U);
+    }
+    else
+    {
+        EXPECT_EQ(values.number_of_dropped_samples, 0U);
+        EXPECT_EQ(values.number_of_allocation_failures, 0U);
+    }
+}
+
 TEST_F(SkeletonEventAllocateFixture, SkeletonEventWithNotMaxSamplesEnforcementAllocateErrorLeadsToError)
 {
     const bool enforce_max_samples{false};
@@ -15,6 +15,7 @@
 #include "score/mw/com/impl/bindings/lola/service_data_control.h"
 #include "score/mw/com/impl/bindings/lola/service_data_storage.h"
 #include "score/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_rollback_executor.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
@@ -22,6 +23,7 @@
 #include "score/mw/com/impl/runtime.h"
 #include "score/mw/com/impl/skeleton_event_binding.h"
 
+#include "score/json/json_writer.h"
 #include "score/memory/shared/managed_memory_resource.h"
 #include "score/memory/shared/new_delete_delegate_resource.h"
 #include "score/memory/shared/shared_memory_factory.h"
@@ -33,9 +35,14 @@
 #include <score/span.hpp>
 #include <sys/types.h>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -96,6 +103,67 @@ std::uint64_t CalculateMemoryResourceId(const LolaServiceTypeDeployment::Service
             (static_cast<std::uint64_t>(lola_instance_id) << 8U) + static_cast<std::uint8_t>(object_type));
 }
 
+// Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall not be called
+//                                                                   implicitly"
+// coverity reports that ToBuffer().value might throw due to std::bad_variant_access. The .value() call will only throw
+// if the ToBuffer returns an error. In this case we are in an unrecoverable state and termination is intended.
+// coverity[autosar_cpp14_a15_5_3_violation]
+std::string SerializeToString(const json::Object& json_object) noexcept
+{
+    json::JsonWriter writer{};
+    return writer.ToBuffer(json_object).value();
+}
+
+/// \brief Appends the meta-info of the given service elements, which influences the layout in shared memory.
+void AppendServiceElementMetaInfo(std::stringstream& key_input, const SkeletonBinding::SkeletonEventBindings& elements)
+{
+    // SkeletonEventBindings is an ordered map, so the order of the elements is stable.
+    for (const auto& element : elements)
+    {
+        key_input << ';' << element.first << ':' << element.second.get().GetMaxSize() << ':'
+                  << element.second.get().GetMaxAlignment();
+    }
+}
+
+/// \brief Calculates the key under which the simulated shm-object sizes of a service instance get cached.
+///
+/// The simulated sizes depend on the deployment of the service instance (number of slots, subscribers, ...), on the
+/// service type deployment (element ids), on the size/alignment of the event/field data types and on the layout of the
+/// control/data structures compiled into this binary (incl. the optional publish time slots). So all of them go into
+/// the key.
+ShmSizeCache::Key CalculateShmSizeCacheKey(const QualityType quality_type,
+                                           const LolaServiceInstanceDeployment& lola_service_instance_deployment,
+                                           const LolaServiceTypeDeployment& lola_service_type_deployment,
+                                           const SkeletonBinding::SkeletonEventBindings& events,
+                                           const SkeletonBinding::SkeletonFieldBindings& fields)
+{
+    // The instance id has no influence on the sizes. Leaving it out lets all instances of a service share the entry.
+    auto instance_layout_deployment = lola_service_instance_deployment;
+    instance_layout_deployment.instance_id_.reset();
+
+    std::stringstream key_input;
+    key_input << SerializeToString(instance_layout_deployment.Serialize())
+              << SerializeToString(lola_service_type_deployment.Serialize())
+              << static_cast<std::uint32_t>(quality_type) << ';' << sizeof(ServiceDataControl) << ':'
+              << sizeof(ServiceDataStorage) << ':' << sizeof(EventControl) << ':' << sizeof(EventMetaInfo) << ':'
+              << kEventPublishTimesEnabled;
+    key_input << ";events";
+    AppendServiceElementMetaInfo(key_input, events);
+    key_input << ";fields";
+    AppendServiceElementMetaInfo(key_input, fields);
+
+    // 64 bit FNV-1a, which (in contrast to std::hash) is stable across processes, so keys can be persisted.
+    constexpr std::uint64_t kFnvOffsetBasis{0xcbf29ce484222325U};
+    constexpr std::uint64_t kFnvPrime{0x100000001b3U};
+    std::uint64_t hash{kFnvOffsetBasis};
+    for (const char character : key_input.str())
+    {
+        hash ^= static_cast<std::uint8_t>(character);
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
 }  // namespace
 
 SkeletonMemoryManager::SkeletonMemoryManager(QualityType quality_type,
@@ -264,18 +332,50 @@ auto SkeletonMemoryManager::RetrieveEventControlsFromOpenedSharedMemory(const El
             &event_control_asil_b};
 }
 
-void SkeletonMemoryManager::RollbackSkeletonTracingTransactions(EventControl& event_control)
+// Suppress "AUTOSAR C++14 A15-5-3": std::terminate() should not be called implicitly.
+// This is a false positive, there is no way for calling std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+void SkeletonMemoryManager::RollbackSkeletonTracingTransactions(concurrency::Executor* const rollback_executor)
 {
-    ConsumerEventDataControlLocalView<> consumer_event_data_control_local{event_control.data_control};
-    auto rollback_result = event_control.transaction_log_set_.RollbackSkeletonTracingTransactions(
-        [&consumer_event_data_control_local](const TransactionLog::SlotIndexType slot_index) {
-            consumer_event_data_control_local.DereferenceEventWithoutTransactionLogging(slot_index);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(control_qm_ != nullptr,
+                                                "Rollback requires an opened shared memory region.");
+    std::vector<EventControl*> event_controls{};
+    for (auto& event : control_qm_->event_controls_)
+    {
+        event_controls.push_back(&event.second);
+    }
+    if (control_asil_b_ != nullptr)
+    {
+        for (auto& event : control_asil_b_->event_controls_)
+        {
+            event_controls.push_back(&event.second);
+        }
+    }
+
+    // A failed rollback of one event must not prevent the rollback of the other events. Therefore, the failure is only
+    // recorded and the rollback of the event is reported as successful to RollbackEvents().
+    std::atomic<bool> did_rollback_fail{false};
+    score::cpp::ignore = RollbackEvents(
+        event_controls.size(),
+        rollback_executor,
+        [&event_controls, &did_rollback_fail](const std::size_t event_index) noexcept -> Result<void> {
+            auto& event_control = *event_controls.at(event_index);
+            ConsumerEventDataControlLocalView<> consumer_event_data_control_local{event_control.data_control};
+            const auto rollback_result = event_control.transaction_log_set_.RollbackSkeletonTracingTransactions(
+                [&consumer_event_data_control_local](const TransactionLog::SlotIndexType slot_index) {
+                    consumer_event_data_control_local.DereferenceEventWithoutTransactionLogging(slot_index);
+                });
+            if (!rollback_result.has_value())
+            {
+                did_rollback_fail.store(true, std::memory_order_relaxed);
+            }
+            return {};
         });
-    if (!rollback_result.has_value())
+
+    if (did_rollback_fail.load(std::memory_order_relaxed))
     {
-        ::score::mw::log::LogWarn("lola")
-            << "SkeletonEvent: PrepareOffer failed: Could not rollback tracing consumer after "
-               "crash. Disabling tracing.";
+        ::score::mw::log::LogWarn("lola") << "Skeleton: PrepareOffer failed: Could not rollback tracing consumer after "
+                                             "crash. Disabling tracing.";
         impl::Runtime::getInstance().GetTracingRuntime()->DisableTracing();
     }
 }
@@ -338,13 +438,13 @@ void SkeletonMemoryManager::Reset()
     control_asil_b_ = nullptr;
 }
 
-SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateShmResourceStorageSizes(
+ShmResourceStorageSizes SkeletonMemoryManager::CalculateShmResourceStorageSizes(
     SkeletonBinding::SkeletonEventBindings& events,
     SkeletonBinding::SkeletonFieldBindings& fields)
 {
+    auto& lola_runtime = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa);
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
-        GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetShmSizeCalculationMode() ==
-            ShmSizeCalculationMode::kSimulation,
+        lola_runtime.GetShmSizeCalculationMode() == ShmSizeCalculationMode::kSimulation,
         "No other shm size calculation mode is currently suppored");
     if ((lola_service_instance_deployment_.shared_memory_size_.has_value()) &&
         (lola_service_instance_deployment_.control_asil_b_memory_size_.has_value()) &&
@@ -364,7 +464,23 @@ SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateS
                 lola_service_instance_deployment_.control_asil_b_memory_size_.value()};
     }
 
-    auto required_shm_storage_size = CalculateShmResourceStorageSizesBySimulation(events, fields);
+    auto* const shm_size_cache = lola_runtime.GetShmSizeCache();
+    ShmSizeCache::Key shm_size_cache_key{};
+    std::optional<ShmResourceStorageSizes> cached_shm_storage_size{};
+    if (shm_size_cache != nullptr)
+    {
+        shm_size_cache_key = CalculateShmSizeCacheKey(
+            quality_type_, lola_service_instance_deployment_, lola_service_type_deployment_, events, fields);
+        cached_shm_storage_size = shm_size_cache->Find(shm_size_cache_key);
+    }
+
+    auto required_shm_storage_size = cached_shm_storage_size.has_value()
+                                         ? cached_shm_storage_size.value()
+                                         : CalculateShmResourceStorageSizesBySimulation(events, fields);
+    if ((shm_size_cache != nullptr) && (!cached_shm_storage_size.has_value()))
+    {
+        shm_size_cache->Insert(shm_size_cache_key, required_shm_storage_size);
+    }
 
     const std::size_t control_asil_b_size_result = required_shm_storage_size.control_asil_b_size.has_value()
                                                        ? required_shm_storage_size.control_asil_b_size.value()
@@ -378,7 +494,7 @@ SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateS
     score::mw::log::LogInfo("lola") << "Calculated sizes of shm-objects for service_id:instance_id " << lola_service_id_
                                     << ":"
                                     // coverity[autosar_cpp14_a18_9_2_violation]
-                                    << lola_instance_id_
+                                    << lola_instance_id_ << (cached_shm_storage_size.has_value() ? " (cached)" : "")
                                     << " are as follows:\nQM-Ctrl: " << required_shm_storage_size.control_qm_size
                                     << ", ASIL_B-Ctrl: " << control_asil_b_size_result
                                     << ", Data: " << required_shm_storage_size.data_size;
@@ -422,7 +538,7 @@ SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateS
     return required_shm_storage_size;
 }
 
-SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateShmResourceStorageSizesBySimulation(
+ShmResourceStorageSizes SkeletonMemoryManager::CalculateShmResourceStorageSizesBySimulation(
     SkeletonBinding::SkeletonEventBindings& events,
     SkeletonBinding::SkeletonFieldBindings& fields)
 {
@@ -18,11 +18,13 @@
 #include "score/mw/com/impl/bindings/lola/i_shm_path_builder.h"
 #include "score/mw/com/impl/bindings/lola/service_data_control.h"
 #include "score/mw/com/impl/bindings/lola/service_data_storage.h"
+#include "score/mw/com/impl/bindings/lola/shm_size_cache.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_event_properties.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/skeleton_binding.h"
 
+#include "score/concurrency/executor.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
 #include <score/assert.hpp>
@@ -127,11 +129,15 @@ class SkeletonMemoryManager final
     template <typename SampleType>
     auto RetrieveEventDataFromOpenedSharedMemory(const ElementFqId element_fq_id) -> EventDataStorage<SampleType>&;
 
-    /// \brief Rolls back any existing operations in the TransactionLog corresponding to a SkeletonEvent
+    /// \brief Rolls back any existing operations in the TransactionLogs of all SkeletonEvents within the opened shared
+    ///        memory region
     ///
-    /// The TransactionLog would only exist if a SkeletonEvent in a crashed process had tracing enabled. If tracing was
-    /// not enabled, then this function will simply do nothing.
-    void RollbackSkeletonTracingTransactions(EventControl& event_control);
+    /// A TransactionLog would only exist if a SkeletonEvent in a crashed process had tracing enabled. If tracing was
+    /// not enabled, then this function will simply do nothing for that SkeletonEvent. The events are rolled back by
+    /// multiple threads, if a rollback executor is given, see RollbackEvents(). Tracing is disabled once, if the
+    /// rollback failed for any of the events. Note: Only invoke _after_ the shared memory region was opened via
+    /// OpenExistingSharedMemory!
+    void RollbackSkeletonTracingTransactions(concurrency::Executor* const rollback_executor);
 
     /// \brief Remove the control and data shared memory regions
     void RemoveSharedMemory();
@@ -148,22 +154,10 @@ class SkeletonMemoryManager final
     void Reset();
 
   private:
-    class ShmResourceStorageSizes
-    {
-      public:
-        // Suppress "AUTOSAR C++14 M11-0-1": All non-POD class types should only have private member data.
-        // Justification: There are no class invariants to maintain which could be violated by directly accessing member
-        // variables.
-        // coverity[autosar_cpp14_m11_0_1_violation]
-        std::size_t data_size;
-        // coverity[autosar_cpp14_m11_0_1_violation]
-        std::size_t control_qm_size;
-        // coverity[autosar_cpp14_m11_0_1_violation]
-        score::cpp::optional<std::size_t> control_asil_b_size;
-    };
-
     /// \brief Calculates needed sizes for shm-objects for data and ctrl either via simulation or a rough estimation
     /// depending on config.
+    /// \details Sizes calculated via simulation are taken from/stored in the ShmSizeCache of the LoLa runtime, so that
+    /// the simulation only runs once per service instance layout.
     /// \return storage sizes for the different shm-objects
     ShmResourceStorageSizes CalculateShmResourceStorageSizes(SkeletonBinding::SkeletonEventBindings& events,
                                                              SkeletonBinding::SkeletonFieldBindings& fields);
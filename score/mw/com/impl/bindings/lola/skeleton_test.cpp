@@ -957,6 +957,43 @@ TEST_P(SkeletonRegisterParamaterisedFixture, RollbackWillBeCalledOnAsilBTransact
     EXPECT_FALSE(IsSkeletonTransactionLogRegistered(transaction_log_set));
 }
 
+TEST_P(SkeletonRegisterParamaterisedFixture, PrepareOfferRollsBackTransactionLogsWithRollbackExecutorOfRuntime)
+{
+    // Given a QM ServiceDataControl which contains a TransactionLogSet with valid transactions
+    auto proxy_event_data_control_qm_local = GetConsumerEventDataControlLocalFromServiceDataControl(
+        test::kDummyElementFqId, existing_service_data_control_qm_);
+    auto& transaction_log_set =
+        GetTransactionLogSetFromServiceDataControl(test::kDummyElementFqId, existing_service_data_control_qm_);
+    InsertSkeletonTransactionLogWithValidTransactions(proxy_event_data_control_qm_local, transaction_log_set);
+    EXPECT_TRUE(IsSkeletonTransactionLogRegistered(transaction_log_set));
+
+    const ServiceElementType element_type = GetParam();
+
+    if (element_type == ServiceElementType::EVENT)
+    {
+        events_.emplace(test::kFooEventName, mock_event_binding_);
+    }
+    else
+    {
+        fields_.emplace(test::kFooEventName, mock_event_binding_);
+    }
+    const InstanceIdentifier instance_identifier{element_type == ServiceElementType::EVENT
+                                                     ? GetValidInstanceIdentifierWithEvent()
+                                                     : GetValidInstanceIdentifierWithField()};
+
+    // Given a Skeleton constructed from a valid identifier referencing a QM deployment
+    InitialiseSkeleton(instance_identifier).WithAlreadyConnectedProxy();
+
+    // Expecting that the rollback executor is retrieved from the runtime
+    EXPECT_CALL(lola_runtime_mock_, GetRollbackExecutor()).WillOnce(Return(nullptr));
+
+    // when calling PrepareOffer ... expect, that it succeeds
+    EXPECT_TRUE(skeleton_->PrepareOffer(events_, fields_, std::move(kEmptyRegisterShmObjectTraceCallback)).has_value());
+
+    // Then the TransactionLog should already be rollbacked and removed before the event is registered
+    EXPECT_FALSE(IsSkeletonTransactionLogRegistered(transaction_log_set));
+}
+
 TEST_P(SkeletonRegisterParamaterisedFixture, TracingWillBeDisabledAndTransactionLogRemainsIfRollbackFails)
 {
     impl::tracing::TracingRuntimeMock tracing_runtime_mock{};
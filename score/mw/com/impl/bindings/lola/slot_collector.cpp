@@ -14,6 +14,7 @@
 
 #include <score/assert.hpp>
 
+#include <algorithm>
 #include <iterator>
 
 namespace score::mw::com::impl::lola
@@ -21,7 +22,10 @@ namespace score::mw::com::impl::lola
 
 SlotCollector::SlotCollector(ConsumerEventDataControlLocalView<>& event_data_control_local,
                              const std::size_t max_slots) noexcept
-    : event_data_control_local_{event_data_control_local}, last_ts_{0U}, collected_slots_(max_slots)
+    : event_data_control_local_{event_data_control_local},
+      last_ts_{0U},
+      collected_slots_(max_slots),
+      collected_timestamps_(max_slots)
 {
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(max_slots > 0U, "Pre-allocated slot vector must not be empty!");
 }
@@ -37,48 +41,29 @@ SlotCollector::SlotIndices SlotCollector::GetNewSamplesSlotIndices(const std::si
     // the newest/youngest collected slot)
     const auto collected_slots_end_const_iterator = CollectSlots(max_count);
 
-    EventSlotStatus::EventTimeStamp newest_delivered{last_ts_};
-    // we are iterating the collected slots from the oldest event (smallest timestamp) to the newest event
-    // (largest timestamp) here.
-    for (auto slot = std::make_reverse_iterator(collected_slots_end_const_iterator); slot != collected_slots_.crend();
-         ++slot)
+    // The collected slots are sorted from the newest event (largest timestamp) to the oldest one.
+    if (collected_slots_end_const_iterator != collected_slots_.cbegin())
     {
-        const EventSlotStatus slot_status{event_data_control_local_.get()[*slot]};
-        newest_delivered = std::max(newest_delivered, slot_status.GetTimeStamp());
+        last_ts_ = std::max(last_ts_, collected_timestamps_.front());
     }
 
-    last_ts_ = newest_delivered;
-
     return {std::make_reverse_iterator(collected_slots_end_const_iterator), collected_slots_.crend()};
 }
 
 SlotCollector::SlotIndexVector::const_iterator SlotCollector::CollectSlots(const std::size_t max_count) noexcept
 {
-    EventSlotStatus::EventTimeStamp current_highest = EventSlotStatus::TIMESTAMP_MAX;
-    auto collected_slot = collected_slots_.begin();
-
     // Defensive programming: We check in the constructor that collected_slots_ must not be empty
-    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(collected_slot != collected_slots_.cend());
-    for (std::size_t count = 0U; count < max_count; ++count)
-    {
-        const std::optional<SlotIndexType> slot =
-            event_data_control_local_.get().ReferenceNextEvent(last_ts_, current_highest);
-        if (!(slot.has_value()))
-        {
-            break;
-        }
-        const EventSlotStatus event_status{event_data_control_local_.get()[*slot]};
-        current_highest = event_status.GetTimeStamp();
-        *collected_slot = *slot;
-        ++collected_slot;
-
-        if (collected_slot == collected_slots_.end())
-        {
-            break;
-        }
-    }
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(!collected_slots_.empty());
+    const std::size_t max_number_of_slots = std::min(max_count, collected_slots_.size());
+    const std::size_t number_of_slots = event_data_control_local_.get().ReferenceNextEvents(
+        last_ts_,
+        score::cpp::span<SlotIndexType>{collected_slots_.data(), max_number_of_slots},
+        score::cpp::span<EventSlotStatus::EventTimeStamp>{collected_timestamps_.data(), max_number_of_slots});
 
-    return collected_slot;
+    // Suppress "AUTOSAR C++14 A4-7-1" rule finding. This rule states: "An integer expression shall not lead to data
+    // loss.". number_of_slots is limited by the size of collected_slots_, so it always fits into the difference type.
+    // coverity[autosar_cpp14_a4_7_1_violation : FALSE]
+    return std::next(collected_slots_.cbegin(), static_cast<SlotIndexVector::difference_type>(number_of_slots));
 }
 
 }  // namespace score::mw::com::impl::lola
@@ -73,6 +73,8 @@ class SlotCollector final
   private:
     /// \brief Collects up to max_count slots (events) in collected_slots_, which have a timestamp > last_ts_
     ///        (are younger than last_ts_) and returns an iterator to one past the last collected (oldest) slot
+    ///
+    /// \details All slots are found within a single scan via ConsumerEventDataControlLocalView::ReferenceNextEvents().
     /// \param max_count maximum number of slots to collect.
     /// \return an iterator to one past the oldest collected slot (smallest timestamp).
     SlotIndexVector::const_iterator CollectSlots(const std::size_t max_count) noexcept;
@@ -80,6 +82,8 @@ class SlotCollector final
     std::reference_wrapper<ConsumerEventDataControlLocalView<>> event_data_control_local_;
     EventSlotStatus::EventTimeStamp last_ts_;
     SlotIndexVector collected_slots_;  // Pre-allocated scratchpad memory to present the events in-order to the user.
+    // Pre-allocated scratchpad memory for the timestamps of the events in collected_slots_.
+    std::vector<EventSlotStatus::EventTimeStamp> collected_timestamps_;
 };
 
 }  // namespace score::mw::com::impl::lola
@@ -0,0 +1,90 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_path_builder.h"
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_reader.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+bool ParseNumber(const char* const argument, const std::uint64_t max_value, std::uint64_t& value)
+{
+    char* end{nullptr};
+    value = std::strtoull(argument, &end, 0);
+    return (end != argument) && (*end == '\0') && (value <= max_value);
+}
+
+}  // namespace
+
+/// \brief Observer tool, which periodically prints the statistics segment of a LoLa service instance, whose skeleton
+/// was offered with enabled ServiceStatisticsPublisher. The segment is mapped read-only, so the observed processes are
+/// not affected.
+///
+/// Usage: lola_top <service id> <instance id> [<refresh period in ms, 0 prints once>]
+int main(int argc, const char** argv)
+{
+    std::uint64_t service_id{0U};
+    std::uint64_t instance_id{0U};
+    std::uint64_t refresh_period_ms{1000U};
+    const bool arguments_valid = ((argc == 3) || (argc == 4)) &&
+                                 ParseNumber(argv[1], std::numeric_limits<std::uint16_t>::max(), service_id) &&
+                                 ParseNumber(argv[2], std::numeric_limits<std::uint16_t>::max(), instance_id) &&
+                                 ((argc == 3) || ParseNumber(argv[3], 3600U * 1000U, refresh_period_ms));
+    if (!arguments_valid)
+    {
+        std::cerr << "Usage: " << argv[0] << " <service id> <instance id> [<refresh period in ms, 0 prints once>]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const score::mw::com::impl::lola::ShmPathBuilder shm_path_builder{static_cast<std::uint16_t>(service_id)};
+    const auto shm_name = shm_path_builder.GetStatisticsChannelShmName(
+        static_cast<score::mw::com::impl::LolaServiceInstanceId::InstanceId>(instance_id));
+    while (true)
+    {
+        const auto snapshot = score::mw::com::impl::lola::statistics::ReadServiceStatistics(shm_name);
+        if (!snapshot.has_value())
+        {
+            std::cerr << "Could not read statistics segment " << shm_name << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (refresh_period_ms != 0U)
+        {
+            // Clear the terminal, so that the statistics are shown in place.
+            std::cout << "\033[2J\033[H";
+        }
+        const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count();
+        if (snapshot->snapshot_time_ns != 0U)
+        {
+            std::cout << "snapshot taken "
+                      << (static_cast<std::uint64_t>(now_ns) - snapshot->snapshot_time_ns) / 1000000U
+                      << " ms ago\n";
+        }
+        score::mw::com::impl::lola::statistics::PrintServiceStatistics(snapshot.value(), std::cout);
+        std::cout << std::flush;
+        if (refresh_period_ms == 0U)
+        {
+            return EXIT_SUCCESS;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{refresh_period_ms});
+    }
+}
@@ -0,0 +1,322 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_publisher.h"
+
+#include "score/mw/com/impl/bindings/lola/event_slot_status.h"
+#include "score/mw/com/impl/com_error.h"
+
+#include "score/mw/log/logging.h"
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace score::mw::com::impl::lola::statistics
+{
+
+namespace
+{
+
+struct EnabledSettings
+{
+    std::mutex mutex{};
+    std::optional<ServiceStatisticsPublisher::Settings> settings{};
+};
+
+EnabledSettings& GetEnabledSettingsStorage() noexcept
+{
+    static EnabledSettings enabled_settings{};
+    return enabled_settings;
+}
+
+void CopyElementName(const std::string_view element_name, ElementStatistics& statistics) noexcept
+{
+    const auto name_length = std::min(element_name.size(), kMaxElementNameLength - 1U);
+    score::cpp::ignore = std::copy_n(element_name.data(), name_length, statistics.element_name.begin());
+    statistics.element_name.at(name_length) = '\0';
+}
+
+void CollectSlotStatistics(const EventDataControl& data_control, ElementStatistics& statistics) noexcept
+{
+    EventSlotStatus::EventTimeStamp newest_time_stamp{0U};
+    std::optional<EventSlotStatus::EventTimeStamp> oldest_referenced_time_stamp{};
+    std::uint16_t number_of_occupied_slots{0U};
+    for (const auto& slot : data_control.state_slots_)
+    {
+        const EventSlotStatus slot_status{slot.load(std::memory_order_relaxed)};
+        if (slot_status.IsInvalid() || slot_status.IsInWriting())
+        {
+            continue;
+        }
+        newest_time_stamp = std::max(newest_time_stamp, slot_status.GetTimeStamp());
+        if (slot_status.GetReferenceCount() > 0U)
+        {
+            number_of_occupied_slots++;
+            oldest_referenced_time_stamp = std::min(
+                oldest_referenced_time_stamp.value_or(slot_status.GetTimeStamp()), slot_status.GetTimeStamp());
+        }
+    }
+    statistics.number_of_slots = static_cast<std::uint16_t>(data_control.state_slots_.size());
+    statistics.number_of_occupied_slots = number_of_occupied_slots;
+    statistics.oldest_outstanding_slot_age =
+        oldest_referenced_time_stamp.has_value() ? (newest_time_stamp - oldest_referenced_time_stamp.value()) : 0U;
+}
+
+void CollectSubscriberStatistics(const TransactionLogSet& transaction_log_set, ElementStatistics& statistics) noexcept
+{
+    statistics.number_of_subscribers = 0U;
+    transaction_log_set.VisitReferencedSlotsOfProxies(
+        [&statistics](const TransactionLogId transaction_log_id, const std::size_t number_of_referenced_slots) {
+            if (statistics.number_of_subscribers < kMaxSubscribersPerElement)
+            {
+                statistics.subscribers.at(statistics.number_of_subscribers) =
+                    SubscriberStatistics{static_cast<std::uint32_t>(transaction_log_id),
+                                         static_cast<std::uint32_t>(number_of_referenced_slots)};
+            }
+            statistics.number_of_subscribers++;
+        });
+}
+
+}  // namespace
+
+void ServiceStatisticsPublisher::Enable(const Settings& settings) noexcept
+{
+    auto& enabled_settings = GetEnabledSettingsStorage();
+    std::lock_guard<std::mutex> lock{enabled_settings.mutex};
+    enabled_settings.settings = settings;
+}
+
+void ServiceStatisticsPublisher::Disable() noexcept
+{
+    auto& enabled_settings = GetEnabledSettingsStorage();
+    std::lock_guard<std::mutex> lock{enabled_settings.mutex};
+    enabled_settings.settings.reset();
+}
+
+auto ServiceStatisticsPublisher::GetEnabledSettings() noexcept -> std::optional<Settings>
+{
+    auto& enabled_settings = GetEnabledSettingsStorage();
+    std::lock_guard<std::mutex> lock{enabled_settings.mutex};
+    return enabled_settings.settings;
+}
+
+auto ServiceStatisticsPublisher::Create(const std::string& shm_name,
+                                        const std::uint16_t service_id,
+                                        const std::uint16_t instance_id,
+                                        const std::size_t capacity,
+                                        const Settings& settings) noexcept
+    -> Result<std::unique_ptr<ServiceStatisticsPublisher>>
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(capacity <= std::numeric_limits<std::uint32_t>::max(),
+                                                      "The capacity of a statistics segment is limited to 32 bit.");
+    const auto mapping_size = GetServiceStatisticsSegmentSize(capacity);
+    // The segment is readable by everybody, so that an observer doesn't need the privileges of the provider.
+    const auto open_result = ::score::os::Mman::instance().shm_open(
+        shm_name.c_str(),
+        ::score::os::Fcntl::Open::kReadWrite | ::score::os::Fcntl::Open::kCreate | ::score::os::Fcntl::Open::kTruncate,
+        ::score::os::Stat::Mode::kReadUser | ::score::os::Stat::Mode::kWriteUser | ::score::os::Stat::Mode::kReadGroup |
+            ::score::os::Stat::Mode::kReadOthers);
+    if (!open_result.has_value())
+    {
+        score::mw::log::LogError("lola") << "ServiceStatisticsPublisher: Could not create statistics segment"
+                                         << shm_name << ":" << open_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    const auto file_descriptor = open_result.value();
+
+    const auto truncate_result = ::score::os::Unistd::instance().ftruncate(file_descriptor, mapping_size);
+    if (!truncate_result.has_value())
+    {
+        score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+        score::cpp::ignore = ::score::os::Mman::instance().shm_unlink(shm_name.c_str());
+        score::mw::log::LogError("lola") << "ServiceStatisticsPublisher: Could not resize statistics segment"
+                                         << shm_name << ":" << truncate_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    const auto mmap_result =
+        ::score::os::Mman::instance().mmap(nullptr,
+                                           mapping_size,
+                                           ::score::os::Mman::Protection::kRead | ::score::os::Mman::Protection::kWrite,
+                                           ::score::os::Mman::Map::kShared,
+                                           file_descriptor,
+                                           0);
+    // The mapping stays valid after closing the file descriptor.
+    score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+    if (!mmap_result.has_value())
+    {
+        score::cpp::ignore = ::score::os::Mman::instance().shm_unlink(shm_name.c_str());
+        score::mw::log::LogError("lola") << "ServiceStatisticsPublisher: Could not map statistics segment" << shm_name
+                                         << ":" << mmap_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+
+    auto* const mapping = static_cast<std::byte*>(mmap_result.value());
+    score::cpp::ignore = new (mapping) ServiceStatisticsHeader{kServiceStatisticsMagic,
+                                                               kServiceStatisticsVersion,
+                                                               service_id,
+                                                               instance_id,
+                                                               static_cast<std::uint32_t>(capacity),
+                                                               0U,
+                                                               0U,
+                                                               {0U}};
+    for (std::size_t index = 0U; index < capacity; ++index)
+    {
+        score::cpp::ignore =
+            new (mapping + kElementStatisticsOffset + (index * sizeof(ElementStatistics))) ElementStatistics{};
+    }
+
+    // Suppress "AUTOSAR C++14 A18-5-2" rule finding. This rule states: "Non-placement new or delete expressions shall
+    // not be used.". The constructor is private, so std::make_unique cannot be used.
+    // coverity[autosar_cpp14_a18_5_2_violation]
+    std::unique_ptr<ServiceStatisticsPublisher> publisher{
+        new ServiceStatisticsPublisher{shm_name, mapping, mapping_size}};
+    auto* const publisher_ptr = publisher.get();
+    publisher->update_thread_ = std::thread{[publisher_ptr, update_period = settings.update_period]() noexcept {
+        publisher_ptr->RunUpdateThread(update_period);
+    }};
+    return publisher;
+}
+
+ServiceStatisticsPublisher::ServiceStatisticsPublisher(std::string shm_name,
+                                                       void* const mapping,
+                                                       const std::size_t mapping_size) noexcept
+    : shm_name_{std::move(shm_name)},
+      mapping_size_{mapping_size},
+      header_{static_cast<ServiceStatisticsHeader*>(mapping)},
+      // Suppress "AUTOSAR C++14 M5-2-8" rule finding. This rule states: "An object with integer type or pointer to
+      // void type shall not be converted to an object with pointer type.". The ElementStatistics were constructed at
+      // this offset of the mapping, which keeps their alignment, in Create().
+      // coverity[autosar_cpp14_m5_2_8_violation]
+      elements_{static_cast<ElementStatistics*>(
+          static_cast<void*>(static_cast<std::byte*>(mapping) + kElementStatisticsOffset))},
+      mutex_{},
+      registered_elements_{},
+      stop_requested_{false},
+      stop_condition_{},
+      update_thread_{}
+{
+}
+
+ServiceStatisticsPublisher::~ServiceStatisticsPublisher() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_requested_ = true;
+    }
+    stop_condition_.notify_all();
+    if (update_thread_.joinable())
+    {
+        update_thread_.join();
+    }
+    score::cpp::ignore = ::score::os::Mman::instance().munmap(header_, mapping_size_);
+    score::cpp::ignore = ::score::os::Mman::instance().shm_unlink(shm_name_.c_str());
+}
+
+void ServiceStatisticsPublisher::RegisterElement(const ElementFqId element_fq_id,
+                                                 const std::string_view element_name,
+                                                 const QualityType quality_type,
+                                                 const EventControl& event_control,
+                                                 const SkeletonEventPerformanceCounters& performance_counters) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (registered_elements_.size() >= static_cast<std::size_t>(header_->capacity))
+    {
+        score::mw::log::LogWarn("lola") << "ServiceStatisticsPublisher: Statistics segment" << shm_name_
+                                        << "is full. Statistics of" << element_fq_id << "are not published.";
+        return;
+    }
+    registered_elements_.push_back(RegisteredElement{element_fq_id,
+                                                     std::string{element_name.data(), element_name.size()},
+                                                     quality_type,
+                                                     std::cref(event_control),
+                                                     std::cref(performance_counters)});
+}
+
+void ServiceStatisticsPublisher::UnregisterElement(const ElementFqId element_fq_id) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    score::cpp::ignore = registered_elements_.erase(
+        std::remove_if(registered_elements_.begin(),
+                       registered_elements_.end(),
+                       [&element_fq_id](const RegisteredElement& registered_element) noexcept {
+                           return registered_element.element_fq_id == element_fq_id;
+                       }),
+        registered_elements_.end());
+}
+
+void ServiceStatisticsPublisher::PublishSnapshot() noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    // Sequence lock: Readers detect an odd or changed sequence and retry.
+    const auto sequence = header_->sequence.load(std::memory_order_relaxed);
+    header_->sequence.store(sequence + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::size_t index{0U};
+    for (const auto& registered_element : registered_elements_)
+    {
+        ElementStatistics statistics{};
+        CopyElementName(registered_element.element_name, statistics);
+        statistics.element_id = registered_element.element_fq_id.element_id_;
+        statistics.element_type = static_cast<std::uint8_t>(registered_element.element_fq_id.element_type_);
+        statistics.quality_type = static_cast<std::uint8_t>(registered_element.quality_type);
+
+        const EventControl& event_control = registered_element.event_control.get();
+        CollectSlotStatistics(event_control.data_control, statistics);
+        CollectSubscriberStatistics(event_control.transaction_log_set_, statistics);
+
+        const auto counter_values = registered_element.performance_counters.get().GetValues();
+        statistics.number_of_allocations = counter_values.number_of_allocations;
+        statistics.number_of_allocation_failures = counter_values.number_of_allocation_failures;
+        statistics.number_of_dropped_samples = counter_values.number_of_dropped_samples;
+        statistics.number_of_sent_notifications = counter_values.number_of_sent_notifications;
+
+        elements_[index] = statistics;
+        ++index;
+    }
+    header_->number_of_elements = static_cast<std::uint32_t>(index);
+    header_->snapshot_time_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+
+    header_->sequence.store(sequence + 2U, std::memory_order_release);
+}
+
+void ServiceStatisticsPublisher::RunUpdateThread(const std::chrono::milliseconds update_period) noexcept
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (!stop_requested_)
+    {
+        if (stop_condition_.wait_for(lock, update_period, [this]() noexcept {
+                return stop_requested_;
+            }))
+        {
+            break;
+        }
+        lock.unlock();
+        PublishSnapshot();
+        lock.lock();
+    }
+}
+
+}  // namespace score::mw::com::impl::lola::statistics
@@ -0,0 +1,127 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_PUBLISHER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_PUBLISHER_H
+
+#include "score/mw/com/impl/bindings/lola/element_fq_id.h"
+#include "score/mw/com/impl/bindings/lola/event_control.h"
+#include "score/mw/com/impl/bindings/lola/event_performance_counters.h"
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_segment.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+
+#include "score/result/result.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola::statistics
+{
+
+/// \brief Publishes snapshots of the events/fields of a skeleton in a statistics shared-memory segment, which can be
+///        mapped read-only by an observer process (e.g. lola_top).
+///
+/// The snapshots are taken by an update thread, which reads the performance counters of the skeleton events and the
+/// control segments (slot states and transaction logs of the proxies). So neither the providers nor the proxies do any
+/// additional work in their hot paths.
+/// Publishing is optional: Only skeletons, which are offered while it is enabled via Enable(), create a segment.
+class ServiceStatisticsPublisher final
+{
+  public:
+    struct Settings
+    {
+        /// \brief Period in which the update thread takes a snapshot.
+        std::chrono::milliseconds update_period{200};
+    };
+
+    /// \brief Lets skeletons, which are offered from now on in this process, publish their statistics.
+    static void Enable(const Settings& settings) noexcept;
+
+    /// \brief Lets skeletons, which are offered from now on in this process, not publish their statistics.
+    static void Disable() noexcept;
+
+    /// \return The settings passed to Enable(), if publishing is enabled, otherwise an empty optional.
+    static std::optional<Settings> GetEnabledSettings() noexcept;
+
+    /// \brief Creates (or truncates) the statistics segment and starts the update thread.
+    /// \param shm_name Name of the segment as returned by IShmPathBuilder::GetStatisticsChannelShmName().
+    /// \param capacity Maximum number of registered events/fields (counting each quality level separately).
+    /// \return kErroneousFileHandle, if the segment could not be created and mapped.
+    static Result<std::unique_ptr<ServiceStatisticsPublisher>> Create(const std::string& shm_name,
+                                                                      const std::uint16_t service_id,
+                                                                      const std::uint16_t instance_id,
+                                                                      const std::size_t capacity,
+                                                                      const Settings& settings) noexcept;
+
+    /// \brief Stops the update thread and removes the segment.
+    ~ServiceStatisticsPublisher() noexcept;
+
+    ServiceStatisticsPublisher(const ServiceStatisticsPublisher&) = delete;
+    ServiceStatisticsPublisher(ServiceStatisticsPublisher&&) noexcept = delete;
+    ServiceStatisticsPublisher& operator=(const ServiceStatisticsPublisher&) = delete;
+    ServiceStatisticsPublisher& operator=(ServiceStatisticsPublisher&&) noexcept = delete;
+
+    /// \brief Adds an event/field at the given quality level to the snapshots.
+    /// \details event_control and performance_counters have to stay valid until UnregisterElement() is called.
+    ///          Elements exceeding the capacity are not published.
+    void RegisterElement(const ElementFqId element_fq_id,
+                         const std::string_view element_name,
+                         const QualityType quality_type,
+                         const EventControl& event_control,
+                         const SkeletonEventPerformanceCounters& performance_counters) noexcept;
+
+    /// \brief Removes an event/field at all quality levels from the snapshots.
+    void UnregisterElement(const ElementFqId element_fq_id) noexcept;
+
+    /// \brief Takes a snapshot of all registered elements. Called periodically by the update thread.
+    void PublishSnapshot() noexcept;
+
+  private:
+    struct RegisteredElement
+    {
+        ElementFqId element_fq_id;
+        std::string element_name;
+        QualityType quality_type;
+        std::reference_wrapper<const EventControl> event_control;
+        std::reference_wrapper<const SkeletonEventPerformanceCounters> performance_counters;
+    };
+
+    ServiceStatisticsPublisher(std::string shm_name, void* const mapping, const std::size_t mapping_size) noexcept;
+
+    void RunUpdateThread(const std::chrono::milliseconds update_period) noexcept;
+
+    std::string shm_name_;
+    std::size_t mapping_size_;
+    ServiceStatisticsHeader* header_;
+    ElementStatistics* elements_;
+
+    /// \brief Protects the registered elements and the update thread.
+    std::mutex mutex_;
+    std::vector<RegisteredElement> registered_elements_;
+    bool stop_requested_;
+    std::condition_variable stop_condition_;
+    std::thread update_thread_;
+};
+
+}  // namespace score::mw::com::impl::lola::statistics
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_PUBLISHER_H
@@ -0,0 +1,245 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_publisher.h"
+
+#include "score/mw/com/impl/bindings/lola/consumer_event_data_control_local_view.h"
+#include "score/mw/com/impl/bindings/lola/provider_event_data_control_local_view.h"
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_reader.h"
+#include "score/mw/com/impl/bindings/lola/transaction_log_local_view.h"
+#include "score/mw/com/impl/service_element_type.h"
+
+#include "score/memory/shared/shared_memory_resource_heap_allocator_mock.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace score::mw::com::impl::lola::statistics
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+const std::string kShmName{"/lola-stats-service-statistics-publisher-test"};
+constexpr std::uint16_t kServiceId{1U};
+constexpr std::uint16_t kInstanceId{2U};
+constexpr SlotIndexType kNumberOfSlots{5U};
+constexpr EventControl::SubscriberCountType kMaxSubscribers{3U};
+constexpr TransactionLogId kTransactionLogId{1000U};
+const ElementFqId kElementFqId{kServiceId, 3U, kInstanceId, ServiceElementType::EVENT};
+// The update thread shall not interfere, so the snapshots are taken explicitly.
+const ServiceStatisticsPublisher::Settings kSettings{1h};
+
+class ServiceStatisticsPublisherFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        auto publisher_result = ServiceStatisticsPublisher::Create(kShmName, kServiceId, kInstanceId, 2U, kSettings);
+        ASSERT_TRUE(publisher_result.has_value());
+        publisher_ = std::move(publisher_result).value();
+    }
+
+    void RegisterEvent(const std::string_view element_name, const QualityType quality_type = QualityType::kASIL_QM)
+    {
+        publisher_->RegisterElement(kElementFqId, element_name, quality_type, event_control_, performance_counters_);
+    }
+
+    void SendSamples(const std::size_t number_of_samples)
+    {
+        for (std::size_t sample = 0U; sample < number_of_samples; ++sample)
+        {
+            const auto slot = provider_.AllocateNextSlot();
+            ASSERT_TRUE(slot.has_value());
+            provider_.EventReady(slot.value(), ++last_time_stamp_);
+        }
+    }
+
+    memory::shared::SharedMemoryResourceHeapAllocatorMock memory_resource_{1U};
+    EventControl event_control_{kNumberOfSlots, kMaxSubscribers, false, memory_resource_};
+    ProviderEventDataControlLocalView<> provider_{event_control_.data_control};
+    ConsumerEventDataControlLocalView<> consumer_{event_control_.data_control};
+    SkeletonEventPerformanceCounters performance_counters_{};
+    EventSlotStatus::EventTimeStamp last_time_stamp_{0U};
+    std::unique_ptr<ServiceStatisticsPublisher> publisher_{nullptr};
+};
+
+TEST_F(ServiceStatisticsPublisherFixture, SegmentWithoutSnapshotCanBeReadAndIsEmpty)
+{
+    // Given a created publisher, which didn't take a snapshot yet
+
+    // When reading the statistics segment
+    const auto snapshot = ReadServiceStatistics(kShmName);
+
+    // Then it identifies the service instance and contains no elements
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->service_id, kServiceId);
+    EXPECT_EQ(snapshot->instance_id, kInstanceId);
+    EXPECT_EQ(snapshot->snapshot_time_ns, 0U);
+    EXPECT_TRUE(snapshot->elements.empty());
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, SnapshotContainsCountersSlotOccupancyAndReferencedSlotsPerSubscriber)
+{
+    // Given an event, which sent three samples, of which a subscriber still references the oldest one
+    SendSamples(3U);
+    performance_counters_.CountAllocation(0U, false);
+    performance_counters_.CountAllocation(0U, true);
+    performance_counters_.CountDroppedSample();
+    performance_counters_.CountSentNotification();
+    auto registration_guard = event_control_.transaction_log_set_.RegisterProxyElement(kTransactionLogId, consumer_);
+    ASSERT_TRUE(registration_guard.has_value());
+    TransactionLogLocalView transaction_log{
+        event_control_.transaction_log_set_.GetTransactionLog(registration_guard->GetTransactionLogIndex())};
+    transaction_log.SubscribeTransactionBegin(1U);
+    transaction_log.SubscribeTransactionCommit();
+    const auto referenced_slot = consumer_.ReferenceNextEvent(0U, 2U);
+    ASSERT_TRUE(referenced_slot.has_value());
+
+    // and given that the event is registered at the publisher
+    RegisterEvent("some_event");
+
+    // When taking and reading a snapshot
+    publisher_->PublishSnapshot();
+    const auto snapshot = ReadServiceStatistics(kShmName);
+
+    // Then the snapshot contains the state of the event
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_NE(snapshot->snapshot_time_ns, 0U);
+    ASSERT_EQ(snapshot->elements.size(), 1U);
+    const auto& element = snapshot->elements.front();
+    EXPECT_EQ(std::string_view{element.element_name.data()}, "some_event");
+    EXPECT_EQ(element.element_id, kElementFqId.element_id_);
+    EXPECT_EQ(element.element_type, static_cast<std::uint8_t>(ServiceElementType::EVENT));
+    EXPECT_EQ(element.quality_type, static_cast<std::uint8_t>(QualityType::kASIL_QM));
+    EXPECT_EQ(element.number_of_slots, kNumberOfSlots);
+    EXPECT_EQ(element.number_of_occupied_slots, 1U);
+    EXPECT_EQ(element.oldest_outstanding_slot_age, 2U);
+    EXPECT_EQ(element.number_of_allocations, 2U);
+    EXPECT_EQ(element.number_of_allocation_failures, 1U);
+    EXPECT_EQ(element.number_of_dropped_samples, 1U);
+    EXPECT_EQ(element.number_of_sent_notifications, 1U);
+    ASSERT_EQ(element.number_of_subscribers, 1U);
+    EXPECT_EQ(element.subscribers.front().transaction_log_id, kTransactionLogId);
+    EXPECT_EQ(element.subscribers.front().number_of_referenced_slots, 1U);
+
+    // Cleanup: Finish all transactions, so that the subscriber can be unregistered
+    consumer_.DereferenceEvent(referenced_slot.value());
+    transaction_log.UnsubscribeTransactionBegin();
+    transaction_log.UnsubscribeTransactionCommit();
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, SnapshotWithoutReferencedSlotsReportsNoOutstandingSlotAge)
+{
+    // Given an event, which sent samples, which are not referenced
+    SendSamples(2U);
+    RegisterEvent("some_event");
+
+    // When taking and reading a snapshot
+    publisher_->PublishSnapshot();
+    const auto snapshot = ReadServiceStatistics(kShmName);
+
+    // Then no slot is occupied and there is no outstanding slot
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot->elements.size(), 1U);
+    EXPECT_EQ(snapshot->elements.front().number_of_occupied_slots, 0U);
+    EXPECT_EQ(snapshot->elements.front().oldest_outstanding_slot_age, 0U);
+    EXPECT_EQ(snapshot->elements.front().number_of_subscribers, 0U);
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, LongElementNamesAreTruncated)
+{
+    // Given an event with a name longer than the segment can hold
+    const std::string long_name(kMaxElementNameLength + 10U, 'x');
+    RegisterEvent(long_name);
+
+    // When taking and reading a snapshot
+    publisher_->PublishSnapshot();
+    const auto snapshot = ReadServiceStatistics(kShmName);
+
+    // Then the name is truncated to the maximum length
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot->elements.size(), 1U);
+    EXPECT_EQ(std::string_view{snapshot->elements.front().element_name.data()},
+              std::string_view(long_name).substr(0U, kMaxElementNameLength - 1U));
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, ElementsExceedingTheCapacityAreNotPublished)
+{
+    // Given a publisher with a capacity of two elements, at which three elements are registered
+    RegisterEvent("qm");
+    RegisterEvent("b", QualityType::kASIL_B);
+    RegisterEvent("too_many");
+
+    // When taking and reading a snapshot
+    publisher_->PublishSnapshot();
+    const auto snapshot = ReadServiceStatistics(kShmName);
+
+    // Then only the first two elements are published
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot->elements.size(), 2U);
+    EXPECT_EQ(std::string_view{snapshot->elements.at(0U).element_name.data()}, "qm");
+    EXPECT_EQ(std::string_view{snapshot->elements.at(1U).element_name.data()}, "b");
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, UnregisteredElementsAreRemovedWithTheNextSnapshot)
+{
+    // Given a published snapshot of a registered element
+    RegisterEvent("some_event");
+    publisher_->PublishSnapshot();
+
+    // When unregistering the element and taking the next snapshot
+    publisher_->UnregisterElement(kElementFqId);
+    publisher_->PublishSnapshot();
+
+    // Then the snapshot doesn't contain the element anymore
+    const auto snapshot = ReadServiceStatistics(kShmName);
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_TRUE(snapshot->elements.empty());
+}
+
+TEST_F(ServiceStatisticsPublisherFixture, DestroyingThePublisherRemovesTheSegment)
+{
+    // When destroying the publisher
+    publisher_.reset();
+
+    // Then the statistics segment cannot be read anymore
+    EXPECT_FALSE(ReadServiceStatistics(kShmName).has_value());
+}
+
+TEST(ServiceStatisticsPublisherEnableTest, PublishingIsOnlyEnabledBetweenEnableAndDisable)
+{
+    // Given publishing is not enabled
+    EXPECT_FALSE(ServiceStatisticsPublisher::GetEnabledSettings().has_value());
+
+    // When enabling it
+    ServiceStatisticsPublisher::Enable(ServiceStatisticsPublisher::Settings{50ms});
+
+    // Then the settings are returned
+    const auto enabled_settings = ServiceStatisticsPublisher::GetEnabledSettings();
+    ASSERT_TRUE(enabled_settings.has_value());
+    EXPECT_EQ(enabled_settings->update_period, 50ms);
+
+    // and when disabling it again, no settings are returned anymore
+    ServiceStatisticsPublisher::Disable();
+    EXPECT_FALSE(ServiceStatisticsPublisher::GetEnabledSettings().has_value());
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::statistics
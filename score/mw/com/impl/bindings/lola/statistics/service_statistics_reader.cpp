@@ -0,0 +1,209 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_reader.h"
+
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/service_element_type.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iomanip>
+#include <iterator>
+#include <string_view>
+#include <thread>
+
+namespace score::mw::com::impl::lola::statistics
+{
+
+namespace
+{
+
+/// \brief Number of attempts to copy a consistent snapshot, before giving up.
+constexpr std::size_t kMaxReadAttempts{100U};
+
+Result<const std::byte*> MapReadOnly(const std::int32_t file_descriptor, const std::size_t mapping_size) noexcept
+{
+    const auto mmap_result = ::score::os::Mman::instance().mmap(nullptr,
+                                                                mapping_size,
+                                                                ::score::os::Mman::Protection::kRead,
+                                                                ::score::os::Mman::Map::kShared,
+                                                                file_descriptor,
+                                                                0);
+    if (!mmap_result.has_value())
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    return static_cast<const std::byte*>(mmap_result.value());
+}
+
+void Unmap(const std::byte* const mapping, const std::size_t mapping_size) noexcept
+{
+    // Suppress "AUTOSAR C++14 A5-2-3" rule finding. This rule states: "A cast shall not remove any const or volatile
+    // qualification from the type of a pointer or reference.". munmap() requires a non-const pointer, although it
+    // doesn't access the memory.
+    // coverity[autosar_cpp14_a5_2_3_violation]
+    score::cpp::ignore = ::score::os::Mman::instance().munmap(const_cast<std::byte*>(mapping), mapping_size);
+}
+
+Result<ServiceStatisticsSnapshot> CopySnapshot(const std::byte* const mapping) noexcept
+{
+    // Suppress "AUTOSAR C++14 M5-2-8" rule finding. This rule states: "An object with integer type or pointer to void
+    // type shall not be converted to an object with pointer type.". The publisher constructed the header at the
+    // beginning and the ElementStatistics at kElementStatisticsOffset of the segment.
+    // coverity[autosar_cpp14_m5_2_8_violation]
+    const auto* const header = static_cast<const ServiceStatisticsHeader*>(static_cast<const void*>(mapping));
+    // coverity[autosar_cpp14_m5_2_8_violation]
+    const auto* const elements =
+        static_cast<const ElementStatistics*>(static_cast<const void*>(mapping + kElementStatisticsOffset));
+
+    ServiceStatisticsSnapshot snapshot{header->service_id, header->instance_id, 0U, {}};
+    for (std::size_t attempt = 0U; attempt < kMaxReadAttempts; ++attempt)
+    {
+        const auto sequence_before = header->sequence.load(std::memory_order_acquire);
+        if ((sequence_before % 2U) != 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto number_of_elements = std::min(header->number_of_elements, header->capacity);
+        snapshot.snapshot_time_ns = header->snapshot_time_ns;
+        snapshot.elements.assign(elements, elements + number_of_elements);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->sequence.load(std::memory_order_relaxed) == sequence_before)
+        {
+            return snapshot;
+        }
+    }
+    return MakeUnexpected(ComErrc::kCouldNotExecute);
+}
+
+std::string_view GetElementTypeName(const ServiceElementType element_type) noexcept
+{
+    switch (element_type)
+    {
+        case ServiceElementType::EVENT:
+            return "event";
+        case ServiceElementType::FIELD:
+            return "field";
+        default:
+            return "unknown";
+    }
+}
+
+std::string_view GetAsilLevelName(const QualityType quality_type) noexcept
+{
+    switch (quality_type)
+    {
+        case QualityType::kASIL_QM:
+            return "QM";
+        case QualityType::kASIL_B:
+            return "B";
+        default:
+            return "?";
+    }
+}
+
+}  // namespace
+
+Result<ServiceStatisticsSnapshot> ReadServiceStatistics(const std::string& shm_name) noexcept
+{
+    const auto open_result =
+        ::score::os::Mman::instance().shm_open(shm_name.c_str(), ::score::os::Fcntl::Open::kReadOnly, {});
+    if (!open_result.has_value())
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    const auto file_descriptor = open_result.value();
+
+    // The header has to be mapped first, as it contains the capacity, which determines the size of the segment.
+    const auto header_mapping = MapReadOnly(file_descriptor, sizeof(ServiceStatisticsHeader));
+    if (!header_mapping.has_value())
+    {
+        score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+        return MakeUnexpected<ServiceStatisticsSnapshot>(header_mapping.error());
+    }
+    // coverity[autosar_cpp14_m5_2_8_violation] see CopySnapshot()
+    const auto* const header = static_cast<const ServiceStatisticsHeader*>(static_cast<const void*>(*header_mapping));
+    const bool is_supported_segment =
+        (header->magic == kServiceStatisticsMagic) && (header->version == kServiceStatisticsVersion);
+    const auto capacity = static_cast<std::size_t>(header->capacity);
+    Unmap(header_mapping.value(), sizeof(ServiceStatisticsHeader));
+    if (!is_supported_segment)
+    {
+        score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+
+    const auto mapping_size = GetServiceStatisticsSegmentSize(capacity);
+    const auto mapping = MapReadOnly(file_descriptor, mapping_size);
+    // The mapping stays valid after closing the file descriptor.
+    score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+    if (!mapping.has_value())
+    {
+        return MakeUnexpected<ServiceStatisticsSnapshot>(mapping.error());
+    }
+    auto snapshot = CopySnapshot(mapping.value());
+    Unmap(mapping.value(), mapping_size);
+    return snapshot;
+}
+
+void PrintServiceStatistics(const ServiceStatisticsSnapshot& snapshot, std::ostream& output) noexcept
+{
+    output << "service " << snapshot.service_id << " instance " << snapshot.instance_id << ": "
+           << snapshot.elements.size() << " elements\n";
+    output << std::left << std::setw(32) << "element" << std::setw(7) << "type" << std::setw(5) << "asil" << std::right
+           << std::setw(7) << "slots" << std::setw(10) << "occupied" << std::setw(12) << "oldest age" << std::setw(13)
+           << "allocations" << std::setw(11) << "failures" << std::setw(10) << "dropped" << std::setw(15)
+           << "notifications" << std::setw(13) << "subscribers" << '\n';
+    for (const auto& element : snapshot.elements)
+    {
+        // The name is only read up to the end of its array, in case the segment is corrupted.
+        const auto name_end = std::find(element.element_name.cbegin(), element.element_name.cend(), '\0');
+        const std::string_view element_name{
+            element.element_name.data(),
+            static_cast<std::size_t>(std::distance(element.element_name.cbegin(), name_end))};
+        output << std::left << std::setw(32) << element_name << std::setw(7)
+               << GetElementTypeName(static_cast<ServiceElementType>(element.element_type)) << std::setw(5)
+               << GetAsilLevelName(static_cast<QualityType>(element.quality_type)) << std::right << std::setw(7)
+               << element.number_of_slots << std::setw(10) << element.number_of_occupied_slots << std::setw(12)
+               << element.oldest_outstanding_slot_age << std::setw(13) << element.number_of_allocations
+               << std::setw(11) << element.number_of_allocation_failures << std::setw(10)
+               << element.number_of_dropped_samples << std::setw(15) << element.number_of_sent_notifications
+               << std::setw(13) << element.number_of_subscribers << '\n';
+
+        const auto number_of_listed_subscribers =
+            std::min(static_cast<std::size_t>(element.number_of_subscribers), kMaxSubscribersPerElement);
+        for (std::size_t index = 0U; index < number_of_listed_subscribers; ++index)
+        {
+            const auto& subscriber = element.subscribers.at(index);
+            output << "    subscriber uid " << subscriber.transaction_log_id << ": "
+                   << subscriber.number_of_referenced_slots << " referenced slots\n";
+        }
+        if (element.number_of_subscribers > kMaxSubscribersPerElement)
+        {
+            output << "    ... " << (element.number_of_subscribers - kMaxSubscribersPerElement)
+                   << " more subscribers\n";
+        }
+    }
+}
+
+}  // namespace score::mw::com::impl::lola::statistics
@@ -0,0 +1,49 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_READER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_READER_H
+
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_segment.h"
+
+#include "score/result/result.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::impl::lola::statistics
+{
+
+/// \brief Consistent copy of a statistics segment.
+struct ServiceStatisticsSnapshot
+{
+    std::uint16_t service_id;
+    std::uint16_t instance_id;
+    /// \brief Monotonic time of the snapshot in nanoseconds. 0 if the publisher didn't take a snapshot yet.
+    std::uint64_t snapshot_time_ns;
+    std::vector<ElementStatistics> elements;
+};
+
+/// \brief Maps the statistics segment read-only and copies the latest snapshot out of it.
+/// \param shm_name Name of the segment as returned by IShmPathBuilder::GetStatisticsChannelShmName().
+/// \return kErroneousFileHandle, if the segment cannot be mapped or is no statistics segment of a supported version,
+///         kCouldNotExecute, if no consistent snapshot could be copied, as the publisher was updating it all the time.
+Result<ServiceStatisticsSnapshot> ReadServiceStatistics(const std::string& shm_name) noexcept;
+
+/// \brief Prints one line per event/field, followed by one line per subscriber with the slots it references.
+void PrintServiceStatistics(const ServiceStatisticsSnapshot& snapshot, std::ostream& output) noexcept;
+
+}  // namespace score::mw::com::impl::lola::statistics
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_READER_H
@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/statistics/service_statistics_reader.h"
+
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/service_element_type.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace score::mw::com::impl::lola::statistics
+{
+namespace
+{
+
+ElementStatistics MakeElementStatistics(const std::uint32_t number_of_subscribers)
+{
+    ElementStatistics element{};
+    element.element_name = {'s', 'o', 'm', 'e', '_', 'e', 'v', 'e', 'n', 't', '\0'};
+    element.element_type = static_cast<std::uint8_t>(ServiceElementType::EVENT);
+    element.quality_type = static_cast<std::uint8_t>(QualityType::kASIL_B);
+    element.number_of_slots = 5U;
+    element.number_of_occupied_slots = 2U;
+    element.oldest_outstanding_slot_age = 42U;
+    element.number_of_subscribers = number_of_subscribers;
+    for (std::uint32_t index = 0U; (index < number_of_subscribers) && (index < kMaxSubscribersPerElement); ++index)
+    {
+        element.subscribers.at(index) = SubscriberStatistics{1000U + index, 1U};
+    }
+    return element;
+}
+
+TEST(ServiceStatisticsReaderTest, ReadingANonExistingSegmentReturnsError)
+{
+    // When reading a statistics segment, which doesn't exist
+    const auto snapshot = ReadServiceStatistics("/lola-stats-service-statistics-reader-test-does-not-exist");
+
+    // Then an error is returned
+    ASSERT_FALSE(snapshot.has_value());
+    EXPECT_EQ(snapshot.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST(ServiceStatisticsReaderTest, PrintingListsElementsAndTheirSubscribers)
+{
+    // Given a snapshot with one element with two subscribers
+    const ServiceStatisticsSnapshot snapshot{1U, 2U, 1U, {MakeElementStatistics(2U)}};
+
+    // When printing it
+    std::ostringstream output{};
+    PrintServiceStatistics(snapshot, output);
+
+    // Then the element and both subscribers are printed
+    const auto printed = output.str();
+    EXPECT_NE(printed.find("service 1 instance 2"), std::string::npos);
+    EXPECT_NE(printed.find("some_event"), std::string::npos);
+    EXPECT_NE(printed.find("event"), std::string::npos);
+    EXPECT_NE(printed.find("42"), std::string::npos);
+    EXPECT_NE(printed.find("subscriber uid 1000: 1 referenced slots"), std::string::npos);
+    EXPECT_NE(printed.find("subscriber uid 1001: 1 referenced slots"), std::string::npos);
+}
+
+TEST(ServiceStatisticsReaderTest, PrintingSummarizesSubscribersWhichAreNotListed)
+{
+    // Given a snapshot with an element with more subscribers than the segment lists
+    const ServiceStatisticsSnapshot snapshot{
+        1U, 2U, 1U, {MakeElementStatistics(static_cast<std::uint32_t>(kMaxSubscribersPerElement) + 3U)}};
+
+    // When printing it
+    std::ostringstream output{};
+    PrintServiceStatistics(snapshot, output);
+
+    // Then the subscribers, which are not listed, are summarized
+    EXPECT_NE(output.str().find("... 3 more subscribers"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::statistics
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_SEGMENT_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_SEGMENT_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace score::mw::com::impl::lola::statistics
+{
+
+/// \brief Maximum length of an event/field name in the statistics segment including the terminating zero. Longer names
+///        are truncated.
+constexpr std::size_t kMaxElementNameLength{64U};
+
+/// \brief Maximum number of subscribers per event/field, whose referenced slots are listed in the statistics segment.
+constexpr std::size_t kMaxSubscribersPerElement{16U};
+
+/// \brief Number of slots a single subscriber (i.e. proxy event/field) references.
+struct SubscriberStatistics
+{
+    /// \brief TransactionLogId (i.e. uid) of the subscriber.
+    std::uint32_t transaction_log_id;
+    std::uint32_t number_of_referenced_slots;
+};
+
+/// \brief Snapshot of the state of an event/field at one quality level.
+struct ElementStatistics
+{
+    /// \brief Zero terminated name of the event/field.
+    std::array<char, kMaxElementNameLength> element_name;
+    std::uint16_t element_id;
+    std::uint8_t element_type;
+    std::uint8_t quality_type;
+    std::uint16_t number_of_slots;
+    /// \brief Number of slots, which are currently referenced by at least one subscriber.
+    std::uint16_t number_of_occupied_slots;
+    /// \brief Number of samples, which were sent after the oldest sample, which is still referenced. 0 if no sample is
+    ///        referenced. A steadily growing age indicates a subscriber, which holds on to a sample.
+    std::uint32_t oldest_outstanding_slot_age;
+    /// \brief Number of registered subscribers, of which the first kMaxSubscribersPerElement are listed in subscribers.
+    std::uint32_t number_of_subscribers;
+    std::uint64_t number_of_allocations;
+    std::uint64_t number_of_allocation_failures;
+    std::uint64_t number_of_dropped_samples;
+    std::uint64_t number_of_sent_notifications;
+    std::array<SubscriberStatistics, kMaxSubscribersPerElement> subscribers;
+};
+static_assert(std::is_trivially_copyable_v<ElementStatistics>, "ElementStatistics are copied bytewise by readers.");
+
+/// \brief Header at the beginning of a statistics segment, which is followed by capacity ElementStatistics.
+/// \details The segment has a single writer (the update thread of the ServiceStatisticsPublisher) and any number of
+///          readers in other processes, which are synchronized via a sequence lock: The writer makes sequence odd
+///          before it updates number_of_elements, snapshot_time_ns or any ElementStatistics and even again afterwards.
+///          Readers copy the segment and retry, if sequence was odd or changed during the copy.
+struct ServiceStatisticsHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint16_t service_id;
+    std::uint16_t instance_id;
+    std::uint32_t capacity;
+    std::uint32_t number_of_elements;
+    /// \brief Monotonic time of the latest snapshot in nanoseconds.
+    std::uint64_t snapshot_time_ns;
+    std::atomic<std::uint64_t> sequence;
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "The sequence is shared between processes, which requires it to be lock free.");
+
+/// \brief "LOLASTA1" in little endian byte order.
+constexpr std::uint64_t kServiceStatisticsMagic{0x31415453414C4F4CU};
+constexpr std::uint32_t kServiceStatisticsVersion{1U};
+
+/// \brief Offset of the first ElementStatistics within the segment.
+constexpr std::size_t kElementStatisticsOffset{
+    ((sizeof(ServiceStatisticsHeader) + alignof(ElementStatistics)) - 1U) / alignof(ElementStatistics) *
+    alignof(ElementStatistics)};
+
+/// \brief Size of a statistics segment, which holds capacity ElementStatistics.
+constexpr std::size_t GetServiceStatisticsSegmentSize(const std::size_t capacity) noexcept
+{
+    return kElementStatisticsOffset + (capacity * sizeof(ElementStatistics));
+}
+
+}  // namespace score::mw::com::impl::lola::statistics
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_STATISTICS_SERVICE_STATISTICS_SEGMENT_H
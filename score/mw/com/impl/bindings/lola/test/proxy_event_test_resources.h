@@ -135,8 +135,11 @@ class LolaRuntimeMock : public IRuntime
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (noexcept, override));
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, noexcept, override));
+    MOCK_METHOD(ShmSizeCache*, GetShmSizeCache, (), (noexcept, override));
     MOCK_METHOD(impl::tracing::IBindingTracingRuntime*, GetTracingRuntime, (), (noexcept, override));
     MOCK_METHOD(RollbackSynchronization&, GetRollbackSynchronization, (), (noexcept, override));
+    MOCK_METHOD(ProxyAttachmentCache*, GetProxyAttachmentCache, (), (noexcept, override));
+    MOCK_METHOD(concurrency::Executor*, GetRollbackExecutor, (), (noexcept, override));
     MOCK_METHOD(pid_t, GetPid, (), (const, noexcept, override));
     MOCK_METHOD(std::uint32_t, GetApplicationId, (), (const, noexcept, override));
 
@@ -0,0 +1,78 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
+
+#include <benchmark/benchmark.h>
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace score::mw::com::impl::lola::tracing
+{
+namespace
+{
+
+const std::string kRecordingPath{"/tmp/lola_trace_recorder_benchmark.bin"};
+const ElementFqId kElementFqId{1U, 2U, 3U, ServiceElementType::EVENT};
+
+/// \brief A trace point while the recorder isn't recording.
+void RecordWhileNotRecording(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        TraceRecorder::Record(TracePointType::kProxyEventSampleCollected, kElementFqId, 0U);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief A trace point while the recorder is recording, i.e. taking the timestamp and appending to the ring of the
+/// calling thread.
+/// \details The ring is flushed, whenever it is full, without measuring the flush. So no record gets dropped, which
+/// would be cheaper than appending it.
+void RecordWhileRecording(benchmark::State& state)
+{
+    // The flush thread shall not interfere with the measurement, the rings are flushed explicitly instead.
+    TraceRecorder::Settings settings{};
+    settings.flush_period = std::chrono::hours{1};
+    const auto start_result = TraceRecorder::Instance().Start(kRecordingPath, settings);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT(start_result.has_value());
+
+    std::size_t number_of_records_in_ring{0U};
+    for (auto _ : state)
+    {
+        TraceRecorder::Record(TracePointType::kProxyEventSampleCollected, kElementFqId, 0U);
+        if (++number_of_records_in_ring == TraceRecordRing::kCapacity)
+        {
+            state.PauseTiming();
+            TraceRecorder::Instance().Flush();
+            number_of_records_in_ring = 0U;
+            state.ResumeTiming();
+        }
+    }
+
+    TraceRecorder::Instance().Stop();
+    score::cpp::ignore = std::remove(kRecordingPath.c_str());
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(RecordWhileNotRecording)->ThreadRange(1, 8);
+BENCHMARK(RecordWhileRecording);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::tracing
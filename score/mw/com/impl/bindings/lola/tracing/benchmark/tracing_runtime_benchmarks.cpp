@@ -0,0 +1,175 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
+#include "score/mw/com/impl/configuration/configuration.h"
+#include "score/mw/com/impl/tracing/i_binding_tracing_runtime.h"
+#include "score/mw/com/impl/tracing/service_element_tracing_data.h"
+#include "score/mw/com/impl/tracing/type_erased_sample_ptr.h"
+
+#include <benchmark/benchmark.h>
+#include <score/utility.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace score::mw::com::impl::lola::tracing
+{
+namespace
+{
+
+using TraceContextId = impl::tracing::IBindingTracingRuntime::TraceContextId;
+
+/// \brief Number of tracing slots of the traced service element (i.e. its numberOfIpcTracingSlots).
+constexpr std::uint8_t kNumberOfTracingSlots{8U};
+
+const Configuration kEmptyConfiguration{Configuration::ServiceTypeDeployments{},
+                                        Configuration::ServiceInstanceDeployments{},
+                                        GlobalConfiguration{},
+                                        TracingConfiguration{}};
+
+/// \brief Stands in for a SamplePtr, so that the benchmarks do not measure the allocation of a sample.
+class BenchmarkSamplePtr
+{
+};
+
+/// \brief The lock-free slot pool of the TracingRuntime.
+class LockFreeTracingSlots
+{
+  public:
+    LockFreeTracingSlots() noexcept
+        : tracing_runtime_{kNumberOfTracingSlots, kEmptyConfiguration},
+          service_element_tracing_data_{tracing_runtime_.RegisterServiceElement(kNumberOfTracingSlots)}
+    {
+    }
+
+    std::optional<TraceContextId> Emplace(impl::tracing::TypeErasedSamplePtr type_erased_sample_ptr) noexcept
+    {
+        return tracing_runtime_.EmplaceTypeErasedSamplePtr(std::move(type_erased_sample_ptr),
+                                                           service_element_tracing_data_);
+    }
+
+    void Clear(const TraceContextId trace_context_id) noexcept
+    {
+        tracing_runtime_.ClearTypeErasedSamplePtr(trace_context_id);
+    }
+
+  private:
+    TracingRuntime tracing_runtime_;
+    impl::tracing::ServiceElementTracingData service_element_tracing_data_;
+};
+
+/// \brief Reference implementation of the slot pool as it was before it became lock-free: every slot is protected by
+/// its own mutex, which is taken to check whether the slot is free and again to fill it.
+class MutexTracingSlots
+{
+  public:
+    std::optional<TraceContextId> Emplace(impl::tracing::TypeErasedSamplePtr type_erased_sample_ptr) noexcept
+    {
+        for (std::size_t index = 0U; index < slots_.size(); ++index)
+        {
+            auto& slot = slots_[index];
+            bool is_free{false};
+            {
+                std::lock_guard<std::mutex> lock{slot.mutex};
+                is_free = !(slot.sample_ptr.has_value());
+            }
+            if (is_free)
+            {
+                std::lock_guard<std::mutex> lock{slot.mutex};
+                // The slot might have been taken in between. The original implementation asserted here, the reference
+                // implementation reports it as no free slot found, so that the benchmark can run with many threads.
+                if (slot.sample_ptr.has_value())
+                {
+                    return {};
+                }
+                slot.sample_ptr = std::move(type_erased_sample_ptr);
+                return static_cast<TraceContextId>(index);
+            }
+        }
+        return {};
+    }
+
+    void Clear(const TraceContextId trace_context_id) noexcept
+    {
+        auto& slot = slots_[static_cast<std::size_t>(trace_context_id)];
+        std::lock_guard<std::mutex> lock{slot.mutex};
+        slot.sample_ptr = {};
+    }
+
+  private:
+    struct Slot
+    {
+        std::optional<impl::tracing::TypeErasedSamplePtr> sample_ptr;
+        std::mutex mutex;
+    };
+
+    std::vector<Slot> slots_ = std::vector<Slot>(kNumberOfTracingSlots);
+};
+
+/// \brief One traced Send: emplacing the sample pointer when sending and clearing it when the trace is done.
+/// \details All threads share the slots of one service element, like concurrent senders of the same event.
+template <typename TracingSlots>
+void EmplaceAndClear(benchmark::State& state)
+{
+    static TracingSlots tracing_slots{};
+
+    std::int64_t number_of_slots_exhausted{0};
+    for (auto _ : state)
+    {
+        const auto trace_context_id = tracing_slots.Emplace(impl::tracing::TypeErasedSamplePtr{BenchmarkSamplePtr{}});
+        if (trace_context_id.has_value())
+        {
+            tracing_slots.Clear(trace_context_id.value());
+        }
+        else
+        {
+            ++number_of_slots_exhausted;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["slots_exhausted"] =
+        benchmark::Counter(static_cast<double>(number_of_slots_exhausted), benchmark::Counter::kAvgThreads);
+}
+
+/// \brief Emplacing while all but the last slot are in use, i.e. the worst case search for a free slot.
+template <typename TracingSlots>
+void EmplaceAndClearWithOccupiedSlots(benchmark::State& state)
+{
+    TracingSlots tracing_slots{};
+    for (std::uint8_t slot = 1U; slot < kNumberOfTracingSlots; ++slot)
+    {
+        score::cpp::ignore = tracing_slots.Emplace(impl::tracing::TypeErasedSamplePtr{BenchmarkSamplePtr{}});
+    }
+
+    for (auto _ : state)
+    {
+        const auto trace_context_id = tracing_slots.Emplace(impl::tracing::TypeErasedSamplePtr{BenchmarkSamplePtr{}});
+        benchmark::DoNotOptimize(trace_context_id);
+        tracing_slots.Clear(trace_context_id.value());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(EmplaceAndClear, LockFreeTracingSlots)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(EmplaceAndClear, MutexTracingSlots)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(EmplaceAndClearWithOccupiedSlots, LockFreeTracingSlots);
+BENCHMARK_TEMPLATE(EmplaceAndClearWithOccupiedSlots, MutexTracingSlots);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::tracing
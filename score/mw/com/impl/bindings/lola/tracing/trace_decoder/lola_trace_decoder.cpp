@@ -0,0 +1,39 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recording_decoder.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/// \brief Offline tool, which prints a recording file of the LoLa TraceRecorder as a timeline.
+///
+/// Usage: lola_trace_decoder <recording file>
+int main(int argc, const char** argv)
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <recording file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string recording_path{argv[1]};
+
+    const auto recording = score::mw::com::impl::lola::tracing::ReadTraceRecording(recording_path);
+    if (!recording.has_value())
+    {
+        std::cerr << "Could not read recording file " << recording_path << std::endl;
+        return EXIT_FAILURE;
+    }
+    score::mw::com::impl::lola::tracing::PrintTimeline(recording.value(), std::cout);
+    return EXIT_SUCCESS;
+}
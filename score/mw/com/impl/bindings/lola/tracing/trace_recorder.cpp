@@ -0,0 +1,323 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
+
+#include "score/mw/com/impl/com_error.h"
+
+#include "score/mw/log/logging.h"
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace score::mw::com::impl::lola::tracing
+{
+
+namespace
+{
+
+/// \brief Hands the ring of a thread back to the TraceRecorder, when the thread exits.
+class RingOwnership
+{
+  public:
+    RingOwnership() noexcept = default;
+    ~RingOwnership() noexcept
+    {
+        if (ring_ != nullptr)
+        {
+            ring_->ReleaseOwnership();
+        }
+    }
+
+    RingOwnership(const RingOwnership&) = delete;
+    RingOwnership(RingOwnership&&) noexcept = delete;
+    RingOwnership& operator=(const RingOwnership&) = delete;
+    RingOwnership& operator=(RingOwnership&&) noexcept = delete;
+
+    TraceRecordRing* Get() const noexcept
+    {
+        return ring_;
+    }
+
+    void Set(TraceRecordRing& ring) noexcept
+    {
+        ring_ = &ring;
+    }
+
+  private:
+    TraceRecordRing* ring_{nullptr};
+};
+
+// Suppress "AUTOSAR C++14 A3-3-2" rule finding. This rule states: "Static and thread-local objects shall be
+// constant-initialized.". The ownership has to be released when the thread exits, which needs a destructor.
+// coverity[autosar_cpp14_a3_3_2_violation]
+thread_local RingOwnership ring_ownership{};
+
+}  // namespace
+
+TraceRecordRing::TraceRecordRing(const std::uint32_t thread_number) noexcept
+    : records_{}, thread_number_{thread_number}, is_owned_{false}, head_{0U}, number_of_dropped_records_{0U}, tail_{0U}
+{
+}
+
+bool TraceRecordRing::TryPush(const TraceRecord& record) noexcept
+{
+    const auto head = head_.load(std::memory_order_relaxed);
+    const auto tail = tail_.load(std::memory_order_acquire);
+    if ((head - tail) == kCapacity)
+    {
+        score::cpp::ignore = number_of_dropped_records_.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+    records_[static_cast<std::size_t>(head % kCapacity)] = record;
+    head_.store(head + 1U, std::memory_order_release);
+    return true;
+}
+
+std::uint64_t TraceRecordRing::TakeNumberOfDroppedRecords() noexcept
+{
+    return number_of_dropped_records_.exchange(0U, std::memory_order_relaxed);
+}
+
+bool TraceRecordRing::TryAcquireOwnership() noexcept
+{
+    bool expected_is_owned{false};
+    return is_owned_.compare_exchange_strong(expected_is_owned, true, std::memory_order_acquire);
+}
+
+void TraceRecordRing::ReleaseOwnership() noexcept
+{
+    is_owned_.store(false, std::memory_order_release);
+}
+
+std::atomic<bool> TraceRecorder::is_recording_{false};
+
+TraceRecorder& TraceRecorder::Instance() noexcept
+{
+    static TraceRecorder instance{};
+    return instance;
+}
+
+TraceRecorder::TraceRecorder() noexcept
+    : rings_mutex_{},
+      rings_{},
+      file_mutex_{},
+      header_{nullptr},
+      records_{nullptr},
+      mapping_size_{0U},
+      stop_condition_{},
+      stop_requested_{false},
+      flush_thread_{}
+{
+}
+
+TraceRecorder::~TraceRecorder() noexcept
+{
+    Stop();
+}
+
+ResultBlank TraceRecorder::Start(const std::string_view file_path, const Settings& settings) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(settings.file_capacity > 0U,
+                                                      "The recording file has to hold at least one record.");
+    std::lock_guard<std::mutex> lock{file_mutex_};
+    if (header_ != nullptr)
+    {
+        score::mw::log::LogError("lola") << "TraceRecorder: Cannot start recording, as it is already recording.";
+        return MakeUnexpected(ComErrc::kCouldNotExecute);
+    }
+
+    const std::string path{file_path.data(), file_path.size()};
+    const auto mapping_size = sizeof(TraceRecordingHeader) + (settings.file_capacity * sizeof(TraceRecord));
+    const auto open_result = ::score::os::Fcntl::instance().open(
+        path.c_str(),
+        ::score::os::Fcntl::Open::kReadWrite | ::score::os::Fcntl::Open::kCreate | ::score::os::Fcntl::Open::kTruncate,
+        ::score::os::Stat::Mode::kReadUser | ::score::os::Stat::Mode::kWriteUser | ::score::os::Stat::Mode::kReadGroup |
+            ::score::os::Stat::Mode::kReadOthers);
+    if (!open_result.has_value())
+    {
+        score::mw::log::LogError("lola") << "TraceRecorder: Could not create recording file" << path << ":"
+                                         << open_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    const auto file_descriptor = open_result.value();
+
+    const auto truncate_result = ::score::os::Unistd::instance().ftruncate(file_descriptor, mapping_size);
+    if (!truncate_result.has_value())
+    {
+        score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+        score::mw::log::LogError("lola") << "TraceRecorder: Could not resize recording file" << path << ":"
+                                         << truncate_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+    const auto mmap_result =
+        ::score::os::Mman::instance().mmap(nullptr,
+                                           mapping_size,
+                                           ::score::os::Mman::Protection::kRead | ::score::os::Mman::Protection::kWrite,
+                                           ::score::os::Mman::Map::kShared,
+                                           file_descriptor,
+                                           0);
+    // The mapping stays valid after closing the file descriptor.
+    score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+    if (!mmap_result.has_value())
+    {
+        score::mw::log::LogError("lola") << "TraceRecorder: Could not map recording file" << path << ":"
+                                         << mmap_result.error();
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+
+    auto* const mapping = static_cast<std::byte*>(mmap_result.value());
+    header_ = new (mapping) TraceRecordingHeader{kTraceRecordingMagic,
+                                                  kTraceRecordingVersion,
+                                                  static_cast<std::uint32_t>(sizeof(TraceRecord)),
+                                                  static_cast<std::uint64_t>(settings.file_capacity),
+                                                  0U,
+                                                  0U};
+    // Suppress "AUTOSAR C++14 M5-2-8" rule finding. This rule states: "An object with integer type or pointer to void
+    // type shall not be converted to an object with pointer type.". The records section starts directly after the
+    // header, which keeps the alignment of TraceRecord, within the mapping created above.
+    // coverity[autosar_cpp14_m5_2_8_violation]
+    records_ = static_cast<TraceRecord*>(static_cast<void*>(mapping + sizeof(TraceRecordingHeader)));
+    mapping_size_ = mapping_size;
+
+    // Records, which were appended after a previous recording was stopped, don't belong to this recording.
+    {
+        std::lock_guard<std::mutex> rings_lock{rings_mutex_};
+        for (auto& ring : rings_)
+        {
+            ring->Drain([](const TraceRecord&) noexcept {});
+            score::cpp::ignore = ring->TakeNumberOfDroppedRecords();
+        }
+    }
+
+    stop_requested_ = false;
+    flush_thread_ = std::thread{[this, flush_period = settings.flush_period]() noexcept {
+        RunFlushThread(flush_period);
+    }};
+    is_recording_.store(true, std::memory_order_release);
+    return {};
+}
+
+void TraceRecorder::Stop() noexcept
+{
+    is_recording_.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock{file_mutex_};
+        stop_requested_ = true;
+    }
+    stop_condition_.notify_all();
+    if (flush_thread_.joinable())
+    {
+        flush_thread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock{file_mutex_};
+    if (header_ == nullptr)
+    {
+        return;
+    }
+    FlushLocked();
+    score::cpp::ignore = ::score::os::Mman::instance().munmap(header_, mapping_size_);
+    header_ = nullptr;
+    records_ = nullptr;
+    mapping_size_ = 0U;
+}
+
+void TraceRecorder::Flush() noexcept
+{
+    std::lock_guard<std::mutex> lock{file_mutex_};
+    FlushLocked();
+}
+
+void TraceRecorder::Append(const TracePointType trace_point_type,
+                           const ElementFqId& element_fq_id,
+                           const SlotIndexType slot_index) noexcept
+{
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+    auto& ring = AcquireRing();
+    score::cpp::ignore = ring.TryPush(TraceRecord{static_cast<std::uint64_t>(timestamp.count()),
+                                                  ring.GetThreadNumber(),
+                                                  element_fq_id.service_id_,
+                                                  element_fq_id.instance_id_,
+                                                  element_fq_id.element_id_,
+                                                  slot_index,
+                                                  static_cast<std::uint8_t>(element_fq_id.element_type_),
+                                                  static_cast<std::uint8_t>(trace_point_type),
+                                                  0U});
+}
+
+TraceRecordRing& TraceRecorder::AcquireRing() noexcept
+{
+    auto* const owned_ring = ring_ownership.Get();
+    if (owned_ring != nullptr)
+    {
+        return *owned_ring;
+    }
+
+    // Only the first trace point of a thread gets here.
+    std::lock_guard<std::mutex> lock{rings_mutex_};
+    for (auto& ring : rings_)
+    {
+        if (ring->TryAcquireOwnership())
+        {
+            ring_ownership.Set(*ring);
+            return *ring;
+        }
+    }
+    auto& new_ring = rings_.emplace_back(std::make_unique<TraceRecordRing>(static_cast<std::uint32_t>(rings_.size())));
+    score::cpp::ignore = new_ring->TryAcquireOwnership();
+    ring_ownership.Set(*new_ring);
+    return *new_ring;
+}
+
+void TraceRecorder::FlushLocked() noexcept
+{
+    if (header_ == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> rings_lock{rings_mutex_};
+    for (auto& ring : rings_)
+    {
+        ring->Drain([this](const TraceRecord& record) noexcept {
+            const auto index = header_->number_of_written_records % header_->capacity;
+            records_[static_cast<std::size_t>(index)] = record;
+            ++header_->number_of_written_records;
+        });
+        header_->number_of_dropped_records += ring->TakeNumberOfDroppedRecords();
+    }
+}
+
+void TraceRecorder::RunFlushThread(const std::chrono::milliseconds flush_period) noexcept
+{
+    std::unique_lock<std::mutex> lock{file_mutex_};
+    while (!stop_requested_)
+    {
+        score::cpp::ignore = stop_condition_.wait_for(lock, flush_period, [this]() noexcept {
+            return stop_requested_;
+        });
+        FlushLocked();
+    }
+}
+
+}  // namespace score::mw::com::impl::lola::tracing
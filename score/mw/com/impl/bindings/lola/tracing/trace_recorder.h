@@ -0,0 +1,217 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDER_H
+
+#include "score/mw/com/impl/bindings/lola/control_slot_types.h"
+#include "score/mw/com/impl/bindings/lola/element_fq_id.h"
+
+#include "score/result/result.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace score::mw::com::impl::lola::tracing
+{
+
+/// \brief The points in the LoLa binding, at which the TraceRecorder records the time.
+enum class TracePointType : std::uint8_t
+{
+    kSkeletonEventSend = 0U,
+    kSkeletonEventNotify,
+    kProxyEventNotificationReceived,
+    kProxyEventGetNewSamples,
+    /// \brief Recorded per slot by ConsumerEventDataControlLocalView, right after its reference count got incremented.
+    kProxyEventSampleCollected,
+};
+
+/// \brief Slot index of the trace points, which do not concern a single slot.
+constexpr SlotIndexType kNoSlotIndex{std::numeric_limits<SlotIndexType>::max()};
+
+/// \brief Fixed-size binary record of a single trace point, as it is stored in the rings and in the recording file.
+struct TraceRecord
+{
+    /// \brief Monotonic time of the trace point in nanoseconds.
+    std::uint64_t timestamp_ns;
+    /// \brief Number of the thread within the recording process, starting at 0.
+    std::uint32_t thread_number;
+    std::uint16_t service_id;
+    std::uint16_t instance_id;
+    std::uint16_t element_id;
+    std::uint16_t slot_index;
+    std::uint8_t element_type;
+    std::uint8_t trace_point_type;
+    std::uint16_t reserved;
+};
+static_assert(sizeof(TraceRecord) == 24U, "The size of a TraceRecord is part of the recording file format.");
+static_assert(std::is_trivially_copyable_v<TraceRecord>, "TraceRecords are copied bytewise into the file.");
+
+/// \brief Header at the beginning of a recording file, which is followed by capacity TraceRecords.
+/// \details The records section is used as a ring: The record with the running number n is stored at index
+///          n % capacity, so that the file always contains the latest records.
+struct TraceRecordingHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t capacity;
+    std::uint64_t number_of_written_records;
+    std::uint64_t number_of_dropped_records;
+};
+static_assert(std::is_trivially_copyable_v<TraceRecordingHeader>, "The header is copied bytewise into the file.");
+
+/// \brief "LOLATRC1" in little endian byte order.
+constexpr std::uint64_t kTraceRecordingMagic{0x31435254414C4F4CU};
+constexpr std::uint32_t kTraceRecordingVersion{1U};
+
+/// \brief Ring of TraceRecords with a single producer (the thread owning it) and a single consumer (the flush).
+/// \details The producer never waits: If the ring is full, the record is dropped and counted.
+class TraceRecordRing
+{
+  public:
+    static constexpr std::size_t kCapacity{4096U};
+
+    explicit TraceRecordRing(const std::uint32_t thread_number) noexcept;
+
+    /// \brief Appends a record. Returns false and counts the record as dropped, if the ring is full.
+    bool TryPush(const TraceRecord& record) noexcept;
+
+    /// \brief Hands all records, which were pushed so far, to consumer in the order they were pushed.
+    template <typename Consumer>
+    void Drain(Consumer&& consumer) noexcept
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_acquire);
+        for (auto position = tail; position != head; ++position)
+        {
+            consumer(records_[static_cast<std::size_t>(position % kCapacity)]);
+        }
+        tail_.store(head, std::memory_order_release);
+    }
+
+    /// \brief Returns the number of dropped records and resets it.
+    std::uint64_t TakeNumberOfDroppedRecords() noexcept;
+
+    std::uint32_t GetThreadNumber() const noexcept
+    {
+        return thread_number_;
+    }
+
+    /// \brief A ring is owned by one thread at a time. A ring, whose thread exited, is handed over to the next new one.
+    bool TryAcquireOwnership() noexcept;
+    void ReleaseOwnership() noexcept;
+
+  private:
+    std::array<TraceRecord, kCapacity> records_;
+    std::uint32_t thread_number_;
+    std::atomic<bool> is_owned_;
+    // The positions are written by different threads and are kept on separate cache lines to avoid false sharing.
+    alignas(64) std::atomic<std::uint64_t> head_;
+    std::atomic<std::uint64_t> number_of_dropped_records_;
+    alignas(64) std::atomic<std::uint64_t> tail_;
+};
+
+/// \brief Process wide recorder of the trace points of the LoLa binding.
+///
+/// While recording, every trace point appends a TraceRecord to the ring of the calling thread, which takes neither a
+/// lock nor a syscall. A flush thread periodically moves the records from the rings into a memory-mapped recording
+/// file. The recording file can be printed as a timeline with lola_trace_decoder.
+/// While not recording, a trace point costs a single relaxed atomic load. The cost of a trace point is measured by
+/// the trace_recorder_benchmarks.
+class TraceRecorder final
+{
+  public:
+    struct Settings
+    {
+        /// \brief Number of records the recording file holds. Older records are overwritten by newer ones.
+        std::size_t file_capacity{1U << 20U};
+        /// \brief Period in which the rings are flushed into the recording file.
+        std::chrono::milliseconds flush_period{100};
+    };
+
+    static TraceRecorder& Instance() noexcept;
+
+    static bool IsRecording() noexcept
+    {
+        return is_recording_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Records a trace point, if the recorder was started.
+    static void Record(const TracePointType trace_point_type,
+                       const ElementFqId& element_fq_id,
+                       const SlotIndexType slot_index = kNoSlotIndex) noexcept
+    {
+        if (IsRecording())
+        {
+            Instance().Append(trace_point_type, element_fq_id, slot_index);
+        }
+    }
+
+    ~TraceRecorder() noexcept;
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder(TraceRecorder&&) noexcept = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(TraceRecorder&&) noexcept = delete;
+
+    /// \brief Creates (or truncates) the recording file and starts recording into it.
+    /// \return kCouldNotExecute, if the recorder is already recording, kErroneousFileHandle, if the recording file
+    ///         could not be created and mapped.
+    ResultBlank Start(const std::string_view file_path, const Settings& settings) noexcept;
+
+    /// \brief Stops recording, flushes the remaining records and unmaps the recording file.
+    void Stop() noexcept;
+
+    /// \brief Moves all records from the rings into the recording file.
+    void Flush() noexcept;
+
+  private:
+    TraceRecorder() noexcept;
+
+    void Append(const TracePointType trace_point_type,
+                const ElementFqId& element_fq_id,
+                const SlotIndexType slot_index) noexcept;
+    TraceRecordRing& AcquireRing() noexcept;
+    void FlushLocked() noexcept;
+    void RunFlushThread(const std::chrono::milliseconds flush_period) noexcept;
+
+    static std::atomic<bool> is_recording_;
+
+    std::mutex rings_mutex_;
+    std::vector<std::unique_ptr<TraceRecordRing>> rings_;
+
+    /// \brief Protects the recording file and the flush thread.
+    std::mutex file_mutex_;
+    TraceRecordingHeader* header_;
+    TraceRecord* records_;
+    std::size_t mapping_size_;
+
+    std::condition_variable stop_condition_;
+    bool stop_requested_;
+    std::thread flush_thread_;
+};
+
+}  // namespace score::mw::com::impl::lola::tracing
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDER_H
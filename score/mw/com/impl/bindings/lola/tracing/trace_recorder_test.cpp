@@ -0,0 +1,301 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
+
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recording_decoder.h"
+#include "score/mw/com/impl/com_error.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace score::mw::com::impl::lola::tracing
+{
+namespace
+{
+
+const std::string kRecordingPath{"/tmp/lola_trace_recorder_test.bin"};
+const ElementFqId kElementFqId{1U, 2U, 3U, ServiceElementType::EVENT};
+const ElementFqId kOtherElementFqId{1U, 4U, 3U, ServiceElementType::FIELD};
+
+TraceRecord MakeRecord(const std::uint64_t timestamp_ns) noexcept
+{
+    return TraceRecord{timestamp_ns, 0U, 1U, 3U, 2U, kNoSlotIndex, 1U, 0U, 0U};
+}
+
+std::vector<std::uint64_t> DrainTimestamps(TraceRecordRing& ring)
+{
+    std::vector<std::uint64_t> timestamps{};
+    ring.Drain([&timestamps](const TraceRecord& record) noexcept {
+        timestamps.push_back(record.timestamp_ns);
+    });
+    return timestamps;
+}
+
+TEST(TraceRecordRingTest, DrainsPushedRecordsInOrder)
+{
+    // Given a ring with three pushed records
+    TraceRecordRing ring{0U};
+    EXPECT_TRUE(ring.TryPush(MakeRecord(1U)));
+    EXPECT_TRUE(ring.TryPush(MakeRecord(2U)));
+    EXPECT_TRUE(ring.TryPush(MakeRecord(3U)));
+
+    // When draining it
+    // Then the records are handed out in the order they were pushed
+    EXPECT_EQ(DrainTimestamps(ring), (std::vector<std::uint64_t>{1U, 2U, 3U}));
+
+    // and a second drain doesn't hand them out again
+    EXPECT_TRUE(DrainTimestamps(ring).empty());
+}
+
+TEST(TraceRecordRingTest, DropsAndCountsRecordsWhenFull)
+{
+    // Given a full ring
+    TraceRecordRing ring{0U};
+    for (std::size_t index = 0U; index < TraceRecordRing::kCapacity; ++index)
+    {
+        EXPECT_TRUE(ring.TryPush(MakeRecord(index)));
+    }
+
+    // When pushing two more records
+    // Then they are dropped
+    EXPECT_FALSE(ring.TryPush(MakeRecord(TraceRecordRing::kCapacity)));
+    EXPECT_FALSE(ring.TryPush(MakeRecord(TraceRecordRing::kCapacity + 1U)));
+
+    // and counted
+    EXPECT_EQ(ring.TakeNumberOfDroppedRecords(), 2U);
+    EXPECT_EQ(ring.TakeNumberOfDroppedRecords(), 0U);
+
+    // and the ring accepts records again after it was drained
+    EXPECT_EQ(DrainTimestamps(ring).size(), TraceRecordRing::kCapacity);
+    EXPECT_TRUE(ring.TryPush(MakeRecord(0U)));
+}
+
+TEST(TraceRecordRingTest, ConcurrentlyDrainedRecordsKeepTheirOrder)
+{
+    constexpr std::uint64_t kNumberOfRecords{100000U};
+
+    // Given a ring, which gets filled by one thread, which pushes a record again, if the ring was full
+    TraceRecordRing ring{0U};
+    std::uint64_t number_of_failed_pushes{0U};
+    std::thread producer{[&ring, &number_of_failed_pushes]() {
+        for (std::uint64_t timestamp = 0U; timestamp < kNumberOfRecords; ++timestamp)
+        {
+            while (!ring.TryPush(MakeRecord(timestamp)))
+            {
+                ++number_of_failed_pushes;
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    // When draining it concurrently
+    std::vector<std::uint64_t> timestamps{};
+    while (timestamps.size() < kNumberOfRecords)
+    {
+        ring.Drain([&timestamps](const TraceRecord& record) noexcept {
+            timestamps.push_back(record.timestamp_ns);
+        });
+    }
+    producer.join();
+
+    // Then every record is drained exactly once and in order
+    for (std::uint64_t index = 0U; index < kNumberOfRecords; ++index)
+    {
+        ASSERT_EQ(timestamps[static_cast<std::size_t>(index)], index);
+    }
+
+    // and only the failed pushes, which were repeated, have been counted as dropped
+    EXPECT_EQ(ring.TakeNumberOfDroppedRecords(), number_of_failed_pushes);
+}
+
+TEST(TraceRecordRingTest, OwnershipCanOnlyBeAcquiredOnceUntilReleased)
+{
+    TraceRecordRing ring{0U};
+    EXPECT_TRUE(ring.TryAcquireOwnership());
+    EXPECT_FALSE(ring.TryAcquireOwnership());
+    ring.ReleaseOwnership();
+    EXPECT_TRUE(ring.TryAcquireOwnership());
+}
+
+class TraceRecorderFixture : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        TraceRecorder::Instance().Stop();
+        score::cpp::ignore = std::remove(kRecordingPath.c_str());
+    }
+
+    TraceRecording StopAndReadRecording()
+    {
+        TraceRecorder::Instance().Stop();
+        auto recording = ReadTraceRecording(kRecordingPath);
+        EXPECT_TRUE(recording.has_value());
+        return std::move(recording).value();
+    }
+
+    TraceRecorder::Settings settings_{16U, std::chrono::milliseconds{1000}};
+};
+
+TEST_F(TraceRecorderFixture, RecordsNothingWhileNotStarted)
+{
+    // Given a TraceRecorder, which was not started
+
+    // When recording a trace point
+    TraceRecorder::Record(TracePointType::kSkeletonEventSend, kElementFqId, 5U);
+
+    // and starting and stopping the recorder afterwards
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+    const auto recording = StopAndReadRecording();
+
+    // Then the recording is empty
+    EXPECT_TRUE(recording.records.empty());
+}
+
+TEST_F(TraceRecorderFixture, WritesTheRecordedTracePointsIntoTheRecordingFile)
+{
+    // Given a started TraceRecorder
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+
+    // When recording two trace points
+    TraceRecorder::Record(TracePointType::kSkeletonEventSend, kElementFqId, 5U);
+    TraceRecorder::Record(TracePointType::kProxyEventGetNewSamples, kOtherElementFqId);
+
+    // Then the recording contains them with their element, slot and trace point type
+    const auto recording = StopAndReadRecording();
+    ASSERT_EQ(recording.records.size(), 2U);
+    const auto& send_record = recording.records[0];
+    EXPECT_EQ(send_record.service_id, 1U);
+    EXPECT_EQ(send_record.element_id, 2U);
+    EXPECT_EQ(send_record.instance_id, 3U);
+    EXPECT_EQ(send_record.element_type, static_cast<std::uint8_t>(ServiceElementType::EVENT));
+    EXPECT_EQ(send_record.slot_index, 5U);
+    EXPECT_EQ(send_record.trace_point_type, static_cast<std::uint8_t>(TracePointType::kSkeletonEventSend));
+
+    const auto& get_new_samples_record = recording.records[1];
+    EXPECT_EQ(get_new_samples_record.element_id, 4U);
+    EXPECT_EQ(get_new_samples_record.slot_index, kNoSlotIndex);
+    EXPECT_EQ(get_new_samples_record.trace_point_type,
+              static_cast<std::uint8_t>(TracePointType::kProxyEventGetNewSamples));
+
+    // and the timestamps are monotonic
+    EXPECT_LE(send_record.timestamp_ns, get_new_samples_record.timestamp_ns);
+}
+
+TEST_F(TraceRecorderFixture, KeepsTheLatestRecordsWhenTheFileIsFull)
+{
+    // Given a started TraceRecorder, whose file holds 16 records
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+
+    // When recording 20 trace points, which are flushed in between
+    for (SlotIndexType slot_index = 0U; slot_index < 20U; ++slot_index)
+    {
+        TraceRecorder::Record(TracePointType::kProxyEventSampleCollected, kElementFqId, slot_index);
+        if (slot_index == 10U)
+        {
+            TraceRecorder::Instance().Flush();
+        }
+    }
+
+    // Then the recording contains the latest 16 of them
+    const auto recording = StopAndReadRecording();
+    EXPECT_EQ(recording.header.number_of_written_records, 20U);
+    ASSERT_EQ(recording.records.size(), 16U);
+    EXPECT_EQ(recording.records.front().slot_index, 4U);
+    EXPECT_EQ(recording.records.back().slot_index, 19U);
+}
+
+TEST_F(TraceRecorderFixture, RecordsTracePointsOfAllThreads)
+{
+    constexpr std::size_t kNumberOfThreads{4U};
+    settings_.file_capacity = 1024U;
+
+    // Given a started TraceRecorder
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+
+    // When several threads record trace points
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([]() {
+            for (SlotIndexType slot_index = 0U; slot_index < 10U; ++slot_index)
+            {
+                TraceRecorder::Record(TracePointType::kSkeletonEventSend, kElementFqId, slot_index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then the recording contains all of them ordered by their timestamp
+    const auto recording = StopAndReadRecording();
+    ASSERT_EQ(recording.records.size(), kNumberOfThreads * 10U);
+    for (std::size_t index = 1U; index < recording.records.size(); ++index)
+    {
+        EXPECT_LE(recording.records[index - 1U].timestamp_ns, recording.records[index].timestamp_ns);
+    }
+}
+
+TEST_F(TraceRecorderFixture, StartingTwiceFails)
+{
+    // Given a started TraceRecorder
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+
+    // When starting it again
+    const auto result = TraceRecorder::Instance().Start(kRecordingPath, settings_);
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kCouldNotExecute);
+}
+
+TEST_F(TraceRecorderFixture, StartingWithAnInvalidPathFails)
+{
+    // When starting the TraceRecorder with a path in a non-existing directory
+    const auto result = TraceRecorder::Instance().Start("/non_existing_directory/recording.bin", settings_);
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST_F(TraceRecorderFixture, RestartingCreatesANewRecording)
+{
+    // Given a TraceRecorder, which was started and stopped
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+    TraceRecorder::Instance().Stop();
+
+    // When it is restarted and a trace point is recorded
+    ASSERT_TRUE(TraceRecorder::Instance().Start(kRecordingPath, settings_).has_value());
+    TraceRecorder::Record(TracePointType::kSkeletonEventNotify, kElementFqId);
+
+    // Then only this trace point is contained in the new recording
+    const auto recording = StopAndReadRecording();
+    ASSERT_EQ(recording.records.size(), 1U);
+    EXPECT_EQ(recording.records[0].trace_point_type, static_cast<std::uint8_t>(TracePointType::kSkeletonEventNotify));
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::tracing
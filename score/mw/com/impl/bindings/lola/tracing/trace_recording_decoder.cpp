@@ -0,0 +1,147 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recording_decoder.h"
+
+#include "score/mw/com/impl/com_error.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace score::mw::com::impl::lola::tracing
+{
+
+namespace
+{
+
+std::uint64_t GetElementKey(const TraceRecord& record) noexcept
+{
+    return (static_cast<std::uint64_t>(record.service_id) << 32U) |
+           (static_cast<std::uint64_t>(record.element_id) << 16U) | static_cast<std::uint64_t>(record.instance_id);
+}
+
+double ToMicroseconds(const std::uint64_t nanoseconds) noexcept
+{
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+}  // namespace
+
+Result<TraceRecording> ReadTraceRecording(const std::string_view file_path) noexcept
+{
+    std::ifstream file{std::string{file_path.data(), file_path.size()}, std::ios::binary};
+    TraceRecording recording{};
+    // Suppress "AUTOSAR C++14 A5-2-4" rule finding. This rule states: "reinterpret_cast shall not be used.". The header
+    // and the records are trivially copyable and were written bytewise.
+    // coverity[autosar_cpp14_a5_2_4_violation]
+    score::cpp::ignore = file.read(reinterpret_cast<char*>(&recording.header), sizeof(TraceRecordingHeader));
+    if ((!file) || (recording.header.magic != kTraceRecordingMagic) ||
+        (recording.header.version != kTraceRecordingVersion) || (recording.header.record_size != sizeof(TraceRecord)))
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+
+    std::vector<TraceRecord> records(static_cast<std::size_t>(recording.header.capacity));
+    // coverity[autosar_cpp14_a5_2_4_violation]
+    score::cpp::ignore = file.read(reinterpret_cast<char*>(records.data()),
+                                   static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+    if (!file)
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle);
+    }
+
+    // Until the records section wrapped around, only its beginning is filled.
+    const auto number_of_records = std::min(recording.header.number_of_written_records, recording.header.capacity);
+    records.resize(static_cast<std::size_t>(number_of_records));
+    // Records of different threads are flushed ring by ring, so they are only ordered per thread in the file.
+    std::stable_sort(records.begin(), records.end(), [](const TraceRecord& lhs, const TraceRecord& rhs) noexcept {
+        return std::tie(lhs.timestamp_ns, lhs.thread_number) < std::tie(rhs.timestamp_ns, rhs.thread_number);
+    });
+    recording.records = std::move(records);
+    return recording;
+}
+
+std::string_view ToString(const TracePointType trace_point_type) noexcept
+{
+    switch (trace_point_type)
+    {
+        case TracePointType::kSkeletonEventSend:
+            return "SkeletonEvent::Send";
+        case TracePointType::kSkeletonEventNotify:
+            return "SkeletonEvent::Notify";
+        case TracePointType::kProxyEventNotificationReceived:
+            return "ProxyEvent::NotificationReceived";
+        case TracePointType::kProxyEventGetNewSamples:
+            return "ProxyEvent::GetNewSamples";
+        case TracePointType::kProxyEventSampleCollected:
+            return "ProxyEvent::SampleCollected";
+        default:
+            return "Unknown";
+    }
+}
+
+void PrintTimeline(const TraceRecording& recording, std::ostream& output) noexcept
+{
+    const auto& header = recording.header;
+    const auto number_of_overwritten_records =
+        header.number_of_written_records - static_cast<std::uint64_t>(recording.records.size());
+    output << recording.records.size() << " records, " << number_of_overwritten_records << " overwritten, "
+           << header.number_of_dropped_records << " dropped\n";
+    if (recording.records.empty())
+    {
+        return;
+    }
+
+    output << std::setw(14) << "time [us]" << std::setw(8) << "thread" << "  " << std::left << std::setw(34)
+           << "trace point" << std::setw(20) << "service/inst/elem" << std::right << std::setw(6) << "slot"
+           << std::setw(16) << "elem delta [us]" << '\n';
+    output << std::fixed << std::setprecision(3);
+
+    const auto first_timestamp = recording.records.front().timestamp_ns;
+    std::unordered_map<std::uint64_t, std::uint64_t> previous_timestamp_of_element{};
+    for (const auto& record : recording.records)
+    {
+        const std::string element = std::to_string(record.service_id) + "/" + std::to_string(record.instance_id) +
+                                    "/" + std::to_string(record.element_id);
+        output << std::setw(14) << ToMicroseconds(record.timestamp_ns - first_timestamp) << std::setw(8)
+               << record.thread_number << "  " << std::left << std::setw(34)
+               << ToString(static_cast<TracePointType>(record.trace_point_type)) << std::setw(20) << element
+               << std::right << std::setw(6);
+        if (record.slot_index == kNoSlotIndex)
+        {
+            output << "-";
+        }
+        else
+        {
+            output << record.slot_index;
+        }
+
+        const auto previous_timestamp = previous_timestamp_of_element.find(GetElementKey(record));
+        if (previous_timestamp != previous_timestamp_of_element.cend())
+        {
+            output << std::setw(16) << ToMicroseconds(record.timestamp_ns - previous_timestamp->second);
+        }
+        output << '\n';
+        previous_timestamp_of_element[GetElementKey(record)] = record.timestamp_ns;
+    }
+}
+
+}  // namespace score::mw::com::impl::lola::tracing
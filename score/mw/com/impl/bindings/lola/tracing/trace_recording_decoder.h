@@ -0,0 +1,47 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDING_DECODER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDING_DECODER_H
+
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recorder.h"
+
+#include "score/result/result.h"
+
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace score::mw::com::impl::lola::tracing
+{
+
+/// \brief Content of a recording file written by the TraceRecorder.
+struct TraceRecording
+{
+    TraceRecordingHeader header;
+    /// \brief The records still contained in the file, ordered by their timestamp.
+    std::vector<TraceRecord> records;
+};
+
+/// \brief Reads a recording file.
+/// \return kErroneousFileHandle, if the file cannot be read or is no recording file of a supported version.
+Result<TraceRecording> ReadTraceRecording(const std::string_view file_path) noexcept;
+
+std::string_view ToString(const TracePointType trace_point_type) noexcept;
+
+/// \brief Prints one line per record, with its time relative to the first record and to the previous record of the
+/// same service element.
+void PrintTimeline(const TraceRecording& recording, std::ostream& output) noexcept;
+
+}  // namespace score::mw::com::impl::lola::tracing
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRACING_TRACE_RECORDING_DECODER_H
@@ -0,0 +1,193 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/tracing/trace_recording_decoder.h"
+
+#include "score/mw/com/impl/com_error.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::impl::lola::tracing
+{
+namespace
+{
+
+const std::string kRecordingPath{"/tmp/lola_trace_recording_decoder_test.bin"};
+
+TraceRecord MakeRecord(const std::uint64_t timestamp_ns,
+                       const std::uint32_t thread_number,
+                       const TracePointType trace_point_type,
+                       const std::uint16_t slot_index) noexcept
+{
+    return TraceRecord{
+        timestamp_ns, thread_number, 1U, 3U, 2U, slot_index, 1U, static_cast<std::uint8_t>(trace_point_type), 0U};
+}
+
+class TraceRecordingDecoderFixture : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        score::cpp::ignore = std::remove(kRecordingPath.c_str());
+    }
+
+    void WriteRecordingFile(const TraceRecordingHeader& header, const std::vector<TraceRecord>& records)
+    {
+        std::ofstream file{kRecordingPath, std::ios::binary | std::ios::trunc};
+        score::cpp::ignore = file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        score::cpp::ignore = file.write(reinterpret_cast<const char*>(records.data()),
+                                        static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+    }
+
+    TraceRecordingHeader MakeHeader(const std::uint64_t capacity, const std::uint64_t number_of_written_records)
+    {
+        return TraceRecordingHeader{kTraceRecordingMagic,
+                                    kTraceRecordingVersion,
+                                    static_cast<std::uint32_t>(sizeof(TraceRecord)),
+                                    capacity,
+                                    number_of_written_records,
+                                    0U};
+    }
+};
+
+TEST_F(TraceRecordingDecoderFixture, ReadingANonExistingFileFails)
+{
+    const auto result = ReadTraceRecording("/non_existing_directory/recording.bin");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST_F(TraceRecordingDecoderFixture, ReadingAFileWithAWrongMagicFails)
+{
+    // Given a recording file with a wrong magic
+    auto header = MakeHeader(1U, 0U);
+    header.magic = 0U;
+    WriteRecordingFile(header, std::vector<TraceRecord>(1U));
+
+    // When reading it
+    const auto result = ReadTraceRecording(kRecordingPath);
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST_F(TraceRecordingDecoderFixture, ReadingAFileWithAnUnsupportedVersionFails)
+{
+    auto header = MakeHeader(1U, 0U);
+    header.version = kTraceRecordingVersion + 1U;
+    WriteRecordingFile(header, std::vector<TraceRecord>(1U));
+
+    const auto result = ReadTraceRecording(kRecordingPath);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST_F(TraceRecordingDecoderFixture, ReadingATruncatedFileFails)
+{
+    // Given a recording file, which contains fewer records than its capacity
+    WriteRecordingFile(MakeHeader(4U, 2U), std::vector<TraceRecord>(2U));
+
+    // When reading it
+    const auto result = ReadTraceRecording(kRecordingPath);
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST_F(TraceRecordingDecoderFixture, ReturnsOnlyTheWrittenRecordsOrderedByTimestamp)
+{
+    // Given a recording file with a capacity of 4, into which the records of two threads were written
+    WriteRecordingFile(MakeHeader(4U, 3U),
+                       {MakeRecord(10U, 0U, TracePointType::kSkeletonEventSend, 1U),
+                        MakeRecord(30U, 0U, TracePointType::kSkeletonEventNotify, kNoSlotIndex),
+                        MakeRecord(20U, 1U, TracePointType::kProxyEventGetNewSamples, kNoSlotIndex),
+                        TraceRecord{}});
+
+    // When reading it
+    const auto result = ReadTraceRecording(kRecordingPath);
+
+    // Then the written records are returned ordered by their timestamp
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().records.size(), 3U);
+    EXPECT_EQ(result.value().records[0].timestamp_ns, 10U);
+    EXPECT_EQ(result.value().records[1].timestamp_ns, 20U);
+    EXPECT_EQ(result.value().records[2].timestamp_ns, 30U);
+}
+
+TEST_F(TraceRecordingDecoderFixture, ReturnsAllRecordsOfAWrappedAroundFile)
+{
+    // Given a recording file with a capacity of 2, into which 3 records were written, so that the first one was
+    // overwritten by the third one
+    WriteRecordingFile(MakeHeader(2U, 3U),
+                       {MakeRecord(30U, 0U, TracePointType::kSkeletonEventSend, 3U),
+                        MakeRecord(20U, 0U, TracePointType::kSkeletonEventSend, 2U)});
+
+    // When reading it
+    const auto result = ReadTraceRecording(kRecordingPath);
+
+    // Then both remaining records are returned in order
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().records.size(), 2U);
+    EXPECT_EQ(result.value().records[0].slot_index, 2U);
+    EXPECT_EQ(result.value().records[1].slot_index, 3U);
+}
+
+TEST(TraceRecordingDecoderTest, ToStringReturnsTheNameOfTheTracePoint)
+{
+    EXPECT_EQ(ToString(TracePointType::kSkeletonEventSend), "SkeletonEvent::Send");
+    EXPECT_EQ(ToString(TracePointType::kSkeletonEventNotify), "SkeletonEvent::Notify");
+    EXPECT_EQ(ToString(TracePointType::kProxyEventNotificationReceived), "ProxyEvent::NotificationReceived");
+    EXPECT_EQ(ToString(TracePointType::kProxyEventGetNewSamples), "ProxyEvent::GetNewSamples");
+    EXPECT_EQ(ToString(TracePointType::kProxyEventSampleCollected), "ProxyEvent::SampleCollected");
+    EXPECT_EQ(ToString(static_cast<TracePointType>(0xFFU)), "Unknown");
+}
+
+TEST(TraceRecordingDecoderTest, PrintsOneLinePerRecord)
+{
+    // Given a recording with two records of the same service element, one of which doesn't concern a slot
+    TraceRecording recording{TraceRecordingHeader{}, {}};
+    recording.header.number_of_written_records = 3U;
+    recording.header.number_of_dropped_records = 4U;
+    recording.records = {MakeRecord(1000U, 0U, TracePointType::kSkeletonEventSend, 7U),
+                         MakeRecord(3500U, 1U, TracePointType::kProxyEventGetNewSamples, kNoSlotIndex)};
+
+    // When printing the timeline
+    std::ostringstream output{};
+    PrintTimeline(recording, output);
+
+    // Then the summary and both records are printed
+    const auto timeline = output.str();
+    EXPECT_NE(timeline.find("2 records, 1 overwritten, 4 dropped"), std::string::npos);
+    EXPECT_NE(timeline.find("SkeletonEvent::Send"), std::string::npos);
+    EXPECT_NE(timeline.find("ProxyEvent::GetNewSamples"), std::string::npos);
+    EXPECT_NE(timeline.find("1/3/2"), std::string::npos);
+    // and the time since the previous record of the same service element
+    EXPECT_NE(timeline.find("2.500"), std::string::npos);
+    // and a "-" for the record, which doesn't concern a slot
+    EXPECT_NE(timeline.find("     -"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::tracing
@@ -23,7 +23,7 @@
 #include <cstdint>
 #include <exception>
 #include <limits>
-#include <mutex>
+#include <thread>
 #include <utility>
 
 namespace score::mw::com::impl::lola::tracing
@@ -357,9 +357,8 @@ std::optional<void*> TracingRuntime::GetShmRegionStartAddress(
 
 bool TracingRuntime::IsTracingSlotUsed(const TraceContextId trace_context_id) noexcept
 {
-    auto& element = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id));
-    std::lock_guard<std::mutex> lock(element.mutex);
-    return element.sample_ptr.has_value();
+    const auto& element = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id));
+    return element.state.load(std::memory_order_acquire) == TracingSlotState::kUsed;
 }
 
 auto TracingRuntime::GetTraceContextIdRangeForServiceElement(
@@ -382,7 +381,7 @@ auto TracingRuntime::GetTraceContextIdRangeForServiceElement(
     return {range_start, static_cast<TraceContextId>(range_start) + static_cast<TraceContextId>(range_size)};
 }
 
-auto TracingRuntime::GetTraceContextId(
+auto TracingRuntime::ClaimFreeTracingSlot(
     const impl::tracing::ServiceElementTracingData& service_element_tracing_data) noexcept
     -> std::optional<TraceContextId>
 {
@@ -390,7 +389,14 @@ auto TracingRuntime::GetTraceContextId(
     for (auto trace_context_id = trace_context_id_range.start; trace_context_id != trace_context_id_range.end;
          ++trace_context_id)
     {
-        if (!IsTracingSlotUsed(trace_context_id))
+        auto& state = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id)).state;
+        // A relaxed load first, so that used slots are skipped without writing to their cache line.
+        if (state.load(std::memory_order_relaxed) != TracingSlotState::kFree)
+        {
+            continue;
+        }
+        auto expected_state = TracingSlotState::kFree;
+        if (state.compare_exchange_strong(expected_state, TracingSlotState::kBusy, std::memory_order_acquire))
         {
             return trace_context_id;
         }
@@ -417,23 +423,35 @@ TracingRuntime::EmplaceTypeErasedSamplePtr(
         std::terminate();
     }
 
-    const auto trace_context_id = GetTraceContextId(service_element_tracing_data);
+    const auto trace_context_id = ClaimFreeTracingSlot(service_element_tracing_data);
     if (!trace_context_id.has_value())
     {
         return {};
     }
     auto& element = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id.value()));
-    std::lock_guard<std::mutex> lock(element.mutex);
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(!element.sample_ptr.has_value());
     element.sample_ptr = std::move(type_erased_sample_ptr);
+    element.state.store(TracingSlotState::kUsed, std::memory_order_release);
     return trace_context_id;
 }
 
 void TracingRuntime::ClearTypeErasedSamplePtr(const TraceContextId trace_context_id) noexcept
 {
-    auto& [sample_ptr, mutex] = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id));
-    std::lock_guard<std::mutex> lock(mutex);
+    auto& [sample_ptr, state] = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id));
+    auto expected_state = TracingSlotState::kUsed;
+    // A slot is only kBusy while a sample pointer is moved into or out of it by another thread, which takes a bounded
+    // amount of time. We wait for it, so that a slot which is being filled concurrently is cleared as well.
+    while (!state.compare_exchange_weak(expected_state, TracingSlotState::kBusy, std::memory_order_acquire))
+    {
+        if (expected_state == TracingSlotState::kFree)
+        {
+            return;
+        }
+        std::this_thread::yield();
+        expected_state = TracingSlotState::kUsed;
+    }
     sample_ptr = {};
+    state.store(TracingSlotState::kFree, std::memory_order_release);
 }
 
 void TracingRuntime::ClearTypeErasedSamplePtrs(
@@ -23,8 +23,9 @@
 #include "score/language/safecpp/scoped_function/scope.h"
 #include "score/memory/shared/i_shared_memory_resource.h"
 
+#include <atomic>
 #include <cstddef>
-#include <mutex>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <unordered_map>
@@ -140,17 +141,26 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
     bool IsTracingSlotUsed(const TraceContextId trace_context_id) noexcept;
 
   private:
-    /// \brief Helper struct which contains an optional sample_ptr and a mutex which is used to protect access to the
-    ///        sample_ptr. A struct is used instead of a std::pair to make the code more explicit when accessing the
-    ///        elements.
-    struct TypeErasedSamplePtrWithMutex
+    /// \brief State of a tracing slot. The transitions kFree -> kBusy and kUsed -> kBusy are done with a
+    ///        compare-exchange, so that only the thread which made the transition accesses the sample_ptr of the slot.
+    enum class TracingSlotState : std::uint8_t
+    {
+        kFree,
+        kBusy,
+        kUsed,
+    };
+
+    /// \brief Helper struct which contains an optional sample_ptr and the state of the slot, which is used to protect
+    ///        access to the sample_ptr without a lock. A struct is used instead of a std::pair to make the code more
+    ///        explicit when accessing the elements.
+    struct TypeErasedSamplePtrSlot
     {
         // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
         // be private.". We need these data elements to be organized into a coherent organized data structure.
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::optional<impl::tracing::TypeErasedSamplePtr> sample_ptr;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        std::mutex mutex;
+        std::atomic<TracingSlotState> state{TracingSlotState::kFree};
     };
 
     /// \brief Helper struct which stores the start and end TraceContextIds of a contiguous range of TraceContextIds
@@ -163,7 +173,9 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
     auto GetTraceContextIdRangeForServiceElement(
         const impl::tracing::ServiceElementTracingData& service_element_tracing_data) noexcept
         -> TraceContextIdContiguousRange;
-    auto GetTraceContextId(const impl::tracing::ServiceElementTracingData& service_element_tracing_data) noexcept
+    /// \brief Claims the first free slot in the range of the service element by setting it to kBusy. The caller has to
+    ///        set the sample_ptr of the claimed slot and to mark it as kUsed afterwards.
+    auto ClaimFreeTracingSlot(const impl::tracing::ServiceElementTracingData& service_element_tracing_data) noexcept
         -> std::optional<TraceContextId>;
 
     const Configuration& configuration_;
@@ -174,8 +186,9 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
     ///        RegisterServiceElement.
     ///
     /// Since the array is of fixed size, we can insert new elements and read other elements at the same time
-    /// without synchronisation. However, operations on individual elements must be protected by a mutex.
-    score::containers::DynamicArray<TypeErasedSamplePtrWithMutex> type_erased_sample_ptrs_;
+    /// without synchronisation. Operations on individual elements are synchronised via the state of the slot, so that
+    /// tracing a sample does not need to take a lock.
+    score::containers::DynamicArray<TypeErasedSamplePtrSlot> type_erased_sample_ptrs_;
 
     /// \brief Index in type_erased_sample_ptrs_. This is the index directly after the index, where the range of last
     /// service element that was registered via RegisterServiceElement, ends.
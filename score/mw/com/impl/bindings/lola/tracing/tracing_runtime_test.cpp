@@ -24,11 +24,15 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace score::mw::com::impl::lola::tracing
 {
@@ -40,7 +44,7 @@ class TracingRuntimeAttorney
   public:
     TracingRuntimeAttorney(TracingRuntime& tracing_runtime) : tracing_runtime_{tracing_runtime} {}
 
-    score::containers::DynamicArray<TracingRuntime::TypeErasedSamplePtrWithMutex>& GetTypeErasedSamplePtrs()
+    score::containers::DynamicArray<TracingRuntime::TypeErasedSamplePtrSlot>& GetTypeErasedSamplePtrs()
         const noexcept
     {
         return tracing_runtime_.type_erased_sample_ptrs_;
@@ -467,6 +471,137 @@ TEST_F(TracingRuntimeTypeErasedSamplePtrFixture,
     EXPECT_FALSE(tracing_runtime_.IsTracingSlotUsed(trace_context_id_2));
 }
 
+class DestructionCounter
+{
+  public:
+    explicit DestructionCounter(std::atomic<std::size_t>& number_of_destructions) noexcept
+        : number_of_destructions_{number_of_destructions}
+    {
+    }
+    ~DestructionCounter() noexcept
+    {
+        number_of_destructions_.fetch_add(1U, std::memory_order_relaxed);
+    }
+    DestructionCounter(const DestructionCounter&) = delete;
+    DestructionCounter& operator=(const DestructionCounter&) = delete;
+    DestructionCounter(DestructionCounter&&) = delete;
+    DestructionCounter& operator=(DestructionCounter&&) = delete;
+
+  private:
+    std::atomic<std::size_t>& number_of_destructions_;
+};
+
+impl::tracing::TypeErasedSamplePtr CreateCountingTypeErasedSamplePtr(std::atomic<std::size_t>& number_of_destructions)
+{
+    mock_binding::SamplePtr<DestructionCounter> pointer = std::make_unique<DestructionCounter>(number_of_destructions);
+    impl::SamplePtr<DestructionCounter> sample_ptr{std::move(pointer), SampleReferenceGuard{}};
+    return impl::tracing::TypeErasedSamplePtr{std::move(sample_ptr)};
+}
+
+constexpr std::size_t kNumberOfStressTestThreads{8U};
+constexpr std::size_t kNumberOfStressTestIterations{2000U};
+
+TEST_F(TracingRuntimeTypeErasedSamplePtrFixture, ConcurrentlyEmplacedTypeErasedSamplePtrsNeverShareASlot)
+{
+    // Given a TracingRuntimeObject with a registered service element which has fewer slots than threads tracing it
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    std::array<std::atomic<std::size_t>, kFakeNumberOfIpcTracingSlotsPerServiceElement> slot_owners{};
+    std::atomic<std::size_t> number_of_shared_slots{0U};
+    std::atomic<std::size_t> number_of_destructions{0U};
+    std::atomic<std::size_t> number_of_emplaced_sample_ptrs{0U};
+
+    // When many threads concurrently emplace and clear type erased sample ptrs
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 1U; thread_index <= kNumberOfStressTestThreads; ++thread_index)
+    {
+        threads.emplace_back([&, thread_index]() {
+            for (std::size_t iteration = 0U; iteration < kNumberOfStressTestIterations; ++iteration)
+            {
+                const auto trace_context_id = tracing_runtime_.EmplaceTypeErasedSamplePtr(
+                    CreateCountingTypeErasedSamplePtr(number_of_destructions), service_element_tracing_data);
+                if (!trace_context_id.has_value())
+                {
+                    continue;
+                }
+                number_of_emplaced_sample_ptrs.fetch_add(1U, std::memory_order_relaxed);
+                auto& slot_owner = slot_owners.at(static_cast<std::size_t>(trace_context_id.value()));
+                if (slot_owner.exchange(thread_index) != 0U)
+                {
+                    number_of_shared_slots.fetch_add(1U, std::memory_order_relaxed);
+                }
+                EXPECT_TRUE(tracing_runtime_.IsTracingSlotUsed(trace_context_id.value()));
+                slot_owner.store(0U);
+                tracing_runtime_.ClearTypeErasedSamplePtr(trace_context_id.value());
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then no slot was handed out to two threads at the same time
+    EXPECT_EQ(number_of_shared_slots.load(), 0U);
+
+    // and all sample ptrs were destroyed, whether they got a slot or not
+    EXPECT_GT(number_of_emplaced_sample_ptrs.load(), 0U);
+    EXPECT_EQ(number_of_destructions.load(), kNumberOfStressTestThreads * kNumberOfStressTestIterations);
+}
+
+TEST_F(TracingRuntimeTypeErasedSamplePtrFixture,
+       ClearingTypeErasedSamplePtrsConcurrentlyToEmplacingAndTraceDoneReleasesAllSamplePtrs)
+{
+    // Given a TracingRuntimeObject with a registered service element
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    std::atomic<std::size_t> number_of_destructions{0U};
+    std::atomic<bool> stop_clearing{false};
+
+    // When type erased sample ptrs are emplaced and cleared by single id (i.e. by trace done callbacks) while another
+    // thread clears all of them (i.e. a TypeErasedSamplePtrsGuard going out of scope)
+    std::thread clearing_thread{[this, &stop_clearing, &service_element_tracing_data]() {
+        while (!stop_clearing.load())
+        {
+            tracing_runtime_.ClearTypeErasedSamplePtrs(service_element_tracing_data);
+        }
+    }};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfStressTestThreads; ++thread_index)
+    {
+        threads.emplace_back([this, &number_of_destructions, &service_element_tracing_data]() {
+            for (std::size_t iteration = 0U; iteration < kNumberOfStressTestIterations; ++iteration)
+            {
+                const auto trace_context_id = tracing_runtime_.EmplaceTypeErasedSamplePtr(
+                    CreateCountingTypeErasedSamplePtr(number_of_destructions), service_element_tracing_data);
+                if (trace_context_id.has_value() && ((iteration % 2U) == 0U))
+                {
+                    tracing_runtime_.ClearTypeErasedSamplePtr(trace_context_id.value());
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    stop_clearing = true;
+    clearing_thread.join();
+    tracing_runtime_.ClearTypeErasedSamplePtrs(service_element_tracing_data);
+
+    // Then all slots are unused
+    for (std::size_t offset = 0U; offset < service_element_tracing_data.number_of_service_element_tracing_slots;
+         ++offset)
+    {
+        const auto trace_context_id = static_cast<impl::tracing::IBindingTracingRuntime::TraceContextId>(
+            service_element_tracing_data.service_element_range_start + offset);
+        EXPECT_FALSE(tracing_runtime_.IsTracingSlotUsed(trace_context_id));
+    }
+
+    // and every sample ptr was destroyed exactly once
+    EXPECT_EQ(number_of_destructions.load(), kNumberOfStressTestThreads * kNumberOfStressTestIterations);
+}
+
 using TracingRuntimeTypeErasedSamplePtrDeathTest = TracingRuntimeTypeErasedSamplePtrFixture;
 TEST_F(TracingRuntimeTypeErasedSamplePtrDeathTest,
        EmplacingTypeErasedSamplePtrBeforeRegisteringServiceElementTerminates)
@@ -17,7 +17,15 @@ namespace score::mw::com::impl::lola
 
 TransactionLog::TransactionLog(const std::size_t number_of_slots,
                                memory::shared::ManagedMemoryResource& resource) noexcept
-    : reference_count_slots_(number_of_slots, resource), subscribe_transactions_{}, subscription_max_sample_count_{}
+    : reference_count_slots_(number_of_slots, resource),
+      subscribe_transactions_{},
+      reference_batch_transaction_{},
+      reference_batch_slots_((number_of_slots + kSlotsPerReferenceBatchWord - 1U) / kSlotsPerReferenceBatchWord,
+                             CopyableAtomic<ReferenceBatchWord>{0U},
+                             resource),
+      transaction_end_sequence_{0U},
+      number_of_transaction_end_waiters_{0U},
+      subscription_max_sample_count_{}
 {
 }
 
@@ -14,11 +14,13 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_H
 
 #include "score/mw/com/impl/bindings/lola/transaction_log_slot.h"
+#include "score/mw/com/impl/util/copyable_atomic.h"
 
 #include "score/containers/dynamic_array.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
 #include <cstdint>
+#include <limits>
 
 namespace score::mw::com::impl::lola
 {
@@ -42,6 +44,13 @@ class TransactionLog
         score::containers::DynamicArray<TransactionLogSlot,
                                         memory::shared::PolymorphicOffsetPtrAllocator<TransactionLogSlot>>;
 
+    using ReferenceBatchWord = std::uint64_t;
+    using ReferenceBatchSlots = score::containers::DynamicArray<
+        CopyableAtomic<ReferenceBatchWord>,
+        memory::shared::PolymorphicOffsetPtrAllocator<CopyableAtomic<ReferenceBatchWord>>>;
+
+    static constexpr std::size_t kSlotsPerReferenceBatchWord{std::numeric_limits<ReferenceBatchWord>::digits};
+
     TransactionLog(const std::size_t number_of_slots, memory::shared::ManagedMemoryResource& resource) noexcept;
 
     /// \brief Vector containing one TransactionLogSlot for each slot in the corresponding control vector.
@@ -50,6 +59,23 @@ class TransactionLog
     /// \brief TransactionLogSlot in shared memory which will record subscribe / unsubscribe transactions.
     TransactionLogSlot subscribe_transactions_;
 
+    /// \brief TransactionLogSlot in shared memory which will record the reference batch transaction of a
+    ///        ConsumerEventDataControlLocalView::ReferenceNextEvents() pass. Only the transaction-begin bit is used.
+    TransactionLogSlot reference_batch_transaction_;
+
+    /// \brief Bitmap with one bit per slot in the corresponding control vector, which is set while the open reference
+    ///        batch transaction intends to reference the slot.
+    ReferenceBatchSlots reference_batch_slots_;
+
+    /// \brief Incremented by a committed dereference transaction, while threads are waiting for the transaction-END bit
+    ///        of a slot to become false. Used as futex word to wake up these threads.
+    ///
+    /// See TransactionLogLocalView::DereferenceTransactionCommit().
+    CopyableAtomic<std::uint32_t> transaction_end_sequence_;
+
+    /// \brief Number of threads waiting for the transaction-END bit of a slot to become false.
+    CopyableAtomic<std::uint32_t> number_of_transaction_end_waiters_;
+
     /// \brief The max sample count used for the recorded subscription transaction.
     ///
     /// This is set in SubscribeTransactionBegin() and used in the UnsubscribeCallback which is called during Rollback()
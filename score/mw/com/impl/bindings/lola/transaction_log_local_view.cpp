@@ -12,39 +12,26 @@
  ********************************************************************************/
 #include "score/mw/com/impl/bindings/lola/transaction_log_local_view.h"
 
-#include <chrono>
-#include <cstdint>
-#include <thread>
-
+#include "score/mw/com/impl/bindings/lola/futex.h"
 #include "score/mw/com/impl/com_error.h"
 
 #include "score/mw/log/logging.h"
 
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+
 namespace score::mw::com::impl::lola
 {
 
 namespace
 {
 
-// Handles race condition between concurrent SamplePtr destruction and creation for the same slot.
-// Thread A may be suspended between decrementing refcount and clearing the transaction-END bit.
-// This allows Thread A to complete its dereference transaction before proceeding.
-void WaitForTransactionEndToBecomeFalse(TransactionLogSlot& slot) noexcept
-{
-    constexpr std::uint8_t kRetryCount = 10U;
-    constexpr std::chrono::milliseconds kRetryInterval(10);
-    for (std::uint8_t retry = 0U; retry < kRetryCount; ++retry)
-    {
-        if (!slot.GetTransactionEnd())
-        {
-            return;
-        }
-        std::this_thread::sleep_for(kRetryInterval);
-    }
-    score::mw::log::LogFatal("lola") << "ReferenceTransactionBegin: Transaction-END bit remains TRUE after "
-                                     << kRetryCount * kRetryInterval.count() << "ms; terminating";
-    std::terminate();
-}
+/// \brief Maximum time to wait for a concurrent dereference transaction to be committed.
+constexpr std::chrono::milliseconds kMaxTransactionEndWaitTime{100};
 
 bool DoesLogContainIncrementOrDecrementTransactions(
     const TransactionLogLocalView::TransactionLogSlotsLocalView& reference_count_slots) noexcept
@@ -66,6 +53,11 @@ TransactionLogLocalView::TransactionLogLocalView(TransactionLog& transaction_log
     : reference_count_slots_local_{transaction_log.reference_count_slots_.data(),
                                    transaction_log.reference_count_slots_.size()},
       subscribe_transactions_{transaction_log.subscribe_transactions_},
+      reference_batch_transaction_{transaction_log.reference_batch_transaction_},
+      reference_batch_slots_local_{transaction_log.reference_batch_slots_.data(),
+                                   transaction_log.reference_batch_slots_.size()},
+      transaction_end_sequence_{transaction_log.transaction_end_sequence_},
+      number_of_transaction_end_waiters_{transaction_log.number_of_transaction_end_waiters_},
       subscription_max_sample_count_{transaction_log.subscription_max_sample_count_}
 {
 }
@@ -169,21 +161,171 @@ void TransactionLogLocalView::DereferenceTransactionCommit(SlotIndexType slot_in
     TransactionLogSlot& slot = reference_count_slots_local_[static_cast<std::size_t>(slot_index)];
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!slot.GetTransactionBegin());
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot.GetTransactionEnd());
-    slot.SetTransactionEnd(false);
+    slot.ClearTransactionEndSeqCst();
+    WakeTransactionEndWaiters();
+}
+
+void TransactionLogLocalView::ReferenceBatchTransactionBegin() noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!reference_batch_transaction_.get().GetTransactionBegin());
+    reference_batch_transaction_.get().SetTransactionBegin(true);
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from 'reference_batch_slots_local_[]' which might leds to a
+// segmentation fault in case the index goes outside the range. As we already do an index check before accessing, so no
+// way for segmentation fault which leds to calling std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+void TransactionLogLocalView::ReferenceBatchTransactionAddSlots(
+    const score::cpp::span<const SlotIndexType> slot_indices) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(reference_batch_transaction_.get().GetTransactionBegin());
+    // The bits are collected per word first, so that each word of the bitmap is only written once.
+    std::size_t word_index{0U};
+    TransactionLog::ReferenceBatchWord word_bits{0U};
+    const auto flush_word_bits = [this, &word_index, &word_bits]() noexcept {
+        if (word_bits != 0U)
+        {
+            score::cpp::ignore = reference_batch_slots_local_[word_index].GetUnderlying().fetch_or(
+                word_bits, std::memory_order_seq_cst);
+            word_bits = 0U;
+        }
+    };
+    for (const auto slot_index : slot_indices)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot_index < reference_count_slots_local_.size());
+        const std::size_t slot_word_index{static_cast<std::size_t>(slot_index) /
+                                          TransactionLog::kSlotsPerReferenceBatchWord};
+        if (slot_word_index != word_index)
+        {
+            flush_word_bits();
+            word_index = slot_word_index;
+        }
+        word_bits |= TransactionLog::ReferenceBatchWord{1U}
+                     << (static_cast<std::size_t>(slot_index) % TransactionLog::kSlotsPerReferenceBatchWord);
+    }
+    flush_word_bits();
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from 'reference_count_slots_local_[]' which might leds to a
+// segmentation fault in case the index goes outside the range. As we already do an index check before accessing, so no
+// way for segmentation fault which leds to calling std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+void TransactionLogLocalView::ReferenceBatchTransactionCommit(
+    const score::cpp::span<const SlotIndexType> referenced_slot_indices) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(reference_batch_transaction_.get().GetTransactionBegin());
+    // The references are recorded before the batch is closed. So a crash in between leaves slots, which are recorded
+    // like after ReferenceTransactionCommit() and are therefore rolled back like any other referenced slot.
+    for (const auto slot_index : referenced_slot_indices)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot_index < reference_count_slots_local_.size());
+        TransactionLogSlot& slot = reference_count_slots_local_[static_cast<std::size_t>(slot_index)];
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!slot.GetTransactionBegin());
+        WaitForTransactionEndToBecomeFalse(slot);
+        slot.SetTransactionBeginAndEnd();
+    }
+    ClearReferenceBatchSlots();
+    reference_batch_transaction_.get().SetTransactionBegin(false);
 }
 
-Result<void> TransactionLogLocalView::RollbackProxyElementLog(const DereferenceSlotCallback& dereference_slot_callback,
-                                                              const UnsubscribeCallback& unsubscribe_callback) noexcept
+void TransactionLogLocalView::ClearReferenceBatchSlots() noexcept
+{
+    for (auto& word : reference_batch_slots_local_)
+    {
+        auto& word_bits = word.GetUnderlying();
+        if (word_bits.load(std::memory_order_seq_cst) != 0U)
+        {
+            word_bits.store(0U, std::memory_order_seq_cst);
+        }
+    }
+}
+
+// Handles race condition between concurrent SamplePtr destruction and creation for the same slot.
+// Thread A may be suspended between decrementing refcount and clearing the transaction-END bit.
+// This allows Thread A to complete its dereference transaction before proceeding.
+void TransactionLogLocalView::WaitForTransactionEndToBecomeFalse(const TransactionLogSlot& slot) noexcept
+{
+    if (!slot.GetTransactionEnd())
+    {
+        return;
+    }
+
+    auto& transaction_end_sequence = transaction_end_sequence_.get().GetUnderlying();
+    auto& number_of_waiters = number_of_transaction_end_waiters_.get().GetUnderlying();
+    // Announcing the waiter before reading the bit again via GetTransactionEndSeqCst() pairs with
+    // DereferenceTransactionCommit(), which clears the bit via ClearTransactionEndSeqCst() before reading the number of
+    // waiters: In the single total order of these seq_cst operations, either we see the cleared bit or the committing
+    // thread sees us and wakes us up.
+    score::cpp::ignore = number_of_waiters.fetch_add(1U, std::memory_order_seq_cst);
+
+    const auto deadline = std::chrono::steady_clock::now() + kMaxTransactionEndWaitTime;
+    bool is_transaction_end_cleared{false};
+    while (true)
+    {
+        const auto observed_sequence = transaction_end_sequence.load(std::memory_order_seq_cst);
+        if (!slot.GetTransactionEndSeqCst())
+        {
+            is_transaction_end_cleared = true;
+            break;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            break;
+        }
+        // The result is ignored, since the transaction-END bit is checked again anyway (EAGAIN: sequence changed
+        // already, ETIMEDOUT, EINTR).
+        score::cpp::ignore = Futex::instance().Wait(transaction_end_sequence, observed_sequence, deadline - now);
+    }
+    score::cpp::ignore = number_of_waiters.fetch_sub(1U, std::memory_order_seq_cst);
+
+    if (!is_transaction_end_cleared)
+    {
+        score::mw::log::LogFatal("lola") << "ReferenceTransactionBegin: Transaction-END bit remains TRUE after "
+                                         << kMaxTransactionEndWaitTime.count() << "ms; terminating";
+        std::terminate();
+    }
+}
+
+void TransactionLogLocalView::WakeTransactionEndWaiters() noexcept
+{
+    // See WaitForTransactionEndToBecomeFalse(). The transaction-END bit has been cleared by
+    // TransactionLogSlot::ClearTransactionEndSeqCst(), so the common case without waiters doesn't need a syscall.
+    if (number_of_transaction_end_waiters_.get().GetUnderlying().load(std::memory_order_seq_cst) == 0U)
+    {
+        return;
+    }
+    auto& transaction_end_sequence = transaction_end_sequence_.get().GetUnderlying();
+    score::cpp::ignore = transaction_end_sequence.fetch_add(1U, std::memory_order_seq_cst);
+    score::cpp::ignore = Futex::instance().WakeAll(transaction_end_sequence);
+}
+
+Result<void> TransactionLogLocalView::RollbackProxyElementLog(
+    const DereferenceSlotCallback& dereference_slot_callback,
+    const IsSlotReferencedCallback& is_slot_referenced_callback,
+    const UnsubscribeCallback& unsubscribe_callback) noexcept
 {
     const bool was_no_subscribe_recorded{!subscribe_transactions_.get().GetTransactionBegin() &&
                                          !subscribe_transactions_.get().GetTransactionEnd()};
     if (was_no_subscribe_recorded)
     {
         SCORE_LANGUAGE_FUTURECPP_PRECONDITION_MESSAGE(
-            !DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_),
+            !DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_) &&
+                !reference_batch_transaction_.get().GetTransactionBegin(),
             "All slot increment transactions should be reversed before calling unsubscribe");
     }
 
+    // A crashed reference batch transaction is settled first, since its commit might have recorded some of its slots
+    // already, which are then rolled back by RollbackIncrementTransactions().
+    const auto rollback_reference_batch_transaction_result =
+        RollbackReferenceBatchTransaction(is_slot_referenced_callback);
+    if (!rollback_reference_batch_transaction_result.has_value())
+    {
+        return rollback_reference_batch_transaction_result;
+    }
+
     const auto rollback_increment_transactions_result = RollbackIncrementTransactions(dereference_slot_callback);
     if (!rollback_increment_transactions_result.has_value())
     {
@@ -201,6 +343,49 @@ Result<void> TransactionLogLocalView::RollbackSkeletonTracingElementLog(
     return rollback_increment_transactions_result;
 }
 
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from 'reference_count_slots_local_[]' which might leds to a
+// segmentation fault in case the index goes outside the range. The slot index is limited by the number of slots, so no
+// way for segmentation fault which leds to calling std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+Result<void> TransactionLogLocalView::RollbackReferenceBatchTransaction(
+    const IsSlotReferencedCallback& is_slot_referenced_callback) noexcept
+{
+    if (!reference_batch_transaction_.get().GetTransactionBegin())
+    {
+        return {};
+    }
+
+    for (std::size_t word_index = 0U; word_index < reference_batch_slots_local_.size(); ++word_index)
+    {
+        auto word_bits = reference_batch_slots_local_[word_index].GetUnderlying().load(std::memory_order_seq_cst);
+        while (word_bits != 0U)
+        {
+            // word_bits is non-zero, for which the result of __builtin_ctzll() is defined
+            const auto bit_index = static_cast<std::size_t>(__builtin_ctzll(word_bits));
+            word_bits &= word_bits - 1U;
+            const auto slot_idx =
+                static_cast<SlotIndexType>((word_index * TransactionLog::kSlotsPerReferenceBatchWord) + bit_index);
+            const TransactionLogSlot& slot = reference_count_slots_local_[static_cast<std::size_t>(slot_idx)];
+
+            // The commit recorded the reference of this slot already.
+            const bool was_slot_reference_recorded{slot.GetTransactionBegin() && slot.GetTransactionEnd()};
+            // The crashed consumer can only have incremented the slot, if the slot is still referenced.
+            if ((!was_slot_reference_recorded) && is_slot_referenced_callback(slot_idx))
+            {
+                score::mw::log::LogError("lola")
+                    << "Could not rollback transaction log as previous service element crashed while "
+                       "referencing control slots in a batch and a slot of the batch is still referenced.";
+                return MakeUnexpected(ComErrc::kCouldNotRestartProxy);
+            }
+        }
+    }
+
+    ClearReferenceBatchSlots();
+    reference_batch_transaction_.get().SetTransactionBegin(false);
+    return {};
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". std::terminate() is implicitly called from 'reference_count_slots_local_.at()' which might throw
 // std::out_of_range As we already do an index check before accessing, so no way for throwing std::out_of_rang which
@@ -274,7 +459,7 @@ bool TransactionLogLocalView::ContainsTransactions() const noexcept
 {
     const bool contains_subscribe_transaction =
         subscribe_transactions_.get().GetTransactionBegin() || subscribe_transactions_.get().GetTransactionEnd();
-    return contains_subscribe_transaction ||
+    return contains_subscribe_transaction || reference_batch_transaction_.get().GetTransactionBegin() ||
            DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_);
 }
 
@@ -16,6 +16,7 @@
 #include "score/mw/com/impl/bindings/lola/control_slot_types.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_slot.h"
+#include "score/mw/com/impl/util/copyable_atomic.h"
 
 #include "score/memory/shared/memory_resource_proxy.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
@@ -25,6 +26,7 @@
 #include <score/span.hpp>
 
 #include <cstdint>
+#include <functional>
 
 namespace score::mw::com::impl::lola
 {
@@ -43,6 +45,9 @@ class TransactionLogLocalView
     using DereferenceSlotCallback = score::cpp::callback<void(TransactionLog::SlotIndexType slot_index)>;
     using UnsubscribeCallback =
         score::cpp::callback<void(TransactionLog::MaxSampleCountType subscription_max_sample_count)>;
+    /// \brief Returns whether the slot with the provided index is currently referenced by any consumer, i.e. whether
+    ///        its reference count in EventDataControl is not zero.
+    using IsSlotReferencedCallback = score::cpp::callback<bool(TransactionLog::SlotIndexType slot_index)>;
 
     TransactionLogLocalView(TransactionLog& transaction_log) noexcept;
 
@@ -64,6 +69,12 @@ class TransactionLogLocalView
     void UnsubscribeTransactionBegin() noexcept;
     void UnsubscribeTransactionCommit() noexcept;
 
+    /// \brief Record Reference / Dereference transactions
+    ///
+    /// Another thread of the same consumer may still be in the middle of a dereference transaction of the slot (i.e.
+    /// the transaction-END bit is still set). In this case, the Reference functions block until the other thread
+    /// clears the bit in DereferenceTransactionCommit() and wakes them up. If this doesn't happen within a bounded
+    /// time, the process is terminated.
     void ReferenceTransactionBegin(SlotIndexType slot_index) noexcept;
     void ReferenceTransactionCommit(SlotIndexType slot_index) noexcept;
     void ReferenceTransactionAbort(SlotIndexType slot_index) noexcept;
@@ -71,16 +82,41 @@ class TransactionLogLocalView
     void DereferenceTransactionBegin(SlotIndexType slot_index) noexcept;
     void DereferenceTransactionCommit(SlotIndexType slot_index) noexcept;
 
+    /// \brief Record a reference batch transaction, which references multiple slots at once
+    ///
+    /// It is used by a pass of ConsumerEventDataControlLocalView::ReferenceNextEvents(). The expected sequence is as
+    /// follows:
+    /// ReferenceBatchTransactionBegin:     batch Begin -> true
+    /// ReferenceBatchTransactionAddSlots:  the slots, which are going to be referenced, are marked in the batch bitmap
+    ///                                     (may be called multiple times)
+    /// (the reference counts of the marked slots are incremented without recording anything)
+    /// ReferenceBatchTransactionCommit:    Begin -> true, End -> true for each referenced slot (i.e. the state after
+    ///                                     ReferenceTransactionCommit()), batch bitmap cleared, batch Begin -> false
+    ///
+    /// The referenced slots are dereferenced one by one via DereferenceTransactionBegin() / Commit(). If the consumer
+    /// crashes while the batch is open, the rollback settles each marked slot by its reference count, see
+    /// RollbackProxyElementLog().
+    void ReferenceBatchTransactionBegin() noexcept;
+    void ReferenceBatchTransactionAddSlots(const score::cpp::span<const SlotIndexType> slot_indices) noexcept;
+    void ReferenceBatchTransactionCommit(const score::cpp::span<const SlotIndexType> referenced_slot_indices) noexcept;
+
     /// \brief Rollback all previous increments and subscriptions that were recorded in the transaction log.
     /// \param dereference_slot_callback Callback which will decrement the slot in EventDataControl with the provided
     ///        index.
+    /// \param is_slot_referenced_callback Callback which checks the reference count of the slot in EventDataControl
+    ///        with the provided index.
     /// \param unsubscribe_callback Callback which will perform the unsubscribe with the stored
     ///        subscription_max_sample_count_.
     ///
     /// This function should be called when trying to create a Proxy service element that had previously crashed. It
     /// will decrement all reference counts that the old Proxy had incremented in the EventDataControl which were
     /// recorded in this TransactionLog.
+    /// If the old Proxy crashed within a reference batch transaction, the log doesn't tell, which of the slots marked
+    /// in the batch have been incremented already. A marked slot, which isn't referenced by anybody, can't have been
+    /// incremented and is therefore settled. A marked slot, which is still referenced, can't be attributed to the old
+    /// Proxy, so the rollback fails like for a crash within a single reference transaction.
     Result<void> RollbackProxyElementLog(const DereferenceSlotCallback& dereference_slot_callback,
+                                         const IsSlotReferencedCallback& is_slot_referenced_callback,
                                          const UnsubscribeCallback& unsubscribe_callback) noexcept;
 
     /// \brief Rollback all previous increments that were recorded in the transaction log.
@@ -98,6 +134,16 @@ class TransactionLogLocalView
     bool ContainsTransactions() const noexcept;
 
   private:
+    /// \brief Blocks until the transaction-END bit of the given slot is false (see DereferenceTransactionCommit()).
+    void WaitForTransactionEndToBecomeFalse(const TransactionLogSlot& slot) noexcept;
+
+    /// \brief Wakes up the threads blocked in WaitForTransactionEndToBecomeFalse(), if there are any.
+    void WakeTransactionEndWaiters() noexcept;
+
+    void ClearReferenceBatchSlots() noexcept;
+
+    Result<void> RollbackReferenceBatchTransaction(
+        const IsSlotReferencedCallback& is_slot_referenced_callback) noexcept;
     Result<void> RollbackIncrementTransactions(const DereferenceSlotCallback& dereference_slot_callback) noexcept;
     Result<void> RollbackSubscribeTransactions(const UnsubscribeCallback& unsubscribe_callback) noexcept;
 
@@ -108,6 +154,19 @@ class TransactionLogLocalView
     /// \brief TransactionLogSlot in shared memory which will record subscribe / unsubscribe transactions.
     std::reference_wrapper<TransactionLogSlot> subscribe_transactions_;
 
+    /// \brief TransactionLogSlot in shared memory which will record the reference batch transaction.
+    std::reference_wrapper<TransactionLogSlot> reference_batch_transaction_;
+
+    /// \brief View pointing to the DynamicArray containing the bitmap of the slots marked in the reference batch
+    ///        transaction.
+    score::cpp::span<TransactionLog::ReferenceBatchSlots::value_type> reference_batch_slots_local_;
+
+    /// \brief Futex word in shared memory, which is incremented to wake up threads waiting for a transaction-END bit.
+    std::reference_wrapper<CopyableAtomic<std::uint32_t>> transaction_end_sequence_;
+
+    /// \brief Number of threads waiting for a transaction-END bit in shared memory.
+    std::reference_wrapper<CopyableAtomic<std::uint32_t>> number_of_transaction_end_waiters_;
+
     /// \brief The max sample count used for the recorded subscription transaction.
     ///
     /// This is set in SubscribeTransactionBegin() and used in the UnsubscribeCallback which is called during Rollback()
@@ -10,21 +10,36 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/futex_mock.h"
 #include "score/mw/com/impl/bindings/lola/test/transaction_log_test_resources.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log.h"
+#include "score/mw/com/impl/com_error.h"
 
 #include "score/memory/shared/shared_memory_resource_heap_allocator_mock.h"
+#include "score/os/ObjectSeam.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
 namespace score::mw::com::impl::lola
 {
 namespace
 {
 
 using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
 using ::testing::MockFunction;
+using ::testing::Return;
 using ::testing::StrictMock;
 
 const std::size_t kNumberOfSlots{5U};
@@ -45,6 +60,15 @@ class TransactionLogLocalViewFixture : public ::testing::Test
         };
     }
 
+    TransactionLogLocalView::IsSlotReferencedCallback GetIsSlotReferencedCallbackWrapper() noexcept
+    {
+        // Since a MockFunction doesn't fit within an score::cpp::callback, we wrap it in a smaller lambda which only
+        // stores a pointer to the MockFunction and therefore fits within the score::cpp::callback.
+        return [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+            return is_slot_referenced_callback_.AsStdFunction()(slot_index);
+        };
+    }
+
     TransactionLogLocalView::DereferenceSlotCallback GetUnsubscribeCallbackWrapper() noexcept
     {
         // Since a MockFunction doesn't fit within an score::cpp::callback, we wrap it in a smaller lambda which only
@@ -59,6 +83,7 @@ class TransactionLogLocalViewFixture : public ::testing::Test
     TransactionLogLocalView unit_{transaction_log_};
 
     StrictMock<MockFunction<void(TransactionLog::SlotIndexType)>> dereference_slot_callback_{};
+    StrictMock<MockFunction<bool(TransactionLog::SlotIndexType)>> is_slot_referenced_callback_{};
     StrictMock<MockFunction<void(TransactionLog::MaxSampleCountType)>> unsubscribe_callback_{};
 };
 
@@ -106,8 +131,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillNotCallCallbackWhenNoTrans
     // When no transactions are recorded
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -132,8 +157,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillNotCallCallbackWhenOnlySub
     unit_.UnsubscribeTransactionCommit();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -167,8 +192,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillNotCallCallbackAfterDerefe
     unit_.UnsubscribeTransactionCommit();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -197,8 +222,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillNotCallCallbackIfReferenci
     unit_.UnsubscribeTransactionCommit();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -217,8 +242,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillNotCallCallbackIfSubscribe
     unit_.SubscribeTransactionAbort();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -248,15 +273,15 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillCallBothCallbacksAfterRefe
     unit_.ReferenceTransactionCommit(kSlotIndex1);
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
 
     // and when rollback is called again, then the slots should have already been derefenced so it should do nothing
-    const auto rollback_result_2 =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
     EXPECT_TRUE(rollback_result_2.has_value());
 }
 
@@ -286,8 +311,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillCallUnsubscribeCallbackAft
     unit_.DereferenceTransactionCommit(kSlotIndex1);
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -319,8 +344,8 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillCallUnsubscribeCallbackWit
     unit_.SubscribeTransactionCommit();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will not contain an error
     EXPECT_TRUE(rollback_result.has_value());
@@ -344,15 +369,15 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillReturnErrorIfReferenceTran
     unit_.ReferenceTransactionBegin(kSlotIndex1);
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will contain an error
     EXPECT_FALSE(rollback_result.has_value());
 
     // and when rollback is called again, then an error should still be returned
-    const auto rollback_result_2 =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
     EXPECT_FALSE(rollback_result_2.has_value());
 }
 
@@ -379,15 +404,15 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillReturnErrorIfDereferenceTr
     unit_.DereferenceTransactionBegin(kSlotIndex1);
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will contain an error
     EXPECT_FALSE(rollback_result.has_value());
 
     // and when rollback is called again, then an error should still be returned
-    const auto rollback_result_2 =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
     EXPECT_FALSE(rollback_result_2.has_value());
 }
 
@@ -412,15 +437,15 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillReturnErrorIfSubscribeTran
     unit_.ReferenceTransactionCommit(kSlotIndex1);
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will contain an error
     EXPECT_FALSE(rollback_result.has_value());
 
     // and when rollback is called again, then an error should still be returned
-    const auto rollback_result_2 =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
     EXPECT_FALSE(rollback_result_2.has_value());
 }
 
@@ -449,15 +474,15 @@ TEST_F(TransactionLogProxyElementFixture, RollbackWillReturnErrorIfUnsubscribeTr
     unit_.UnsubscribeTransactionBegin();
 
     // and when rollback is called
-    const auto rollback_result =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
 
     // Then the result will contain an error
     EXPECT_FALSE(rollback_result.has_value());
 
     // and when rollback is called again, then an error should still be returned
-    const auto rollback_result_2 =
-        unit_.RollbackProxyElementLog(GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
     EXPECT_FALSE(rollback_result_2.has_value());
 }
 
@@ -722,6 +747,313 @@ TEST_F(TransactionLogContainsTransactionsReferenceFixture, ReturnsFalseWhenDeref
     EXPECT_FALSE(unit_.ContainsTransactions());
 }
 
+TEST_F(TransactionLogContainsTransactionsReferenceFixture, ReturnsTrueWhenReferenceBatchTransactionBeginRecorded)
+{
+    // Given a valid TransactionLog which has recorded a ReferenceBatchTransactionBegin
+    unit_.ReferenceBatchTransactionBegin();
+
+    // When calling ContainsTransactions
+    // Then the result should be true
+    EXPECT_TRUE(unit_.ContainsTransactions());
+}
+
+TEST_F(TransactionLogContainsTransactionsReferenceFixture, ReturnsFalseWhenEmptyReferenceBatchTransactionCommitRecorded)
+{
+    // Given a valid TransactionLog which has recorded a reference batch transaction, which didn't reference any slot
+    const std::array<SlotIndexType, 2U> marked_slots{kSlotIndex0, kSlotIndex1};
+    unit_.ReferenceBatchTransactionBegin();
+    unit_.ReferenceBatchTransactionAddSlots(marked_slots);
+    unit_.ReferenceBatchTransactionCommit({});
+
+    // When calling ContainsTransactions
+    // Then the result should be false
+    EXPECT_FALSE(unit_.ContainsTransactions());
+}
+
+using TransactionLogReferenceBatchFixture = TransactionLogLocalViewFixture;
+TEST_F(TransactionLogReferenceBatchFixture, CommitRecordsReferencedSlotsLikeSingleReferenceTransactions)
+{
+    // Given a reference batch transaction, which marked two slots
+    const std::array<SlotIndexType, 2U> marked_slots{kSlotIndex0, kSlotIndex1};
+    unit_.ReferenceBatchTransactionBegin();
+    unit_.ReferenceBatchTransactionAddSlots(marked_slots);
+
+    // When committing it after only the second slot has been referenced
+    const std::array<SlotIndexType, 1U> referenced_slots{kSlotIndex1};
+    unit_.ReferenceBatchTransactionCommit(referenced_slots);
+
+    // Then only the reference of the second slot is recorded, like by a committed reference transaction
+    EXPECT_FALSE(transaction_log_.reference_count_slots_.at(kSlotIndex0).GetTransactionBegin());
+    EXPECT_FALSE(transaction_log_.reference_count_slots_.at(kSlotIndex0).GetTransactionEnd());
+    EXPECT_TRUE(transaction_log_.reference_count_slots_.at(kSlotIndex1).GetTransactionBegin());
+    EXPECT_TRUE(transaction_log_.reference_count_slots_.at(kSlotIndex1).GetTransactionEnd());
+
+    // and the batch is closed and its bitmap cleared
+    EXPECT_FALSE(transaction_log_.reference_batch_transaction_.GetTransactionBegin());
+    for (const auto& word : transaction_log_.reference_batch_slots_)
+    {
+        EXPECT_EQ(word.GetUnderlying().load(), 0U);
+    }
+
+    // and the slot can be dereferenced like any other referenced slot
+    unit_.DereferenceTransactionBegin(kSlotIndex1);
+    unit_.DereferenceTransactionCommit(kSlotIndex1);
+    EXPECT_FALSE(unit_.ContainsTransactions());
+}
+
+TEST_F(TransactionLogReferenceBatchFixture, AddSlotsMarksTheSlotsInTheBitmap)
+{
+    // Given an open reference batch transaction
+    unit_.ReferenceBatchTransactionBegin();
+
+    // When marking two slots in two calls
+    const std::array<SlotIndexType, 1U> first_slots{kSlotIndex1};
+    const std::array<SlotIndexType, 1U> second_slots{kSlotIndex0};
+    unit_.ReferenceBatchTransactionAddSlots(first_slots);
+    unit_.ReferenceBatchTransactionAddSlots(second_slots);
+
+    // Then both slots are marked
+    EXPECT_EQ(transaction_log_.reference_batch_slots_.at(0U).GetUnderlying().load(),
+              (TransactionLog::ReferenceBatchWord{1U} << kSlotIndex0) |
+                  (TransactionLog::ReferenceBatchWord{1U} << kSlotIndex1));
+}
+
+TEST_F(TransactionLogReferenceBatchFixture, RollbackSettlesMarkedSlotsWhichAreNotReferenced)
+{
+    // Given a recorded subscription
+    unit_.SubscribeTransactionBegin(kSubscriptionMaxSampleCount);
+    unit_.SubscribeTransactionCommit();
+
+    // and a reference batch transaction, which marked two slots, but crashed before incrementing any of them
+    const std::array<SlotIndexType, 2U> marked_slots{kSlotIndex0, kSlotIndex1};
+    unit_.ReferenceBatchTransactionBegin();
+    unit_.ReferenceBatchTransactionAddSlots(marked_slots);
+
+    // Expecting that the reference count of both slots is checked and neither slot is referenced
+    EXPECT_CALL(is_slot_referenced_callback_, Call(kSlotIndex0)).WillOnce(Return(false));
+    EXPECT_CALL(is_slot_referenced_callback_, Call(kSlotIndex1)).WillOnce(Return(false));
+
+    // and that no slot is dereferenced, but the subscription is rolled back
+    EXPECT_CALL(dereference_slot_callback_, Call(_)).Times(0);
+    EXPECT_CALL(unsubscribe_callback_, Call(kSubscriptionMaxSampleCount));
+
+    // When rollback is called
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+
+    // Then the result will not contain an error
+    EXPECT_TRUE(rollback_result.has_value());
+
+    // and the log doesn't contain any transactions anymore
+    EXPECT_FALSE(unit_.ContainsTransactions());
+}
+
+TEST_F(TransactionLogReferenceBatchFixture, RollbackWillReturnErrorIfAMarkedSlotIsStillReferenced)
+{
+    // Given a recorded subscription
+    unit_.SubscribeTransactionBegin(kSubscriptionMaxSampleCount);
+    unit_.SubscribeTransactionCommit();
+
+    // and a reference batch transaction, which marked a slot and crashed before committing
+    const std::array<SlotIndexType, 1U> marked_slots{kSlotIndex1};
+    unit_.ReferenceBatchTransactionBegin();
+    unit_.ReferenceBatchTransactionAddSlots(marked_slots);
+
+    // Expecting that the marked slot is still referenced, i.e. it might have been incremented by the crashed consumer
+    EXPECT_CALL(is_slot_referenced_callback_, Call(kSlotIndex1)).WillRepeatedly(Return(true));
+
+    // and that neither the slot is dereferenced nor the subscription is rolled back
+    EXPECT_CALL(dereference_slot_callback_, Call(_)).Times(0);
+    EXPECT_CALL(unsubscribe_callback_, Call(_)).Times(0);
+
+    // When rollback is called
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+
+    // Then the result will contain an error
+    ASSERT_FALSE(rollback_result.has_value());
+    EXPECT_EQ(rollback_result.error(), ComErrc::kCouldNotRestartProxy);
+
+    // and the batch is kept, so that another rollback fails as well
+    EXPECT_TRUE(transaction_log_.reference_batch_transaction_.GetTransactionBegin());
+    const auto rollback_result_2 = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    EXPECT_FALSE(rollback_result_2.has_value());
+}
+
+TEST_F(TransactionLogReferenceBatchFixture, RollbackDereferencesTheSlotsRecordedByAnInterruptedCommit)
+{
+    // Given a recorded subscription
+    unit_.SubscribeTransactionBegin(kSubscriptionMaxSampleCount);
+    unit_.SubscribeTransactionCommit();
+
+    // and a reference batch transaction, which marked two slots and only referenced the first one
+    const std::array<SlotIndexType, 2U> marked_slots{kSlotIndex0, kSlotIndex1};
+    unit_.ReferenceBatchTransactionBegin();
+    unit_.ReferenceBatchTransactionAddSlots(marked_slots);
+
+    // and which crashed within the commit after recording the reference of the first slot
+    transaction_log_.reference_count_slots_.at(kSlotIndex0).SetTransactionBeginAndEnd();
+
+    // Expecting that only the reference count of the second slot is checked, which isn't referenced
+    EXPECT_CALL(is_slot_referenced_callback_, Call(kSlotIndex1)).WillOnce(Return(false));
+
+    // and that the first slot is dereferenced and the subscription is rolled back
+    EXPECT_CALL(dereference_slot_callback_, Call(kSlotIndex0));
+    EXPECT_CALL(unsubscribe_callback_, Call(kSubscriptionMaxSampleCount));
+
+    // When rollback is called
+    const auto rollback_result = unit_.RollbackProxyElementLog(
+        GetDereferenceSlotCallbackWrapper(), GetIsSlotReferencedCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+
+    // Then the result will not contain an error
+    EXPECT_TRUE(rollback_result.has_value());
+    EXPECT_FALSE(unit_.ContainsTransactions());
+}
+
+TEST(TransactionLogReferenceCrashTest, RollbackOnlyFailsWhileASingleSlotIsBeingReferenced)
+{
+    // Given the steps of a consumer referencing two slots, in which the increment of a slot's refcount in
+    // EventDataControl is simulated by incrementing the respective element of reference_counts
+    std::array<std::uint32_t, kNumberOfSlots> reference_counts{};
+    const std::vector<std::function<void(TransactionLogLocalView&)>> steps{
+        [](TransactionLogLocalView& log) {
+            log.ReferenceTransactionBegin(kSlotIndex0);
+        },
+        [&reference_counts](TransactionLogLocalView&) {
+            reference_counts.at(kSlotIndex0)++;
+        },
+        [](TransactionLogLocalView& log) {
+            log.ReferenceTransactionCommit(kSlotIndex0);
+        },
+        [](TransactionLogLocalView& log) {
+            log.ReferenceTransactionBegin(kSlotIndex1);
+        },
+        [&reference_counts](TransactionLogLocalView&) {
+            reference_counts.at(kSlotIndex1)++;
+        },
+        [](TransactionLogLocalView& log) {
+            log.ReferenceTransactionCommit(kSlotIndex1);
+        },
+    };
+
+    for (std::size_t number_of_executed_steps = 0U; number_of_executed_steps <= steps.size();
+         ++number_of_executed_steps)
+    {
+        reference_counts.fill(0U);
+        memory::shared::SharedMemoryResourceHeapAllocatorMock memory_resource{1U};
+        TransactionLog transaction_log{kNumberOfSlots, memory_resource};
+        TransactionLogLocalView unit{transaction_log};
+
+        // When the consumer crashes after executing the given number of steps
+        for (std::size_t step = 0U; step < number_of_executed_steps; ++step)
+        {
+            steps.at(step)(unit);
+        }
+
+        // and the log is rolled back by the restarted consumer
+        const auto rollback_result = unit.RollbackSkeletonTracingElementLog(
+            [&reference_counts](const TransactionLog::SlotIndexType slot_index) noexcept {
+                reference_counts.at(slot_index)--;
+            });
+
+        // Then the rollback only fails, if the consumer crashed between beginning and committing the reference
+        // transaction of a slot
+        const bool is_slot_being_referenced{(number_of_executed_steps % 3U) != 0U};
+        EXPECT_EQ(rollback_result.has_value(), !is_slot_being_referenced)
+            << "executed steps: " << number_of_executed_steps;
+
+        // and otherwise no slot is referenced afterwards, i.e. no reference was leaked and no slot was dereferenced
+        // twice
+        if (rollback_result.has_value())
+        {
+            for (const auto reference_count : reference_counts)
+            {
+                EXPECT_EQ(reference_count, 0U) << "executed steps: " << number_of_executed_steps;
+            }
+            EXPECT_FALSE(unit.ContainsTransactions());
+        }
+    }
+}
+
+TEST(TransactionLogReferenceCrashTest, RollbackOfABatchOnlyFailsWhileAnIncrementedSlotIsNotRecorded)
+{
+    // Given the steps of a consumer referencing two slots within a reference batch transaction, in which the increment
+    // of a slot's refcount in EventDataControl is simulated by incrementing the respective element of reference_counts
+    std::array<std::uint32_t, kNumberOfSlots> reference_counts{};
+    const std::array<SlotIndexType, 2U> marked_slots{kSlotIndex0, kSlotIndex1};
+    const std::vector<std::function<void(TransactionLogLocalView&)>> steps{
+        [](TransactionLogLocalView& log) {
+            log.ReferenceBatchTransactionBegin();
+        },
+        [&marked_slots](TransactionLogLocalView& log) {
+            log.ReferenceBatchTransactionAddSlots(marked_slots);
+        },
+        [&reference_counts](TransactionLogLocalView&) {
+            reference_counts.at(kSlotIndex0)++;
+        },
+        [&reference_counts](TransactionLogLocalView&) {
+            reference_counts.at(kSlotIndex1)++;
+        },
+        [&marked_slots](TransactionLogLocalView& log) {
+            log.ReferenceBatchTransactionCommit(marked_slots);
+        },
+    };
+    constexpr std::size_t kFirstIncrementStep{2U};
+    constexpr std::size_t kCommitStep{4U};
+
+    for (std::size_t number_of_executed_steps = 0U; number_of_executed_steps <= steps.size();
+         ++number_of_executed_steps)
+    {
+        reference_counts.fill(0U);
+        memory::shared::SharedMemoryResourceHeapAllocatorMock memory_resource{1U};
+        TransactionLog transaction_log{kNumberOfSlots, memory_resource};
+        TransactionLogLocalView unit{transaction_log};
+        unit.SubscribeTransactionBegin(kSubscriptionMaxSampleCount);
+        unit.SubscribeTransactionCommit();
+
+        // When the consumer crashes after executing the given number of steps
+        for (std::size_t step = 0U; step < number_of_executed_steps; ++step)
+        {
+            steps.at(step)(unit);
+        }
+        const auto reference_counts_at_crash = reference_counts;
+
+        // and the log is rolled back by the restarted consumer, which settles the marked slots by their refcount
+        const auto rollback_result = unit.RollbackProxyElementLog(
+            [&reference_counts](const TransactionLog::SlotIndexType slot_index) noexcept {
+                reference_counts.at(slot_index)--;
+            },
+            [&reference_counts](const TransactionLog::SlotIndexType slot_index) noexcept {
+                return reference_counts.at(slot_index) != 0U;
+            },
+            [](const TransactionLog::MaxSampleCountType) noexcept {});
+
+        // Then the rollback only fails, if the consumer crashed after incrementing a slot, but before committing the
+        // batch
+        const bool is_incremented_slot_unrecorded{(number_of_executed_steps > kFirstIncrementStep) &&
+                                                  (number_of_executed_steps <= kCommitStep)};
+        EXPECT_EQ(rollback_result.has_value(), !is_incremented_slot_unrecorded)
+            << "executed steps: " << number_of_executed_steps;
+
+        if (rollback_result.has_value())
+        {
+            // and otherwise no slot is referenced afterwards, i.e. no reference was leaked and no slot was
+            // dereferenced twice
+            for (const auto reference_count : reference_counts)
+            {
+                EXPECT_EQ(reference_count, 0U) << "executed steps: " << number_of_executed_steps;
+            }
+            EXPECT_FALSE(unit.ContainsTransactions());
+        }
+        else
+        {
+            // and a failed rollback doesn't dereference any slot
+            EXPECT_EQ(reference_counts, reference_counts_at_crash) << "executed steps: " << number_of_executed_steps;
+        }
+    }
+}
+
 // Test for boundary condition: ReferenceTransactionBegin should retry and terminate
 // when transaction-END bit remains TRUE after max retries (indicating stuck dereference thread).
 class ReferenceTransactionBoundaryConditionFixture : public TransactionLogLocalViewFixture
@@ -755,5 +1087,138 @@ TEST_F(ReferenceTransactionBoundaryConditionFixture, ReferenceTransactionBeginSu
     EXPECT_TRUE(slot.GetTransactionBegin());
 }
 
+TEST_F(ReferenceTransactionBoundaryConditionFixture, ReferenceTransactionBeginWaitsForConcurrentDereferenceCommit)
+{
+    // Given a TransactionLog with a slot, which is dereferenced by another thread, which has not committed the
+    // dereference transaction yet
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+    unit_.DereferenceTransactionBegin(kSlotIndex0);
+
+    // When ReferenceTransactionBegin is called for the slot
+    std::atomic<bool> is_reference_transaction_begun{false};
+    std::thread referencing_thread{[this, &is_reference_transaction_begun]() {
+        unit_.ReferenceTransactionBegin(kSlotIndex0);
+        is_reference_transaction_begun = true;
+    }};
+
+    // Then it doesn't return before the dereference transaction is committed
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    EXPECT_FALSE(is_reference_transaction_begun);
+
+    // and when the dereference transaction is committed
+    unit_.DereferenceTransactionCommit(kSlotIndex0);
+
+    // Then ReferenceTransactionBegin returns and sets TransactionBegin
+    referencing_thread.join();
+    EXPECT_TRUE(is_reference_transaction_begun);
+    const auto& slot = transaction_log_.reference_count_slots_.at(static_cast<std::size_t>(kSlotIndex0));
+    EXPECT_TRUE(slot.GetTransactionBegin());
+    EXPECT_FALSE(slot.GetTransactionEnd());
+
+    // and no thread is waiting anymore
+    EXPECT_EQ(transaction_log_.number_of_transaction_end_waiters_.GetUnderlying().load(), 0U);
+}
+
+TEST_F(ReferenceTransactionBoundaryConditionFixture, DereferenceTransactionCommitWithoutWaitersDoesNotWakeAnybody)
+{
+    // Given a TransactionLog with a referenced slot
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+
+    // When the slot is dereferenced while nobody waits for the transaction-END bit
+    unit_.DereferenceTransactionBegin(kSlotIndex0);
+    unit_.DereferenceTransactionCommit(kSlotIndex0);
+
+    // Then the futex word is not changed
+    EXPECT_EQ(transaction_log_.transaction_end_sequence_.GetUnderlying().load(), 0U);
+}
+
+class ReferenceTransactionFutexFixture : public TransactionLogLocalViewFixture
+{
+  protected:
+    void GivenASlotWhichIsBeingDereferenced() noexcept
+    {
+        unit_.ReferenceTransactionBegin(kSlotIndex0);
+        unit_.ReferenceTransactionCommit(kSlotIndex0);
+        unit_.DereferenceTransactionBegin(kSlotIndex0);
+    }
+
+    std::atomic<std::uint32_t>& GetFutexWord() noexcept
+    {
+        return transaction_log_.transaction_end_sequence_.GetUnderlying();
+    }
+
+    os::MockGuard<StrictMock<FutexMock>> futex_mock_{};
+};
+
+TEST_F(ReferenceTransactionFutexFixture, ReferenceTransactionBeginWaitsOnFutexUntilDereferenceIsCommitted)
+{
+    // Given a slot, which is dereferenced by another thread, which has not committed the dereference transaction yet
+    GivenASlotWhichIsBeingDereferenced();
+
+    // Expecting that ReferenceTransactionBegin waits on the futex word with the observed sequence, while the other
+    // thread commits the dereference transaction, which wakes up the waiter
+    InSequence sequence{};
+    EXPECT_CALL(*futex_mock_, Wait(::testing::Ref(GetFutexWord()), 0U, _))
+        .WillOnce(Invoke([this](auto&, auto, auto) noexcept -> score::cpp::expected_blank<os::Error> {
+            unit_.DereferenceTransactionCommit(kSlotIndex0);
+            return {};
+        }));
+    EXPECT_CALL(*futex_mock_, WakeAll(::testing::Ref(GetFutexWord()))).WillOnce(Return(score::cpp::blank{}));
+
+    // When ReferenceTransactionBegin is called for the slot
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+
+    // Then TransactionBegin is set after the transaction-END bit has been cleared
+    const auto& slot = transaction_log_.reference_count_slots_.at(static_cast<std::size_t>(kSlotIndex0));
+    EXPECT_TRUE(slot.GetTransactionBegin());
+    EXPECT_FALSE(slot.GetTransactionEnd());
+
+    // and the futex word has been incremented and no thread is waiting anymore
+    EXPECT_EQ(GetFutexWord().load(), 1U);
+    EXPECT_EQ(transaction_log_.number_of_transaction_end_waiters_.GetUnderlying().load(), 0U);
+}
+
+TEST_F(ReferenceTransactionFutexFixture, ReferenceTransactionBeginChecksTransactionEndAgainWhenFutexWaitFails)
+{
+    // Given a slot, which is dereferenced by another thread, which has not committed the dereference transaction yet
+    GivenASlotWhichIsBeingDereferenced();
+
+    // Expecting that ReferenceTransactionBegin waits again after the futex wait got interrupted, until the other thread
+    // commits the dereference transaction
+    InSequence sequence{};
+    EXPECT_CALL(*futex_mock_, Wait(::testing::Ref(GetFutexWord()), 0U, _))
+        .WillOnce(Return(score::cpp::make_unexpected(os::Error::createFromErrno(EINTR))))
+        .WillOnce(Invoke([this](auto&, auto, auto) noexcept -> score::cpp::expected_blank<os::Error> {
+            unit_.DereferenceTransactionCommit(kSlotIndex0);
+            return {};
+        }));
+    EXPECT_CALL(*futex_mock_, WakeAll(::testing::Ref(GetFutexWord()))).WillOnce(Return(score::cpp::blank{}));
+
+    // When ReferenceTransactionBegin is called for the slot
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+
+    // Then TransactionBegin is set
+    const auto& slot = transaction_log_.reference_count_slots_.at(static_cast<std::size_t>(kSlotIndex0));
+    EXPECT_TRUE(slot.GetTransactionBegin());
+}
+
+TEST_F(ReferenceTransactionFutexFixture, ReferenceAndDereferenceTransactionsWithoutWaitersDoNotUseTheFutex)
+{
+    // Expecting that the futex is neither waited on nor woken up
+    EXPECT_CALL(*futex_mock_, Wait(_, _, _)).Times(0);
+    EXPECT_CALL(*futex_mock_, WakeAll(_)).Times(0);
+
+    // When a slot is referenced and dereferenced while nobody waits for the transaction-END bit
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+    unit_.DereferenceTransactionBegin(kSlotIndex0);
+    unit_.DereferenceTransactionCommit(kSlotIndex0);
+
+    // Then the transactions are recorded nonetheless
+    EXPECT_FALSE(unit_.ContainsTransactions());
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::lola
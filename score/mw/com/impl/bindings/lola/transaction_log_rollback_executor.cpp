@@ -20,7 +20,16 @@
 #include "score/mw/log/logging.h"
 
 #include <score/assert.hpp>
+#include <score/stop_token.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -28,6 +37,13 @@ namespace score::mw::com::impl::lola
 namespace
 {
 
+/// \brief Upper bound of the threads (including the calling one) rolling back the transaction logs of one service
+///        instance.
+constexpr std::size_t kMaxNumberOfRollbackThreads{4U};
+
+/// \brief Minimum number of events per rollback thread.
+constexpr std::size_t kMinNumberOfEventsPerRollbackThread{16U};
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings.
 // This rule states: "The std::terminate() function shall not be called implicitly".
 // The coverity tool reports: "fun_call_w_exception: Called function throws an exception of type
@@ -44,19 +60,165 @@ void MarkTransactionLogsNeedRollback(ProxyServiceDataControlLocalView& service_d
     }
 }
 
+Result<void> RollbackEventTransactionLogs(ConsumerEventControlLocalView& event_control,
+                                         const TransactionLogId transaction_log_id) noexcept
+{
+    auto& transaction_log_set = event_control.transaction_log_set;
+    return transaction_log_set.get().RollbackProxyTransactions(
+        transaction_log_id,
+        [&event_control](const TransactionLog::SlotIndexType slot_index) noexcept {
+            event_control.data_control.DereferenceEventWithoutTransactionLogging(slot_index);
+        },
+        [&event_control](const TransactionLog::SlotIndexType slot_index) noexcept {
+            return event_control.data_control.IsEventReferenced(slot_index);
+        },
+        [&event_control](const TransactionLog::MaxSampleCountType subscription_max_sample_count) noexcept {
+            event_control.subscription_control.get().Unsubscribe(subscription_max_sample_count);
+        });
+}
+
+/// \brief State of a rollback of events, which is shared by the calling thread and the tasks posted to an executor.
+struct ParallelRollbackState
+{
+    ParallelRollbackState(const std::size_t number_of_events_in,
+                          const EventRollbackCallback& rollback_event_in) noexcept
+        : number_of_events{number_of_events_in},
+          rollback_event{rollback_event_in},
+          next_event_index{0U},
+          did_rollback_fail{false},
+          rollback_results(number_of_events_in, Result<void>{}),
+          mutex{},
+          tasks_finished{},
+          number_of_active_tasks{0U},
+          is_closed{false}
+    {
+    }
+
+    const std::size_t number_of_events;
+    // only accessed while the rollback isn't closed, i.e. while the calling thread waits for the tasks
+    const EventRollbackCallback& rollback_event;
+    std::atomic<std::size_t> next_event_index;
+    std::atomic<bool> did_rollback_fail;
+    std::vector<Result<void>> rollback_results;
+
+    std::mutex mutex;
+    std::condition_variable tasks_finished;
+    // number of tasks, which started rolling back events and didn't finish yet
+    std::size_t number_of_active_tasks;
+    // set by the calling thread after it rolled back its events. Tasks started afterwards don't roll back any event.
+    bool is_closed;
+};
+
+/// \brief Rolls back events, which weren't handed out yet, until all are handed out or a rollback failed.
+/// \details The events are handed out one by one, since the rollback of an event takes longer, the more proxy service
+///          elements of this process were connected to it.
+void RollbackNextEvents(ParallelRollbackState& rollback_state) noexcept
+{
+    while (!rollback_state.did_rollback_fail.load(std::memory_order_relaxed))
+    {
+        const auto event_index = rollback_state.next_event_index.fetch_add(1U, std::memory_order_relaxed);
+        if (event_index >= rollback_state.number_of_events)
+        {
+            return;
+        }
+        auto& rollback_result = rollback_state.rollback_results.at(event_index);
+        rollback_result = rollback_state.rollback_event(event_index);
+        if (!rollback_result.has_value())
+        {
+            rollback_state.did_rollback_fail.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
 }  // namespace
 
+std::size_t GetNumberOfRollbackThreads(const std::size_t number_of_events) noexcept
+{
+    return std::clamp(
+        number_of_events / kMinNumberOfEventsPerRollbackThread, std::size_t{1U}, kMaxNumberOfRollbackThreads);
+}
+
+Result<void> RollbackEvents(const std::size_t number_of_events,
+                            concurrency::Executor* const executor,
+                            const EventRollbackCallback& rollback_event) noexcept
+{
+    const auto number_of_threads = GetNumberOfRollbackThreads(number_of_events);
+    if ((executor == nullptr) || (number_of_threads <= 1U))
+    {
+        for (std::size_t event_index = 0U; event_index < number_of_events; ++event_index)
+        {
+            const auto rollback_result = rollback_event(event_index);
+            if (!rollback_result.has_value())
+            {
+                return rollback_result;
+            }
+        }
+        return {};
+    }
+
+    // The state is shared with the posted tasks, as a task might only be started by the executor after this function
+    // returned. Such a task finds the rollback closed and returns without accessing rollback_event.
+    const auto rollback_state = std::make_shared<ParallelRollbackState>(number_of_events, rollback_event);
+    for (std::size_t task_index = 1U; task_index < number_of_threads; ++task_index)
+    {
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+        // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". The function Post
+        // throws on allocation failure but this throw directly leads to a termination based on a compiler hook.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        executor->Post([rollback_state](const score::cpp::stop_token& /*token*/) noexcept {
+            {
+                std::lock_guard<std::mutex> lock{rollback_state->mutex};
+                if (rollback_state->is_closed)
+                {
+                    return;
+                }
+                ++rollback_state->number_of_active_tasks;
+            }
+            RollbackNextEvents(*rollback_state);
+            {
+                std::lock_guard<std::mutex> lock{rollback_state->mutex};
+                --rollback_state->number_of_active_tasks;
+            }
+            rollback_state->tasks_finished.notify_all();
+        });
+    }
+
+    RollbackNextEvents(*rollback_state);
+    {
+        // All events have been handed out (or a rollback failed), so only the tasks, which are still rolling back an
+        // event, have to be waited for.
+        std::unique_lock<std::mutex> lock{rollback_state->mutex};
+        rollback_state->is_closed = true;
+        rollback_state->tasks_finished.wait(lock, [&rollback_state]() noexcept {
+            return rollback_state->number_of_active_tasks == 0U;
+        });
+    }
+
+    const auto& rollback_results = rollback_state->rollback_results;
+    const auto failed_rollback_result =
+        std::find_if(rollback_results.cbegin(), rollback_results.cend(), [](const Result<void>& rollback_result) {
+            return !rollback_result.has_value();
+        });
+    if (failed_rollback_result != rollback_results.cend())
+    {
+        return *failed_rollback_result;
+    }
+    return {};
+}
+
 TransactionLogRollbackExecutor::TransactionLogRollbackExecutor(
     ProxyServiceDataControlLocalView& service_data_control_local,
     const SkeletonInstanceIdentifier skeleton_instance_identifier,
     const QualityType asil_level,
     pid_t provider_pid,
-    const TransactionLogId transaction_log_id) noexcept
+    const TransactionLogId transaction_log_id,
+    concurrency::Executor* const rollback_executor) noexcept
     : service_data_control_local_{service_data_control_local},
       asil_level_{asil_level},
       provider_pid_{provider_pid},
       transaction_log_id_{transaction_log_id},
-      skeleton_instance_identifier_{skeleton_instance_identifier}
+      skeleton_instance_identifier_{skeleton_instance_identifier},
+      rollback_executor_{rollback_executor}
 {
 }
 
@@ -116,24 +278,19 @@ Result<void> TransactionLogRollbackExecutor::RollbackTransactionLogs() noexcept
         PrepareRollback(lola_runtime);
     }
 
+    std::vector<std::reference_wrapper<ConsumerEventControlLocalView>> event_controls{};
+    event_controls.reserve(service_data_control_local_.event_controls_.size());
     for (auto& element : service_data_control_local_.event_controls_)
     {
-        auto& event_control = element.second;
-        auto& transaction_log_set = event_control.transaction_log_set;
-        const auto rollback_result = transaction_log_set.get().RollbackProxyTransactions(
-            transaction_log_id_,
-            [&event_control](const TransactionLog::SlotIndexType slot_index) noexcept {
-                event_control.data_control.DereferenceEventWithoutTransactionLogging(slot_index);
-            },
-            [&event_control](const TransactionLog::MaxSampleCountType subscription_max_sample_count) noexcept {
-                event_control.subscription_control.get().Unsubscribe(subscription_max_sample_count);
-            });
-        if (!rollback_result.has_value())
-        {
-            return rollback_result;
-        }
+        event_controls.emplace_back(element.second);
     }
-    return {};
+
+    return RollbackEvents(
+        event_controls.size(),
+        rollback_executor_,
+        [&event_controls, transaction_log_id = transaction_log_id_](const std::size_t event_index) noexcept {
+            return RollbackEventTransactionLogs(event_controls.at(event_index).get(), transaction_log_id);
+        });
 }
 
 }  // namespace score::mw::com::impl::lola
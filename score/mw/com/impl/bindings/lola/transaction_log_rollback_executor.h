@@ -19,9 +19,36 @@
 #include "score/mw/com/impl/bindings/lola/transaction_log_id.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 
+#include "score/concurrency/executor.h"
+#include "score/result/result.h"
+
+#include <score/callback.hpp>
+
+#include <cstddef>
+
 namespace score::mw::com::impl::lola
 {
 
+/// \brief Callback, which rolls back the transaction logs of the event with the given index.
+using EventRollbackCallback = score::cpp::callback<Result<void>(std::size_t)>;
+
+/// \brief Returns the number of threads (including the calling one), which are used to roll back the transaction
+///        logs of number_of_events events, if an executor for the rollback is given.
+/// \details Handing out work to another thread costs more than rolling back the transaction logs of a few events.
+///          Therefore, additional threads are only used for service instances with many events.
+std::size_t GetNumberOfRollbackThreads(const std::size_t number_of_events) noexcept;
+
+/// \brief Calls rollback_event for each event index in [0, number_of_events) and returns the first error.
+/// \details Without an executor, the events are rolled back one after the other by the calling thread. With an
+///          executor, GetNumberOfRollbackThreads() - 1 tasks are posted to it, which roll back events concurrently to
+///          the calling thread. The calling thread doesn't wait for tasks, which the executor didn't start yet, so a
+///          saturated executor only delays the rollback but doesn't block it. After a rollback failed, no further
+///          rollbacks are started. rollback_event has to be callable concurrently for different event indices, if an
+///          executor is given.
+Result<void> RollbackEvents(const std::size_t number_of_events,
+                            concurrency::Executor* const executor,
+                            const EventRollbackCallback& rollback_event) noexcept;
+
 class TransactionLogRollbackExecutor
 {
   public:
@@ -30,17 +57,22 @@ class TransactionLogRollbackExecutor
     /// \param asil_level asil level of the proxy instance owning this executor.
     /// \param provider_pid pid/node-id of the service instance provider
     /// \param transaction_log_id id of transaction logs to be rolled back.
+    /// \param rollback_executor optional executor, which rolls back the transaction logs of different events
+    ///        concurrently. If not given, the transaction logs are rolled back sequentially by the calling thread.
     TransactionLogRollbackExecutor(ProxyServiceDataControlLocalView& service_data_control_local,
                                    const SkeletonInstanceIdentifier skeleton_instance_identifier,
                                    const QualityType asil_level,
                                    const pid_t provider_pid,
-                                   const TransactionLogId transaction_log_id) noexcept;
+                                   const TransactionLogId transaction_log_id,
+                                   concurrency::Executor* const rollback_executor = nullptr) noexcept;
 
     /// \brief Does a rollback of all transaction logs (log per service element) related to service_data_control/
     ///        transaction_log_id specific to a proxy instance given in the ctor.
     /// \details Besides the pure transaction rollback, there is also some preparation needed/done once for a given
     ///          service_data_control (independent from the number of local proxy instances referring to it). This
     ///          is done by an internal call to #PrepareRollback
+    ///          If a rollback executor was given, the transaction logs of service instances with many events are
+    ///          rolled back by multiple threads, see RollbackEvents().
     Result<void> RollbackTransactionLogs() noexcept;
 
   private:
@@ -64,6 +96,7 @@ class TransactionLogRollbackExecutor
     const pid_t provider_pid_;
     TransactionLogId transaction_log_id_;
     SkeletonInstanceIdentifier skeleton_instance_identifier_;
+    concurrency::Executor* rollback_executor_;
 };
 
 }  // namespace score::mw::com::impl::lola
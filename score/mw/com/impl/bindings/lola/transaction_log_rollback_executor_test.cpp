@@ -22,17 +22,24 @@
 #include "score/mw/com/impl/bindings/lola/skeleton_event_properties.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/test/transaction_log_test_resources.h"
+#include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/runtime.h"
 #include "score/mw/com/impl/runtime_mock.h"
 #include "score/mw/com/impl/test/runtime_mock_guard.h"
 
+#include "score/concurrency/executor_mock.h"
+#include "score/concurrency/thread_pool.h"
 #include "score/memory/shared/shared_memory_resource_heap_allocator_mock.h"
 
 #include <gtest/gtest.h>
+#include <score/utility.hpp>
 #include <score/jthread.hpp>
+#include <score/stop_token.hpp>
 #include <sys/types.h>
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace score::mw::com::impl::lola
@@ -54,6 +61,8 @@ const ElementFqId kDummyElementFqId{1U, 2U, 3U, ServiceElementType::EVENT};
 const SkeletonInstanceIdentifier kSkeletonInstanceIdentifier{kDummyElementFqId.service_id_,
                                                              kDummyElementFqId.instance_id_};
 
+constexpr std::size_t kNumberOfRollbackPoolThreads{3U};
+
 constexpr std::size_t kNumberOfSlots{20U};
 constexpr std::size_t kMaxSubscribers{20U};
 const SkeletonEventProperties kDummySkeletonEventProperties{kNumberOfSlots, kMaxSubscribers, true};
@@ -70,21 +79,35 @@ class TransactionLogRollbackExecutorFixture : public ::testing::Test
         ON_CALL(lola_runtime_mock_, GetRollbackSynchronization()).WillByDefault(ReturnRef(rollback_synchronization_));
     }
 
-    TransactionLogRollbackExecutorFixture& WithTransactionLogRollbackExecutor()
+    TransactionLogRollbackExecutorFixture& WithTransactionLogRollbackExecutor(
+        const std::size_t number_of_events = 1U,
+        concurrency::Executor* const rollback_executor = nullptr)
     {
         service_data_control_ = std::make_unique<ServiceDataControl>(memory_resource_mock_);
-        AddEvent(kDummyElementFqId, kDummySkeletonEventProperties);
+        for (std::size_t event_index = 0U; event_index < number_of_events; ++event_index)
+        {
+            AddEvent(GetElementFqId(event_index), kDummySkeletonEventProperties);
+        }
 
         score::cpp::ignore = proxy_service_data_control_local_.emplace(*service_data_control_);
         unit_ = std::make_unique<TransactionLogRollbackExecutor>(proxy_service_data_control_local_.value(),
                                                                  kSkeletonInstanceIdentifier,
                                                                  kDummyQualityType,
                                                                  kDummyProviderPid,
-                                                                 kDummyTransactionLogId);
+                                                                 kDummyTransactionLogId,
+                                                                 rollback_executor);
 
         return *this;
     }
 
+    static ElementFqId GetElementFqId(const std::size_t event_index) noexcept
+    {
+        return ElementFqId{kDummyElementFqId.service_id_,
+                           static_cast<ElementFqId::ElementId>(kDummyElementFqId.element_id_ + event_index),
+                           kDummyElementFqId.instance_id_,
+                           ServiceElementType::EVENT};
+    }
+
     void AddEvent(const ElementFqId element_fq_id, const SkeletonEventProperties skeleton_event_properties) noexcept
     {
         const auto emplace_result = service_data_control_->event_controls_.emplace(
@@ -348,6 +371,193 @@ TEST_F(TransactionLogRollbackExecutorRollbackLogsFixture, WillReturnErrorIfAnyLo
     EXPECT_TRUE(transaction_log_node_1.NeedsRollback());
 }
 
+TEST_F(TransactionLogRollbackExecutorRollbackLogsFixture, RollsBackLogsOfAllEventsWhenUsingMultipleThreads)
+{
+    constexpr std::size_t kNumberOfEvents{64U};
+    ASSERT_GT(GetNumberOfRollbackThreads(kNumberOfEvents), 1U);
+
+    // Given a service instance with enough events to be rolled back by multiple threads of a rollback executor
+    concurrency::ThreadPool thread_pool{kNumberOfRollbackPoolThreads};
+    WithTransactionLogRollbackExecutor(kNumberOfEvents, &thread_pool);
+
+    // and a registered TransactionLog for each event
+    std::vector<std::reference_wrapper<TransactionLogSet::TransactionLogNode>> transaction_log_nodes{};
+    for (std::size_t event_index = 0U; event_index < kNumberOfEvents; ++event_index)
+    {
+        transaction_log_nodes.emplace_back(
+            RegisterProxyElementWithTransactionLogSet(GetElementFqId(event_index), kDummyTransactionLogId));
+    }
+
+    // When rolling back the transaction logs
+    const auto result = unit_->RollbackTransactionLogs();
+
+    // Then the rollback succeeds
+    ASSERT_TRUE(result.has_value());
+
+    // and the TransactionLogs of all events have been rolled back
+    for (const auto& transaction_log_node : transaction_log_nodes)
+    {
+        EXPECT_FALSE(transaction_log_node.get().IsActive());
+        EXPECT_FALSE(transaction_log_node.get().NeedsRollback());
+    }
+}
+
+TEST_F(TransactionLogRollbackExecutorRollbackLogsFixture, ReturnsErrorIfAnyEventFailsToRollBackWhenUsingMultipleThreads)
+{
+    constexpr std::size_t kNumberOfEvents{64U};
+    constexpr std::size_t kFailingEventIndex{40U};
+
+    // Given a service instance with enough events to be rolled back by multiple threads of a rollback executor
+    concurrency::ThreadPool thread_pool{kNumberOfRollbackPoolThreads};
+    WithTransactionLogRollbackExecutor(kNumberOfEvents, &thread_pool);
+
+    // and a registered TransactionLog for each event
+    for (std::size_t event_index = 0U; event_index < kNumberOfEvents; ++event_index)
+    {
+        auto& transaction_log_node =
+            RegisterProxyElementWithTransactionLogSet(GetElementFqId(event_index), kDummyTransactionLogId);
+
+        // of which one contains an unfinished subscribe transaction, indicating a crash
+        if (event_index == kFailingEventIndex)
+        {
+            TransactionLogLocalView transaction_log_local_view{transaction_log_node.GetTransactionLog()};
+            transaction_log_local_view.SubscribeTransactionBegin(0U);
+        }
+    }
+
+    // When rolling back the transaction logs
+    const auto result = unit_->RollbackTransactionLogs();
+
+    // Then the error of the failing rollback is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kCouldNotRestartProxy);
+}
+
+TEST(TransactionLogRollbackExecutorParallelRollbackTest, UsesAdditionalThreadsOnlyForManyEvents)
+{
+    EXPECT_EQ(GetNumberOfRollbackThreads(0U), 1U);
+    EXPECT_EQ(GetNumberOfRollbackThreads(1U), 1U);
+    EXPECT_EQ(GetNumberOfRollbackThreads(31U), 1U);
+    EXPECT_EQ(GetNumberOfRollbackThreads(32U), 2U);
+    EXPECT_EQ(GetNumberOfRollbackThreads(1000U), 4U);
+}
+
+TEST(TransactionLogRollbackExecutorParallelRollbackTest, RollsBackEachEventExactlyOnce)
+{
+    constexpr std::size_t kNumberOfEvents{100U};
+
+    // Given a rollback executor
+    concurrency::ThreadPool thread_pool{kNumberOfRollbackPoolThreads};
+
+    // and a rollback callback counting its calls per event
+    std::vector<std::atomic<std::size_t>> number_of_rollbacks(kNumberOfEvents);
+
+    // When rolling back the events using the rollback executor
+    const auto result = RollbackEvents(
+        kNumberOfEvents, &thread_pool, [&number_of_rollbacks](const std::size_t event_index) noexcept {
+            score::cpp::ignore = number_of_rollbacks.at(event_index).fetch_add(1U);
+            return Result<void>{};
+        });
+
+    // Then the rollback succeeds
+    ASSERT_TRUE(result.has_value());
+
+    // and each event has been rolled back exactly once
+    for (const auto& number_of_event_rollbacks : number_of_rollbacks)
+    {
+        EXPECT_EQ(number_of_event_rollbacks.load(), 1U);
+    }
+}
+
+TEST(TransactionLogRollbackExecutorParallelRollbackTest, StopsRollingBackAfterTheFirstError)
+{
+    constexpr std::size_t kNumberOfEvents{100U};
+    constexpr std::size_t kFailingEventIndex{0U};
+
+    // Given a rollback callback failing for the first event
+    std::atomic<std::size_t> number_of_rollbacks{0U};
+
+    // When rolling back the events without a rollback executor
+    const auto result = RollbackEvents(
+        kNumberOfEvents, nullptr, [&number_of_rollbacks](const std::size_t event_index) noexcept -> Result<void> {
+            score::cpp::ignore = number_of_rollbacks.fetch_add(1U);
+            if (event_index == kFailingEventIndex)
+            {
+                return MakeUnexpected(ComErrc::kCouldNotRestartProxy);
+            }
+            return {};
+        });
+
+    // Then the error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kCouldNotRestartProxy);
+
+    // and no further event has been rolled back
+    EXPECT_EQ(number_of_rollbacks.load(), 1U);
+}
+
+TEST(TransactionLogRollbackExecutorParallelRollbackTest, RollsBackOnTheCallingThreadWithoutExecutor)
+{
+    constexpr std::size_t kNumberOfEvents{100U};
+    ASSERT_GT(GetNumberOfRollbackThreads(kNumberOfEvents), 1U);
+
+    // Given a rollback callback recording the threads it is called from
+    std::vector<std::thread::id> rollback_thread_ids{};
+
+    // When rolling back many events without a rollback executor
+    const auto result = RollbackEvents(
+        kNumberOfEvents, nullptr, [&rollback_thread_ids](const std::size_t /*event_index*/) noexcept {
+            rollback_thread_ids.push_back(std::this_thread::get_id());
+            return Result<void>{};
+        });
+
+    // Then the rollback succeeds
+    ASSERT_TRUE(result.has_value());
+
+    // and all events have been rolled back by the calling thread
+    ASSERT_EQ(rollback_thread_ids.size(), kNumberOfEvents);
+    for (const auto& rollback_thread_id : rollback_thread_ids)
+    {
+        EXPECT_EQ(rollback_thread_id, std::this_thread::get_id());
+    }
+}
+
+TEST(TransactionLogRollbackExecutorParallelRollbackTest, DoesNotWaitForTasksNotStartedByTheExecutor)
+{
+    constexpr std::size_t kNumberOfEvents{100U};
+
+    // Given a rollback executor, which doesn't start the posted tasks
+    concurrency::testing::ExecutorMock executor_mock{};
+    std::vector<score::cpp::pmr::unique_ptr<concurrency::Task>> posted_tasks{};
+    EXPECT_CALL(executor_mock, Enqueue(_))
+        .Times(static_cast<int>(GetNumberOfRollbackThreads(kNumberOfEvents) - 1U))
+        .WillRepeatedly([&posted_tasks](auto&& task) {
+            posted_tasks.push_back(std::forward<decltype(task)>(task));
+        });
+
+    // and a rollback callback counting its calls
+    std::atomic<std::size_t> number_of_rollbacks{0U};
+
+    // When rolling back the events using the rollback executor
+    const auto result = RollbackEvents(
+        kNumberOfEvents, &executor_mock, [&number_of_rollbacks](const std::size_t /*event_index*/) noexcept {
+            score::cpp::ignore = number_of_rollbacks.fetch_add(1U);
+            return Result<void>{};
+        });
+
+    // Then the rollback succeeds, as all events have been rolled back by the calling thread
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(number_of_rollbacks.load(), kNumberOfEvents);
+
+    // and the tasks started afterwards don't roll back any event
+    const score::cpp::stop_token stop_token{};
+    for (auto& posted_task : posted_tasks)
+    {
+        (*posted_task)(stop_token);
+    }
+    EXPECT_EQ(number_of_rollbacks.load(), kNumberOfEvents);
+}
+
 using TransactionLogRollbackExecutorMarkNeedRollbackDeathTest = TransactionLogRollbackExecutorFixture;
 TEST_F(TransactionLogRollbackExecutorMarkNeedRollbackDeathTest, FailingToGetLolaRuntimeTerminates)
 {
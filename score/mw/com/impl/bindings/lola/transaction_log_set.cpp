@@ -18,8 +18,9 @@
 #include "score/result/result.h"
 
 #include <score/assert.hpp>
+#include <score/utility.hpp>
 
-#include <limits>
+#include <algorithm>
 #include <mutex>
 
 namespace score::mw::com::impl::lola
@@ -54,7 +55,11 @@ TransactionLogSet::TransactionLogSet(const TransactionLogIndex max_number_of_log
                                      const std::size_t number_of_slots,
                                      memory::shared::ManagedMemoryResource& resource)
     : proxy_transaction_logs_(max_number_of_logs, TransactionLogNode{number_of_slots, resource}, resource),
-      skeleton_tracing_transaction_log_{number_of_slots, resource}
+      skeleton_tracing_transaction_log_{number_of_slots, resource},
+      logs_needing_rollback_((static_cast<std::size_t>(max_number_of_logs) + kLogsPerBitmapWord - 1U) /
+                                 kLogsPerBitmapWord,
+                             CopyableAtomic<LogBitmapWord>{0U},
+                             resource)
 {
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
         max_number_of_logs != kSkeletonIndexSentinel,
@@ -63,6 +68,7 @@ TransactionLogSet::TransactionLogSet(const TransactionLogIndex max_number_of_log
 
 void TransactionLogSet::MarkTransactionLogsNeedRollback(const TransactionLogId& transaction_log_id)
 {
+    std::size_t transaction_log_index{0U};
     for (auto& transaction_log_node : proxy_transaction_logs_)
     {
         const bool log_is_active = transaction_log_node.IsActive();
@@ -75,29 +81,38 @@ void TransactionLogSet::MarkTransactionLogsNeedRollback(const TransactionLogId&
         if (log_is_active && has_matching_id)
         {
             transaction_log_node.MarkNeedsRollback(true);
+            SetLogNeedsRollbackBit(transaction_log_index);
         }
+        transaction_log_index++;
     }
 }
 
 Result<void> TransactionLogSet::RollbackProxyTransactions(
     const TransactionLogId& transaction_log_id,
     const TransactionLogLocalView::DereferenceSlotCallback dereference_slot_callback,
+    const TransactionLogLocalView::IsSlotReferencedCallback is_slot_referenced_callback,
     const TransactionLogLocalView::DereferenceSlotCallback unsubscribe_callback)
 {
-    const auto transaction_log_node_iterators_to_be_rolled_back =
-        FindTransactionLogNodesToBeRolledBack(transaction_log_id);
-
     // Keep trying to rollback a TransactionLog. If a rollback succeeds, return. If a rollback fails, try to rollback
     // the next TransactionLog. If there are only TransactionLogs remaining which cannot be rolled back, return an
-    // error.
+    // error. Only the TransactionLogs marked in logs_needing_rollback_ are visited. Since the bits of the other
+    // TransactionLogIds are set too, the TransactionLogNode has to confirm that it belongs to transaction_log_id.
     Result<void> rollback_result{};
-    for (const auto transaction_log_node_it : transaction_log_node_iterators_to_be_rolled_back)
+    for (auto transaction_log_index = FindNextLogNeedingRollback(0U);
+         transaction_log_index < proxy_transaction_logs_.size();
+         transaction_log_index = FindNextLogNeedingRollback(transaction_log_index + 1U))
     {
-        rollback_result = transaction_log_node_it->GetTransactionLogLocalView().RollbackProxyElementLog(
-            dereference_slot_callback, unsubscribe_callback);
+        auto& transaction_log_node = proxy_transaction_logs_.at(transaction_log_index);
+        if (!transaction_log_node.TryAcquireForRead(transaction_log_id) || !transaction_log_node.NeedsRollback())
+        {
+            continue;
+        }
+        rollback_result = transaction_log_node.GetTransactionLogLocalView().RollbackProxyElementLog(
+            dereference_slot_callback, is_slot_referenced_callback, unsubscribe_callback);
         if (rollback_result.has_value())
         {
-            transaction_log_node_it->Reset();
+            ClearLogNeedsRollbackBit(transaction_log_index);
+            transaction_log_node.Reset();
             return {};
         }
     }
@@ -166,6 +181,7 @@ void TransactionLogSet::Unregister(const TransactionLogIndex transaction_log_ind
     {
         SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(static_cast<std::size_t>(transaction_log_index) <
                                             proxy_transaction_logs_.size());
+        ClearLogNeedsRollbackBit(static_cast<std::size_t>(transaction_log_index));
         proxy_transaction_logs_.at(static_cast<std::size_t>(transaction_log_index)).Reset();
     }
 }
@@ -187,38 +203,66 @@ TransactionLog& TransactionLogSet::GetTransactionLog(const TransactionLogIndex t
     return proxy_transaction_logs_.at(static_cast<std::size_t>(transaction_log_index)).GetTransactionLog();
 }
 
-std::vector<TransactionLogSet::TransactionLogCollection::iterator>
-TransactionLogSet::FindTransactionLogNodesToBeRolledBack(const TransactionLogId& target_transaction_log_id)
+void TransactionLogSet::VisitReferencedSlotsOfProxies(const ReferencedSlotsVisitor visitor) const
 {
-    std::vector<TransactionLogSet::TransactionLogCollection::iterator> found_node_iterators{};
-
-    // LCOV_EXCL_BR_START (Tool incorrectly marks the branch as "Decision couldn't be analyzed" despite all lines within
-    // the for loop being covered. We also have a test in case proxy_transaction_logs_.size() == 0. Suppression can be
-    // removed when bug is fixed in Ticket-188259).
-    // autosar_cpp14_m5_0_15_violation
-    // This rule has an explicit exception for using ++/-- operators on iterators, which is what is happening here.
-    //
-    // autosar_cpp14_a5_3_2_violation
-    // `it` can only be a nullpointer if proxy_transaction_logs_ is zero length DynamicArray. In which case both begin
-    // and end will return a nullpointer and the loop condition will fail before ever entering the loop. Thus
-    // derefferencing a nullpointer is impossible here.
-    //
-    // coverity[autosar_cpp14_m5_0_15_violation]
-    // coverity[autosar_cpp14_a5_3_2_violation : FALSE]
-    for (auto it = proxy_transaction_logs_.begin(); it != proxy_transaction_logs_.end(); it++)
+    for (const auto& transaction_log_node : proxy_transaction_logs_)
     {
-        // LCOV_EXCL_BR_STOP
-        // coverity[autosar_cpp14_a5_3_2_violation : FALSE]
-        const bool acquired = it->TryAcquireForRead(target_transaction_log_id);
-        if (acquired)
+        if (!transaction_log_node.IsActive())
         {
-            if (it->NeedsRollback())
+            continue;
+        }
+        std::size_t number_of_referenced_slots{0U};
+        for (const auto& slot : transaction_log_node.GetTransactionLog().reference_count_slots_)
+        {
+            // A slot is referenced between the commit of the reference transaction and the begin of the dereference
+            // transaction.
+            if (slot.GetTransactionBegin() && slot.GetTransactionEnd())
             {
-                found_node_iterators.push_back(it);
+                number_of_referenced_slots++;
             }
         }
+        visitor(transaction_log_node.GetTransactionLogId(), number_of_referenced_slots);
+    }
+}
+
+std::size_t TransactionLogSet::FindNextLogNeedingRollback(const std::size_t start_index) const
+{
+    const std::size_t number_of_logs{proxy_transaction_logs_.size()};
+    std::size_t word_index{start_index / kLogsPerBitmapWord};
+    // The bits before start_index are shifted out of the first word.
+    std::size_t bit_offset{start_index % kLogsPerBitmapWord};
+    while ((word_index * kLogsPerBitmapWord) < number_of_logs)
+    {
+        const auto remaining_bits =
+            logs_needing_rollback_.at(word_index).GetUnderlying().load(std::memory_order_acquire) >> bit_offset;
+        // Words without any set bit are skipped as a whole.
+        if (remaining_bits != 0U)
+        {
+            // remaining_bits is non-zero, for which the result of __builtin_ctzll() is defined
+            const std::size_t index{(word_index * kLogsPerBitmapWord) + bit_offset +
+                                    static_cast<std::size_t>(__builtin_ctzll(remaining_bits))};
+            return std::min(index, number_of_logs);
+        }
+        word_index++;
+        bit_offset = 0U;
     }
-    return found_node_iterators;
+    return number_of_logs;
+}
+
+void TransactionLogSet::SetLogNeedsRollbackBit(const std::size_t transaction_log_index)
+{
+    const LogBitmapWord bit{LogBitmapWord{1U} << (transaction_log_index % kLogsPerBitmapWord)};
+    score::cpp::ignore = logs_needing_rollback_.at(transaction_log_index / kLogsPerBitmapWord)
+                             .GetUnderlying()
+                             .fetch_or(bit, std::memory_order_acq_rel);
+}
+
+void TransactionLogSet::ClearLogNeedsRollbackBit(const std::size_t transaction_log_index)
+{
+    const LogBitmapWord bit{LogBitmapWord{1U} << (transaction_log_index % kLogsPerBitmapWord)};
+    score::cpp::ignore = logs_needing_rollback_.at(transaction_log_index / kLogsPerBitmapWord)
+                             .GetUnderlying()
+                             .fetch_and(static_cast<LogBitmapWord>(~bit), std::memory_order_acq_rel);
 }
 
 std::optional<std::pair<TransactionLogSet::TransactionLogCollection::iterator, TransactionLogIndex>>
@@ -27,7 +27,12 @@
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 #include "score/result/result.h"
 
+#include <score/callback.hpp>
+
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 
 namespace score::mw::com::impl::lola
 {
@@ -58,6 +63,10 @@ namespace score::mw::com::impl::lola
 /// implementation of the lock-free algo, which needs a fast/repeated iteration over all elements would have been
 /// harder. We think that iterating over this DynamicArray should be very quick due to the limited size of the
 /// DynamicArray and CPU caching (similar to the control DynamicArray in EventDataControl).
+///
+/// The TransactionLogNodes, which are marked as needing a rollback, are additionally tracked in a bitmap (one bit per
+/// TransactionLogNode). So the rollback only visits these TransactionLogNodes and their slots instead of all the
+/// TransactionLogNodes of all the (potentially many) Proxy service elements.
 class TransactionLogSet
 {
     // Suppress "AUTOSAR C++14 A11-3-1", The rule declares: "Friend declarations shall not be used".
@@ -133,6 +142,11 @@ class TransactionLogSet
             return transaction_log_;
         }
 
+        const TransactionLog& GetTransactionLog() const
+        {
+            return transaction_log_;
+        }
+
         // Since the TransactionLogNode is copyable / moveable, we can't store the TransactionLogLocalView in the
         // TransactionLogNode itself as it will be invalidated whenever the TransactionLogNode (and the containing
         // TransactionLog which the view points to) is copied / moved. Since this function is only called during
@@ -172,6 +186,10 @@ class TransactionLogSet
     // coverity[autosar_cpp14_a0_1_1_violation : FALSE]
     static constexpr const TransactionLogIndex kSkeletonIndexSentinel{std::numeric_limits<TransactionLogIndex>::max()};
 
+    /// \brief Callback, which gets the TransactionLogId of a registered proxy TransactionLog and the number of slots,
+    ///        which are referenced according to this TransactionLog.
+    using ReferencedSlotsVisitor = score::cpp::callback<void(TransactionLogId, std::size_t)>;
+
     /// \brief Constructor
     /// \param max_number_of_logs The maximum number of logs that can be registered via Register().
     /// \param number_of_slots number of slots each of the transaction logs within the TransactionLogSet will contain.
@@ -187,6 +205,10 @@ class TransactionLogSet
     TransactionLogSet(TransactionLogSet&&) noexcept = delete;
     TransactionLogSet& operator=(TransactionLogSet&& other) noexcept = delete;
 
+    /// \brief Marks all Proxy TransactionLogs corresponding to the provided TransactionLogId as needing a rollback.
+    ///
+    /// This is the only place, which searches all TransactionLogNodes for the provided TransactionLogId. The marked
+    /// TransactionLogNodes are recorded in logs_needing_rollback_, which is used by RollbackProxyTransactions().
     void MarkTransactionLogsNeedRollback(const TransactionLogId& transaction_log_id);
 
     /// \brief Rolls back all Proxy TransactionLogs corresponding to the provided TransactionLogId.
@@ -203,6 +225,7 @@ class TransactionLogSet
     Result<void> RollbackProxyTransactions(
         const TransactionLogId& transaction_log_id,
         const TransactionLogLocalView::DereferenceSlotCallback dereference_slot_callback,
+        const TransactionLogLocalView::IsSlotReferencedCallback is_slot_referenced_callback,
         const TransactionLogLocalView::DereferenceSlotCallback unsubscribe_callback);
 
     /// \brief If a Skeleton TransactionLog exists, performs a rollback on it.
@@ -247,6 +270,12 @@ class TransactionLogSet
     /// Must not be called concurrently with Unregister() with the same transaction_log_index.
     TransactionLog& GetTransactionLog(const TransactionLogIndex transaction_log_index);
 
+    /// \brief Calls the visitor for each registered proxy TransactionLog.
+    ///
+    /// Only meant for observation (e.g. by the ServiceStatisticsPublisher): The TransactionLogs are read without any
+    /// synchronization with the proxies owning them, so the result is a best-effort snapshot.
+    void VisitReferencedSlotsOfProxies(const ReferencedSlotsVisitor visitor) const;
+
   private:
     using TransactionLogCollection =
         score::containers::DynamicArray<TransactionLogNode,
@@ -260,12 +289,19 @@ class TransactionLogSet
     /// and RegisterSkeletonTracingElement.
     void Unregister(const TransactionLogIndex transaction_log_index);
 
-    /// \brief Returns iterators to all TransactionLogNodes for the given target_transaction_log_id, which needs roll
-    /// back.
-    /// \param target_transaction_log_id transaction log id to be searched for
-    /// \return vector of iterators
-    std::vector<TransactionLogSet::TransactionLogCollection::iterator> FindTransactionLogNodesToBeRolledBack(
-        const TransactionLogId& target_transaction_log_id);
+    using LogBitmapWord = std::uint64_t;
+    using LogBitmap =
+        score::containers::DynamicArray<CopyableAtomic<LogBitmapWord>,
+                                        memory::shared::PolymorphicOffsetPtrAllocator<CopyableAtomic<LogBitmapWord>>>;
+
+    static constexpr std::size_t kLogsPerBitmapWord{std::numeric_limits<LogBitmapWord>::digits};
+
+    /// \brief Returns the index of the next TransactionLogNode at or after start_index, which is marked in
+    ///        logs_needing_rollback_. Returns proxy_transaction_logs_.size(), if there is none.
+    std::size_t FindNextLogNeedingRollback(const std::size_t start_index) const;
+
+    void SetLogNeedsRollbackBit(const std::size_t transaction_log_index);
+    void ClearLogNeedsRollbackBit(const std::size_t transaction_log_index);
 
     /// \brief Acquires next available/free transaction log from the proxy transaction logs.
     /// \param transaction_log_id
@@ -278,6 +314,15 @@ class TransactionLogSet
 
     TransactionLogCollection proxy_transaction_logs_;
     TransactionLogNode skeleton_tracing_transaction_log_;
+
+    /// \brief Dirty bitmap with one bit per element of proxy_transaction_logs_, which is set while the element needs a
+    ///        rollback.
+    /// \details A bit is set by MarkTransactionLogsNeedRollback() after marking the TransactionLogNode and cleared
+    ///          before resetting the TransactionLogNode. So a set bit is only a hint, that has to be confirmed by
+    ///          the TransactionLogNode itself, but every TransactionLogNode needing a rollback has its bit set.
+    ///          The bits of different TransactionLogNodes are updated concurrently by different proxy processes,
+    ///          therefore they are atomics.
+    LogBitmap logs_needing_rollback_;
 };
 
 }  // namespace score::mw::com::impl::lola
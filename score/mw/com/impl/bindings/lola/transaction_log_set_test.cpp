@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace score::mw::com::impl::lola
@@ -62,6 +63,15 @@ class TransactionLogSetFixture : public TransactionLogSetHelperFixture
         };
     }
 
+    TransactionLogLocalView::IsSlotReferencedCallback GetIsSlotReferencedCallbackWrapper() noexcept
+    {
+        // Since a MockFunction doesn't fit within an score::cpp::callback, we wrap it in a smaller lambda which only
+        // stores a pointer to the MockFunction and therefore fits within the score::cpp::callback.
+        return [this](const TransactionLog::SlotIndexType slot_index) noexcept {
+            return is_slot_referenced_callback_.AsStdFunction()(slot_index);
+        };
+    }
+
     TransactionLogLocalView::DereferenceSlotCallback GetUnsubscribeCallbackWrapper() noexcept
     {
         // Since a MockFunction doesn't fit within an score::cpp::callback, we wrap it in a smaller lambda which only
@@ -121,6 +131,7 @@ class TransactionLogSetFixture : public TransactionLogSetHelperFixture
     std::unique_ptr<TransactionLogSet> unit_{nullptr};
 
     StrictMock<MockFunction<void(TransactionLog::SlotIndexType)>> dereference_slot_callback_{};
+    StrictMock<MockFunction<bool(TransactionLog::SlotIndexType)>> is_slot_referenced_callback_{};
     StrictMock<MockFunction<void(TransactionLog::MaxSampleCountType)>> unsubscribe_callback_{};
 };
 
@@ -131,8 +142,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnUnregisteredIdIdReturn
     WithATransactionLogSet(kNumberOfLogs);
 
     // When calling RollbackProxyTransactions with a transaction log id that was never registered
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then a valid result is returned
     ASSERT_TRUE(rollback_result.has_value());
@@ -144,8 +157,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackWhenMaxLogsIsZeroReturns
     WithATransactionLogSet(number_of_logs);
 
     // When calling RollbackProxyTransactions with a transaction log id that was never registered
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then a valid result is returned
     EXPECT_TRUE(rollback_result.has_value());
@@ -169,8 +184,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdWithoutMar
     // and MarkTransactionLogsNeedRollback is not called
 
     // and RollbackProxyTransactions is called
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
     ASSERT_TRUE(rollback_result.has_value());
 
     // Then the TransactionLog still remains
@@ -202,8 +219,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdRollsBackL
     unit_->MarkTransactionLogsNeedRollback(kDummyTransactionLogId);
 
     // and RollbackProxyTransactions is called
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then no error should be returned
     ASSERT_TRUE(rollback_result.has_value());
@@ -240,8 +259,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdRollsBackF
     unit_->MarkTransactionLogsNeedRollback(kDummyTransactionLogId);
 
     // and RollbackProxyTransactions is called
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then no error should be returned
     ASSERT_TRUE(rollback_result.has_value());
@@ -254,8 +275,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdRollsBackF
                                            expect_needs_rollback);
 
     // and when RollbackProxyTransactions is called again
-    const auto rollback_result_2 = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result_2 = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                    GetDereferenceSlotCallbackWrapper(),
+                                                                    GetIsSlotReferencedCallbackWrapper(),
+                                                                    GetUnsubscribeCallbackWrapper());
 
     // Then no error should be returned
     ASSERT_TRUE(rollback_result_2.has_value());
@@ -293,8 +316,10 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdOnlyRollsB
         RegisterProxyElementWithSubscribeAndReferenceTransactions(kDummyTransactionLogId, slot_index);
 
     // When RollbackProxyTransactions is called
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then no error should be returned
     ASSERT_TRUE(rollback_result.has_value());
@@ -307,6 +332,93 @@ TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnRegisteredIdOnlyRollsB
                                            expect_needs_rollback);
 }
 
+TEST_F(TransactionLogSetRollbackFixture, CallingRollbackOnlyRollsBackMarkedLogsWithProvidedId)
+{
+    // Since we manually call rollback and also destroy a TransactionLogRegistrationGuard in this test, we need to
+    // disable the guard's destructor from doing any operations to avoid a crash. Details in
+    // TransactionLogRegistrationGuard.
+    TransactionLogRegistrationGuardDeactiveDestructionOperationGuard guard{};
+
+    const TransactionLogId other_transaction_log_id{kDummyTransactionLogId + 1U};
+
+    WithATransactionLogSet(kNumberOfLogs);
+
+    // Expecting that the unsubscribe callback will be called once
+    EXPECT_CALL(unsubscribe_callback_, Call(kSubscriptionMaxSampleCount));
+
+    // Given a TransactionLog with a successful subscribe transaction for another TransactionLogId, followed by one for
+    // the provided TransactionLogId
+    const auto other_transaction_log_registration_guard =
+        RegisterProxyElementWithSubscribeTransaction(other_transaction_log_id);
+    const auto transaction_log_registration_guard =
+        RegisterProxyElementWithSubscribeTransaction(kDummyTransactionLogId);
+
+    // and both TransactionLogIds are marked as needing a rollback
+    unit_->MarkTransactionLogsNeedRollback(other_transaction_log_id);
+    unit_->MarkTransactionLogsNeedRollback(kDummyTransactionLogId);
+
+    // When RollbackProxyTransactions is called for the provided TransactionLogId
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
+
+    // Then no error should be returned
+    ASSERT_TRUE(rollback_result.has_value());
+
+    // And only the TransactionLog of the other TransactionLogId should remain, still needing a rollback
+    const bool expect_needs_rollback{true};
+    ExpectProxyTransactionLogExistsAtIndex(*unit_,
+                                           other_transaction_log_id,
+                                           other_transaction_log_registration_guard.GetTransactionLogIndex(),
+                                           expect_needs_rollback);
+}
+
+TEST_F(TransactionLogSetRollbackFixture, CallingRollbackRollsBackMarkedLogsBehindTheFirst64Logs)
+{
+    // Since we manually call rollback and also destroy a TransactionLogRegistrationGuard in this test, we need to
+    // disable the guard's destructor from doing any operations to avoid a crash. Details in
+    // TransactionLogRegistrationGuard.
+    TransactionLogRegistrationGuardDeactiveDestructionOperationGuard guard{};
+
+    const std::size_t number_of_logs{130U};
+    const std::size_t number_of_logs_of_other_ids{100U};
+    const TransactionLogId other_transaction_log_id{kDummyTransactionLogId + 1U};
+
+    // Given a TransactionLogSet, whose dirty bitmap consists of several words
+    WithATransactionLogSet(number_of_logs);
+
+    // Expecting that the unsubscribe callback will be called once
+    EXPECT_CALL(unsubscribe_callback_, Call(kSubscriptionMaxSampleCount));
+
+    // and TransactionLogs of another TransactionLogId occupying the first words, which don't need a rollback
+    std::vector<TransactionLogRegistrationGuard> other_transaction_log_registration_guards{};
+    for (std::size_t i = 0U; i < number_of_logs_of_other_ids; ++i)
+    {
+        other_transaction_log_registration_guards.push_back(
+            unit_->RegisterProxyElement(other_transaction_log_id, consumer_event_data_control_local_).value());
+    }
+
+    // and a TransactionLog with a successful subscribe transaction behind them
+    const auto transaction_log_registration_guard =
+        RegisterProxyElementWithSubscribeTransaction(kDummyTransactionLogId);
+    ASSERT_EQ(transaction_log_registration_guard.GetTransactionLogIndex(), number_of_logs_of_other_ids);
+
+    // When MarkTransactionLogsNeedRollback and RollbackProxyTransactions are called
+    unit_->MarkTransactionLogsNeedRollback(kDummyTransactionLogId);
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
+
+    // Then no error should be returned
+    ASSERT_TRUE(rollback_result.has_value());
+
+    // And the TransactionLog should be cleared, while the ones of the other TransactionLogId remain
+    EXPECT_FALSE(IsProxyTransactionLogIdRegistered(*unit_, kDummyTransactionLogId));
+    EXPECT_TRUE(IsProxyTransactionLogIdRegistered(*unit_, other_transaction_log_id));
+}
+
 TEST_F(TransactionLogSetRollbackFixture,
        CallingRollbackOnRegisteredProxyTransactionLogIdPropagatesErrorFromTransactionLog)
 {
@@ -336,8 +448,10 @@ TEST_F(TransactionLogSetRollbackFixture,
     unit_->MarkTransactionLogsNeedRollback(kDummyTransactionLogId);
 
     // and RollbackProxyTransactions is called
-    const auto rollback_result = unit_->RollbackProxyTransactions(
-        kDummyTransactionLogId, GetDereferenceSlotCallbackWrapper(), GetUnsubscribeCallbackWrapper());
+    const auto rollback_result = unit_->RollbackProxyTransactions(kDummyTransactionLogId,
+                                                                  GetDereferenceSlotCallbackWrapper(),
+                                                                  GetIsSlotReferencedCallbackWrapper(),
+                                                                  GetUnsubscribeCallbackWrapper());
 
     // Then an error should be returned
     ASSERT_FALSE(rollback_result.has_value());
@@ -670,5 +784,40 @@ TEST_F(TransactionLogSetRegisterFixture, RegisterUnregisterMultipleTransactionLo
     ExpectTransactionLogSetEmpty(*unit_);
 }
 
+using TransactionLogSetVisitFixture = TransactionLogSetFixture;
+TEST_F(TransactionLogSetVisitFixture, VisitingReferencedSlotsReportsTheReferencedSlotsOfEachRegisteredProxy)
+{
+    const TransactionLog::SlotIndexType slot_index{1U};
+    const TransactionLogId other_transaction_log_id{kDummyTransactionLogId + 1U};
+
+    // Given a TransactionLogSet with one proxy, which references a slot, and one proxy, which doesn't
+    WithATransactionLogSet(kNumberOfLogs);
+    auto referencing_guard =
+        RegisterProxyElementWithSubscribeAndReferenceTransactions(kDummyTransactionLogId, slot_index);
+    auto subscribed_guard = RegisterProxyElementWithSubscribeTransaction(other_transaction_log_id);
+
+    // When visiting the referenced slots of the proxies
+    std::vector<std::pair<TransactionLogId, std::size_t>> visited_proxies{};
+    unit_->VisitReferencedSlotsOfProxies(
+        [&visited_proxies](const TransactionLogId transaction_log_id, const std::size_t number_of_referenced_slots) {
+            visited_proxies.emplace_back(transaction_log_id, number_of_referenced_slots);
+        });
+
+    // Then both proxies are visited with the number of slots they reference
+    ASSERT_EQ(visited_proxies.size(), 2U);
+    EXPECT_EQ(visited_proxies.at(0U), std::make_pair(kDummyTransactionLogId, std::size_t{1U}));
+    EXPECT_EQ(visited_proxies.at(1U), std::make_pair(other_transaction_log_id, std::size_t{0U}));
+
+    // Cleanup: Finish all transactions, so that the proxies can be unregistered
+    TransactionLogLocalView referencing_log{unit_->GetTransactionLog(referencing_guard.GetTransactionLogIndex())};
+    referencing_log.DereferenceTransactionBegin(slot_index);
+    referencing_log.DereferenceTransactionCommit(slot_index);
+    referencing_log.UnsubscribeTransactionBegin();
+    referencing_log.UnsubscribeTransactionCommit();
+    TransactionLogLocalView subscribed_log{unit_->GetTransactionLog(subscribed_guard.GetTransactionLogIndex())};
+    subscribed_log.UnsubscribeTransactionBegin();
+    subscribed_log.UnsubscribeTransactionCommit();
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::lola
@@ -13,39 +13,99 @@
 #ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_SLOT_H
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_SLOT_H
 
+#include "score/mw/com/impl/util/copyable_atomic.h"
+
+#include <score/utility.hpp>
+
+#include <atomic>
 #include <cstdint>
 
 namespace score::mw::com::impl::lola
 {
 
+/// \brief Records the begin and end of a transaction in shared memory.
+///
+/// Both bits are held in one lock-free atomic word, so that a thread waiting for the transaction-END bit to be cleared
+/// by another thread (see TransactionLogLocalView::WaitForTransactionEndToBecomeFalse()) reads it with an atomic load.
+///
+/// The setters are release RMWs and the getters acquire loads: Recording a transaction only has to be ordered after
+/// the preceding writes of the same thread. Only the wait/wake handshake on the transaction-END bit uses the seq_cst
+/// variants ClearTransactionEndSeqCst() and GetTransactionEndSeqCst(): The waiter increments the number of waiters and
+/// then reads the bit, the waker clears the bit and then reads the number of waiters. These are store-load pairs on
+/// different words, which acquire/release doesn't order, so without a single total order both could miss each other and
+/// the waiter would sleep until its timeout.
 class TransactionLogSlot
 {
   public:
-    TransactionLogSlot() noexcept : transaction_begin_{0U}, transaction_end_{0U} {}
+    TransactionLogSlot() noexcept : transaction_bits_{0U} {}
 
     void SetTransactionBegin(bool new_value) noexcept
     {
-        transaction_begin_ = static_cast<std::uint8_t>(new_value);
+        SetBit(kTransactionBeginBit, new_value);
     }
     void SetTransactionEnd(bool new_value) noexcept
     {
-        transaction_end_ = static_cast<std::uint8_t>(new_value);
+        SetBit(kTransactionEndBit, new_value);
+    }
+
+    /// \brief Sets both bits in one step, i.e. records a transaction, which has been begun and committed.
+    void SetTransactionBeginAndEnd() noexcept
+    {
+        score::cpp::ignore = transaction_bits_.GetUnderlying().fetch_or(
+            static_cast<std::uint8_t>(kTransactionBeginBit | kTransactionEndBit), std::memory_order_release);
+    }
+
+    /// \brief Clears the transaction-END bit as part of the wait/wake handshake, i.e. before the waiters get woken up.
+    void ClearTransactionEndSeqCst() noexcept
+    {
+        score::cpp::ignore = transaction_bits_.GetUnderlying().fetch_and(
+            static_cast<std::uint8_t>(~kTransactionEndBit), std::memory_order_seq_cst);
     }
 
     bool GetTransactionBegin() const noexcept
     {
-        return static_cast<bool>(transaction_begin_);
+        return IsBitSet(kTransactionBeginBit, std::memory_order_acquire);
     }
     bool GetTransactionEnd() const noexcept
     {
-        return static_cast<bool>(transaction_end_);
+        return IsBitSet(kTransactionEndBit, std::memory_order_acquire);
+    }
+
+    /// \brief Reads the transaction-END bit as part of the wait/wake handshake, i.e. after announcing the waiter.
+    bool GetTransactionEndSeqCst() const noexcept
+    {
+        return IsBitSet(kTransactionEndBit, std::memory_order_seq_cst);
     }
 
   private:
-    std::uint8_t transaction_begin_ : 1;
-    std::uint8_t transaction_end_ : 2;
+    static constexpr std::uint8_t kTransactionBeginBit{0x01U};
+    static constexpr std::uint8_t kTransactionEndBit{0x02U};
+
+    void SetBit(const std::uint8_t bit, const bool new_value) noexcept
+    {
+        auto& transaction_bits = transaction_bits_.GetUnderlying();
+        if (new_value)
+        {
+            score::cpp::ignore = transaction_bits.fetch_or(bit, std::memory_order_release);
+        }
+        else
+        {
+            score::cpp::ignore =
+                transaction_bits.fetch_and(static_cast<std::uint8_t>(~bit), std::memory_order_release);
+        }
+    }
+
+    bool IsBitSet(const std::uint8_t bit, const std::memory_order order) const noexcept
+    {
+        return (transaction_bits_.GetUnderlying().load(order) & bit) != 0U;
+    }
+
+    CopyableAtomic<std::uint8_t> transaction_bits_;
 };
 
+static_assert(std::atomic<std::uint8_t>::is_always_lock_free,
+              "TransactionLogSlot is placed in shared memory and therefore requires a lock-free atomic");
+
 }  // namespace score::mw::com::impl::lola
 
 #endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_SLOT_H
@@ -57,5 +57,28 @@ TEST(TransactionLogSlotTest, SettingTransactionEnd)
     EXPECT_FALSE(unit.GetTransactionEnd());
 }
 
+TEST(TransactionLogSlotTest, SettingTransactionBeginAndEnd)
+{
+    TransactionLogSlot unit{};
+
+    unit.SetTransactionBeginAndEnd();
+
+    EXPECT_TRUE(unit.GetTransactionBegin());
+    EXPECT_TRUE(unit.GetTransactionEnd());
+    EXPECT_TRUE(unit.GetTransactionEndSeqCst());
+}
+
+TEST(TransactionLogSlotTest, ClearingTransactionEndOfWaitWakeHandshake)
+{
+    TransactionLogSlot unit{};
+    unit.SetTransactionBeginAndEnd();
+
+    unit.ClearTransactionEndSeqCst();
+
+    EXPECT_TRUE(unit.GetTransactionBegin());
+    EXPECT_FALSE(unit.GetTransactionEnd());
+    EXPECT_FALSE(unit.GetTransactionEndSeqCst());
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::lola
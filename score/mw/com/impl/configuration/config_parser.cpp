@@ -15,6 +15,7 @@
 #include "score/mw/com/impl/configuration/configuration_common_resources.h"
 #include "score/mw/com/impl/configuration/lola_method_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "score/mw/com/impl/configuration/precompiled_configuration.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/configuration/service_type_deployment.h"
 #include "score/mw/com/impl/configuration/tracing_configuration.h"
@@ -89,6 +90,8 @@ constexpr auto kAllowedConsumerKey = "allowedConsumer"sv;
 constexpr auto kAllowedProviderKey = "allowedProvider"sv;
 constexpr auto kQueueSizeKey = "queue-size"sv;
 constexpr auto kShmSizeCalcModeKey = "shm-size-calc-mode"sv;
+constexpr auto kServiceDiscoveryBackendKey = "service-discovery-backend"sv;
+constexpr auto kShmSizeCacheFileKey = "shm-size-cache-file"sv;
 constexpr auto kTracingPropertiesKey = "tracing"sv;
 constexpr auto kTracingEnabledKey = "enable"sv;
 constexpr auto kTracingGloballyEnabledDefaultValue = false;
@@ -104,6 +107,8 @@ constexpr auto kPermissionChecksKey = "permission-checks"sv;
 constexpr auto kSomeIpBinding = "SOME/IP"sv;
 constexpr auto kShmBinding = "SHM"sv;
 constexpr auto kShmSizeCalcModeSimulation = "SIMULATION"sv;
+constexpr auto kServiceDiscoveryBackendFlagFile = "FLAG_FILE"sv;
+constexpr auto kServiceDiscoveryBackendSharedMemoryRegistry = "SHARED_MEMORY_REGISTRY"sv;
 
 constexpr auto kTracingTraceFilterConfigPathDefaultValue = "./etc/mw_com_trace_filter.json"sv;
 constexpr auto kStrictPermission = "strict"sv;
@@ -240,6 +245,49 @@ auto ParseShmSizeCalcMode(const score::json::Object& json_map) -> score::cpp::op
     return score::cpp::nullopt;
 }
 
+auto ParseServiceDiscoveryBackend(const score::json::Object& json_map) -> score::cpp::optional<ServiceDiscoveryBackend>
+{
+    const auto& service_discovery_backend = json_map.find(kServiceDiscoveryBackendKey.data());
+    if (service_discovery_backend != json_map.cend())
+    {
+        auto backend_result = service_discovery_backend->second.As<std::string>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(backend_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        const auto& service_discovery_backend_value = backend_result.value().get();
+
+        if (service_discovery_backend_value == kServiceDiscoveryBackendFlagFile)
+        {
+            return ServiceDiscoveryBackend::kFlagFile;
+        }
+        else if (service_discovery_backend_value == kServiceDiscoveryBackendSharedMemoryRegistry)
+        {
+            return ServiceDiscoveryBackend::kSharedMemoryRegistry;
+        }
+        else
+        {
+            score::mw::log::LogError("lola") << "Unknown value " << service_discovery_backend_value << " in key "
+                                             << kServiceDiscoveryBackendKey;
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+        }
+    }
+
+    return score::cpp::nullopt;
+}
+
+auto ParseShmSizeCacheFile(const score::json::Object& json_map) -> std::optional<std::string>
+{
+    const auto& shm_size_cache_file = json_map.find(kShmSizeCacheFileKey.data());
+    if (shm_size_cache_file != json_map.cend())
+    {
+        auto path_result = shm_size_cache_file->second.As<std::string>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(path_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        return path_result.value().get();
+    }
+
+    return std::nullopt;
+}
+
 // Note 1:
 // Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall not be called
 //                                                                   implicitly"
@@ -1214,6 +1262,19 @@ auto ParseGlobalProperties(const score::json::Object& top_level_object) -> Globa
             global_configuration.SetShmSizeCalcMode(shm_size_calc_mode.value());
         }
 
+        const score::cpp::optional<ServiceDiscoveryBackend> service_discovery_backend{
+            ParseServiceDiscoveryBackend(process_properties_map)};
+        if (service_discovery_backend.has_value())
+        {
+            global_configuration.SetServiceDiscoveryBackend(service_discovery_backend.value());
+        }
+
+        std::optional<std::string> shm_size_cache_file{ParseShmSizeCacheFile(process_properties_map)};
+        if (shm_size_cache_file.has_value())
+        {
+            global_configuration.SetShmSizeCacheFilePath(std::move(shm_size_cache_file).value());
+        }
+
         const auto& application_id_it = process_properties_map.find(kApplicationIdKey.data());
         if (application_id_it != process_properties_map.cend())
         {
@@ -1403,6 +1464,13 @@ void CrosscheckServiceInstancesToTypes(const Configuration& config)
 // coverity[autosar_cpp14_a15_5_3_violation]
 auto score::mw::com::impl::configuration::Parse(const std::string_view path) -> Configuration
 {
+    // A precompiled configuration was already parsed and validated at build time and only needs to be decoded. It is
+    // selected by its file extension, so that loading a JSON configuration doesn't pay for probing the file first.
+    if (IsPrecompiledConfigurationPath(path))
+    {
+        return LoadPrecompiledConfiguration(path);
+    }
+
     const score::json::JsonParser json_parser_obj;
     // Reason for banning is AoU of vaJson library about integrity of provided path.
     // This AoU is forwarded as AoU of Lola. See broken_link_c/issue/5835192
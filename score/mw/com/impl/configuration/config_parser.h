@@ -21,6 +21,10 @@
 namespace score::mw::com::impl::configuration
 {
 
+/// \brief Parses the configuration file under the given path.
+///
+/// The file is a precompiled configuration (see precompiled_configuration.h), if the path ends with
+/// kPrecompiledConfigurationFileExtension, otherwise it is a JSON configuration.
 Configuration Parse(const std::string_view path);
 Configuration Parse(score::json::Any json);
 
@@ -2552,6 +2552,77 @@ const std::vector<std::tuple<std::string, ShmSizeCalculationMode>> valid_global_
 
 INSTANTIATE_TEST_SUITE_P(ValidShmSizeCalcMode, ShmSizeCalcMode, ::testing::ValuesIn(valid_global_shm_size_calc_modes));
 
+class ServiceDiscoveryBackendParam
+    : public ::testing::TestWithParam<std::tuple<std::string, ServiceDiscoveryBackend>>
+{
+};
+
+TEST_P(ServiceDiscoveryBackendParam, ValidServiceDiscoveryBackend)
+{
+    json::JsonParser json_parser_obj;
+    json::Any json{json_parser_obj.FromBuffer(std::get<std::string>(GetParam())).value()};
+    Configuration config{configuration::Parse(std::move(json))};
+    EXPECT_EQ(config.GetGlobalConfiguration().GetServiceDiscoveryBackend(),
+              std::get<ServiceDiscoveryBackend>(GetParam()));
+}
+
+const std::vector<std::tuple<std::string, ServiceDiscoveryBackend>> valid_global_service_discovery_backends{
+    {R"json({"serviceTypes": [], "serviceInstances": [],
+             "global": { "service-discovery-backend": "FLAG_FILE" }})json",
+     ServiceDiscoveryBackend::kFlagFile},
+    {R"json({"serviceTypes": [], "serviceInstances": [],
+             "global": { "service-discovery-backend": "SHARED_MEMORY_REGISTRY" }})json",
+     ServiceDiscoveryBackend::kSharedMemoryRegistry},
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "asil-level": "QM" }})json",
+     ServiceDiscoveryBackend::kFlagFile},
+};
+
+INSTANTIATE_TEST_SUITE_P(ValidServiceDiscoveryBackend,
+                         ServiceDiscoveryBackendParam,
+                         ::testing::ValuesIn(valid_global_service_discovery_backends));
+
+TEST(ConfigParserServiceDiscoveryBackend, UnknownServiceDiscoveryBackendWillDie)
+{
+    // Given a JSON with an unknown service discovery backend
+    json::JsonParser json_parser_obj;
+    auto json = json_parser_obj.FromBuffer(R"json({"serviceTypes": [], "serviceInstances": [],
+                                                   "global": { "service-discovery-backend": "Unknown" }})json");
+
+    // When parsing the JSON
+    // Then the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::Parse(std::move(json).value()));
+}
+
+TEST(ConfigParserShmSizeCacheFile, ShmSizeCacheFileIsParsed)
+{
+    // Given a JSON with a configured shm size cache file
+    json::JsonParser json_parser_obj;
+    auto json = json_parser_obj.FromBuffer(R"json({"serviceTypes": [], "serviceInstances": [],
+                                                   "global": { "shm-size-cache-file": "/tmp/shm_sizes.json" }})json");
+
+    // When parsing the JSON
+    const Configuration config{configuration::Parse(std::move(json).value())};
+
+    // Then the path is part of the global configuration
+    ASSERT_TRUE(config.GetGlobalConfiguration().GetShmSizeCacheFilePath().has_value());
+    EXPECT_EQ(config.GetGlobalConfiguration().GetShmSizeCacheFilePath().value(), "/tmp/shm_sizes.json");
+}
+
+TEST(ConfigParserShmSizeCacheFile, ShmSizeCacheFileIsEmptyIfNotConfigured)
+{
+    // Given a JSON without a configured shm size cache file
+    json::JsonParser json_parser_obj;
+    auto json = json_parser_obj.FromBuffer(R"json({"serviceTypes": [], "serviceInstances": [],
+                                                   "global": { "asil-level": "QM" }})json");
+
+    // When parsing the JSON
+    const Configuration config{configuration::Parse(std::move(json).value())};
+
+    // Then no path is part of the global configuration
+    EXPECT_FALSE(config.GetGlobalConfiguration().GetShmSizeCacheFilePath().has_value());
+}
+
 TEST(ConfigParserTracing, EnablingGlobalTracingFlagSetsTracingEnabled)
 {
     RecordProperty("Verifies", "SCR-18159733");
@@ -25,7 +25,9 @@ GlobalConfiguration::GlobalConfiguration() noexcept
       message_rx_queue_size_qm{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_rx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_tx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_TX_QUEUE},
-      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation}
+      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation},
+      service_discovery_backend_{ServiceDiscoveryBackend::kFlagFile},
+      shm_size_cache_file_path_{}
 {
 }
 
@@ -14,12 +14,16 @@
 #define SCORE_MW_COM_IMPL_CONFIGURATION_GLOBAL_CONFIGURATION_H
 
 #include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/service_discovery_backend.h"
 #include "score/mw/com/impl/configuration/shm_size_calc_mode.h"
 
 #include <score/optional.hpp>
 
 #include <sys/types.h>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
 
 namespace score::mw::com::impl
 {
@@ -66,6 +70,16 @@ class GlobalConfiguration final
 
     void SetShmSizeCalcMode(const ShmSizeCalculationMode shm_size_calc_mode) noexcept;
 
+    void SetServiceDiscoveryBackend(const ServiceDiscoveryBackend service_discovery_backend) noexcept
+    {
+        service_discovery_backend_ = service_discovery_backend;
+    }
+
+    void SetShmSizeCacheFilePath(std::string shm_size_cache_file_path) noexcept
+    {
+        shm_size_cache_file_path_ = std::move(shm_size_cache_file_path);
+    }
+
     std::int32_t GetReceiverMessageQueueSize(const QualityType quality_type) const noexcept;
 
     std::int32_t GetSenderMessageQueueSize() const noexcept
@@ -93,6 +107,18 @@ class GlobalConfiguration final
         return shm_size_calc_mode_;
     }
 
+    ServiceDiscoveryBackend GetServiceDiscoveryBackend() const noexcept
+    {
+        return service_discovery_backend_;
+    }
+
+    /// \brief Path of the file, in which calculated shm-object sizes get persisted across process restarts. If not
+    ///        set, calculated sizes are only cached in-process.
+    const std::optional<std::string>& GetShmSizeCacheFilePath() const noexcept
+    {
+        return shm_size_cache_file_path_;
+    }
+
   private:
     /// properties/settings from the "global" section
     QualityType process_asil_level_;
@@ -103,6 +129,8 @@ class GlobalConfiguration final
     std::int32_t message_tx_queue_size_b;
 
     ShmSizeCalculationMode shm_size_calc_mode_;
+    ServiceDiscoveryBackend service_discovery_backend_;
+    std::optional<std::string> shm_size_cache_file_path_;
 };
 
 }  // namespace score::mw::com::impl
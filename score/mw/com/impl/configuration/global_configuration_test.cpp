@@ -118,6 +118,20 @@ TEST(GlobalConfigurationTest, GettingShmSizeCalcModeBeforeSetValueReturnsDefault
     EXPECT_EQ(get_shm_calc_size_mod, kDefaultShmSizeCalculationMode);
 }
 
+TEST(GlobalConfigurationTest, ShmSizeCacheFilePathIsEmptyByDefault)
+{
+    GlobalConfiguration global_configuration{};
+    EXPECT_FALSE(global_configuration.GetShmSizeCacheFilePath().has_value());
+}
+
+TEST(GlobalConfigurationTest, GettingShmSizeCacheFilePathReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+    global_configuration.SetShmSizeCacheFilePath("/tmp/lola_shm_sizes.json");
+    ASSERT_TRUE(global_configuration.GetShmSizeCacheFilePath().has_value());
+    EXPECT_EQ(global_configuration.GetShmSizeCacheFilePath().value(), "/tmp/lola_shm_sizes.json");
+}
+
 TEST(GlobalConfigurationDeathTest, GetReceiverMessageQueueSize_InvalidQualityType)
 {
     // Given a default constructed GlobalConfiguration
@@ -0,0 +1,652 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/precompiled_configuration.h"
+
+#include "score/mw/com/impl/configuration/configuration_common_resources.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/service_discovery_backend.h"
+#include "score/mw/com/impl/configuration/shm_size_calc_mode.h"
+#include "score/mw/com/impl/instance_specifier.h"
+#include "score/mw/com/impl/service_element_type.h"
+#include "score/mw/com/impl/tracing/configuration/service_element_identifier.h"
+
+#include "score/json/json_parser.h"
+#include "score/mw/log/logging.h"
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace score::mw::com::impl::configuration
+{
+namespace
+{
+
+using std::string_view_literals::operator""sv;
+
+constexpr auto kServiceTypesKey = "serviceTypes"sv;
+constexpr auto kServiceInstancesKey = "serviceInstances"sv;
+constexpr auto kGlobalKey = "global"sv;
+constexpr auto kTracingKey = "tracing"sv;
+constexpr auto kServiceIdentifierKey = "serviceIdentifier"sv;
+constexpr auto kInstanceSpecifierKey = "instanceSpecifier"sv;
+constexpr auto kDeploymentKey = "deployment"sv;
+
+constexpr auto kProcessAsilLevelKey = "processAsilLevel"sv;
+constexpr auto kApplicationIdKey = "applicationId"sv;
+constexpr auto kReceiverQueueSizeQmKey = "receiverQueueSizeQm"sv;
+constexpr auto kReceiverQueueSizeBKey = "receiverQueueSizeB"sv;
+constexpr auto kSenderQueueSizeKey = "senderQueueSize"sv;
+constexpr auto kShmSizeCalcModeKey = "shmSizeCalcMode"sv;
+constexpr auto kServiceDiscoveryBackendKey = "serviceDiscoveryBackend"sv;
+constexpr auto kShmSizeCacheFileKey = "shmSizeCacheFile"sv;
+
+constexpr auto kTracingEnabledKey = "enabled"sv;
+constexpr auto kApplicationInstanceIdKey = "applicationInstanceId"sv;
+constexpr auto kTraceFilterConfigPathKey = "traceFilterConfigPath"sv;
+constexpr auto kServiceElementsKey = "serviceElements"sv;
+constexpr auto kServiceTypeNameKey = "serviceTypeName"sv;
+constexpr auto kServiceElementNameKey = "serviceElementName"sv;
+constexpr auto kServiceElementTypeKey = "serviceElementType"sv;
+constexpr auto kInstanceSpecifiersKey = "instanceSpecifiers"sv;
+
+/// \brief Header: magic, format version and size of the encoded payload, which follows the header.
+constexpr std::size_t kHeaderSize{kPrecompiledConfigurationMagic.size() + sizeof(std::uint32_t) +
+                                  sizeof(std::uint64_t)};
+
+/// \brief Maximum nesting of objects/lists. Deployments are nested far less deep, so this only protects the decoder
+///        against corrupted files.
+constexpr std::uint32_t kMaxNestingDepth{32U};
+
+/// \brief Type tags of the encoded json values.
+enum class ValueTag : std::uint8_t
+{
+    kObject = 1U,
+    kList = 2U,
+    kString = 3U,
+    kBool = 4U,
+    kUnsigned = 5U,
+    kSigned = 6U,
+};
+
+[[noreturn]] void TerminateOnCorruptedConfiguration(const std::string_view reason) noexcept
+{
+    ::score::mw::log::LogFatal("lola") << "Precompiled configuration is corrupted:" << reason << ". Terminating.";
+    std::terminate();
+}
+
+[[noreturn]] void TerminateOnUnreadableFile(const std::string_view path, const std::string_view operation) noexcept
+{
+    ::score::mw::log::LogFatal("lola") << "Precompiled configuration" << path << "can't be read:" << operation
+                                       << "failed. Terminating.";
+    std::terminate();
+}
+
+class BinaryWriter
+{
+  public:
+    template <typename T>
+    void WriteFixed(const T value) noexcept
+    {
+        static_assert(std::is_unsigned<T>::value, "Only unsigned integers are written as fixed size values");
+        for (std::size_t byte_index = 0U; byte_index < sizeof(T); ++byte_index)
+        {
+            const auto byte = static_cast<std::uint8_t>(static_cast<std::uint64_t>(value) >> (8U * byte_index));
+            buffer_.push_back(static_cast<char>(byte));
+        }
+    }
+
+    void WriteBytes(const std::string_view bytes) noexcept
+    {
+        buffer_.append(bytes.data(), bytes.size());
+    }
+
+    void WriteString(const std::string_view string) noexcept
+    {
+        WriteFixed(static_cast<std::uint32_t>(string.size()));
+        WriteBytes(string);
+    }
+
+    void WriteAny(const json::Any& value) noexcept;
+
+    std::string& GetBuffer() noexcept
+    {
+        return buffer_;
+    }
+
+  private:
+    void WriteTag(const ValueTag tag) noexcept
+    {
+        WriteFixed(static_cast<std::underlying_type_t<ValueTag>>(tag));
+    }
+
+    std::string buffer_{};
+};
+
+void BinaryWriter::WriteAny(const json::Any& value) noexcept
+{
+    const auto object_result = value.As<json::Object>();
+    if (object_result.has_value())
+    {
+        const auto& object = object_result.value().get();
+        WriteTag(ValueTag::kObject);
+        WriteFixed(static_cast<std::uint32_t>(object.size()));
+        for (const auto& element : object)
+        {
+            WriteString(element.first.GetAsStringView());
+            WriteAny(element.second);
+        }
+        return;
+    }
+
+    const auto list_result = value.As<json::List>();
+    if (list_result.has_value())
+    {
+        const auto& list = list_result.value().get();
+        WriteTag(ValueTag::kList);
+        WriteFixed(static_cast<std::uint32_t>(list.size()));
+        for (const auto& element : list)
+        {
+            WriteAny(element);
+        }
+        return;
+    }
+
+    const auto string_result = value.As<std::string>();
+    if (string_result.has_value())
+    {
+        WriteTag(ValueTag::kString);
+        WriteString(string_result.value().get());
+        return;
+    }
+
+    const auto bool_result = value.As<bool>();
+    if (bool_result.has_value())
+    {
+        WriteTag(ValueTag::kBool);
+        WriteFixed(static_cast<std::uint8_t>(bool_result.value() ? 1U : 0U));
+        return;
+    }
+
+    const auto unsigned_result = value.As<std::uint64_t>();
+    if (unsigned_result.has_value())
+    {
+        WriteTag(ValueTag::kUnsigned);
+        WriteFixed(unsigned_result.value());
+        return;
+    }
+
+    const auto signed_result = value.As<std::int64_t>();
+    if (signed_result.has_value())
+    {
+        WriteTag(ValueTag::kSigned);
+        WriteFixed(static_cast<std::uint64_t>(signed_result.value()));
+        return;
+    }
+
+    // Floating point numbers and null values aren't used by any serialized configuration element.
+    ::score::mw::log::LogFatal("lola") << "Configuration contains a value, which can't be precompiled. Terminating.";
+    std::terminate();
+}
+
+class BinaryReader
+{
+  public:
+    explicit BinaryReader(const std::string_view buffer) noexcept : buffer_{buffer}, offset_{0U} {}
+
+    std::string_view ReadBytes(const std::size_t count) noexcept
+    {
+        if (count > (buffer_.size() - offset_))
+        {
+            TerminateOnCorruptedConfiguration("unexpected end of data");
+        }
+        const auto bytes = buffer_.substr(offset_, count);
+        offset_ += count;
+        return bytes;
+    }
+
+    template <typename T>
+    T ReadFixed() noexcept
+    {
+        static_assert(std::is_unsigned<T>::value, "Only unsigned integers are read as fixed size values");
+        const auto bytes = ReadBytes(sizeof(T));
+        std::uint64_t value{0U};
+        for (std::size_t byte_index = 0U; byte_index < sizeof(T); ++byte_index)
+        {
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(bytes[byte_index])) << (8U * byte_index);
+        }
+        return static_cast<T>(value);
+    }
+
+    std::string ReadString() noexcept
+    {
+        const auto size = ReadFixed<std::uint32_t>();
+        const auto bytes = ReadBytes(size);
+        return std::string{bytes.data(), bytes.size()};
+    }
+
+    json::Any ReadAny(const std::uint32_t depth) noexcept;
+
+    bool IsAtEnd() const noexcept
+    {
+        return offset_ == buffer_.size();
+    }
+
+  private:
+    std::string_view buffer_;
+    std::size_t offset_;
+};
+
+json::Any BinaryReader::ReadAny(const std::uint32_t depth) noexcept
+{
+    if (depth > kMaxNestingDepth)
+    {
+        TerminateOnCorruptedConfiguration("maximum nesting depth exceeded");
+    }
+
+    const auto tag = static_cast<ValueTag>(ReadFixed<std::underlying_type_t<ValueTag>>());
+    // Suppress "AUTOSAR C++14 M6-4-5" and "AUTOSAR C++14 M6-4-3", The rule states: An unconditional throw or break
+    // statement shall terminate every nonempty switch-clause." and "A switch statement shall be a well-formed switch
+    // statement.", respectively. The `return` statements in the case clauses unconditionally exit the function,
+    // making an additional `break` statement redundant.
+    // coverity[autosar_cpp14_m6_4_3_violation] See above
+    switch (tag)
+    {
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kObject:
+        {
+            const auto size = ReadFixed<std::uint32_t>();
+            json::Object object{};
+            for (std::uint32_t index = 0U; index < size; ++index)
+            {
+                auto key = ReadString();
+                auto element = ReadAny(depth + 1U);
+                const auto insert_result = object.insert(std::make_pair(std::move(key), std::move(element)));
+                if (!insert_result.second)
+                {
+                    TerminateOnCorruptedConfiguration("duplicate object key");
+                }
+            }
+            return json::Any{std::move(object)};
+        }
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kList:
+        {
+            const auto size = ReadFixed<std::uint32_t>();
+            json::List list{};
+            for (std::uint32_t index = 0U; index < size; ++index)
+            {
+                list.push_back(ReadAny(depth + 1U));
+            }
+            return json::Any{std::move(list)};
+        }
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kString:
+            return json::Any{ReadString()};
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kBool:
+            return json::Any{ReadFixed<std::uint8_t>() != 0U};
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kUnsigned:
+            return json::Any{ReadFixed<std::uint64_t>()};
+        // coverity[autosar_cpp14_m6_4_5_violation] Return will terminate this switch clause
+        case ValueTag::kSigned:
+            return json::Any{static_cast<std::int64_t>(ReadFixed<std::uint64_t>())};
+        // coverity[autosar_cpp14_m6_4_5_violation] Termination will terminate this switch clause
+        default:
+            TerminateOnCorruptedConfiguration("unknown value tag");
+    }
+}
+
+auto AsObject(const json::Any& value) noexcept -> const json::Object&
+{
+    const auto object_result = value.As<json::Object>();
+    if (!object_result.has_value())
+    {
+        TerminateOnCorruptedConfiguration("expected an object");
+    }
+    return object_result.value().get();
+}
+
+auto AsString(const json::Any& value) noexcept -> const std::string&
+{
+    const auto string_result = value.As<std::string>();
+    if (!string_result.has_value())
+    {
+        TerminateOnCorruptedConfiguration("expected a string");
+    }
+    return string_result.value().get();
+}
+
+auto CreateInstanceSpecifier(std::string instance_specifier) noexcept -> InstanceSpecifier
+{
+    auto instance_specifier_result = InstanceSpecifier::Create(std::move(instance_specifier));
+    if (!instance_specifier_result.has_value())
+    {
+        TerminateOnCorruptedConfiguration("invalid instance specifier");
+    }
+    return std::move(instance_specifier_result).value();
+}
+
+template <typename Enum>
+auto ToJson(const Enum value) noexcept -> json::Any
+{
+    return json::Any{static_cast<std::underlying_type_t<Enum>>(value)};
+}
+
+template <typename Enum>
+auto EnumFromJson(const json::Object& json_object, const std::string_view key) noexcept -> Enum
+{
+    return static_cast<Enum>(GetValueFromJson<std::underlying_type_t<Enum>>(json_object, key));
+}
+
+auto SerializeServiceTypes(const Configuration::ServiceTypeDeployments& service_types) noexcept -> json::List
+{
+    json::List service_types_json{};
+    for (const auto& service_type : service_types)
+    {
+        json::Object service_type_json{};
+        service_type_json[kServiceIdentifierKey.data()] = service_type.first.Serialize();
+        service_type_json[kDeploymentKey.data()] = service_type.second.Serialize();
+        service_types_json.push_back(json::Any{std::move(service_type_json)});
+    }
+    return service_types_json;
+}
+
+auto DeserializeServiceTypes(const json::Object& top_level_object) noexcept -> Configuration::ServiceTypeDeployments
+{
+    Configuration::ServiceTypeDeployments service_types{};
+    for (const auto& service_type : GetValueFromJson<json::List>(top_level_object, kServiceTypesKey))
+    {
+        const auto& service_type_json = AsObject(service_type);
+        ServiceIdentifierType service_identifier{
+            GetValueFromJson<json::Object>(service_type_json, kServiceIdentifierKey)};
+        ServiceTypeDeployment service_type_deployment{
+            GetValueFromJson<json::Object>(service_type_json, kDeploymentKey)};
+        const auto insert_result =
+            service_types.emplace(std::move(service_identifier), std::move(service_type_deployment));
+        if (!insert_result.second)
+        {
+            TerminateOnCorruptedConfiguration("duplicate service type");
+        }
+    }
+    return service_types;
+}
+
+auto SerializeServiceInstances(const Configuration::ServiceInstanceDeployments& service_instances) noexcept
+    -> json::List
+{
+    json::List service_instances_json{};
+    for (const auto& service_instance : service_instances)
+    {
+        json::Object service_instance_json{};
+        const auto instance_specifier_view = service_instance.first.ToString();
+        service_instance_json[kInstanceSpecifierKey.data()] =
+            json::Any{std::string{instance_specifier_view.data(), instance_specifier_view.size()}};
+        service_instance_json[kDeploymentKey.data()] = service_instance.second.Serialize();
+        service_instances_json.push_back(json::Any{std::move(service_instance_json)});
+    }
+    return service_instances_json;
+}
+
+auto DeserializeServiceInstances(const json::Object& top_level_object) noexcept
+    -> Configuration::ServiceInstanceDeployments
+{
+    Configuration::ServiceInstanceDeployments service_instances{};
+    for (const auto& service_instance : GetValueFromJson<json::List>(top_level_object, kServiceInstancesKey))
+    {
+        const auto& service_instance_json = AsObject(service_instance);
+        auto instance_specifier =
+            CreateInstanceSpecifier(GetValueFromJson<std::string>(service_instance_json, kInstanceSpecifierKey));
+        ServiceInstanceDeployment service_instance_deployment{
+            GetValueFromJson<json::Object>(service_instance_json, kDeploymentKey)};
+        const auto insert_result =
+            service_instances.emplace(std::move(instance_specifier), std::move(service_instance_deployment));
+        if (!insert_result.second)
+        {
+            TerminateOnCorruptedConfiguration("duplicate service instance");
+        }
+    }
+    return service_instances;
+}
+
+auto SerializeGlobalConfiguration(const GlobalConfiguration& global_configuration) noexcept -> json::Object
+{
+    json::Object global_json{};
+    global_json[kProcessAsilLevelKey.data()] = ToJson(global_configuration.GetProcessAsilLevel());
+    const auto application_id = global_configuration.GetApplicationId();
+    if (application_id.has_value())
+    {
+        global_json[kApplicationIdKey.data()] = json::Any{application_id.value()};
+    }
+    global_json[kReceiverQueueSizeQmKey.data()] =
+        json::Any{global_configuration.GetReceiverMessageQueueSize(QualityType::kASIL_QM)};
+    global_json[kReceiverQueueSizeBKey.data()] =
+        json::Any{global_configuration.GetReceiverMessageQueueSize(QualityType::kASIL_B)};
+    global_json[kSenderQueueSizeKey.data()] = json::Any{global_configuration.GetSenderMessageQueueSize()};
+    global_json[kShmSizeCalcModeKey.data()] = ToJson(global_configuration.GetShmSizeCalcMode());
+    global_json[kServiceDiscoveryBackendKey.data()] = ToJson(global_configuration.GetServiceDiscoveryBackend());
+    const auto& shm_size_cache_file_path = global_configuration.GetShmSizeCacheFilePath();
+    if (shm_size_cache_file_path.has_value())
+    {
+        global_json[kShmSizeCacheFileKey.data()] = json::Any{shm_size_cache_file_path.value()};
+    }
+    return global_json;
+}
+
+auto DeserializeGlobalConfiguration(const json::Object& top_level_object) noexcept -> GlobalConfiguration
+{
+    const auto& global_json = GetValueFromJson<json::Object>(top_level_object, kGlobalKey);
+
+    GlobalConfiguration global_configuration{};
+    global_configuration.SetProcessAsilLevel(EnumFromJson<QualityType>(global_json, kProcessAsilLevelKey));
+    const auto application_id =
+        GetOptionalValueFromJson<GlobalConfiguration::ApplicationId>(global_json, kApplicationIdKey);
+    if (application_id.has_value())
+    {
+        global_configuration.SetApplicationId(application_id.value());
+    }
+    global_configuration.SetReceiverMessageQueueSize(
+        QualityType::kASIL_QM, GetValueFromJson<std::int32_t>(global_json, kReceiverQueueSizeQmKey));
+    global_configuration.SetReceiverMessageQueueSize(
+        QualityType::kASIL_B, GetValueFromJson<std::int32_t>(global_json, kReceiverQueueSizeBKey));
+    global_configuration.SetSenderMessageQueueSize(GetValueFromJson<std::int32_t>(global_json, kSenderQueueSizeKey));
+    global_configuration.SetShmSizeCalcMode(EnumFromJson<ShmSizeCalculationMode>(global_json, kShmSizeCalcModeKey));
+    global_configuration.SetServiceDiscoveryBackend(
+        EnumFromJson<ServiceDiscoveryBackend>(global_json, kServiceDiscoveryBackendKey));
+    const auto shm_size_cache_file = global_json.find(kShmSizeCacheFileKey);
+    if (shm_size_cache_file != global_json.end())
+    {
+        global_configuration.SetShmSizeCacheFilePath(AsString(shm_size_cache_file->second));
+    }
+    return global_configuration;
+}
+
+auto SerializeTracingConfiguration(const TracingConfiguration& tracing_configuration) noexcept -> json::Object
+{
+    json::List service_elements_json{};
+    for (const auto& service_element : tracing_configuration.GetServiceElementTracingEnabledMap())
+    {
+        json::List instance_specifiers_json{};
+        for (const auto& instance_specifier : service_element.second)
+        {
+            const auto instance_specifier_view = instance_specifier.ToString();
+            instance_specifiers_json.push_back(
+                json::Any{std::string{instance_specifier_view.data(), instance_specifier_view.size()}});
+        }
+
+        json::Object service_element_json{};
+        service_element_json[kServiceTypeNameKey.data()] = json::Any{service_element.first.service_type_name};
+        service_element_json[kServiceElementNameKey.data()] = json::Any{service_element.first.service_element_name};
+        service_element_json[kServiceElementTypeKey.data()] = ToJson(service_element.first.service_element_type);
+        service_element_json[kInstanceSpecifiersKey.data()] = json::Any{std::move(instance_specifiers_json)};
+        service_elements_json.push_back(json::Any{std::move(service_element_json)});
+    }
+
+    json::Object tracing_json{};
+    tracing_json[kTracingEnabledKey.data()] = json::Any{tracing_configuration.IsTracingEnabled()};
+    const auto application_instance_id = tracing_configuration.GetApplicationInstanceID();
+    tracing_json[kApplicationInstanceIdKey.data()] =
+        json::Any{std::string{application_instance_id.data(), application_instance_id.size()}};
+    const auto trace_filter_config_path = tracing_configuration.GetTracingFilterConfigPath();
+    tracing_json[kTraceFilterConfigPathKey.data()] =
+        json::Any{std::string{trace_filter_config_path.data(), trace_filter_config_path.size()}};
+    tracing_json[kServiceElementsKey.data()] = json::Any{std::move(service_elements_json)};
+    return tracing_json;
+}
+
+auto DeserializeTracingConfiguration(const json::Object& top_level_object) noexcept -> TracingConfiguration
+{
+    const auto& tracing_json = GetValueFromJson<json::Object>(top_level_object, kTracingKey);
+
+    TracingConfiguration tracing_configuration{};
+    tracing_configuration.SetTracingEnabled(GetValueFromJson<bool>(tracing_json, kTracingEnabledKey));
+    tracing_configuration.SetApplicationInstanceID(
+        GetValueFromJson<std::string>(tracing_json, kApplicationInstanceIdKey));
+    tracing_configuration.SetTracingTraceFilterConfigPath(
+        GetValueFromJson<std::string>(tracing_json, kTraceFilterConfigPathKey));
+
+    for (const auto& service_element : GetValueFromJson<json::List>(tracing_json, kServiceElementsKey))
+    {
+        const auto& service_element_json = AsObject(service_element);
+        const tracing::ServiceElementIdentifier service_element_identifier{
+            GetValueFromJson<std::string>(service_element_json, kServiceTypeNameKey),
+            GetValueFromJson<std::string>(service_element_json, kServiceElementNameKey),
+            EnumFromJson<ServiceElementType>(service_element_json, kServiceElementTypeKey)};
+        const auto& instance_specifiers = GetValueFromJson<json::List>(service_element_json, kInstanceSpecifiersKey);
+        for (const auto& instance_specifier : instance_specifiers)
+        {
+            tracing_configuration.SetServiceElementTracingEnabled(
+                service_element_identifier, CreateInstanceSpecifier(AsString(instance_specifier)));
+        }
+    }
+    return tracing_configuration;
+}
+
+}  // namespace
+
+std::string SerializePrecompiledConfiguration(const Configuration& configuration) noexcept
+{
+    json::Object top_level_object{};
+    top_level_object[kServiceTypesKey.data()] = json::Any{SerializeServiceTypes(configuration.GetServiceTypes())};
+    top_level_object[kServiceInstancesKey.data()] =
+        json::Any{SerializeServiceInstances(configuration.GetServiceInstances())};
+    top_level_object[kGlobalKey.data()] = SerializeGlobalConfiguration(configuration.GetGlobalConfiguration());
+    top_level_object[kTracingKey.data()] = SerializeTracingConfiguration(configuration.GetTracingConfiguration());
+
+    BinaryWriter payload_writer{};
+    payload_writer.WriteAny(json::Any{std::move(top_level_object)});
+    const auto& payload = payload_writer.GetBuffer();
+
+    BinaryWriter writer{};
+    writer.WriteBytes(std::string_view{kPrecompiledConfigurationMagic.data(), kPrecompiledConfigurationMagic.size()});
+    writer.WriteFixed(kPrecompiledConfigurationVersion);
+    writer.WriteFixed(static_cast<std::uint64_t>(payload.size()));
+    writer.WriteBytes(payload);
+    return std::move(writer.GetBuffer());
+}
+
+bool IsPrecompiledConfiguration(const std::string_view buffer) noexcept
+{
+    return (buffer.size() >= kPrecompiledConfigurationMagic.size()) &&
+           (std::memcmp(buffer.data(), kPrecompiledConfigurationMagic.data(), kPrecompiledConfigurationMagic.size()) ==
+            0);
+}
+
+Configuration DeserializePrecompiledConfiguration(const std::string_view buffer) noexcept
+{
+    if (!IsPrecompiledConfiguration(buffer))
+    {
+        TerminateOnCorruptedConfiguration("missing magic");
+    }
+
+    BinaryReader reader{buffer};
+    score::cpp::ignore = reader.ReadBytes(kPrecompiledConfigurationMagic.size());
+    const auto version = reader.ReadFixed<std::uint32_t>();
+    if (version != kPrecompiledConfigurationVersion)
+    {
+        ::score::mw::log::LogFatal("lola") << "Precompiled configuration has version" << version << "but version"
+                                           << kPrecompiledConfigurationVersion << "is expected. Terminating.";
+        std::terminate();
+    }
+    const auto payload_size = reader.ReadFixed<std::uint64_t>();
+    if (payload_size != (buffer.size() - kHeaderSize))
+    {
+        TerminateOnCorruptedConfiguration("payload size doesn't match file size");
+    }
+
+    const auto top_level_json = reader.ReadAny(0U);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(reader.IsAtEnd());
+    const auto& top_level_object = AsObject(top_level_json);
+
+    return Configuration{DeserializeServiceTypes(top_level_object),
+                         DeserializeServiceInstances(top_level_object),
+                         DeserializeGlobalConfiguration(top_level_object),
+                         DeserializeTracingConfiguration(top_level_object)};
+}
+
+bool IsPrecompiledConfigurationPath(const std::string_view path) noexcept
+{
+    return (path.size() > kPrecompiledConfigurationFileExtension.size()) &&
+           (path.substr(path.size() - kPrecompiledConfigurationFileExtension.size()) ==
+            kPrecompiledConfigurationFileExtension);
+}
+
+Configuration LoadPrecompiledConfiguration(const std::string_view path) noexcept
+{
+    const std::string path_string{path.data(), path.size()};
+    ::score::os::StatBuffer stat_buffer{};
+    const auto stat_result = ::score::os::Stat::instance().stat(path_string.c_str(), stat_buffer);
+    if (!stat_result.has_value())
+    {
+        TerminateOnUnreadableFile(path, "stat");
+    }
+    const auto file_size = static_cast<std::size_t>(stat_buffer.st_size);
+    if (file_size < kHeaderSize)
+    {
+        TerminateOnCorruptedConfiguration("file is shorter than the header");
+    }
+
+    const auto open_result =
+        ::score::os::Fcntl::instance().open(path_string.c_str(), ::score::os::Fcntl::Open::kReadOnly);
+    if (!open_result.has_value())
+    {
+        TerminateOnUnreadableFile(path, "open");
+    }
+    const auto file_descriptor = open_result.value();
+    const auto mmap_result = ::score::os::Mman::instance().mmap(
+        nullptr, file_size, ::score::os::Mman::Protection::kRead, ::score::os::Mman::Map::kPrivate, file_descriptor, 0);
+    // The mapping stays valid after closing the file descriptor.
+    score::cpp::ignore = ::score::os::Unistd::instance().close(file_descriptor);
+    if (!mmap_result.has_value())
+    {
+        TerminateOnUnreadableFile(path, "mmap");
+    }
+
+    const std::string_view file_content{static_cast<const char*>(mmap_result.value()), file_size};
+    auto configuration = DeserializePrecompiledConfiguration(file_content);
+    score::cpp::ignore = ::score::os::Mman::instance().munmap(mmap_result.value(), file_size);
+    return configuration;
+}
+
+}  // namespace score::mw::com::impl::configuration
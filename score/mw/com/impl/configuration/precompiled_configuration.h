@@ -0,0 +1,67 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_CONFIGURATION_PRECOMPILED_CONFIGURATION_H
+#define SCORE_MW_COM_IMPL_CONFIGURATION_PRECOMPILED_CONFIGURATION_H
+
+#include "score/mw/com/impl/configuration/configuration.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace score::mw::com::impl::configuration
+{
+
+/// \brief Magic bytes at the start of every precompiled configuration file.
+///
+/// Used to tell a precompiled configuration apart from a JSON configuration, which can never start with these bytes.
+constexpr std::array<char, 8U> kPrecompiledConfigurationMagic{'\x7f', 'M', 'W', 'C', 'O', 'M', 'C', 'F'};
+
+/// \brief Version of the precompiled configuration format. Files with a different version are rejected.
+constexpr std::uint32_t kPrecompiledConfigurationVersion{1U};
+
+/// \brief Serializes a Configuration into the precompiled (binary) configuration format.
+///
+/// The format is meant to be produced at build time from an already validated JSON configuration (see
+/// mw_com_config_precompiler), so that loading it at runtime neither needs to tokenize JSON text nor to re-run the
+/// validation and cross checks of the JSON config parser. It contains no pointers and only fixed-width little-endian
+/// integers, so it is independent of the host it was created on and gets decoded directly from a read-only mapping of
+/// the file.
+std::string SerializePrecompiledConfiguration(const Configuration& configuration) noexcept;
+
+/// \brief Returns true, if the given buffer starts with kPrecompiledConfigurationMagic.
+bool IsPrecompiledConfiguration(std::string_view buffer) noexcept;
+
+/// \brief Creates a Configuration from a buffer, which was created by SerializePrecompiledConfiguration().
+///
+/// Terminates, if the buffer is truncated, has an unsupported version or is corrupted otherwise.
+Configuration DeserializePrecompiledConfiguration(std::string_view buffer) noexcept;
+
+/// \brief File extension, which selects the precompiled configuration format for a configuration path.
+///
+/// All other paths are parsed as JSON configuration without probing the file for kPrecompiledConfigurationMagic.
+constexpr std::string_view kPrecompiledConfigurationFileExtension{".bin"};
+
+/// \brief Returns true, if the given configuration path ends with kPrecompiledConfigurationFileExtension.
+bool IsPrecompiledConfigurationPath(std::string_view path) noexcept;
+
+/// \brief Maps the file under the given path and creates a Configuration from it.
+///
+/// Terminates, if the file can't be opened/mapped, if it doesn't start with kPrecompiledConfigurationMagic or if it is
+/// a corrupted precompiled configuration.
+Configuration LoadPrecompiledConfiguration(std::string_view path) noexcept;
+
+}  // namespace score::mw::com::impl::configuration
+
+#endif  // SCORE_MW_COM_IMPL_CONFIGURATION_PRECOMPILED_CONFIGURATION_H
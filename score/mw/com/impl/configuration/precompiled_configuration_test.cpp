@@ -0,0 +1,237 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/precompiled_configuration.h"
+
+#include "score/mw/com/impl/configuration/config_parser.h"
+#include "score/mw/com/impl/service_element_type.h"
+#include "score/mw/com/impl/tracing/configuration/service_element_identifier_view.h"
+
+#include <score/utility.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace score::mw::com::impl::configuration
+{
+namespace
+{
+
+const std::string kPrecompiledConfigurationPath{"/tmp/mw_com_config_precompiled_test.bin"};
+
+class PrecompiledConfigurationFixture : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        score::cpp::ignore = std::remove(kPrecompiledConfigurationPath.c_str());
+    }
+
+    std::string GetExampleConfigPath()
+    {
+        const std::string default_path = "score/mw/com/impl/configuration/example/mw_com_config.json";
+
+        std::ifstream file(default_path);
+        if (file.is_open())
+        {
+            file.close();
+            return default_path;
+        }
+        else
+        {
+            return "external/safe_posix_platform/" + default_path;
+        }
+    }
+
+    void WriteFile(const std::string_view content)
+    {
+        std::ofstream file{kPrecompiledConfigurationPath, std::ios::binary | std::ios::trunc};
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    void ExpectEqualConfigurations(const Configuration& expected, const Configuration& actual)
+    {
+        EXPECT_EQ(actual.GetServiceTypes(), expected.GetServiceTypes());
+        EXPECT_EQ(actual.GetServiceInstances(), expected.GetServiceInstances());
+
+        const auto& expected_global = expected.GetGlobalConfiguration();
+        const auto& actual_global = actual.GetGlobalConfiguration();
+        EXPECT_EQ(actual_global.GetProcessAsilLevel(), expected_global.GetProcessAsilLevel());
+        EXPECT_EQ(actual_global.GetApplicationId(), expected_global.GetApplicationId());
+        EXPECT_EQ(actual_global.GetReceiverMessageQueueSize(QualityType::kASIL_QM),
+                  expected_global.GetReceiverMessageQueueSize(QualityType::kASIL_QM));
+        EXPECT_EQ(actual_global.GetReceiverMessageQueueSize(QualityType::kASIL_B),
+                  expected_global.GetReceiverMessageQueueSize(QualityType::kASIL_B));
+        EXPECT_EQ(actual_global.GetSenderMessageQueueSize(), expected_global.GetSenderMessageQueueSize());
+        EXPECT_EQ(actual_global.GetShmSizeCalcMode(), expected_global.GetShmSizeCalcMode());
+        EXPECT_EQ(actual_global.GetServiceDiscoveryBackend(), expected_global.GetServiceDiscoveryBackend());
+        EXPECT_EQ(actual_global.GetShmSizeCacheFilePath(), expected_global.GetShmSizeCacheFilePath());
+
+        const auto& expected_tracing = expected.GetTracingConfiguration();
+        const auto& actual_tracing = actual.GetTracingConfiguration();
+        EXPECT_EQ(actual_tracing.IsTracingEnabled(), expected_tracing.IsTracingEnabled());
+        EXPECT_EQ(actual_tracing.GetApplicationInstanceID(), expected_tracing.GetApplicationInstanceID());
+        EXPECT_EQ(actual_tracing.GetTracingFilterConfigPath(), expected_tracing.GetTracingFilterConfigPath());
+        EXPECT_EQ(actual_tracing.GetServiceElementTracingEnabledMap(),
+                  expected_tracing.GetServiceElementTracingEnabledMap());
+    }
+};
+
+using PrecompiledConfigurationDeathTest = PrecompiledConfigurationFixture;
+
+TEST_F(PrecompiledConfigurationFixture, SerializedConfigurationStartsWithMagic)
+{
+    // Given a configuration parsed from the example JSON
+    const auto configuration = Parse(GetExampleConfigPath());
+
+    // When serializing it into the precompiled format
+    const auto serialized_configuration = SerializePrecompiledConfiguration(configuration);
+
+    // Then it is detected as precompiled configuration
+    EXPECT_TRUE(IsPrecompiledConfiguration(serialized_configuration));
+}
+
+TEST_F(PrecompiledConfigurationFixture, JsonIsNotDetectedAsPrecompiledConfiguration)
+{
+    EXPECT_FALSE(IsPrecompiledConfiguration(R"({"serviceTypes": []})"));
+    EXPECT_FALSE(IsPrecompiledConfiguration(""));
+}
+
+TEST_F(PrecompiledConfigurationFixture, DeserializingSerializedConfigurationReturnsEqualConfiguration)
+{
+    // Given a configuration parsed from the example JSON, which contains deployments and tracing enabled elements
+    const auto configuration = Parse(GetExampleConfigPath());
+    ASSERT_FALSE(configuration.GetTracingConfiguration().GetServiceElementTracingEnabledMap().empty());
+
+    // When serializing and deserializing it again
+    const auto deserialized_configuration =
+        DeserializePrecompiledConfiguration(SerializePrecompiledConfiguration(configuration));
+
+    // Then the deserialized configuration is equal to the original one
+    ExpectEqualConfigurations(configuration, deserialized_configuration);
+}
+
+TEST_F(PrecompiledConfigurationFixture, DeserializingKeepsTracingEnabledServiceElements)
+{
+    // Given a configuration parsed from the example JSON
+    const auto configuration = Parse(GetExampleConfigPath());
+
+    // When serializing and deserializing it again
+    const auto deserialized_configuration =
+        DeserializePrecompiledConfiguration(SerializePrecompiledConfiguration(configuration));
+
+    // Then tracing is still enabled for the field, which has tracing slots configured
+    const tracing::ServiceElementIdentifierView service_element_identifier_view{
+        "/score/ncar/services/TirePressureService", "CurrentTemperatureFrontLeft", ServiceElementType::FIELD};
+    EXPECT_TRUE(deserialized_configuration.GetTracingConfiguration().IsServiceElementTracingEnabled(
+        service_element_identifier_view, "abc/abc/TirePressurePort"));
+}
+
+TEST_F(PrecompiledConfigurationFixture, ParsingPrecompiledConfigurationFileReturnsEqualConfiguration)
+{
+    // Given a precompiled configuration file created from the example JSON
+    const auto configuration = Parse(GetExampleConfigPath());
+    WriteFile(SerializePrecompiledConfiguration(configuration));
+
+    // When parsing the precompiled configuration file
+    const auto precompiled_configuration = Parse(kPrecompiledConfigurationPath);
+
+    // Then the configuration is equal to the one parsed from JSON
+    ExpectEqualConfigurations(configuration, precompiled_configuration);
+}
+
+TEST_F(PrecompiledConfigurationFixture, OnlyPathsWithPrecompiledExtensionSelectThePrecompiledFormat)
+{
+    EXPECT_TRUE(IsPrecompiledConfigurationPath("/etc/mw_com_config.bin"));
+    EXPECT_TRUE(IsPrecompiledConfigurationPath("mw_com_config.json.bin"));
+    EXPECT_FALSE(IsPrecompiledConfigurationPath("./etc/mw_com_config.json"));
+    EXPECT_FALSE(IsPrecompiledConfigurationPath("/etc/mw_com_config.bin.json"));
+    EXPECT_FALSE(IsPrecompiledConfigurationPath("/etc/mw_com_config_bin"));
+    EXPECT_FALSE(IsPrecompiledConfigurationPath(".bin"));
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, ParsingPrecompiledConfigurationWithJsonExtensionTerminates)
+{
+    // Given a precompiled configuration file, which has the extension of a JSON configuration
+    const auto configuration = Parse(GetExampleConfigPath());
+    const std::string json_path{kPrecompiledConfigurationPath + ".json"};
+    {
+        std::ofstream file{json_path, std::ios::binary | std::ios::trunc};
+        const auto serialized_configuration = SerializePrecompiledConfiguration(configuration);
+        file.write(serialized_configuration.data(), static_cast<std::streamsize>(serialized_configuration.size()));
+    }
+
+    // When parsing it
+    // Then it isn't probed for the precompiled format, but parsed as invalid JSON, which terminates the program
+    EXPECT_DEATH(score::cpp::ignore = Parse(json_path), ".*");
+    score::cpp::ignore = std::remove(json_path.c_str());
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, ParsingJsonConfigurationWithPrecompiledExtensionTerminates)
+{
+    // Given a JSON configuration file, which has the extension of a precompiled configuration
+    std::ifstream json_file{GetExampleConfigPath()};
+    const std::string json_content{std::istreambuf_iterator<char>{json_file}, std::istreambuf_iterator<char>{}};
+    WriteFile(json_content);
+
+    // When parsing it
+    // Then the program terminates, since the file doesn't start with the magic of the precompiled format
+    EXPECT_DEATH(score::cpp::ignore = Parse(kPrecompiledConfigurationPath), ".*");
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, LoadingNonExistingFileTerminates)
+{
+    // When loading a precompiled configuration file, which doesn't exist
+    // Then the program terminates
+    EXPECT_DEATH(score::cpp::ignore = LoadPrecompiledConfiguration("my_invalid_path_to_nowhere.bin"), ".*");
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, DeserializingTruncatedConfigurationTerminates)
+{
+    // Given a precompiled configuration, of which the last byte is missing
+    const auto configuration = Parse(GetExampleConfigPath());
+    auto serialized_configuration = SerializePrecompiledConfiguration(configuration);
+    serialized_configuration.pop_back();
+
+    // When deserializing it
+    // Then the program terminates
+    EXPECT_DEATH(score::cpp::ignore = DeserializePrecompiledConfiguration(serialized_configuration), ".*");
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, DeserializingConfigurationWithOtherVersionTerminates)
+{
+    // Given a precompiled configuration with a different format version
+    const auto configuration = Parse(GetExampleConfigPath());
+    auto serialized_configuration = SerializePrecompiledConfiguration(configuration);
+    serialized_configuration[kPrecompiledConfigurationMagic.size()] =
+        static_cast<char>(kPrecompiledConfigurationVersion + 1U);
+
+    // When deserializing it
+    // Then the program terminates
+    EXPECT_DEATH(score::cpp::ignore = DeserializePrecompiledConfiguration(serialized_configuration), ".*");
+}
+
+TEST_F(PrecompiledConfigurationDeathTest, DeserializingBufferWithoutMagicTerminates)
+{
+    // When deserializing a JSON buffer
+    // Then the program terminates
+    EXPECT_DEATH(score::cpp::ignore = DeserializePrecompiledConfiguration(R"({"serviceTypes": []})"), ".*");
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::configuration
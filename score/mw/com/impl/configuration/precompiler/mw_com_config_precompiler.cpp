@@ -0,0 +1,61 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/config_parser.h"
+#include "score/mw/com/impl/configuration/precompiled_configuration.h"
+
+#include <score/utility.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+/// \brief Build-time tool, which converts a mw_com JSON configuration into the precompiled configuration format.
+///
+/// The JSON configuration is parsed with the regular config parser, so all its checks apply. The precompiled result
+/// gets deserialized again before it is written, so that a broken output file is never produced.
+///
+/// Usage: mw_com_config_precompiler <input mw_com_config.json> <output file>.bin
+int main(int argc, const char** argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input mw_com_config.json> <output file>.bin" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string input_path{argv[1]};
+    const std::string output_path{argv[2]};
+    // The runtime selects the precompiled format by the file extension, so any other name would be parsed as JSON.
+    if (!score::mw::com::impl::configuration::IsPrecompiledConfigurationPath(output_path))
+    {
+        std::cerr << "Output file " << output_path << " has to end with "
+                  << score::mw::com::impl::configuration::kPrecompiledConfigurationFileExtension << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto configuration = score::mw::com::impl::configuration::Parse(input_path);
+    const auto precompiled_configuration =
+        score::mw::com::impl::configuration::SerializePrecompiledConfiguration(configuration);
+    score::cpp::ignore =
+        score::mw::com::impl::configuration::DeserializePrecompiledConfiguration(precompiled_configuration);
+
+    std::ofstream output_file{output_path, std::ios::binary | std::ios::trunc};
+    output_file.write(precompiled_configuration.data(), static_cast<std::streamsize>(precompiled_configuration.size()));
+    output_file.close();
+    if (!output_file)
+    {
+        std::cerr << "Could not write precompiled configuration to " << output_path << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
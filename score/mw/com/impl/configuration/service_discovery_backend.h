@@ -0,0 +1,35 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_CONFIGURATION_SERVICE_DISCOVERY_BACKEND_H
+#define SCORE_MW_COM_IMPL_CONFIGURATION_SERVICE_DISCOVERY_BACKEND_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Mechanism used by the LoLa binding to announce and discover service instances.
+enum class ServiceDiscoveryBackend : std::uint8_t
+{
+    /// \brief One flag file per offered service instance, searches are served via directory crawling and inotify.
+    kFlagFile,
+    /// \brief One well-known shared-memory segment holding a table of all offered service instances.
+    kSharedMemoryRegistry,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const ServiceDiscoveryBackend& backend);
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_CONFIGURATION_SERVICE_DISCOVERY_BACKEND_H
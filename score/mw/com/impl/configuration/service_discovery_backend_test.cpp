@@ -0,0 +1,60 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/service_discovery_backend.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+TEST(ServiceDiscoveryBackendTest, OperatorStreamOutputsCorrectStringForkFlagFile)
+{
+    // Given a ServiceDiscoveryBackend set to kFlagFile
+    std::ostringstream oss;
+
+    // When streaming to ostringstream
+    oss << ServiceDiscoveryBackend::kFlagFile;
+
+    // Then the output should match "FLAG_FILE"
+    EXPECT_EQ(oss.str(), "FLAG_FILE");
+}
+
+TEST(ServiceDiscoveryBackendTest, OperatorStreamOutputsCorrectStringForkSharedMemoryRegistry)
+{
+    // Given a ServiceDiscoveryBackend set to kSharedMemoryRegistry
+    std::ostringstream oss;
+
+    // When streaming to ostringstream
+    oss << ServiceDiscoveryBackend::kSharedMemoryRegistry;
+
+    // Then the output should match "SHARED_MEMORY_REGISTRY"
+    EXPECT_EQ(oss.str(), "SHARED_MEMORY_REGISTRY");
+}
+
+TEST(ServiceDiscoveryBackendTest, OperatorStreamOutputsUnknownForInvalidValue)
+{
+    // Given a ServiceDiscoveryBackend set to an invalid value
+    std::ostringstream oss;
+    auto invalid_value = static_cast<ServiceDiscoveryBackend>(0xFF);
+
+    // When streaming to ostringstream
+    oss << invalid_value;
+
+    // Then the output should match "unknown"
+    EXPECT_EQ(oss.str(), "(unknown)");
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
@@ -115,6 +115,21 @@ TEST(TracingConfigurationTest, CheckingIsServiceElementTracingEnabledAfterSettin
     EXPECT_TRUE(is_enabled_2);
 }
 
+TEST(TracingConfigurationTest, GettingServiceElementTracingEnabledMapReturnsAllEnabledElements)
+{
+    // Given a TracingConfiguration which has enabled tracing for a service element
+    TracingConfiguration tracing_configuration{};
+    tracing_configuration.SetServiceElementTracingEnabled(kDummyServiceElementIdentifier, kDummyInstanceSpecifier);
+
+    // When getting the service element tracing enabled map
+    const auto& tracing_enabled_map = tracing_configuration.GetServiceElementTracingEnabledMap();
+
+    // Then it contains the enabled service element with its instance specifier
+    ASSERT_EQ(tracing_enabled_map.size(), 1U);
+    EXPECT_EQ(tracing_enabled_map.begin()->first, kDummyServiceElementIdentifier);
+    EXPECT_EQ(tracing_enabled_map.begin()->second.count(kDummyInstanceSpecifier), 1U);
+}
+
 TEST(TracingConfigurationDeathTest, SettingServiceElementTracingEnabledWithTheSameElementTerminates)
 {
     // Given a TracingConfiguration which has enabled tracing for a service element
@@ -40,6 +40,20 @@ using ServiceHandleContainer = std::vector<T>;
 template <typename T>
 using FindServiceHandler = score::cpp::callback<void(ServiceHandleContainer<T>, FindServiceHandle)>;
 
+/// \api
+/// \brief Opt-in alternative to FindServiceHandler, which only gets the changes of the service availability.
+///
+/// \details It takes as input parameters a handle container with the handles of the matching service instances, which
+/// became available, and one with the handles of those, which became unavailable since the previous call of the
+/// handler. The first call reports all matching service instances, which are available at that time, as added. The
+/// FindServiceHandle can be used to invoke StopFindService from within the handler.
+///
+/// Compared to FindServiceHandler, the cost of a call doesn't grow with the number of matching service instances, which
+/// makes it the better choice for searches (e.g. find-any searches), which match many service instances.
+template <typename T>
+using FindServiceDeltaHandler =
+    score::cpp::callback<void(ServiceHandleContainer<T> added, ServiceHandleContainer<T> removed, FindServiceHandle)>;
+
 }  // namespace score::mw::com::impl
 
 #endif  // SCORE_MW_COM_IMPL_FIND_SERVICE_HANDLER_H
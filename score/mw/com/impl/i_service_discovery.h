@@ -22,6 +22,8 @@
 
 #include "score/result/result.h"
 
+#include <score/span.hpp>
+
 namespace score::mw::com::impl
 {
 
@@ -38,6 +40,8 @@ class IServiceDiscovery
     IServiceDiscovery() = default;
 
     [[nodiscard]] virtual Result<void> OfferService(InstanceIdentifier) noexcept = 0;
+    /// \brief Offers all the given instances in one go. Either all of them get offered or, on failure, none.
+    [[nodiscard]] virtual Result<void> OfferServices(score::cpp::span<const InstanceIdentifier>) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopOfferService(InstanceIdentifier) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopOfferService(InstanceIdentifier,
                                                         QualityTypeSelector quality_type) noexcept = 0;
@@ -46,6 +50,14 @@ class IServiceDiscovery
     virtual Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>, InstanceIdentifier) noexcept = 0;
     virtual Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>,
                                                        const EnrichedInstanceIdentifier) noexcept = 0;
+    /// \brief Starts one search for all the given instance identifiers. The handler gets the handles of all of them in
+    /// one consolidated call.
+    virtual Result<FindServiceHandle> StartFindServices(FindServiceHandler<HandleType>,
+                                                        score::cpp::span<const InstanceIdentifier>) noexcept = 0;
+    virtual Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType>,
+                                                            const InstanceSpecifier) noexcept = 0;
+    virtual Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType>,
+                                                            InstanceIdentifier) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopFindService(const FindServiceHandle) noexcept = 0;
     [[nodiscard]] virtual Result<ServiceHandleContainer<HandleType>> FindService(
         InstanceIdentifier instance_identifier) noexcept = 0;
@@ -22,6 +22,8 @@
 
 #include "score/result/result.h"
 
+#include <score/span.hpp>
+
 namespace score::mw::com::impl
 {
 
@@ -32,6 +34,9 @@ class IServiceDiscoveryClient
     IServiceDiscoveryClient() = default;
 
     [[nodiscard]] virtual Result<void> OfferService(const InstanceIdentifier instance_identifier) noexcept = 0;
+    /// \brief Offers all the given instances in one go. Either all of them get offered or, on failure, none.
+    [[nodiscard]] virtual Result<void> OfferServices(
+        const score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopOfferService(
         const InstanceIdentifier instance_identifier,
         const IServiceDiscovery::QualityTypeSelector quality_type_selector) noexcept = 0;
@@ -39,6 +44,18 @@ class IServiceDiscoveryClient
         const FindServiceHandle find_service_handle,
         FindServiceHandler<HandleType> handler,
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
+    /// \brief Like StartFindService(), but a single search covers all the given identifiers. The handler gets the
+    /// handles of all of them in one consolidated call.
+    [[nodiscard]] virtual Result<void> StartFindServices(
+        const FindServiceHandle find_service_handle,
+        FindServiceHandler<HandleType> handler,
+        const score::cpp::span<const EnrichedInstanceIdentifier> enriched_instance_identifiers) noexcept = 0;
+    /// \brief Like StartFindService(), but the handler only gets the handles which were added / removed since its
+    /// previous call.
+    [[nodiscard]] virtual Result<void> StartFindServiceDelta(
+        const FindServiceHandle find_service_handle,
+        FindServiceDeltaHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopFindService(const FindServiceHandle find_service_handle) noexcept = 0;
     [[nodiscard]] virtual Result<ServiceHandleContainer<HandleType>> FindService(
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
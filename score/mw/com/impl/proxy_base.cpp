@@ -148,6 +148,43 @@ auto ProxyBase::StartFindService(FindServiceHandler<HandleType> handler, Instanc
     return start_find_service_result;
 }
 
+auto ProxyBase::StartFindServices(FindServiceHandler<HandleType> handler,
+                                  score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept
+    -> Result<FindServiceHandle>
+{
+    const auto start_find_service_result =
+        Runtime::getInstance().GetServiceDiscovery().StartFindServices(std::move(handler), instance_identifiers);
+    if (!(start_find_service_result.has_value()))
+    {
+        return MakeUnexpected(ComErrc::kFindServiceHandlerFailure, start_find_service_result.error().UserMessage());
+    }
+    return start_find_service_result;
+}
+
+auto ProxyBase::StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                      InstanceIdentifier instance_identifier) noexcept -> Result<FindServiceHandle>
+{
+    const auto start_find_service_result = Runtime::getInstance().GetServiceDiscovery().StartFindServiceDelta(
+        std::move(handler), std::move(instance_identifier));
+    if (!(start_find_service_result.has_value()))
+    {
+        return MakeUnexpected(ComErrc::kFindServiceHandlerFailure, start_find_service_result.error().UserMessage());
+    }
+    return start_find_service_result;
+}
+
+auto ProxyBase::StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                      InstanceSpecifier instance_specifier) noexcept -> Result<FindServiceHandle>
+{
+    const auto start_find_service_result = Runtime::getInstance().GetServiceDiscovery().StartFindServiceDelta(
+        std::move(handler), std::move(instance_specifier));
+    if (!(start_find_service_result.has_value()))
+    {
+        return MakeUnexpected(ComErrc::kFindServiceHandlerFailure, start_find_service_result.error().UserMessage());
+    }
+    return start_find_service_result;
+}
+
 score::Result<void> ProxyBase::StopFindService(const FindServiceHandle handle) noexcept
 {
     const auto stop_find_service_result = Runtime::getInstance().GetServiceDiscovery().StopFindService(handle);
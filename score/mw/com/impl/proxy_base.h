@@ -99,6 +99,47 @@ class ProxyBase
     static Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType> handler,
                                                       InstanceSpecifier instance_specifier) noexcept;
 
+    /**
+     * \api
+     * \brief Starts one asynchronous service discovery for all the given instance identifiers.
+     * \details Like StartFindService, but for many instances of a service at once. The watches are shared between the
+     *          instances of the same service and the handler is called with the handles of all currently available
+     *          matching instances, instead of once per instance.
+     * \param handler The callback handler to be invoked when service availability changes.
+     * \param instance_identifiers The instance identifiers of the services to find.
+     * \return A result which on success contains a handle to control the find operation. On failure, returns an
+     *         error code.
+     */
+    static Result<FindServiceHandle> StartFindServices(
+        FindServiceHandler<HandleType> handler,
+        score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept;
+
+    /**
+     * \api
+     * \brief Starts asynchronous service discovery that matches the given instance identifier and only reports changes.
+     * \details Like StartFindService, but the handler gets the handles which became available and the ones which
+     *          became unavailable since its previous call, instead of all currently available handles. The first call
+     *          reports all the instances available at that time as added.
+     * \param handler The callback handler to be invoked with the added and removed handles.
+     * \param instance_identifier The instance identifier of the service to find.
+     * \return A result which on success contains a handle to control the find operation. On failure, returns an
+     *         error code.
+     */
+    static Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                                           InstanceIdentifier instance_identifier) noexcept;
+
+    /**
+     * \api
+     * \brief Starts asynchronous service discovery that matches the given instance specifier and only reports changes.
+     * \details See StartFindServiceDelta(FindServiceDeltaHandler<HandleType>, InstanceIdentifier).
+     * \param handler The callback handler to be invoked with the added and removed handles.
+     * \param instance_specifier The instance specifier of the service to find.
+     * \return A result which on success contains a handle to control the find operation. On failure, returns an
+     *         error code.
+     */
+    static Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                                           InstanceSpecifier instance_specifier) noexcept;
+
     /**
      * \api
      * \brief Stops an ongoing asynchronous service discovery operation.
@@ -20,6 +20,7 @@
 #include "score/mw/com/impl/proxy_event_base.h"
 #include "score/mw/com/impl/proxy_event_binding.h"
 #include "score/mw/com/impl/runtime.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 #include "score/mw/com/impl/tracing/proxy_event_tracing.h"
 
 #include "score/mw/com/impl/mocking/i_proxy_event.h"
@@ -229,7 +230,10 @@ Result<std::size_t> ProxyEvent<SampleType>::GetNewSamples(F&& receiver, std::siz
         return proxy_event_mock_->GetNewSamples(std::move(mock_callback), max_num_samples);
     }
 
-    tracing::TraceGetNewSamples(tracing_data_, *binding_base_);
+    if constexpr (tracing::kIpcTracingCompiledIn)
+    {
+        tracing::TraceGetNewSamples(tracing_data_, *binding_base_);
+    }
 
     auto guard_factory = tracker_->Allocate(max_num_samples);
 
@@ -24,12 +24,14 @@
 #include <score/assert.hpp>
 #include <score/utility.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <exception>
 #include <memory>
 #include <mutex>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace score::mw::com::impl
@@ -68,6 +70,32 @@ auto ServiceDiscovery::OfferService(score::mw::com::impl::InstanceIdentifier ins
     return service_discovery_client.OfferService(std::move(instance_identifier));
 }
 
+auto ServiceDiscovery::OfferServices(score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept
+    -> Result<void>
+{
+    const auto instances_per_client = GroupByServiceDiscoveryClient(instance_identifiers);
+    for (auto client_it = instances_per_client.cbegin(); client_it != instances_per_client.cend(); ++client_it)
+    {
+        const auto& [service_discovery_client, client_instance_identifiers] = *client_it;
+        auto result = service_discovery_client->OfferServices(client_instance_identifiers);
+        if (!(result.has_value()))
+        {
+            // The clients offer all or none of their instances, so only the offers of the previous clients have to be
+            // withdrawn again.
+            for (auto offered_it = instances_per_client.cbegin(); offered_it != client_it; ++offered_it)
+            {
+                for (const auto& offered_instance_identifier : offered_it->second)
+                {
+                    score::cpp::ignore =
+                        offered_it->first->StopOfferService(offered_instance_identifier, QualityTypeSelector::kBoth);
+                }
+            }
+            return result;
+        }
+    }
+    return {};
+}
+
 auto ServiceDiscovery::StopOfferService(score::mw::com::impl::InstanceIdentifier instance_identifier) noexcept
     -> Result<void>
 {
@@ -85,6 +113,20 @@ auto ServiceDiscovery::StopOfferService(score::mw::com::impl::InstanceIdentifier
 auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
                                         const InstanceSpecifier instance_specifier) noexcept
     -> Result<FindServiceHandle>
+{
+    return StartFindServiceForCallback(UserCallback{std::move(handler)}, instance_specifier);
+}
+
+auto ServiceDiscovery::StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                             const InstanceSpecifier instance_specifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    return StartFindServiceForCallback(UserCallback{std::move(handler)}, instance_specifier);
+}
+
+auto ServiceDiscovery::StartFindServiceForCallback(UserCallback handler,
+                                                   const InstanceSpecifier instance_specifier) noexcept
+    -> Result<FindServiceHandle>
 {
     const auto instance_identifiers = runtime_.resolve(instance_specifier);
     const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers(instance_identifiers.begin(),
@@ -142,9 +184,24 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
     return StartFindService(std::move(handler), std::move(enriched_instance_identifier));
 }
 
+auto ServiceDiscovery::StartFindServiceDelta(FindServiceDeltaHandler<HandleType> handler,
+                                             InstanceIdentifier instance_identifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    EnrichedInstanceIdentifier enriched_instance_identifier{std::move(instance_identifier)};
+    return StartFindServiceForCallback(UserCallback{std::move(handler)}, std::move(enriched_instance_identifier));
+}
+
 auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
                                         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
     -> Result<FindServiceHandle>
+{
+    return StartFindServiceForCallback(UserCallback{std::move(handler)}, enriched_instance_identifier);
+}
+
+auto ServiceDiscovery::StartFindServiceForCallback(
+    UserCallback handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept -> Result<FindServiceHandle>
 {
     auto find_service_handle = GetNextFreeFindServiceHandle();
 
@@ -173,6 +230,46 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
     return result;
 }
 
+auto ServiceDiscovery::StartFindServices(FindServiceHandler<HandleType> handler,
+                                         score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept
+    -> Result<FindServiceHandle>
+{
+    const auto find_service_handle = GetNextFreeFindServiceHandle();
+
+    // Same locking scheme as in StartFindServiceForCallback: the binding is called without container_mutex_ locked.
+    std::unique_lock lock{container_mutex_};
+    auto handler_weak_ptr = StoreUserCallback(find_service_handle, UserCallback{std::move(handler)});
+    for (const auto& instance_identifier : instance_identifiers)
+    {
+        StoreInstanceIdentifier(find_service_handle, EnrichedInstanceIdentifier{instance_identifier});
+    }
+    lock.unlock();
+
+    // Each binding gets all its identifiers at once, so that it can share the search setup between them and call the
+    // handler once with the handles of all of them.
+    for (const auto& [service_discovery_client, client_instance_identifiers] :
+         GroupByServiceDiscoveryClient(instance_identifiers))
+    {
+        const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers(
+            client_instance_identifiers.cbegin(), client_instance_identifiers.cend());
+        const auto result = service_discovery_client->StartFindServices(
+            find_service_handle, CreateBindingHandler(handler_weak_ptr), enriched_instance_identifiers);
+        if (!(result.has_value()))
+        {
+            const auto stop_find_service_result = StopFindService(find_service_handle);
+            if (!(stop_find_service_result.has_value()))
+            {
+                mw::log::LogError("lola") << "StopFindService after StartFindServices failed on binding for"
+                                          << FindServiceHandleView{find_service_handle}.getUid()
+                                          << "could not be stopped." << result.error();
+            }
+            return Unexpected{result.error()};
+        }
+    }
+
+    return find_service_handle;
+}
+
 [[nodiscard]] auto ServiceDiscovery::StopFindService(const FindServiceHandle find_service_handle) noexcept
     -> Result<void>
 {
@@ -192,12 +289,24 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
     score::cpp::ignore = handle_to_instances_.erase(find_service_handle);
     lock.unlock();
 
-    Result<void> result{};
+    // A search started with StartFindServices() has several identifiers of the same binding, which has to be stopped
+    // only once.
+    std::vector<IServiceDiscoveryClient*> service_discovery_clients{};
     for (const auto& enriched_instance_identifier : enriched_instance_identifiers)
     {
-        auto& service_discovery_client =
-            GetServiceDiscoveryClient(enriched_instance_identifier.GetInstanceIdentifier());
-        auto specific_result = service_discovery_client.StopFindService(find_service_handle);
+        auto* const service_discovery_client =
+            &GetServiceDiscoveryClient(enriched_instance_identifier.GetInstanceIdentifier());
+        if (std::find(service_discovery_clients.cbegin(), service_discovery_clients.cend(), service_discovery_client) ==
+            service_discovery_clients.cend())
+        {
+            service_discovery_clients.push_back(service_discovery_client);
+        }
+    }
+
+    Result<void> result{};
+    for (auto* const service_discovery_client : service_discovery_clients)
+    {
+        auto specific_result = service_discovery_client->StopFindService(find_service_handle);
         if (!specific_result.has_value())
         {
             result = specific_result;
@@ -208,7 +317,7 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
 }
 
 auto ServiceDiscovery::StartFindServiceImpl(FindServiceHandle find_service_handle,
-                                            std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                            std::weak_ptr<UserCallback> handler_weak_ptr,
                                             const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
     -> Result<FindServiceHandle>
 {
@@ -270,11 +379,10 @@ FindServiceHandle ServiceDiscovery::GetNextFreeFindServiceHandle() noexcept
     return make_FindServiceHandle(free_uid);
 }
 
-auto ServiceDiscovery::StoreUserCallback(const FindServiceHandle& find_service_handle,
-                                         FindServiceHandler<HandleType> handler) noexcept
-    -> std::weak_ptr<FindServiceHandler<HandleType>>
+auto ServiceDiscovery::StoreUserCallback(const FindServiceHandle& find_service_handle, UserCallback handler) noexcept
+    -> std::weak_ptr<UserCallback>
 {
-    auto shared_pointer_handler_wrapper = std::make_shared<FindServiceHandler<HandleType>>(std::move(handler));
+    auto shared_pointer_handler_wrapper = std::make_shared<UserCallback>(std::move(handler));
     auto entry = user_callbacks_.emplace(std::piecewise_construct,
                                          std::forward_as_tuple(find_service_handle),
                                          std::forward_as_tuple(std::move(shared_pointer_handler_wrapper)));
@@ -307,22 +415,74 @@ auto ServiceDiscovery::GetServiceDiscoveryClient(const InstanceIdentifier& insta
     return binding_runtime->GetServiceDiscoveryClient();
 }
 
+auto ServiceDiscovery::GroupByServiceDiscoveryClient(
+    score::cpp::span<const InstanceIdentifier> instance_identifiers) noexcept -> InstancesPerClient
+{
+    InstancesPerClient instances_per_client{};
+    for (const auto& instance_identifier : instance_identifiers)
+    {
+        auto* const service_discovery_client = &GetServiceDiscoveryClient(instance_identifier);
+        auto client_it = std::find_if(
+            instances_per_client.begin(), instances_per_client.end(), [service_discovery_client](const auto& entry) {
+                return entry.first == service_discovery_client;
+            });
+        if (client_it == instances_per_client.end())
+        {
+            client_it = instances_per_client.emplace(
+                instances_per_client.end(), service_discovery_client, std::vector<InstanceIdentifier>{});
+        }
+        client_it->second.push_back(instance_identifier);
+    }
+    return instances_per_client;
+}
+
+auto ServiceDiscovery::CreateBindingHandler(std::weak_ptr<UserCallback> handler_weak_ptr) noexcept
+    -> FindServiceHandler<HandleType>
+{
+    return [handler_weak_ptr](auto container, auto handle) noexcept {
+        if (auto handler_shared_ptr = handler_weak_ptr.lock())
+        {
+            const auto* const handler = std::get_if<FindServiceHandler<HandleType>>(&*handler_shared_ptr);
+            if (handler != nullptr)
+            {
+                (*handler)(container, handle);
+            }
+        }
+    };
+}
+
 auto ServiceDiscovery::BindingSpecificStartFindService(
     FindServiceHandle search_handle,
-    std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+    std::weak_ptr<UserCallback> handler_weak_ptr,
     const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept -> Result<void>
 {
     auto& service_discovery_client = GetServiceDiscoveryClient(enriched_instance_identifier.GetInstanceIdentifier());
 
+    bool is_delta_handler{false};
+    if (const auto handler_shared_ptr = handler_weak_ptr.lock())
+    {
+        is_delta_handler = std::holds_alternative<FindServiceDeltaHandler<HandleType>>(*handler_shared_ptr);
+    }
+
+    if (is_delta_handler)
+    {
+        return service_discovery_client.StartFindServiceDelta(
+            search_handle,
+            [handler_weak_ptr](auto added_handles, auto removed_handles, auto handle) noexcept {
+                if (auto handler_shared_ptr = handler_weak_ptr.lock())
+                {
+                    const auto* const handler = std::get_if<FindServiceDeltaHandler<HandleType>>(&*handler_shared_ptr);
+                    if (handler != nullptr)
+                    {
+                        (*handler)(added_handles, removed_handles, handle);
+                    }
+                }
+            },
+            enriched_instance_identifier);
+    }
+
     return service_discovery_client.StartFindService(
-        search_handle,
-        [handler_weak_ptr](auto container, auto handle) noexcept {
-            if (auto handler_shared_ptr = handler_weak_ptr.lock())
-            {
-                (*handler_shared_ptr)(container, handle);
-            }
-        },
-        enriched_instance_identifier);
+        search_handle, CreateBindingHandler(handler_weak_ptr), enriched_instance_identifier);
 }
 
 Result<ServiceHandleContainer<HandleType>> ServiceDiscovery::FindService(
@@ -25,10 +25,14 @@
 
 #include "score/result/result.h"
 
+#include <score/span.hpp>
+
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace score::mw::com::impl
@@ -45,6 +49,7 @@ class ServiceDiscovery final : public IServiceDiscovery
     ~ServiceDiscovery() override;
 
     [[nodiscard]] Result<void> OfferService(InstanceIdentifier) noexcept override;
+    [[nodiscard]] Result<void> OfferServices(score::cpp::span<const InstanceIdentifier>) noexcept override;
     [[nodiscard]] Result<void> StopOfferService(InstanceIdentifier) noexcept override;
     [[nodiscard]] Result<void> StopOfferService(InstanceIdentifier, QualityTypeSelector quality_type) noexcept override;
     Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>,
@@ -52,6 +57,12 @@ class ServiceDiscovery final : public IServiceDiscovery
     Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>, InstanceIdentifier) noexcept override;
     Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>,
                                                const EnrichedInstanceIdentifier) noexcept override;
+    Result<FindServiceHandle> StartFindServices(FindServiceHandler<HandleType>,
+                                                score::cpp::span<const InstanceIdentifier>) noexcept override;
+    Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType>,
+                                                    const InstanceSpecifier) noexcept override;
+    Result<FindServiceHandle> StartFindServiceDelta(FindServiceDeltaHandler<HandleType>,
+                                                    InstanceIdentifier) noexcept override;
     [[nodiscard]] Result<void> StopFindService(const FindServiceHandle) noexcept override;
     [[nodiscard]] Result<ServiceHandleContainer<HandleType>> FindService(
         InstanceIdentifier instance_identifier) noexcept override;
@@ -59,13 +70,29 @@ class ServiceDiscovery final : public IServiceDiscovery
         InstanceSpecifier instance_specifier) noexcept override;
 
   private:
+    /// \brief A handler registered with StartFindService or StartFindServiceDelta
+    using UserCallback = std::variant<FindServiceHandler<HandleType>, FindServiceDeltaHandler<HandleType>>;
+
+    /// \brief Instance identifiers grouped by the service discovery client of their binding, in order of appearance
+    using InstancesPerClient = std::vector<std::pair<IServiceDiscoveryClient*, std::vector<InstanceIdentifier>>>;
+
+    /// \brief Creates the handler which is handed to the binding and forwards to the stored user callback, as long as
+    /// the search is ongoing.
+    static FindServiceHandler<HandleType> CreateBindingHandler(std::weak_ptr<UserCallback> handler_weak_ptr) noexcept;
+
+    /// \brief Common implementation of StartFindService and StartFindServiceDelta for an InstanceSpecifier
+    Result<FindServiceHandle> StartFindServiceForCallback(UserCallback, const InstanceSpecifier) noexcept;
+
+    /// \brief Common implementation of StartFindService and StartFindServiceDelta for an EnrichedInstanceIdentifier
+    Result<FindServiceHandle> StartFindServiceForCallback(UserCallback, const EnrichedInstanceIdentifier) noexcept;
+
     /// \brief Dispatches to BindingSpecificStartFindService and processes a binding error if returned
     ///
     /// This functionality within this function itself is threadsafe. HOWEVER, the thread safety of the binding specific
     /// StartFindService call depends on the binding itself. For a Lola binding, this function is completely thread
     /// safe.
     Result<FindServiceHandle> StartFindServiceImpl(FindServiceHandle,
-                                                   std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                                   std::weak_ptr<UserCallback> handler_weak_ptr,
                                                    const EnrichedInstanceIdentifier&) noexcept;
 
     /// \brief Generates the next available FindServiceHandle
@@ -76,8 +103,7 @@ class ServiceDiscovery final : public IServiceDiscovery
     /// \brief Store the user callback provided to StartFindService
     ///
     /// This function is NOT threadsafe and should be called with container_mutex_ locked.
-    std::weak_ptr<FindServiceHandler<HandleType>> StoreUserCallback(const FindServiceHandle&,
-                                                                    FindServiceHandler<HandleType>) noexcept;
+    std::weak_ptr<UserCallback> StoreUserCallback(const FindServiceHandle&, UserCallback) noexcept;
 
     /// \brief Store the InstanceIdentifier corresponding to a FindServiceHandle to represent an ongoing search (with
     /// StartFindService).
@@ -87,13 +113,15 @@ class ServiceDiscovery final : public IServiceDiscovery
 
     IServiceDiscoveryClient& GetServiceDiscoveryClient(const InstanceIdentifier&) noexcept;
 
+    InstancesPerClient GroupByServiceDiscoveryClient(score::cpp::span<const InstanceIdentifier>) noexcept;
+
     /// \brief Call the binding specific StartFindService
     ///
     /// This functionality within this function itself is threadsafe. HOWEVER, the thread safety of the binding specific
     /// StartFindService call depends on the binding itself. For a Lola binding, this function is completely thread
     /// safe.
     Result<void> BindingSpecificStartFindService(FindServiceHandle,
-                                                 std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                                 std::weak_ptr<UserCallback> handler_weak_ptr,
                                                  const EnrichedInstanceIdentifier&) noexcept;
 
     /// \brief Removes any InstanceIdentifiers which were added to handle_to_instances_ but were never processed since
@@ -120,7 +148,7 @@ class ServiceDiscovery final : public IServiceDiscovery
     /// The handlers are stored as shared_ptrs. When a handler needs to be called by the bindings, a weak_ptr to the
     /// handler is passed. This ensures that the handler will not be destroyed as long as the handler is being held by
     /// the binding (which only happens for the duration of the call to the binding).
-    std::unordered_map<FindServiceHandle, std::shared_ptr<FindServiceHandler<HandleType>>> user_callbacks_;
+    std::unordered_map<FindServiceHandle, std::shared_ptr<UserCallback>> user_callbacks_;
     std::unordered_multimap<FindServiceHandle, EnrichedInstanceIdentifier> handle_to_instances_;
 };
 
@@ -24,6 +24,7 @@ class ServiceDiscoveryClientMock : public IServiceDiscoveryClient
 {
   public:
     MOCK_METHOD(Result<void>, OfferService, (InstanceIdentifier), (noexcept, override));
+    MOCK_METHOD(Result<void>, OfferServices, (score::cpp::span<const InstanceIdentifier>), (noexcept, override));
     MOCK_METHOD(Result<void>,
                 StopOfferService,
                 (InstanceIdentifier, IServiceDiscovery::QualityTypeSelector),
@@ -32,6 +33,16 @@ class ServiceDiscoveryClientMock : public IServiceDiscoveryClient
                 StartFindService,
                 (FindServiceHandle, (FindServiceHandler<HandleType>), EnrichedInstanceIdentifier),
                 (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                StartFindServices,
+                (FindServiceHandle,
+                 (FindServiceHandler<HandleType>),
+                 score::cpp::span<const EnrichedInstanceIdentifier>),
+                (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                StartFindServiceDelta,
+                (FindServiceHandle, (FindServiceDeltaHandler<HandleType>), EnrichedInstanceIdentifier),
+                (noexcept, override));
     MOCK_METHOD(Result<void>, StopFindService, (FindServiceHandle), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>,
                 FindService,
@@ -32,6 +32,7 @@ class ServiceDiscoveryMock : public IServiceDiscovery
 {
   public:
     MOCK_METHOD(Result<void>, OfferService, (InstanceIdentifier), (noexcept, override));
+    MOCK_METHOD(Result<void>, OfferServices, (score::cpp::span<const InstanceIdentifier>), (noexcept, override));
     MOCK_METHOD(Result<void>, StopOfferService, (InstanceIdentifier), (noexcept, override));
     MOCK_METHOD(Result<void>,
                 StopOfferService,
@@ -49,6 +50,18 @@ class ServiceDiscoveryMock : public IServiceDiscovery
                 StartFindService,
                 (FindServiceHandler<HandleType>, EnrichedInstanceIdentifier),
                 (noexcept, override));
+    MOCK_METHOD(Result<FindServiceHandle>,
+                StartFindServices,
+                (FindServiceHandler<HandleType>, score::cpp::span<const InstanceIdentifier>),
+                (noexcept, override));
+    MOCK_METHOD(Result<FindServiceHandle>,
+                StartFindServiceDelta,
+                (FindServiceDeltaHandler<HandleType>, InstanceSpecifier),
+                (noexcept, override));
+    MOCK_METHOD(Result<FindServiceHandle>,
+                StartFindServiceDelta,
+                (FindServiceDeltaHandler<HandleType>, InstanceIdentifier),
+                (noexcept, override));
     MOCK_METHOD(Result<void>, StopFindService, (FindServiceHandle), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>, FindService, (InstanceIdentifier), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>, FindService, (InstanceSpecifier), (noexcept, override));
@@ -19,6 +19,7 @@
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/configuration/service_identifier_type.h"
 #include "score/mw/com/impl/configuration/test/configuration_store.h"
+#include "score/mw/com/impl/enriched_instance_identifier.h"
 #include "score/mw/com/impl/find_service_handler.h"
 #include "score/mw/com/impl/handle_type.h"
 #include "score/mw/com/impl/instance_identifier.h"
@@ -89,6 +90,8 @@ class ServiceDiscoveryTest : public Test
         ON_CALL(lola_runtime_, GetServiceDiscoveryClient()).WillByDefault(ReturnRef(service_discovery_client_));
 
         ON_CALL(service_discovery_client_, StartFindService(_, _, _)).WillByDefault(Return(Result<void>{}));
+        ON_CALL(service_discovery_client_, StartFindServiceDelta(_, _, _)).WillByDefault(Return(Result<void>{}));
+        ON_CALL(service_discovery_client_, StartFindServices(_, _, _)).WillByDefault(Return(Result<void>{}));
 
         ON_CALL(service_discovery_client_, StopFindService(_)).WillByDefault(Return(Result<void>{}));
     }
@@ -677,6 +680,57 @@ TEST_F(ServiceDiscoveryStartFindServiceInstanceIdentifierFixture,
     EXPECT_EQ(future_status, std::future_status::timeout);
 }
 
+using ServiceDiscoveryStartFindServiceDeltaFixture = ServiceDiscoveryTest;
+TEST_F(ServiceDiscoveryStartFindServiceDeltaFixture, StartFindServiceDeltaCallsBindingSpecificStartFindServiceDelta)
+{
+    WithAServiceContainingTwoInstances();
+
+    EXPECT_CALL(service_discovery_client_, StartFindService(_, _, _)).Times(0);
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceDelta(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()));
+
+    score::cpp::ignore =
+        unit_->StartFindServiceDelta([](auto, auto, auto) noexcept {}, config_stores_[0].GetInstanceIdentifier());
+}
+
+TEST_F(ServiceDiscoveryStartFindServiceDeltaFixture, StartFindServiceDeltaWithInstanceSpecifierCallsAllBindings)
+{
+    WithAServiceContainingTwoInstances();
+
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceDelta(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()));
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceDelta(_, _, config_stores_[1].GetEnrichedInstanceIdentifier()));
+
+    const auto handle = unit_->StartFindServiceDelta([](auto, auto, auto) noexcept {}, instance_specifier_);
+    EXPECT_TRUE(handle.has_value());
+}
+
+TEST_F(ServiceDiscoveryStartFindServiceDeltaFixture, StartFindServiceDeltaForwardsCorrectHandler)
+{
+    WithAServiceContainingOneInstances();
+
+    const auto expected_handle = config_stores_[0].GetHandle();
+    ON_CALL(service_discovery_client_, StartFindServiceDelta(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()))
+        .WillByDefault([&expected_handle](auto find_service_handle, auto handler, auto) {
+            handler({expected_handle}, {}, find_service_handle);
+            return Result<void>{};
+        });
+
+    ServiceHandleContainer<HandleType> received_added_handles{};
+    ServiceHandleContainer<HandleType> received_removed_handles{};
+    std::ignore = unit_->StartFindServiceDelta(
+        [&received_added_handles, &received_removed_handles](auto added_handles, auto removed_handles, auto) noexcept {
+            received_added_handles = added_handles;
+            received_removed_handles = removed_handles;
+        },
+        config_stores_[0].GetInstanceIdentifier());
+
+    ASSERT_EQ(received_added_handles.size(), 1U);
+    EXPECT_EQ(received_added_handles.front(), expected_handle);
+    EXPECT_TRUE(received_removed_handles.empty());
+}
+
 using ServiceDiscoveryStopFindServiceFixture = ServiceDiscoveryTest;
 TEST_F(ServiceDiscoveryStopFindServiceFixture, StopFindServiceInvokedIfForgottenByUser)
 {
@@ -931,5 +985,122 @@ TEST_F(ServiceDiscoveryStopOfferServiceFixture, StopOfferServiceWithQualityTypeI
     auto result = unit_->StopOfferService(instance_id, quality_type);
     EXPECT_TRUE(result.has_value());
 }
+
+using ServiceDiscoveryOfferServicesFixture = ServiceDiscoveryTest;
+TEST_F(ServiceDiscoveryOfferServicesFixture, OfferServicesCallsBindingOnceWithAllInstanceIdentifiers)
+{
+    // Given a ServiceDiscovery with a mocked ServiceDiscoveryClient
+    WithAServiceContainingTwoInstances();
+    const std::vector<InstanceIdentifier> instance_identifiers{config_stores_[0].GetInstanceIdentifier(),
+                                                               config_stores_[1].GetInstanceIdentifier()};
+
+    // Expecting that OfferServices is called once on the binding with both instance identifiers
+    std::vector<InstanceIdentifier> offered_instance_identifiers{};
+    EXPECT_CALL(service_discovery_client_, OfferService(_)).Times(0);
+    EXPECT_CALL(service_discovery_client_, OfferServices(_))
+        .WillOnce([&offered_instance_identifiers](auto identifiers) {
+            offered_instance_identifiers.assign(identifiers.begin(), identifiers.end());
+            return Result<void>{};
+        });
+
+    // When offering both instances at once
+    const auto result = unit_->OfferServices(instance_identifiers);
+
+    // Then the offer succeeds
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(offered_instance_identifiers, instance_identifiers);
+}
+
+TEST_F(ServiceDiscoveryOfferServicesFixture, OfferServicesReturnsErrorOfBinding)
+{
+    // Given a ServiceDiscovery with a mocked ServiceDiscoveryClient
+    WithAServiceContainingTwoInstances();
+    const std::vector<InstanceIdentifier> instance_identifiers{config_stores_[0].GetInstanceIdentifier(),
+                                                               config_stores_[1].GetInstanceIdentifier()};
+
+    // Expecting that the binding fails to offer the instances
+    EXPECT_CALL(service_discovery_client_, OfferServices(_)).WillOnce(Return(Unexpected{ComErrc::kBindingFailure}));
+
+    // When offering both instances at once
+    const auto result = unit_->OfferServices(instance_identifiers);
+
+    // Then the error of the binding is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kBindingFailure);
+}
+
+using ServiceDiscoveryStartFindServicesFixture = ServiceDiscoveryTest;
+TEST_F(ServiceDiscoveryStartFindServicesFixture, StartFindServicesCallsBindingOnceWithAllInstanceIdentifiers)
+{
+    // Given a ServiceDiscovery with a mocked ServiceDiscoveryClient
+    WithAServiceContainingTwoInstances();
+    const std::vector<InstanceIdentifier> instance_identifiers{config_stores_[0].GetInstanceIdentifier(),
+                                                               config_stores_[1].GetInstanceIdentifier()};
+
+    // Expecting that StartFindServices is called once on the binding with both instance identifiers
+    std::vector<EnrichedInstanceIdentifier> searched_instance_identifiers{};
+    EXPECT_CALL(service_discovery_client_, StartFindService(_, _, _)).Times(0);
+    EXPECT_CALL(service_discovery_client_, StartFindServices(_, _, _))
+        .WillOnce([&searched_instance_identifiers](auto, auto, auto identifiers) {
+            searched_instance_identifiers.assign(identifiers.begin(), identifiers.end());
+            return Result<void>{};
+        });
+
+    // When starting one search for both instances
+    const auto handle = unit_->StartFindServices([](auto, auto) noexcept {}, instance_identifiers);
+
+    // Then a handle is returned
+    EXPECT_TRUE(handle.has_value());
+    ASSERT_EQ(searched_instance_identifiers.size(), 2U);
+    EXPECT_EQ(searched_instance_identifiers[0], config_stores_[0].GetEnrichedInstanceIdentifier());
+    EXPECT_EQ(searched_instance_identifiers[1], config_stores_[1].GetEnrichedInstanceIdentifier());
+}
+
+TEST_F(ServiceDiscoveryStartFindServicesFixture, StartFindServicesForwardsCorrectHandler)
+{
+    // Given a ServiceDiscovery with a mocked ServiceDiscoveryClient
+    WithAServiceContainingTwoInstances();
+    const std::vector<InstanceIdentifier> instance_identifiers{config_stores_[0].GetInstanceIdentifier(),
+                                                               config_stores_[1].GetInstanceIdentifier()};
+
+    // Expecting that the binding calls the handler with the handles of both instances
+    const ServiceHandleContainer<HandleType> expected_handles{config_stores_[0].GetHandle(),
+                                                              config_stores_[1].GetHandle()};
+    ON_CALL(service_discovery_client_, StartFindServices(_, _, _))
+        .WillByDefault([&expected_handles](auto find_service_handle, auto handler, auto) {
+            handler(expected_handles, find_service_handle);
+            return Result<void>{};
+        });
+
+    // When starting one search for both instances
+    ServiceHandleContainer<HandleType> received_handles{};
+    score::cpp::ignore = unit_->StartFindServices(
+        [&received_handles](auto handles, auto) noexcept {
+            received_handles = handles;
+        },
+        instance_identifiers);
+
+    // Then the user handler is called with these handles
+    EXPECT_EQ(received_handles, expected_handles);
+}
+
+TEST_F(ServiceDiscoveryStartFindServicesFixture, StopFindServiceStopsSearchOfStartFindServicesOnceOnTheBinding)
+{
+    // Given a ServiceDiscovery with an ongoing search for two instances of the same binding
+    WithAServiceContainingTwoInstances();
+    const std::vector<InstanceIdentifier> instance_identifiers{config_stores_[0].GetInstanceIdentifier(),
+                                                               config_stores_[1].GetInstanceIdentifier()};
+    const auto handle = unit_->StartFindServices([](auto, auto) noexcept {}, instance_identifiers);
+    ASSERT_TRUE(handle.has_value());
+
+    // Expecting that StopFindService is called only once on the binding
+    EXPECT_CALL(service_discovery_client_, StopFindService(handle.value())).Times(1);
+
+    // When stopping the search
+    const auto result = unit_->StopFindService(handle.value());
+
+    // Then stopping succeeds
+    EXPECT_TRUE(result.has_value());
+}
 }  // namespace
 }  // namespace score::mw::com::impl
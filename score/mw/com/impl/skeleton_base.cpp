@@ -26,6 +26,7 @@
 #include <score/utility.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <exception>
 #include <unordered_map>
 #include <utility>
@@ -91,10 +92,16 @@ SkeletonBase::SkeletonBase(std::unique_ptr<SkeletonBinding> skeleton_binding, In
       methods_{},
       instance_id_{std::move(instance_id)},
       skeleton_mock_{nullptr},
-      service_offered_flag_{}
+      service_offered_flag_{},
+      async_offer_done_{}
 {
 }
 
+SkeletonBase::~SkeletonBase() noexcept
+{
+    WaitForAsyncOffer();
+}
+
 SkeletonBase::SkeletonBase(SkeletonBase&& other) noexcept
     : binding_{std::move(other.binding_)},
       events_{std::move(other.events_)},
@@ -102,8 +109,13 @@ SkeletonBase::SkeletonBase(SkeletonBase&& other) noexcept
       methods_{std::move(other.methods_)},
       instance_id_{std::move(other.instance_id_)},
       skeleton_mock_{std::move(other.skeleton_mock_)},
-      service_offered_flag_{std::move(other.service_offered_flag_)}
+      service_offered_flag_{std::move(other.service_offered_flag_)},
+      async_offer_done_{std::move(other.async_offer_done_)}
 {
+    // The pending offer task refers to the moved-from skeleton, so moving is only allowed once it is done.
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(!IsAsyncOfferPending(),
+                                                "Skeleton must not be moved while an asynchronous offer is pending.");
+
     // Since the address of this skeleton has changed, we need update the address stored in each of the events and
     // fields belonging to the skeleton.
     for (auto& event : events_)
@@ -134,6 +146,9 @@ SkeletonBase& SkeletonBase::operator=(SkeletonBase&& other) noexcept
         return *this;
     }
 
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(!IsAsyncOfferPending() && !other.IsAsyncOfferPending(),
+                                                "Skeleton must not be moved while an asynchronous offer is pending.");
+
     binding_ = std::move(other.binding_);
     events_ = std::move(other.events_);
     fields_ = std::move(other.fields_);
@@ -141,6 +156,7 @@ SkeletonBase& SkeletonBase::operator=(SkeletonBase&& other) noexcept
     instance_id_ = std::move(other.instance_id_);
     skeleton_mock_ = std::move(other.skeleton_mock_);
     service_offered_flag_ = std::move(other.service_offered_flag_);
+    async_offer_done_ = std::move(other.async_offer_done_);
 
     // Since the address of this skeleton has changed, we need update the address stored in each of the events and
     // fields belonging to the skeleton.
@@ -261,8 +277,52 @@ auto SkeletonBase::OfferService() noexcept -> Result<void>
     return {};
 }
 
+auto SkeletonBase::OfferServiceAsync(concurrency::Executor& executor,
+                                     OfferServiceCompletionCallback completion_callback) noexcept -> Result<void>
+{
+    if (IsAsyncOfferPending())
+    {
+        return MakeUnexpected(ComErrc::kBindingFailure, "An asynchronous offer of this skeleton is still pending.");
+    }
+
+    std::promise<void> async_offer_done{};
+    async_offer_done_ = async_offer_done.get_future();
+
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+    // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". The function Post
+    // throws on allocation failure but this throw directly leads to a termination based on a compiler hook.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    executor.Post(
+        [this, async_offer_done = std::move(async_offer_done), completion_callback = std::move(completion_callback)](
+            const score::cpp::stop_token& /*token*/) mutable noexcept {
+            auto offer_result = OfferService();
+            // The offer is marked as done before calling the completion callback, so that the callback itself may
+            // already call StopOfferService() without blocking forever.
+            async_offer_done.set_value();
+            completion_callback(std::move(offer_result));
+        });
+    return {};
+}
+
+auto SkeletonBase::IsAsyncOfferPending() const noexcept -> bool
+{
+    return async_offer_done_.valid() &&
+           (async_offer_done_.wait_for(std::chrono::seconds{0}) != std::future_status::ready);
+}
+
+auto SkeletonBase::WaitForAsyncOffer() noexcept -> void
+{
+    if (async_offer_done_.valid())
+    {
+        async_offer_done_.wait();
+        async_offer_done_ = {};
+    }
+}
+
 auto SkeletonBase::StopOfferService() noexcept -> void
 {
+    WaitForAsyncOffer();
+
     if (skeleton_mock_ != nullptr)
     {
         skeleton_mock_->StopOfferService();
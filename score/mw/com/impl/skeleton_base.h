@@ -13,6 +13,7 @@
 #ifndef SCORE_MW_COM_IMPL_SKELETON_BASE_H
 #define SCORE_MW_COM_IMPL_SKELETON_BASE_H
 
+#include "score/concurrency/executor.h"
 #include "score/mw/com/impl/flag_owner.h"
 #include "score/mw/com/impl/instance_identifier.h"
 #include "score/mw/com/impl/instance_specifier.h"
@@ -26,11 +27,13 @@
 #include "score/mw/log/logging.h"
 
 #include <score/assert.hpp>
+#include <score/callback.hpp>
 #include <score/optional.hpp>
 #include <score/span.hpp>
 
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <string_view>
@@ -51,6 +54,9 @@ class SkeletonBase
     using SkeletonFields = std::map<std::string_view, std::reference_wrapper<SkeletonFieldBase>>;
     using SkeletonMethods = std::map<std::string_view, std::reference_wrapper<SkeletonMethodBase>>;
 
+    /// \brief Callback, which gets the result of an asynchronous offer (see OfferServiceAsync()).
+    using OfferServiceCompletionCallback = score::cpp::callback<void(Result<void>)>;
+
     /// \brief Creation of service skeleton with provided Skeleton binding
     ///
     /// \requirement SWS_CM_00130
@@ -59,7 +65,7 @@ class SkeletonBase
     /// \param instance_id The instance identifier which uniquely identifies this Skeleton instance.
     SkeletonBase(std::unique_ptr<SkeletonBinding> skeleton_binding, InstanceIdentifier instance_id);
 
-    virtual ~SkeletonBase() = default;
+    virtual ~SkeletonBase() noexcept;
 
     /// \brief A Skeleton shall not be copyable
     /// \requirement SWS_CM_00134
@@ -74,6 +80,22 @@ class SkeletonBase
      */
     [[nodiscard]] Result<void> OfferService() noexcept;
 
+    /**
+     * \api
+     * \brief Offer the respective service to other applications without blocking the caller.
+     * \details The offer, i.e. the creation of the binding specific resources (e.g. shared memory and flag files), the
+     * preparation of all service elements and the registration in service discovery, is executed as a task on the
+     * given executor. Several skeletons can thereby be offered in parallel. Until the completion callback has been
+     * called, the skeleton shall neither be moved nor be offered again. A call to StopOfferService() (or the
+     * destruction of the skeleton) in the meantime blocks until the pending offer is done.
+     * \param executor Executor on which the offer is executed.
+     * \param completion_callback Called from the executor with the result of the offer, which is the same as the one
+     * OfferService() would have returned.
+     * \return An error, if an asynchronous offer of this skeleton is still pending. Otherwise, an empty result.
+     */
+    [[nodiscard]] Result<void> OfferServiceAsync(concurrency::Executor& executor,
+                                                 OfferServiceCompletionCallback completion_callback) noexcept;
+
     /**
      * \api
      * \brief Stops offering the respective service to other applications
@@ -111,7 +133,14 @@ class SkeletonBase
     [[nodiscard]] score::Result<void> OfferServiceEvents() const noexcept;
     [[nodiscard]] score::Result<void> OfferServiceFields() const noexcept;
 
+    bool IsAsyncOfferPending() const noexcept;
+    void WaitForAsyncOffer() noexcept;
+
     FlagOwner service_offered_flag_;
+
+    /// \brief Becomes ready once the asynchronous offer started via OfferServiceAsync() is done. Invalid, if there
+    ///        was no asynchronous offer.
+    std::future<void> async_offer_done_;
 };
 
 class SkeletonBaseView
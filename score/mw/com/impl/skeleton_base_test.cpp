@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/com/impl/skeleton_base.h"
 
+#include "score/concurrency/thread_pool.h"
 #include "score/mw/com/impl/bindings/mock_binding/skeleton.h"
 #include "score/mw/com/impl/bindings/mock_binding/skeleton_method.h"
 #include "score/mw/com/impl/com_error.h"
@@ -30,6 +31,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -447,6 +449,98 @@ TEST_F(SkeletonBaseOfferFixture, OfferServiceReturnsErrorWhenServiceDiscoveryOff
     EXPECT_EQ(offer_result.error(), ComErrc::kBindingFailure);
 }
 
+TEST_F(SkeletonBaseOfferFixture, OfferServiceAsyncReportsSuccessfulOfferViaCompletionCallback)
+{
+    concurrency::ThreadPool executor{1U};
+    std::promise<Result<void>> completion_result{};
+
+    // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // Expecting that PrepareOffer gets called on the skeleton binding and each event
+    ExpectOfferService();
+
+    // and the initial field value is set
+    std::ignore = skeleton_->dummy_field.Update(kInitialFieldValue);
+
+    // When offering the Service asynchronously
+    const auto offer_result =
+        skeleton_->OfferServiceAsync(executor, [&completion_result](Result<void> result) noexcept {
+            completion_result.set_value(std::move(result));
+        });
+
+    // Then the asynchronous offer is started
+    ASSERT_TRUE(offer_result.has_value());
+
+    // and the completion callback is called without an error
+    EXPECT_TRUE(completion_result.get_future().get().has_value());
+}
+
+TEST_F(SkeletonBaseOfferFixture, OfferServiceAsyncReportsFailedOfferViaCompletionCallback)
+{
+    concurrency::ThreadPool executor{1U};
+    std::promise<Result<void>> completion_result{};
+
+    // Given a constructed Skeleton with a valid identifier
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+
+    // Expect that PrepareOffer fails when being called on the binding
+    EXPECT_CALL(*binding_mock_, PrepareOffer(_, _, _))
+        .WillOnce(Return(MakeUnexpected(ComErrc::kInvalidBindingInformation)));
+
+    // When offering the Service asynchronously
+    const auto offer_result =
+        skeleton_->OfferServiceAsync(executor, [&completion_result](Result<void> result) noexcept {
+            completion_result.set_value(std::move(result));
+        });
+    ASSERT_TRUE(offer_result.has_value());
+
+    // Then the completion callback is called with the same error a synchronous offer would have returned
+    const auto completion = completion_result.get_future().get();
+    ASSERT_FALSE(completion.has_value());
+    EXPECT_EQ(completion.error(), ComErrc::kBindingFailure);
+}
+
+TEST_F(SkeletonBaseOfferFixture, OfferServiceAsyncReturnsErrorWhileAsynchronousOfferIsPending)
+{
+    concurrency::ThreadPool executor{1U};
+    std::promise<void> continue_offer{};
+    std::promise<Result<void>> completion_result{};
+
+    // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
+    CreateSkeleton(GetInstanceIdentifierWithValidBinding());
+    std::ignore = skeleton_->dummy_field.Update(kInitialFieldValue);
+
+    // and given that the skeleton binding blocks in PrepareOffer until the test continues it
+    auto continue_offer_future = continue_offer.get_future();
+    EXPECT_CALL(*binding_mock_, PrepareOffer(_, _, _)).WillOnce(Invoke([&continue_offer_future](auto&&...) {
+        continue_offer_future.wait();
+        return Result<void>{};
+    }));
+    EXPECT_CALL(*event_binding_mock_1_, PrepareOffer());
+    EXPECT_CALL(*event_binding_mock_2_, PrepareOffer());
+    EXPECT_CALL(*field_binding_mock_, PrepareOffer());
+    EXPECT_CALL(service_discovery_mock_, OfferService(_));
+
+    // and given an asynchronous offer, which is pending
+    const auto first_offer_result =
+        skeleton_->OfferServiceAsync(executor, [&completion_result](Result<void> result) noexcept {
+            completion_result.set_value(std::move(result));
+        });
+    ASSERT_TRUE(first_offer_result.has_value());
+
+    // When offering the Service asynchronously again
+    const auto second_offer_result = skeleton_->OfferServiceAsync(executor, [](Result<void>) noexcept {});
+
+    // Then an error is returned
+    ASSERT_FALSE(second_offer_result.has_value());
+    EXPECT_EQ(second_offer_result.error(), ComErrc::kBindingFailure);
+
+    // and the pending offer still completes successfully
+    continue_offer.set_value();
+    EXPECT_TRUE(completion_result.get_future().get().has_value());
+}
+
 TEST_F(SkeletonBaseMoveFixture, SelfMovingAssignmentDoesNotCauseIssues)
 {
     // Given a constructed Skeleton with a valid identifier with two events and a field registered with the skeleton
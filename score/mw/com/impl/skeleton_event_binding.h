@@ -61,6 +61,9 @@ class SkeletonEventBindingBase
     /// allocations)
     virtual std::size_t GetMaxSize() const noexcept = 0;
 
+    /// \brief Gets the alignment of the underlying event-type
+    virtual std::size_t GetMaxAlignment() const noexcept = 0;
+
     /// \brief Gets the binding type of the binding
     virtual BindingType GetBindingType() const noexcept = 0;
 
@@ -93,6 +96,11 @@ class SkeletonEventBinding : public SkeletonEventBindingBase
     {
         return sizeof(SampleType);
     }
+
+    std::size_t GetMaxAlignment() const noexcept override
+    {
+        return alignof(SampleType);
+    }
 };
 
 }  // namespace score::mw::com::impl
@@ -59,6 +59,12 @@ TEST(SkeletonEventBindingTest, CanGetMaxSizeOfLiteralType)
     EXPECT_EQ(unit.GetMaxSize(), 1);
 }
 
+TEST(SkeletonEventBindingTest, CanGetMaxAlignmentOfLiteralType)
+{
+    MyEvent<std::uint64_t> unit{};
+    EXPECT_EQ(unit.GetMaxAlignment(), alignof(std::uint64_t));
+}
+
 TEST(SkeletonEventBindingTest, SkeletonEventBindingShouldNotBeCopyable)
 {
     static_assert(!std::is_copy_constructible<MyEvent<std::uint8_t>>::value, "Is wrongly copyable");
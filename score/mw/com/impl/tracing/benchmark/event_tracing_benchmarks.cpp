@@ -0,0 +1,103 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/mock_binding/proxy_event.h"
+#include "score/mw/com/impl/bindings/mock_binding/sample_allocatee_ptr.h"
+#include "score/mw/com/impl/bindings/mock_binding/skeleton_event.h"
+#include "score/mw/com/impl/plumbing/sample_allocatee_ptr.h"
+#include "score/mw/com/impl/plumbing/sample_ptr.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
+#include "score/mw/com/impl/tracing/proxy_event_tracing.h"
+#include "score/mw/com/impl/tracing/proxy_event_tracing_data.h"
+#include "score/mw/com/impl/tracing/skeleton_event_tracing.h"
+#include "score/mw/com/impl/tracing/skeleton_event_tracing_data.h"
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace score::mw::com::impl::tracing
+{
+namespace
+{
+
+using TestSampleType = std::uint64_t;
+
+/// \brief Number of samples handed out per GetNewSamples() call.
+constexpr std::int64_t kMaxNumberOfSamples{8};
+
+void AddBuildLabel(benchmark::State& state)
+{
+    state.SetLabel(kIpcTracingCompiledIn ? "ipc_tracing:compiled_in" : "ipc_tracing:compiled_out");
+}
+
+/// \brief The tracing part of SkeletonEvent::Send(SampleAllocateePtr): creating the optional trace callback and
+///        checking it after the binding sent the sample, for an event whose trace points are not configured.
+void SendTracing(benchmark::State& state)
+{
+    AddBuildLabel(state);
+    SkeletonEventTracingData skeleton_event_tracing_data{};
+    ::testing::NiceMock<mock_binding::SkeletonEvent<TestSampleType>> skeleton_event_binding{};
+    auto sample = MakeSampleAllocateePtr(std::make_unique<TestSampleType>(42U));
+
+    for (auto _ : state)
+    {
+        auto tracing_handler =
+            CreateTracingSendWithAllocateCallback<TestSampleType>(skeleton_event_tracing_data, skeleton_event_binding);
+        benchmark::DoNotOptimize(tracing_handler);
+        if (tracing_handler.has_value())
+        {
+            (*tracing_handler)(sample);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// \brief The tracing part of ProxyEvent::GetNewSamples(): the GetNewSamples trace point, wrapping the user receiver
+///        into the binding callback and calling it for every sample, for an event whose trace points are not
+///        configured.
+void GetNewSamplesTracing(benchmark::State& state)
+{
+    AddBuildLabel(state);
+    ProxyEventTracingData proxy_event_tracing_data{};
+    ::testing::NiceMock<mock_binding::ProxyEvent<TestSampleType>> proxy_event_binding{};
+    const auto number_of_samples = state.range(0);
+    std::uint64_t number_of_received_samples{0U};
+
+    for (auto _ : state)
+    {
+        if constexpr (kIpcTracingCompiledIn)
+        {
+            TraceGetNewSamples(proxy_event_tracing_data, proxy_event_binding);
+        }
+        auto receiver = [&number_of_received_samples](SamplePtr<TestSampleType>) noexcept {
+            ++number_of_received_samples;
+        };
+        auto tracing_receiver = CreateTracingGetNewSamplesCallback<TestSampleType, decltype(receiver)>(
+            proxy_event_tracing_data, proxy_event_binding, std::move(receiver));
+        for (std::int64_t sample_index = 0; sample_index < number_of_samples; ++sample_index)
+        {
+            tracing_receiver(nullptr, static_cast<ITracingRuntime::TracePointDataId>(sample_index));
+        }
+    }
+    benchmark::DoNotOptimize(number_of_received_samples);
+    state.SetItemsProcessed(state.iterations() * number_of_samples);
+}
+
+BENCHMARK(SendTracing);
+BENCHMARK(GetNewSamplesTracing)->RangeMultiplier(2)->Range(1, kMaxNumberOfSamples)->ArgName("samples");
+
+}  // namespace
+}  // namespace score::mw::com::impl::tracing
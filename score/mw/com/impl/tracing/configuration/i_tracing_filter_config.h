@@ -18,7 +18,9 @@
 #include "score/mw/com/impl/tracing/configuration/proxy_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/skeleton_event_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/skeleton_field_trace_point_type.h"
+#include "score/mw/com/impl/tracing/configuration/trace_point_throttling_config.h"
 
+#include <optional>
 #include <string_view>
 
 namespace score::mw::com::impl::tracing
@@ -73,6 +75,29 @@ class ITracingFilterConfig
                                InstanceSpecifierView instance_specifier,
                                ProxyFieldTracePointType proxy_field_trace_point_type) noexcept = 0;
 
+    /// \brief Returns the throttling configured for the given trace point, which applies to all its instances.
+    /// \details Throttling is only supported for the trace points, which hand over data residing in shared memory
+    ///          (send/update), since these are the ones blocking event slots while being traced.
+    /// \return throttling config, if one has been configured for the trace point, otherwise an empty optional (no
+    ///         throttling).
+    virtual std::optional<TracePointThrottlingConfig> GetTracePointThrottling(
+        std::string_view service_type,
+        std::string_view event_name,
+        SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept = 0;
+    virtual std::optional<TracePointThrottlingConfig> GetTracePointThrottling(
+        std::string_view service_type,
+        std::string_view field_name,
+        SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept = 0;
+
+    virtual void SetTracePointThrottling(std::string_view service_type,
+                                         std::string_view event_name,
+                                         SkeletonEventTracePointType skeleton_event_trace_point_type,
+                                         const TracePointThrottlingConfig& throttling_config) noexcept = 0;
+    virtual void SetTracePointThrottling(std::string_view service_type,
+                                         std::string_view field_name,
+                                         SkeletonFieldTracePointType skeleton_field_trace_point_type,
+                                         const TracePointThrottlingConfig& throttling_config) noexcept = 0;
+
     virtual std::uint16_t GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept = 0;
 };
 
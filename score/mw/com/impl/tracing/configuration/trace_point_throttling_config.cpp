@@ -0,0 +1,28 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/configuration/trace_point_throttling_config.h"
+
+namespace score::mw::com::impl::tracing
+{
+
+bool operator==(const TracePointThrottlingConfig& lhs, const TracePointThrottlingConfig& rhs) noexcept
+{
+    // Suppress "AUTOSAR C++14 A5-2-6" rule finding. This rule states:"The operands of a logical && or \\ shall be
+    // parenthesized if the operands contain binary operators".
+    // This a false-positive, all operands are parenthesized.
+    // coverity[autosar_cpp14_a5_2_6_violation : FALSE]
+    return ((lhs.sampling_ratio == rhs.sampling_ratio) &&
+            (lhs.max_records_per_second == rhs.max_records_per_second) && (lhs.burst_size == rhs.burst_size));
+}
+
+}  // namespace score::mw::com::impl::tracing
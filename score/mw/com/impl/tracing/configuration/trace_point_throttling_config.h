@@ -0,0 +1,46 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_THROTTLING_CONFIG_H
+#define SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_THROTTLING_CONFIG_H
+
+#include <cstdint>
+#include <optional>
+
+namespace score::mw::com::impl::tracing
+{
+
+/// \brief Throttling of a single (enabled) trace point as configured in the trace filter config.
+/// \details A trace point call is first subjected to sampling: only the given ratio of calls is considered for
+///          tracing. The sampled calls are then subjected to an (optional) token-bucket rate limit, which allows up to
+///          burst_size records in a row and refills with max_records_per_second. A default constructed config does
+///          not throttle at all.
+struct TracePointThrottlingConfig
+{
+    /// \brief Ratio of trace point calls, which shall be traced. Must be in the range (0, 1].
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+    // be private.". We need these data elements to be organized into a coherent organized data structure.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    double sampling_ratio{1.0};
+    /// \brief Sustained number of records per second, which may be traced. No rate limit is applied, if empty.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::optional<double> max_records_per_second{};
+    /// \brief Number of records, which may be traced in a row, before the rate limit kicks in.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t burst_size{1U};
+};
+
+bool operator==(const TracePointThrottlingConfig& lhs, const TracePointThrottlingConfig& rhs) noexcept;
+
+}  // namespace score::mw::com::impl::tracing
+
+#endif  // SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_THROTTLING_CONFIG_H
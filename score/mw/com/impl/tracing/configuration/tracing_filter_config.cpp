@@ -118,6 +118,53 @@ bool IsTracePointEnabledInMap(
     return instance_specifier_in_vector;
 }
 
+template <typename TracePointType>
+void SetTracePointThrottlingInMap(
+    std::string_view service_type,
+    std::string_view service_element_name,
+    ServiceElementType service_element_type,
+    TracePointType trace_point_type,
+    const TracePointThrottlingConfig& throttling_config,
+    std::unordered_map<TracePointKey, TracePointThrottlingConfig>& trace_point_throttling_map,
+    std::set<std::string, std::less<>>& config_names) noexcept
+{
+    if (trace_point_type == TracePointType::INVALID)
+    {
+        score::mw::log::LogFatal("lola") << "Invalid TracePointType: " << static_cast<int>(trace_point_type);
+        std::terminate();
+    }
+    auto service_type_stored = GetOrInsertStringInSet(service_type, config_names);
+    auto service_element_name_stored = GetOrInsertStringInSet(service_element_name, config_names);
+    const ServiceElementIdentifierView service_element_identifer{
+        service_type_stored, service_element_name_stored, service_element_type};
+
+    auto trace_point_type_int = static_cast<std::uint8_t>(trace_point_type);
+    const TracePointKey trace_point_key{service_element_identifer, trace_point_type_int};
+
+    trace_point_throttling_map[trace_point_key] = throttling_config;
+}
+
+template <typename TracePointType>
+std::optional<TracePointThrottlingConfig> GetTracePointThrottlingFromMap(
+    std::string_view service_type,
+    std::string_view service_element_name,
+    ServiceElementType service_element_type,
+    TracePointType trace_point_type,
+    const std::unordered_map<TracePointKey, TracePointThrottlingConfig>& trace_point_throttling_map) noexcept
+{
+    const ServiceElementIdentifierView service_element_identifer{
+        service_type, service_element_name, service_element_type};
+    auto trace_point_type_int = static_cast<std::uint8_t>(trace_point_type);
+    const TracePointKey trace_point_key{service_element_identifer, trace_point_type_int};
+
+    const auto map_it = trace_point_throttling_map.find(trace_point_key);
+    if (map_it == trace_point_throttling_map.cend())
+    {
+        return {};
+    }
+    return map_it->second;
+}
+
 template <typename T>
 constexpr bool DoesTracePointNeedTraceDoneCB([[maybe_unused]] const T& trace_point_type) noexcept
 {
@@ -374,6 +421,58 @@ void TracingFilterConfig::AddTracePoint(std::string_view service_type,
                        config_names_);
 }
 
+std::optional<TracePointThrottlingConfig> TracingFilterConfig::GetTracePointThrottling(
+    std::string_view service_type,
+    std::string_view event_name,
+    SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept
+{
+    return GetTracePointThrottlingFromMap(service_type,
+                                          event_name,
+                                          ServiceElementType::EVENT,
+                                          skeleton_event_trace_point_type,
+                                          skeleton_event_trace_point_throttlings_);
+}
+
+std::optional<TracePointThrottlingConfig> TracingFilterConfig::GetTracePointThrottling(
+    std::string_view service_type,
+    std::string_view field_name,
+    SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept
+{
+    return GetTracePointThrottlingFromMap(service_type,
+                                          field_name,
+                                          ServiceElementType::FIELD,
+                                          skeleton_field_trace_point_type,
+                                          skeleton_field_trace_point_throttlings_);
+}
+
+void TracingFilterConfig::SetTracePointThrottling(std::string_view service_type,
+                                                  std::string_view event_name,
+                                                  SkeletonEventTracePointType skeleton_event_trace_point_type,
+                                                  const TracePointThrottlingConfig& throttling_config) noexcept
+{
+    SetTracePointThrottlingInMap(service_type,
+                                 event_name,
+                                 ServiceElementType::EVENT,
+                                 skeleton_event_trace_point_type,
+                                 throttling_config,
+                                 skeleton_event_trace_point_throttlings_,
+                                 config_names_);
+}
+
+void TracingFilterConfig::SetTracePointThrottling(std::string_view service_type,
+                                                  std::string_view field_name,
+                                                  SkeletonFieldTracePointType skeleton_field_trace_point_type,
+                                                  const TracePointThrottlingConfig& throttling_config) noexcept
+{
+    SetTracePointThrottlingInMap(service_type,
+                                 field_name,
+                                 ServiceElementType::FIELD,
+                                 skeleton_field_trace_point_type,
+                                 throttling_config,
+                                 skeleton_field_trace_point_throttlings_,
+                                 config_names_);
+}
+
 /// @brief: Find the number of configured tracing slots for all trace points.
 std::uint16_t TracingFilterConfig::GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept
 {
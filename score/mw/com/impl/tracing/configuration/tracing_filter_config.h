@@ -16,7 +16,9 @@
 #include "score/mw/com/impl/configuration/configuration.h"
 #include "score/mw/com/impl/tracing/configuration/i_tracing_filter_config.h"
 #include "score/mw/com/impl/tracing/configuration/trace_point_key.h"
+#include "score/mw/com/impl/tracing/configuration/trace_point_throttling_config.h"
 
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -62,6 +64,24 @@ class TracingFilterConfig : public ITracingFilterConfig
                        InstanceSpecifierView instance_specifier,
                        ProxyFieldTracePointType proxy_field_trace_point_type) noexcept override;
 
+    std::optional<TracePointThrottlingConfig> GetTracePointThrottling(
+        std::string_view service_type,
+        std::string_view event_name,
+        SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept override;
+    std::optional<TracePointThrottlingConfig> GetTracePointThrottling(
+        std::string_view service_type,
+        std::string_view field_name,
+        SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept override;
+
+    void SetTracePointThrottling(std::string_view service_type,
+                                 std::string_view event_name,
+                                 SkeletonEventTracePointType skeleton_event_trace_point_type,
+                                 const TracePointThrottlingConfig& throttling_config) noexcept override;
+    void SetTracePointThrottling(std::string_view service_type,
+                                 std::string_view field_name,
+                                 SkeletonFieldTracePointType skeleton_field_trace_point_type,
+                                 const TracePointThrottlingConfig& throttling_config) noexcept override;
+
     std::uint16_t GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept override;
 
   private:
@@ -72,6 +92,10 @@ class TracingFilterConfig : public ITracingFilterConfig
     TracePointMapType skeleton_field_trace_points_;
     TracePointMapType proxy_event_trace_points_;
     TracePointMapType proxy_field_trace_points_;
+
+    using TracePointThrottlingMapType = std::unordered_map<TracePointKey, TracePointThrottlingConfig>;
+    TracePointThrottlingMapType skeleton_event_trace_point_throttlings_;
+    TracePointThrottlingMapType skeleton_field_trace_point_throttlings_;
 };
 
 }  // namespace score::mw::com::impl::tracing
@@ -19,7 +19,9 @@
 
 #include <score/overload.hpp>
 
+#include <cstdint>
 #include <exception>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -41,6 +43,10 @@ constexpr auto kShortnameKey = "shortname"sv;
 constexpr auto kNotifierKey = "notifier"sv;
 constexpr auto kGetterKey = "getter"sv;
 constexpr auto kSetterKey = "setter"sv;
+constexpr auto kThrottlingKey = "throttling"sv;
+constexpr auto kSamplingRatioKey = "sampling_ratio"sv;
+constexpr auto kMaxRecordsPerSecondKey = "max_records_per_second"sv;
+constexpr auto kBurstSizeKey = "burst_size"sv;
 
 /// \brief List of json property names from the tracing filter config json file which are not currently implemented.
 constexpr std::array<const std::string_view, 2U> service_element_notifier_filter_properties_not_implemented_array{
@@ -258,6 +264,112 @@ void AddTracePoint(const score::json::Object& json,
     }
 }
 
+/// \brief Parses the throttling object of a single trace point.
+/// \param json throttling object of the trace point
+/// \param trace_point_name json property name of the trace point, only used for logging
+/// \return parsed throttling or an empty optional, if the throttling has invalid values. In this case the trace point
+///         stays unthrottled.
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". This is a false positive, std::terminate() is implicitly called from '.value()' in case the returned
+// result from 'json.As()' doesn't have value but we check with 'has_value()' before accessing the value, so no way for
+// throwing std::bad_optional_access which leds to std::terminate(). This suppression should be removed after fixing
+// [Ticket-173043](broken_link_j/Ticket-173043)
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+std::optional<TracePointThrottlingConfig> ParseTracePointThrottling(const score::json::Any& json,
+                                                                    const std::string_view trace_point_name) noexcept
+{
+    auto object_result = json.As<score::json::Object>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(object_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& object = object_result.value().get();
+
+    TracePointThrottlingConfig throttling_config{};
+    const auto& sampling_ratio = object.find(kSamplingRatioKey);
+    if (sampling_ratio != object.cend())
+    {
+        const auto sampling_ratio_result = sampling_ratio->second.As<double>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(sampling_ratio_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        throttling_config.sampling_ratio = sampling_ratio_result.value();
+    }
+    const auto& max_records_per_second = object.find(kMaxRecordsPerSecondKey);
+    if (max_records_per_second != object.cend())
+    {
+        const auto max_records_per_second_result = max_records_per_second->second.As<double>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(max_records_per_second_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        throttling_config.max_records_per_second = max_records_per_second_result.value();
+    }
+    const auto& burst_size = object.find(kBurstSizeKey);
+    if (burst_size != object.cend())
+    {
+        const auto burst_size_result = burst_size->second.As<std::uint32_t>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(burst_size_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        throttling_config.burst_size = burst_size_result.value();
+    }
+
+    const bool is_sampling_ratio_valid{(throttling_config.sampling_ratio > 0.0) &&
+                                       (throttling_config.sampling_ratio <= 1.0)};
+    const bool is_rate_limit_valid{(!throttling_config.max_records_per_second.has_value()) ||
+                                   (throttling_config.max_records_per_second.value() > 0.0)};
+    if ((!is_sampling_ratio_valid) || (!is_rate_limit_valid) || (throttling_config.burst_size == 0U))
+    {
+        ::score::mw::log::LogError("lola")
+            << "Trace Filter Configuration: invalid throttling for trace point " << trace_point_name
+            << ". Trace point will not be throttled.";
+        return {};
+    }
+    return throttling_config;
+}
+
+/// \brief Sets the throttling of all the trace points within the given mapping, for which the throttling object
+///        inside the given json object contains an entry.
+/// \tparam Mapping property-name-to-trace-point-type mapping arrays
+/// \param json_object json object (event-object or field-notifier-object), which may contain a throttling object
+/// \param service_type service type in which context the throttling shall be set
+/// \param service_element_name name of service element (event or field name)
+/// \param property_name_trace_point_mappings json-property-name-to-trace-point-type mapping
+/// \param filter_config filter config, where the throttling shall be set.
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". This is a false positive, std::terminate() is implicitly called from
+// 'json.As<score::json::Object>().value()' in case the returned result from 'json.As()' doesn't have value but as we do
+// check inside 'json.As' using 'std::get_if' and null pointer check before accessing the value, so no way for throwing
+// std::bad_optional_access which leds to std::terminate(). This suppression should be removed after fixing
+// [Ticket-173043](broken_link_j/Ticket-173043)
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+template <typename Mapping>
+void SetTracePointThrottlings(const score::json::Object& json_object,
+                              std::string_view service_type,
+                              std::string_view service_element_name,
+                              const Mapping& property_name_trace_point_mappings,
+                              TracingFilterConfig& filter_config) noexcept
+{
+    const auto& throttling = json_object.find(kThrottlingKey);
+    if (throttling == json_object.cend())
+    {
+        return;
+    }
+    auto throttling_result = throttling->second.As<score::json::Object>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(throttling_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& throttling_object = throttling_result.value().get();
+    for (const auto& [trace_point_name, trace_point_type] : property_name_trace_point_mappings)
+    {
+        const auto& trace_point_throttling = throttling_object.find(trace_point_name);
+        if (trace_point_throttling == throttling_object.cend())
+        {
+            continue;
+        }
+        const auto throttling_config = ParseTracePointThrottling(trace_point_throttling->second, trace_point_name);
+        if (throttling_config.has_value())
+        {
+            filter_config.SetTracePointThrottling(
+                service_type, service_element_name, trace_point_type, throttling_config.value());
+        }
+    }
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". This is a false positive, std::terminate() is implicitly called from
 // 'json.As<score::json::Object>().value()' in case the returned result from 'json.As()' doesn't have value but as we do
@@ -335,6 +447,9 @@ void ParseEvent(const score::json::Any& json,
                 << " has been disabled in mw_com_config but is present in trace filter config file!";
         }
     }
+
+    // throttling applies to all instances of the event, for which the throttled trace points are enabled.
+    SetTracePointThrottlings(object, service_type, event_name, filter_property_skeleton_event_mappings, filter_config);
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
@@ -537,6 +652,19 @@ void ParseField(const score::json::Any& json,
                 << " has been disabled in mw_com_config but is present in trace filter config file!";
         }
     }
+
+    const auto& notifier = object.find(kNotifierKey);
+    if (notifier != object.cend())
+    {
+        auto notifier_result = notifier->second.As<score::json::Object>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(notifier_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        SetTracePointThrottlings(notifier_result.value().get(),
+                                 service_type,
+                                 field_name,
+                                 filter_property_skeleton_field_notifier_mappings,
+                                 filter_config);
+    }
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
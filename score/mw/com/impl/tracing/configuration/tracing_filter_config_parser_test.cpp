@@ -772,6 +772,119 @@ TEST_F(TraceConfigParserFixture, IgnoreTracePointReferencingUnknownEventField)
     expectAllFieldTracePoints(tracing_filter_config, "CurrentTemperatureFrontLeft", false);
 }
 
+TEST_F(TraceConfigParserFixture, ThrottlingOfEventAndFieldTracePointsIsParsed)
+{
+    // Given a tracing filter configuration, which enables and throttles the send trace points of an event and the
+    // update trace point of a field
+    auto filter_config_json = R"(
+{
+  "services": [
+    {
+      "shortname_path": "/score/ncar/services/TirePressureService",
+      "events": [
+        {
+          "shortname": "CurrentPressureFrontLeft",
+          "trace_send": true,
+          "trace_send_allocate": true,
+          "throttling": {
+            "trace_send": {
+              "sampling_ratio": 0.1,
+              "max_records_per_second": 100.0,
+              "burst_size": 20
+            },
+            "trace_send_allocate": {
+              "sampling_ratio": 0.5
+            }
+          }
+        }
+      ],
+      "fields": [
+        {
+          "shortname": "CurrentTemperatureFrontLeft",
+          "notifier": {
+            "trace_update": true,
+            "throttling": {
+              "trace_update": {
+                "max_records_per_second": 10.0,
+                "burst_size": 2
+              }
+            }
+          }
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // when parsing the given tracing filter config
+    auto result = Parse(std::move(filter_config_json), *config_);
+    // expect, that there is no error
+    ASSERT_TRUE(result.has_value());
+
+    // and expect, that the throttling of the event trace points is reflected in the returned TracingFilterConfig
+    const TracingFilterConfig tracing_filter_config = std::move(result).value();
+    const std::string_view service_type_name{"/score/ncar/services/TirePressureService"};
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(
+                  service_type_name, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND),
+              (TracePointThrottlingConfig{0.1, 100.0, 20U}));
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(
+                  service_type_name, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND_WITH_ALLOCATE),
+              (TracePointThrottlingConfig{0.5, {}, 1U}));
+
+    // and that the throttling of "trace_update" applies to both field update trace points
+    const TracePointThrottlingConfig expected_field_throttling{1.0, 10.0, 2U};
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(
+                  service_type_name, "CurrentTemperatureFrontLeft", SkeletonFieldTracePointType::UPDATE),
+              expected_field_throttling);
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(
+                  service_type_name, "CurrentTemperatureFrontLeft", SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE),
+              expected_field_throttling);
+}
+
+TEST_F(TraceConfigParserFixture, InvalidThrottlingIsIgnored)
+{
+    // Given a tracing filter configuration, which enables a send trace point with a throttling having a sampling ratio
+    // out of range
+    auto filter_config_json = R"(
+{
+  "services": [
+    {
+      "shortname_path": "/score/ncar/services/TirePressureService",
+      "events": [
+        {
+          "shortname": "CurrentPressureFrontLeft",
+          "trace_send": true,
+          "throttling": {
+            "trace_send": {
+              "sampling_ratio": 2.0
+            }
+          }
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // when parsing the given tracing filter config
+    auto result = Parse(std::move(filter_config_json), *config_);
+    // expect, that there is no error
+    ASSERT_TRUE(result.has_value());
+
+    // and expect, that the trace point is enabled, but not throttled
+    const TracingFilterConfig tracing_filter_config = std::move(result).value();
+    const std::string_view service_type_name{"/score/ncar/services/TirePressureService"};
+    EXPECT_TRUE(tracing_filter_config.IsTracePointEnabled(service_type_name,
+                                                          "CurrentPressureFrontLeft",
+                                                          kInstanceSpecifier,
+                                                          SkeletonEventTracePointType::SEND));
+    EXPECT_FALSE(tracing_filter_config
+                     .GetTracePointThrottling(
+                         service_type_name, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND)
+                     .has_value());
+}
+
 /// \brief This test verifies, that a specific trace-point, which has been activated/enabled in the trace-filter-config
 ///        for an event/field, for which tracing has been disabled in the mw::com/LoLa config, will not lead to
 ///        corresponding enabling in the returned TracingFilterConfig AND that a warning message is logged.
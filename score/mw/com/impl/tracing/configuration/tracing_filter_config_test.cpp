@@ -176,6 +176,86 @@ TEST(TracingFilterConfigDeathTest, AddingInvalidTracePointTypeTerminates)
         tracing_filter_config.AddTracePoint(kServiceType, kEventName, kInstanceSpecifierView, trace_point_type), ".*");
 }
 
+TEST(TracingFilterConfigThrottlingTest, TracePointWithoutConfiguredThrottlingIsNotThrottled)
+{
+    // Given an empty ipc tracing filter config
+    TracingFilterConfig tracing_filter_config{};
+
+    // When getting the throttling of a trace point
+    const auto throttling = tracing_filter_config.GetTracePointThrottling(
+        kServiceType, kEventName, kSkeletonEventTracePointTypeSend);
+
+    // Then no throttling is returned
+    EXPECT_FALSE(throttling.has_value());
+}
+
+TEST(TracingFilterConfigThrottlingTest, ReturnsTheThrottlingSetForAnEventTracePoint)
+{
+    // Given an empty ipc tracing filter config
+    TracingFilterConfig tracing_filter_config{};
+
+    // When setting the throttling of an event trace point
+    const TracePointThrottlingConfig throttling_config{0.25, 100.0, 10U};
+    tracing_filter_config.SetTracePointThrottling(
+        kServiceType, kEventName, kSkeletonEventTracePointTypeSend, throttling_config);
+
+    // Then the same throttling is returned for this trace point
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(kServiceType, kEventName, kSkeletonEventTracePointTypeSend),
+              throttling_config);
+    // and no throttling is returned for the other trace point of the event
+    EXPECT_FALSE(tracing_filter_config
+                     .GetTracePointThrottling(kServiceType, kEventName, kSkeletonEventTracePointTypeSendWithAllocate)
+                     .has_value());
+}
+
+TEST(TracingFilterConfigThrottlingTest, ReturnsTheThrottlingSetForAFieldTracePoint)
+{
+    // Given an empty ipc tracing filter config
+    TracingFilterConfig tracing_filter_config{};
+
+    // When setting the throttling of a field trace point
+    const TracePointThrottlingConfig throttling_config{0.5, {}, 1U};
+    tracing_filter_config.SetTracePointThrottling(
+        kServiceType, kFieldName, kSkeletonFieldTracePointTypeUpdate, throttling_config);
+
+    // Then the same throttling is returned for this trace point
+    EXPECT_EQ(
+        tracing_filter_config.GetTracePointThrottling(kServiceType, kFieldName, kSkeletonFieldTracePointTypeUpdate),
+        throttling_config);
+    // and no throttling is returned for an event with the same name
+    EXPECT_FALSE(
+        tracing_filter_config.GetTracePointThrottling(kServiceType, kFieldName, kSkeletonEventTracePointTypeSend)
+            .has_value());
+}
+
+TEST(TracingFilterConfigThrottlingTest, SettingTheThrottlingAgainOverwritesIt)
+{
+    // Given an ipc tracing filter config with a throttled trace point
+    TracingFilterConfig tracing_filter_config{};
+    tracing_filter_config.SetTracePointThrottling(
+        kServiceType, kEventName, kSkeletonEventTracePointTypeSend, TracePointThrottlingConfig{0.5, {}, 1U});
+
+    // When setting the throttling of the trace point again
+    const TracePointThrottlingConfig throttling_config{1.0, 10.0, 2U};
+    tracing_filter_config.SetTracePointThrottling(
+        kServiceType, kEventName, kSkeletonEventTracePointTypeSend, throttling_config);
+
+    // Then the latest throttling is returned
+    EXPECT_EQ(tracing_filter_config.GetTracePointThrottling(kServiceType, kEventName, kSkeletonEventTracePointTypeSend),
+              throttling_config);
+}
+
+TEST(TracingFilterConfigDeathTest, SettingThrottlingOfInvalidTracePointTypeTerminates)
+{
+    // Given an empty ipc tracing filter config
+    TracingFilterConfig tracing_filter_config{};
+
+    // When setting the throttling of an invalid trace point type it terminates
+    EXPECT_DEATH(tracing_filter_config.SetTracePointThrottling(
+                     kServiceType, kEventName, SkeletonEventTracePointType::INVALID, TracePointThrottlingConfig{}),
+                 ".*");
+}
+
 static score::mw::com::impl::Configuration GetAraComConfigJson()
 {
     std::string config_string_ = R"(
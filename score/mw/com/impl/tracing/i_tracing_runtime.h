@@ -22,12 +22,15 @@
 #include "score/mw/com/impl/tracing/configuration/skeleton_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/i_binding_tracing_runtime.h"
 #include "score/mw/com/impl/tracing/service_element_tracing_data.h"
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
 #include "score/mw/com/impl/tracing/type_erased_sample_ptr.h"
 #include "score/result/result.h"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 namespace score::mw::com::impl::tracing
 {
@@ -41,6 +44,21 @@ class ITracingRuntime
                                         SkeletonFieldTracePointType>;
     using TracePointDataId = analysis::tracing::AraComProperties::TracePointDataId;
 
+    /// \brief Record counters of a throttled trace point of a service element instance.
+    struct TracePointThrottlingStatistics
+    {
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+        // be private.". We need these data elements to be organized into a coherent organized data structure.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        ServiceElementInstanceIdentifierView service_element_instance_identifier_view;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        TracePointType trace_point_type;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::uint64_t number_of_sampled_records;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::uint64_t number_of_dropped_records;
+    };
+
     ITracingRuntime() noexcept = default;
 
     virtual ~ITracingRuntime() noexcept = default;
@@ -79,6 +97,13 @@ class ITracingRuntime
 
     virtual IBindingTracingRuntime& GetBindingTracingRuntime(const BindingType binding_type) const noexcept = 0;
 
+    virtual void RegisterTracePointThrottle(
+        const ServiceElementInstanceIdentifierView service_element_instance_identifier_view,
+        const TracePointType trace_point_type,
+        std::shared_ptr<const TracePointThrottle> trace_point_throttle) noexcept = 0;
+
+    virtual std::vector<TracePointThrottlingStatistics> GetTracePointThrottlingStatistics() const noexcept = 0;
+
   protected:
     ITracingRuntime(ITracingRuntime&&) noexcept = default;
     ITracingRuntime& operator=(ITracingRuntime&&) noexcept = default;
@@ -0,0 +1,32 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_TRACING_IPC_TRACING_BUILD_CONFIG_H
+#define SCORE_MW_COM_IMPL_TRACING_IPC_TRACING_BUILD_CONFIG_H
+
+namespace score::mw::com::impl::tracing
+{
+
+/// \brief Whether IPC tracing is compiled into the event hot paths.
+/// \details Controlled by the build setting //score/mw/com/flags:ipc_tracing (default: true). If it is false,
+///          SCORE_MW_COM_IPC_TRACING_DISABLED is defined for all dependents and the tracing branches of
+///          SkeletonEvent::Send() and ProxyEvent::GetNewSamples() are discarded at compile time. In addition, no
+///          tracing data is generated from the configuration, so that all other trace points stay disabled as well.
+#ifdef SCORE_MW_COM_IPC_TRACING_DISABLED
+constexpr bool kIpcTracingCompiledIn{false};
+#else
+constexpr bool kIpcTracingCompiledIn{true};
+#endif
+
+}  // namespace score::mw::com::impl::tracing
+
+#endif  // SCORE_MW_COM_IMPL_TRACING_IPC_TRACING_BUILD_CONFIG_H
@@ -65,7 +65,7 @@ ProxyEventTracingData GenerateProxyTracingStructFromEventConfig(const InstanceId
 {
     const auto* const tracing_config = Runtime::getInstance().GetTracingFilterConfig();
     ProxyEventTracingData proxy_event_tracing_data{};
-    if (tracing_config != nullptr)
+    if (kIpcTracingCompiledIn && (tracing_config != nullptr))
     {
         const auto service_element_instance_identifier_view =
             GetServiceElementInstanceIdentifierView(instance_identifier, event_name, ServiceElementType::EVENT);
@@ -119,7 +119,7 @@ ProxyEventTracingData GenerateProxyTracingStructFromFieldConfig(const InstanceId
 {
     const auto* const tracing_config = Runtime::getInstance().GetTracingFilterConfig();
     ProxyEventTracingData proxy_event_tracing_data{};
-    if (tracing_config != nullptr)
+    if (kIpcTracingCompiledIn && (tracing_config != nullptr))
     {
         const auto service_element_instance_identifier_view =
             GetServiceElementInstanceIdentifierView(instance_identifier, field_name, ServiceElementType::FIELD);
@@ -23,6 +23,7 @@
 #include "score/mw/com/impl/instance_identifier.h"
 #include "score/mw/com/impl/proxy_event_binding.h"
 #include "score/mw/com/impl/proxy_event_binding_base.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 #include "score/mw/com/impl/tracing/proxy_event_tracing_data.h"
 
 #include <score/callback.hpp>
@@ -66,45 +67,47 @@ auto CreateTracingGetNewSamplesCallback(ProxyEventTracingData& proxy_event_traci
                                         ReceiverType&& receiver) noexcept ->
     typename ProxyEventBinding<SampleType>::Callback
 {
-    // LCOV_EXCL_BR_START (Tool incorrectly marks the branch when the condition is true as not covered. However, the
-    // lines in that branch are marked as covered indicating that the branch is indeed taken. Suppression can be removed
-    // when bug is fixed in Ticket-184256).
-    if (proxy_event_tracing_data.enable_new_samples_callback)
+    if constexpr (kIpcTracingCompiledIn)
     {
-        // LCOV_EXCL_BR_STOP
-        typename ProxyEventBinding<SampleType>::Callback tracing_receiver =
-            // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be done
-            // via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is forwarding
-            // reference. std::forward is already used here.
-            // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
-            [&proxy_event_tracing_data, &proxy_event_binding_base, receiver = std::forward<ReceiverType>(receiver)](
-                SamplePtr<SampleType> sample_ptr, ITracingRuntime::TracePointDataId trace_point_data_id) noexcept {
-                TraceCallGetNewSamplesCallback(proxy_event_tracing_data, proxy_event_binding_base, trace_point_data_id);
+        // LCOV_EXCL_BR_START (Tool incorrectly marks the branch when the condition is true as not covered. However,
+        // the lines in that branch are marked as covered indicating that the branch is indeed taken. Suppression can
+        // be removed when bug is fixed in Ticket-184256).
+        if (proxy_event_tracing_data.enable_new_samples_callback)
+        {
+            // LCOV_EXCL_BR_STOP
+            typename ProxyEventBinding<SampleType>::Callback tracing_receiver =
                 // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be
                 // done via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is
-                // forwarding reference. std::move is already used here.
+                // forwarding reference. std::forward is already used here.
                 // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
-                receiver(std::move(sample_ptr));
-            };
-        return tracing_receiver;
+                [&proxy_event_tracing_data, &proxy_event_binding_base, receiver = std::forward<ReceiverType>(receiver)](
+                    SamplePtr<SampleType> sample_ptr, ITracingRuntime::TracePointDataId trace_point_data_id) noexcept {
+                    TraceCallGetNewSamplesCallback(
+                        proxy_event_tracing_data, proxy_event_binding_base, trace_point_data_id);
+                    // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall
+                    // be done via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value
+                    // is forwarding reference. std::move is already used here.
+                    // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
+                    receiver(std::move(sample_ptr));
+                };
+            return tracing_receiver;
+        }
     }
-    else
-    {
-        typename ProxyEventBinding<SampleType>::Callback tracing_receiver =
-            // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be done
-            // via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is forwarding
-            // reference. std::forward is already used here.
+
+    typename ProxyEventBinding<SampleType>::Callback tracing_receiver =
+        // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be done
+        // via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is forwarding
+        // reference. std::forward is already used here.
+        // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
+        [receiver = std::forward<ReceiverType>(receiver)](SamplePtr<SampleType> sample_ptr,
+                                                          ITracingRuntime::TracePointDataId) noexcept {
+            // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be
+            // done via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is
+            // forwarding reference. std::move is already used here.
             // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
-            [receiver = std::forward<ReceiverType>(receiver)](SamplePtr<SampleType> sample_ptr,
-                                                              ITracingRuntime::TracePointDataId) noexcept {
-                // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be
-                // done via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is
-                // forwarding reference. std::move is already used here.
-                // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
-                receiver(std::move(sample_ptr));
-            };
-        return tracing_receiver;
-    }
+            receiver(std::move(sample_ptr));
+        };
+    return tracing_receiver;
 }
 
 template <typename ReceiverType>
@@ -119,12 +122,12 @@ typename GenericProxyEventBinding::Callback CreateTracingGenericGetNewSamplesCal
     typename GenericProxyEventBinding::Callback tracing_receiver = [receiver = std::forward<ReceiverType>(receiver)](
                                                                        SamplePtr<void> sample_ptr,
                                                                        ITracingRuntime::TracePointDataId) noexcept {
-        // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be done
-        // via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is forwarding
-        // reference. std::move is already used here.
-        // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
-        receiver(std::move(sample_ptr));
-    };
+            // Suppress "AUTOSAR C++14 A18-9-2", The rule states: "Forwarding values to other functions shall be
+            // done via: (1) std::move if the value is an rvalue reference, (2) std::forward if the value is
+            // forwarding reference. std::move is already used here.
+            // coverity[autosar_cpp14_a18_9_2_violation : FALSE]
+            receiver(std::move(sample_ptr));
+        };
     return tracing_receiver;
 }
 
@@ -24,10 +24,12 @@
 #include "score/mw/com/impl/tracing/configuration/tracing_filter_config.h"
 #include "score/mw/com/impl/tracing/skeleton_event_tracing_data.h"
 #include "score/mw/com/impl/tracing/trace_error.h"
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
 
 #include <score/assert.hpp>
 
 #include <exception>
+#include <memory>
 
 namespace score::mw::com::impl::tracing
 {
@@ -121,6 +123,32 @@ std::uint8_t GetNumberOfTracingSlots(const InstanceIdentifier& instance_identifi
     return slots_per_tracing_point;
 }
 
+/// \brief Creates the throttle of the given (enabled) trace point, if throttling has been configured for it, and
+///        registers it at the tracing runtime to provide its record counters.
+/// \return throttle or nullptr, if the trace point isn't throttled.
+template <typename TracePointType>
+std::shared_ptr<TracePointThrottle> CreateTracePointThrottle(
+    const ITracingFilterConfig& tracing_config,
+    ITracingRuntime& tracing_runtime,
+    const ServiceElementInstanceIdentifierView& service_element_instance_identifier_view,
+    const TracePointType trace_point_type) noexcept
+{
+    const auto& service_element_identifier_view =
+        service_element_instance_identifier_view.service_element_identifier_view;
+    const auto throttling_config =
+        tracing_config.GetTracePointThrottling(service_element_identifier_view.service_type_name,
+                                               service_element_identifier_view.service_element_name,
+                                               trace_point_type);
+    if (!throttling_config.has_value())
+    {
+        return nullptr;
+    }
+    auto trace_point_throttle = std::make_shared<TracePointThrottle>(throttling_config.value());
+    tracing_runtime.RegisterTracePointThrottle(
+        service_element_instance_identifier_view, trace_point_type, trace_point_throttle);
+    return trace_point_throttle;
+}
+
 }  // namespace
 
 // Suppress "AUTOSAR C++14 A3-1-1", The rule states: "It shall be possible to include any header file
@@ -139,7 +167,8 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromEventConfig(const Inst
     // We want to make sure that default initialization is always performed.
     // coverity[autosar_cpp14_m8_5_2_violation : FALSE]
     SkeletonEventTracingData skeleton_event_tracing_data{};
-    const bool is_tracing_globally_enabled = ((tracing_runtime != nullptr) && (tracing_runtime->IsTracingEnabled()));
+    const bool is_tracing_globally_enabled =
+        (kIpcTracingCompiledIn && (tracing_runtime != nullptr) && (tracing_runtime->IsTracingEnabled()));
 
     // in case tracing is globally disabled, this will never switch back to enable. Thus, we work with default
     // initialized skeleton_event_tracing_data, which has all trace-points disabled. Only if is_tracing_globally_enabled
@@ -161,6 +190,23 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromEventConfig(const Inst
         skeleton_event_tracing_data.enable_send_with_allocate = tracing_config->IsTracePointEnabled(
             service_type, event_name, instance_specifier_view, SkeletonEventTracePointType::SEND_WITH_ALLOCATE);
 
+        if (skeleton_event_tracing_data.enable_send)
+        {
+            skeleton_event_tracing_data.send_throttle =
+                CreateTracePointThrottle(*tracing_config,
+                                         *tracing_runtime,
+                                         service_element_instance_identifier_view,
+                                         SkeletonEventTracePointType::SEND);
+        }
+        if (skeleton_event_tracing_data.enable_send_with_allocate)
+        {
+            skeleton_event_tracing_data.send_with_allocate_throttle =
+                CreateTracePointThrottle(*tracing_config,
+                                         *tracing_runtime,
+                                         service_element_instance_identifier_view,
+                                         SkeletonEventTracePointType::SEND_WITH_ALLOCATE);
+        }
+
         // only register this service element at Runtime, in case TraceDoneCB relevant trace-point are enabled:
         const auto isTraceDoneCallbackNeeded =
             skeleton_event_tracing_data.enable_send || skeleton_event_tracing_data.enable_send_with_allocate;
@@ -193,7 +239,8 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromFieldConfig(const Inst
     // We want to make sure that default initialization is always performed.
     // coverity[autosar_cpp14_m8_5_2_violation : FALSE]
     SkeletonEventTracingData skeleton_event_tracing_data{};
-    const bool is_tracing_globally_enabled = ((tracing_runtime != nullptr) && (tracing_runtime->IsTracingEnabled()));
+    const bool is_tracing_globally_enabled =
+        (kIpcTracingCompiledIn && (tracing_runtime != nullptr) && (tracing_runtime->IsTracingEnabled()));
 
     // in case tracing is globally disabled, this will never switch back to enable. Thus, we work with default
     // initialized skeleton_event_tracing_data, which has all trace-points disabled. Only if is_tracing_globally_enabled
@@ -212,6 +259,23 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromFieldConfig(const Inst
         skeleton_event_tracing_data.enable_send_with_allocate = tracing_config->IsTracePointEnabled(
             service_type, field_name, instance_specifier_view, SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE);
 
+        if (skeleton_event_tracing_data.enable_send)
+        {
+            skeleton_event_tracing_data.send_throttle =
+                CreateTracePointThrottle(*tracing_config,
+                                         *tracing_runtime,
+                                         service_element_instance_identifier_view,
+                                         SkeletonFieldTracePointType::UPDATE);
+        }
+        if (skeleton_event_tracing_data.enable_send_with_allocate)
+        {
+            skeleton_event_tracing_data.send_with_allocate_throttle =
+                CreateTracePointThrottle(*tracing_config,
+                                         *tracing_runtime,
+                                         service_element_instance_identifier_view,
+                                         SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE);
+        }
+
         // only register this service element at Runtime, in case TraceDoneCB relevant trace-point are enabled:
         const auto isTraceDoneCallbackNeeded =
             skeleton_event_tracing_data.enable_send || skeleton_event_tracing_data.enable_send_with_allocate;
@@ -25,6 +25,7 @@
 #include "score/mw/com/impl/skeleton_event_binding.h"
 #include "score/mw/com/impl/tracing/common_event_tracing.h"
 #include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 #include "score/mw/com/impl/tracing/skeleton_event_tracing_data.h"
 
 #include <cstdint>
@@ -175,6 +176,14 @@ void TraceSend(SkeletonEventTracingData& skeleton_event_tracing_data,
             SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(false, "Service element type must be EVENT or FIELD");
         }
 
+        // the throttling decision has to be taken before the sample gets referenced for tracing, so that a dropped
+        // call does not block an event slot.
+        const auto& send_throttle = skeleton_event_tracing_data.send_throttle;
+        if ((send_throttle != nullptr) && (!send_throttle->ShouldTrace()))
+        {
+            return;
+        }
+
         const auto tracing_data = detail_skeleton_event_tracing::ExtractBindingTracingData(sample_data_ptr);
         auto type_erased_sample_ptr = detail_skeleton_event_tracing::CreateTypeErasedSamplePtr(sample_data_ptr);
 
@@ -220,6 +229,14 @@ void TraceSendWithAllocate(SkeletonEventTracingData& skeleton_event_tracing_data
             SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(false, "Service element type must be EVENT or FIELD");
         }
 
+        // the throttling decision has to be taken before the sample gets referenced for tracing, so that a dropped
+        // call does not block an event slot.
+        const auto& send_with_allocate_throttle = skeleton_event_tracing_data.send_with_allocate_throttle;
+        if ((send_with_allocate_throttle != nullptr) && (!send_with_allocate_throttle->ShouldTrace()))
+        {
+            return;
+        }
+
         const auto tracing_data = detail_skeleton_event_tracing::ExtractBindingTracingData(sample_data_ptr);
         auto type_erased_sample_ptr = detail_skeleton_event_tracing::CreateTypeErasedSamplePtr(sample_data_ptr);
 
@@ -243,12 +260,15 @@ auto CreateTracingSendCallback(SkeletonEventTracingData& skeleton_event_tracing_
     -> std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>
 {
     std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback> tracing_handler{};
-    if (skeleton_event_tracing_data.enable_send)
+    if constexpr (kIpcTracingCompiledIn)
     {
-        tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
-                              impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
-            TraceSend<SampleType>(skeleton_event_tracing_data, skeleton_event_binding_base, sample_data_ptr);
-        };
+        if (skeleton_event_tracing_data.enable_send)
+        {
+            tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
+                                  impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
+                TraceSend<SampleType>(skeleton_event_tracing_data, skeleton_event_binding_base, sample_data_ptr);
+            };
+        }
     }
     return tracing_handler;
 }
@@ -259,13 +279,16 @@ auto CreateTracingSendWithAllocateCallback(SkeletonEventTracingData& skeleton_ev
     -> std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>
 {
     std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback> tracing_handler{};
-    if (skeleton_event_tracing_data.enable_send_with_allocate)
+    if constexpr (kIpcTracingCompiledIn)
     {
-        tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
-                              impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
-            TraceSendWithAllocate<SampleType>(
-                skeleton_event_tracing_data, skeleton_event_binding_base, sample_data_ptr);
-        };
+        if (skeleton_event_tracing_data.enable_send_with_allocate)
+        {
+            tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
+                                  impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
+                TraceSendWithAllocate<SampleType>(
+                    skeleton_event_tracing_data, skeleton_event_binding_base, sample_data_ptr);
+            };
+        }
     }
     return tracing_handler;
 }
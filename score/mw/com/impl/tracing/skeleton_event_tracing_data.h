@@ -15,6 +15,9 @@
 
 #include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
 #include "score/mw/com/impl/tracing/service_element_tracing_data.h"
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
+
+#include <memory>
 
 namespace score::mw::com::impl::tracing
 {
@@ -34,6 +37,13 @@ class SkeletonEventTracingData
     bool enable_send{false};
     // coverity[autosar_cpp14_m11_0_1_violation]
     bool enable_send_with_allocate{false};
+
+    /// \brief Throttles of the send/send-with-allocate trace points. Only set, if the trace point is enabled and
+    ///        throttling has been configured for it, otherwise every call of the enabled trace point is traced.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::shared_ptr<TracePointThrottle> send_throttle{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::shared_ptr<TracePointThrottle> send_with_allocate_throttle{};
 };
 
 void DisableAllTracePoints(SkeletonEventTracingData& skeleton_event_tracing_data) noexcept;
@@ -47,7 +57,9 @@ inline bool operator==(const SkeletonEventTracingData& lhs, const SkeletonEventT
     // coverity[autosar_cpp14_a5_2_6_violation : FALSE]
     return ((lhs.service_element_instance_identifier_view == rhs.service_element_instance_identifier_view) &&
             (lhs.service_element_tracing_data == rhs.service_element_tracing_data) &&
-            (lhs.enable_send == rhs.enable_send) && (lhs.enable_send_with_allocate == rhs.enable_send_with_allocate));
+            (lhs.enable_send == rhs.enable_send) && (lhs.enable_send_with_allocate == rhs.enable_send_with_allocate) &&
+            (lhs.send_throttle == rhs.send_throttle) &&
+            (lhs.send_with_allocate_throttle == rhs.send_with_allocate_throttle));
 }
 
 }  // namespace score::mw::com::impl::tracing
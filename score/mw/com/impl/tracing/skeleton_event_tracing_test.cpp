@@ -26,8 +26,10 @@
 #include "score/mw/com/impl/tracing/common_event_tracing.h"
 #include "score/mw/com/impl/tracing/configuration/skeleton_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/tracing_filter_config_mock.h"
+#include "score/mw/com/impl/tracing/ipc_tracing_build_config.h"
 #include "score/mw/com/impl/tracing/skeleton_event_tracing_data.h"
 #include "score/mw/com/impl/tracing/trace_error.h"
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
 #include "score/mw/com/impl/tracing/tracing_runtime_mock.h"
 
 #include <score/assert.hpp>
@@ -103,6 +105,15 @@ class SkeletonEventTracingFixture : public ::testing::TestWithParam<ServiceEleme
         return *this;
     }
 
+    SkeletonEventTracingFixture& WithAllTracePointsThrottled(const TracePointThrottlingConfig& throttling_config)
+    {
+        skeleton_event_tracing_data_.send_throttle = std::make_shared<TracePointThrottle>(throttling_config);
+        skeleton_event_tracing_data_.send_with_allocate_throttle =
+            std::make_shared<TracePointThrottle>(throttling_config);
+
+        return *this;
+    }
+
     using TestSampleType = std::uint32_t;
 
     SkeletonEventTracingData skeleton_event_tracing_data_{};
@@ -210,6 +221,26 @@ TEST_P(SkeletonEventTraceSendFixture, TraceSendWillIgnoreUnknownErrorFromBinding
     EXPECT_TRUE(skeleton_event_tracing_data_.enable_send);
 }
 
+TEST_P(SkeletonEventTraceSendFixture, TraceSendWillOnlyDispatchSampledCallsOfAThrottledTracePoint)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled and throttled to every second call
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled().WithAllTracePointsThrottled(
+        TracePointThrottlingConfig{0.5, {}, 1U});
+
+    // Expecting TraceData will be called only twice on the TracingRuntime binding
+    EXPECT_CALL(tracing_runtime_mock_, Trace(_, _, _, _, _, _, _, _)).Times(2);
+
+    // When calling TraceSend four times
+    for (std::size_t i = 0U; i < 4U; ++i)
+    {
+        TraceSend<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_, sample_data_ptr_);
+    }
+
+    // Then the throttle of the send trace point counted two sampled and two dropped records
+    EXPECT_EQ(skeleton_event_tracing_data_.send_throttle->GetNumberOfSampledRecords(), 2U);
+    EXPECT_EQ(skeleton_event_tracing_data_.send_throttle->GetNumberOfDroppedRecords(), 2U);
+}
+
 TEST_F(SkeletonEventTraceSendParamaterisedDeathTest, TraceSendWithInvalidTraceServiceElementTypeTerminates)
 {
     // Given a SkeletonEventTracingData with an invalid element type and all trace points enabled
@@ -312,6 +343,28 @@ TEST_P(SkeletonEventTraceSendWithAllocateFixture, TraceSendWithAllocateWillIgnor
     EXPECT_TRUE(skeleton_event_tracing_data_.enable_send_with_allocate);
 }
 
+TEST_P(SkeletonEventTraceSendWithAllocateFixture,
+       TraceSendWithAllocateWillOnlyDispatchSampledCallsOfAThrottledTracePoint)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled and throttled to every second call
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled().WithAllTracePointsThrottled(
+        TracePointThrottlingConfig{0.5, {}, 1U});
+
+    // Expecting TraceData will be called only twice on the TracingRuntime binding
+    EXPECT_CALL(tracing_runtime_mock_, Trace(_, _, _, _, _, _, _, _)).Times(2);
+
+    // When calling TraceSendWithAllocate four times
+    for (std::size_t i = 0U; i < 4U; ++i)
+    {
+        TraceSendWithAllocate<TestSampleType>(
+            skeleton_event_tracing_data_, skeleton_event_binding_base_, sample_data_ptr_);
+    }
+
+    // Then the throttle of the send-with-allocate trace point counted two sampled and two dropped records
+    EXPECT_EQ(skeleton_event_tracing_data_.send_with_allocate_throttle->GetNumberOfSampledRecords(), 2U);
+    EXPECT_EQ(skeleton_event_tracing_data_.send_with_allocate_throttle->GetNumberOfDroppedRecords(), 2U);
+}
+
 TEST_P(SkeletonEventTraceSendWithAllocateParamaterisedDeathTest,
        TraceSendWithAllocateWithInvalidTraceServiceElementTypeTerminates)
 {
@@ -369,6 +422,23 @@ class SkeletonEventTracingGenerateTracingStructFixture : public ::testing::TestW
         return *this;
     }
 
+    SkeletonEventTracingGenerateTracingStructFixture& WithSendTracePointThrottled(
+        const TracePointThrottlingConfig& throttling_config)
+    {
+        if (GetParam() == ServiceElementType::EVENT)
+        {
+            ON_CALL(tracing_filter_config_mock_, GetTracePointThrottling(_, _, SkeletonEventTracePointType::SEND))
+                .WillByDefault(Return(throttling_config));
+        }
+        else
+        {
+            ON_CALL(tracing_filter_config_mock_, GetTracePointThrottling(_, _, SkeletonFieldTracePointType::UPDATE))
+                .WillByDefault(Return(throttling_config));
+        }
+
+        return *this;
+    }
+
     SkeletonEventTracingGenerateTracingStructFixture& WithSendWithAllocateTracePointEnabled(bool is_enabled)
     {
         if (GetParam() == ServiceElementType::EVENT)
@@ -533,6 +603,45 @@ TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
     EXPECT_FALSE(tracing_data.enable_send_with_allocate);
 }
 
+TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
+       CallingGenerateTracingStructCreatesAndRegistersThrottleOfAThrottledTracePoint)
+{
+    // Given a valid tracing runtime and TracingFilterConfig and a throttled send trace point enabled in the
+    // TracingFilterConfig
+    WithSendTracePointEnabled(true).WithSendTracePointThrottled(TracePointThrottlingConfig{0.1, 100.0, 10U});
+
+    // Expecting that the throttle of the trace point gets registered at the tracing runtime
+    std::shared_ptr<const TracePointThrottle> registered_throttle{};
+    EXPECT_CALL(tracing_runtime_mock_, RegisterTracePointThrottle(_, _, _))
+        .WillOnce(SaveArg<2>(&registered_throttle));
+
+    // When calling GenerateSkeletonTracingStructFromEventConfig / GenerateSkeletonTracingStructFromFieldConfig
+    const auto tracing_data = GenerateSkeletonTracingStruct(
+        kConfigStore.GetInstanceIdentifier(), BindingType::kFake, GetServiceElementName());
+
+    // Then the provided struct contains the registered throttle for the send trace point only
+    ASSERT_NE(tracing_data.send_throttle, nullptr);
+    EXPECT_EQ(tracing_data.send_throttle, registered_throttle);
+    EXPECT_EQ(tracing_data.send_with_allocate_throttle, nullptr);
+}
+
+TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
+       CallingGenerateTracingStructCreatesNoThrottleForADisabledTracePoint)
+{
+    // Given a valid tracing runtime and TracingFilterConfig and a throttled, but disabled send trace point
+    WithSendTracePointEnabled(false).WithSendTracePointThrottled(TracePointThrottlingConfig{0.1, 100.0, 10U});
+
+    // Expecting that no throttle gets registered at the tracing runtime
+    EXPECT_CALL(tracing_runtime_mock_, RegisterTracePointThrottle(_, _, _)).Times(0);
+
+    // When calling GenerateSkeletonTracingStructFromEventConfig / GenerateSkeletonTracingStructFromFieldConfig
+    const auto tracing_data = GenerateSkeletonTracingStruct(
+        kConfigStore.GetInstanceIdentifier(), BindingType::kFake, GetServiceElementName());
+
+    // Then the provided struct contains no throttle
+    EXPECT_EQ(tracing_data.send_throttle, nullptr);
+}
+
 TEST_P(SkeletonEventTracingGenerateTracingStructFixture, CallingGenerateTracingStructWithoutTracingRuntimeReturnsEmpty)
 {
     // Given a valid TracingFilterConfig but no tracing runtime
@@ -605,5 +714,42 @@ TEST_P(SkeletonEventTracingGenerateTracingStructDeathTest,
                  ".*");
 }
 
+using SkeletonEventCreateTracingSendCallbackFixture = SkeletonEventTracingFixture;
+INSTANTIATE_TEST_SUITE_P(SkeletonEventCreateTracingSendCallbackFixture,
+                         SkeletonEventCreateTracingSendCallbackFixture,
+                         ::testing::Values(ServiceElementType::EVENT, ServiceElementType::FIELD));
+
+TEST_P(SkeletonEventCreateTracingSendCallbackFixture, CreatesSendCallbacksIfTracePointsAreEnabledAndTracingIsCompiledIn)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled();
+
+    // When creating the send callbacks
+    const auto send_callback =
+        CreateTracingSendCallback<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_);
+    const auto send_with_allocate_callback = CreateTracingSendWithAllocateCallback<TestSampleType>(
+        skeleton_event_tracing_data_, skeleton_event_binding_base_);
+
+    // Then the callbacks are only created, if IPC tracing is compiled in
+    EXPECT_EQ(send_callback.has_value(), kIpcTracingCompiledIn);
+    EXPECT_EQ(send_with_allocate_callback.has_value(), kIpcTracingCompiledIn);
+}
+
+TEST_P(SkeletonEventCreateTracingSendCallbackFixture, CreatesNoSendCallbacksIfTracePointsAreDisabled)
+{
+    // Given a SkeletonEventTracingData with all trace points disabled
+    WithAValidSkeletonEventTracingData();
+
+    // When creating the send callbacks
+    const auto send_callback =
+        CreateTracingSendCallback<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_);
+    const auto send_with_allocate_callback = CreateTracingSendWithAllocateCallback<TestSampleType>(
+        skeleton_event_tracing_data_, skeleton_event_binding_base_);
+
+    // Then no callbacks are created
+    EXPECT_FALSE(send_callback.has_value());
+    EXPECT_FALSE(send_with_allocate_callback.has_value());
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::tracing
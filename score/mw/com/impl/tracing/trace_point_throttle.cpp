@@ -0,0 +1,129 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace score::mw::com::impl::tracing
+{
+
+namespace
+{
+
+std::uint32_t ToSamplingRatioPpm(const double sampling_ratio) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE((sampling_ratio > 0.0) && (sampling_ratio <= 1.0),
+                                                      "Sampling ratio must be in the range (0, 1]");
+    const auto sampling_ratio_ppm =
+        std::lround(sampling_ratio * static_cast<double>(TracePointThrottle::kSamplingRatioScale));
+    // a very small (but valid) ratio shall still sample once in a while instead of never.
+    return static_cast<std::uint32_t>(std::max(sampling_ratio_ppm, 1L));
+}
+
+}  // namespace
+
+TracePointThrottle::TracePointThrottle(const TracePointThrottlingConfig& throttling_config) noexcept
+    : sampling_ratio_ppm_{ToSamplingRatioPpm(throttling_config.sampling_ratio)},
+      // start with a credit, which lets the very first call be sampled.
+      initial_sampling_credit_ppm_{kSamplingRatioScale - sampling_ratio_ppm_},
+      number_of_calls_{0U},
+      max_records_per_second_{throttling_config.max_records_per_second},
+      burst_size_{static_cast<double>(throttling_config.burst_size)},
+      token_bucket_mutex_{},
+      available_tokens_{burst_size_},
+      last_refill_{},
+      number_of_sampled_records_{0U},
+      number_of_dropped_records_{0U}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+        (!max_records_per_second_.has_value()) || (max_records_per_second_.value() > 0.0),
+        "Rate limit must be positive");
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(throttling_config.burst_size != 0U,
+                                                      "Burst size must be positive");
+}
+
+bool TracePointThrottle::ShouldTrace() noexcept
+{
+    // only pay for the clock read, if there is a rate limit at all.
+    const auto now = max_records_per_second_.has_value() ? Clock::now() : Clock::time_point{};
+    return ShouldTrace(now);
+}
+
+bool TracePointThrottle::ShouldTrace(const Clock::time_point now) noexcept
+{
+    const bool should_trace{IsSampled() && TryTakeToken(now)};
+    if (should_trace)
+    {
+        score::cpp::ignore = number_of_sampled_records_.fetch_add(1U, std::memory_order_relaxed);
+    }
+    else
+    {
+        score::cpp::ignore = number_of_dropped_records_.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return should_trace;
+}
+
+std::uint64_t TracePointThrottle::GetNumberOfSampledRecords() const noexcept
+{
+    return number_of_sampled_records_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t TracePointThrottle::GetNumberOfDroppedRecords() const noexcept
+{
+    return number_of_dropped_records_.load(std::memory_order_relaxed);
+}
+
+bool TracePointThrottle::IsSampled() noexcept
+{
+    // Every call adds sampling_ratio_ppm_ to the sampling credit and a call is sampled, whenever the credit passes a
+    // multiple of kSamplingRatioScale. The credit is computed from the index of the call instead of being accumulated,
+    // so that concurrent calls only share the call counter. The pattern of sampled calls repeats every
+    // kSamplingRatioScale calls, which keeps the credit small.
+    const std::uint64_t call_index{number_of_calls_.fetch_add(1U, std::memory_order_relaxed) % kSamplingRatioScale};
+    const std::uint64_t credit_before_call{initial_sampling_credit_ppm_ + (call_index * sampling_ratio_ppm_)};
+    const std::uint64_t credit_after_call{credit_before_call + sampling_ratio_ppm_};
+    return (credit_after_call / kSamplingRatioScale) != (credit_before_call / kSamplingRatioScale);
+}
+
+bool TracePointThrottle::TryTakeToken(const Clock::time_point now) noexcept
+{
+    if (!max_records_per_second_.has_value())
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock{token_bucket_mutex_};
+    if (last_refill_.has_value() && (now > last_refill_.value()))
+    {
+        const std::chrono::duration<double> elapsed_time{now - last_refill_.value()};
+        available_tokens_ =
+            std::min(burst_size_, available_tokens_ + (elapsed_time.count() * max_records_per_second_.value()));
+    }
+    if ((!last_refill_.has_value()) || (now > last_refill_.value()))
+    {
+        last_refill_ = now;
+    }
+
+    if (available_tokens_ < 1.0)
+    {
+        return false;
+    }
+    available_tokens_ -= 1.0;
+    return true;
+}
+
+}  // namespace score::mw::com::impl::tracing
@@ -0,0 +1,87 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_THROTTLE_H
+#define SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_THROTTLE_H
+
+#include "score/mw/com/impl/tracing/configuration/trace_point_throttling_config.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace score::mw::com::impl::tracing
+{
+
+/// \brief Runtime state of a throttled trace point, which decides per trace point call, whether it shall be traced.
+/// \details The decision is taken before any tracing data is extracted or any sample is handed over to the tracing
+///          runtime. So a call, which is dropped, only costs the sampling counter update (and a clock read, if a rate
+///          limit is configured). Sampling is deterministic: with a sampling ratio of e.g. 0.25 exactly every fourth
+///          call is sampled, starting with the first one. Sampled calls then have to take a token from a token bucket,
+///          which holds up to burst_size tokens and gets refilled with max_records_per_second.
+///          ShouldTrace() may be called concurrently, e.g. by several threads sending via the same skeleton event: The
+///          sampling decision is derived from a single atomic call counter, so that sampling stays lock-free. Only
+///          sampled calls of a rate limited trace point take the mutex protecting the token bucket. The record counters
+///          may be read concurrently from any thread.
+class TracePointThrottle final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Resolution of the sampling ratio, which is handled as integral parts-per-million internally.
+    static constexpr std::uint32_t kSamplingRatioScale{1'000'000U};
+
+    explicit TracePointThrottle(const TracePointThrottlingConfig& throttling_config) noexcept;
+
+    TracePointThrottle(const TracePointThrottle&) = delete;
+    TracePointThrottle(TracePointThrottle&&) = delete;
+    TracePointThrottle& operator=(const TracePointThrottle&) = delete;
+    TracePointThrottle& operator=(TracePointThrottle&&) = delete;
+    ~TracePointThrottle() noexcept = default;
+
+    /// \brief Decides, whether the current trace point call shall be traced and updates the record counters.
+    /// \return true, if the call shall be traced, false if it shall be dropped.
+    bool ShouldTrace() noexcept;
+
+    /// \brief Same as ShouldTrace(), but with the current time provided by the caller for the rate limit.
+    bool ShouldTrace(const Clock::time_point now) noexcept;
+
+    /// \brief Number of trace point calls, which passed the throttling and have been handed over for tracing.
+    std::uint64_t GetNumberOfSampledRecords() const noexcept;
+
+    /// \brief Number of trace point calls, which have been dropped by either sampling or rate limit.
+    std::uint64_t GetNumberOfDroppedRecords() const noexcept;
+
+  private:
+    bool IsSampled() noexcept;
+    bool TryTakeToken(const Clock::time_point now) noexcept;
+
+    std::uint32_t sampling_ratio_ppm_;
+    std::uint32_t initial_sampling_credit_ppm_;
+    std::atomic<std::uint64_t> number_of_calls_;
+
+    std::optional<double> max_records_per_second_;
+    double burst_size_;
+    /// \brief Protects available_tokens_ and last_refill_.
+    std::mutex token_bucket_mutex_;
+    double available_tokens_;
+    std::optional<Clock::time_point> last_refill_;
+
+    std::atomic<std::uint64_t> number_of_sampled_records_;
+    std::atomic<std::uint64_t> number_of_dropped_records_;
+};
+
+}  // namespace score::mw::com::impl::tracing
+
+#endif  // SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_THROTTLE_H
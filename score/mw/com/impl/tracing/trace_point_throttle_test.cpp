@@ -0,0 +1,224 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/trace_point_throttle.h"
+
+#include <gtest/gtest.h>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::tracing
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+std::uint32_t CountTracedCalls(TracePointThrottle& throttle,
+                               const std::uint32_t number_of_calls,
+                               const TracePointThrottle::Clock::time_point now)
+{
+    std::uint32_t traced_calls{0U};
+    for (std::uint32_t i = 0U; i < number_of_calls; ++i)
+    {
+        if (throttle.ShouldTrace(now))
+        {
+            ++traced_calls;
+        }
+    }
+    return traced_calls;
+}
+
+TEST(TracePointThrottleTest, DefaultConfigTracesEveryCall)
+{
+    // Given a throttle with a default constructed config
+    TracePointThrottle throttle{TracePointThrottlingConfig{}};
+
+    // When calling ShouldTrace 100 times
+    std::uint32_t traced_calls{0U};
+    for (std::uint32_t i = 0U; i < 100U; ++i)
+    {
+        if (throttle.ShouldTrace())
+        {
+            ++traced_calls;
+        }
+    }
+
+    // Then every call is traced and counted as sampled
+    EXPECT_EQ(traced_calls, 100U);
+    EXPECT_EQ(throttle.GetNumberOfSampledRecords(), 100U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 0U);
+}
+
+TEST(TracePointThrottleTest, SamplingTracesTheConfiguredRatioStartingWithTheFirstCall)
+{
+    // Given a throttle, which samples every tenth call
+    TracePointThrottle throttle{TracePointThrottlingConfig{0.1, {}, 1U}};
+    const TracePointThrottle::Clock::time_point now{};
+
+    // When calling ShouldTrace
+    // Then the first call is traced and the following nine are dropped
+    EXPECT_TRUE(throttle.ShouldTrace(now));
+    for (std::uint32_t i = 0U; i < 9U; ++i)
+    {
+        EXPECT_FALSE(throttle.ShouldTrace(now));
+    }
+    // and the eleventh call is traced again
+    EXPECT_TRUE(throttle.ShouldTrace(now));
+}
+
+TEST(TracePointThrottleTest, SamplingWithNonIntegralIntervalKeepsTheRatio)
+{
+    // Given a throttle, which samples 30% of the calls
+    TracePointThrottle throttle{TracePointThrottlingConfig{0.3, {}, 1U}};
+
+    // When calling ShouldTrace 1000 times
+    const auto traced_calls = CountTracedCalls(throttle, 1000U, TracePointThrottle::Clock::time_point{});
+
+    // Then exactly 300 calls are traced and 700 are dropped
+    EXPECT_EQ(traced_calls, 300U);
+    EXPECT_EQ(throttle.GetNumberOfSampledRecords(), 300U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 700U);
+}
+
+TEST(TracePointThrottleTest, RateLimitAllowsABurstAndThenDrops)
+{
+    // Given a throttle with a rate limit of 10 records per second and a burst size of 5
+    TracePointThrottle throttle{TracePointThrottlingConfig{1.0, 10.0, 5U}};
+
+    // When calling ShouldTrace 20 times at the same point in time
+    const auto traced_calls = CountTracedCalls(throttle, 20U, TracePointThrottle::Clock::time_point{});
+
+    // Then only the burst is traced
+    EXPECT_EQ(traced_calls, 5U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 15U);
+}
+
+TEST(TracePointThrottleTest, RateLimitRefillsTokensOverTime)
+{
+    // Given a throttle with a rate limit of 10 records per second and a burst size of 5, whose burst has been used up
+    TracePointThrottle throttle{TracePointThrottlingConfig{1.0, 10.0, 5U}};
+    const TracePointThrottle::Clock::time_point start{};
+    EXPECT_EQ(CountTracedCalls(throttle, 5U, start), 5U);
+
+    // When calling ShouldTrace 20 times 200ms later
+    const auto traced_calls = CountTracedCalls(throttle, 20U, start + 200ms);
+
+    // Then two more records are traced
+    EXPECT_EQ(traced_calls, 2U);
+}
+
+TEST(TracePointThrottleTest, RateLimitRefillIsCappedByTheBurstSize)
+{
+    // Given a throttle with a rate limit of 10 records per second and a burst size of 5, whose burst has been used up
+    TracePointThrottle throttle{TracePointThrottlingConfig{1.0, 10.0, 5U}};
+    const TracePointThrottle::Clock::time_point start{};
+    EXPECT_EQ(CountTracedCalls(throttle, 5U, start), 5U);
+
+    // When calling ShouldTrace 20 times 10s later
+    const auto traced_calls = CountTracedCalls(throttle, 20U, start + 10s);
+
+    // Then only a single burst is traced
+    EXPECT_EQ(traced_calls, 5U);
+}
+
+TEST(TracePointThrottleTest, RateLimitIsOnlyAppliedToSampledCalls)
+{
+    // Given a throttle, which samples every second call with a rate limit of 1 record per second and a burst size of 2
+    TracePointThrottle throttle{TracePointThrottlingConfig{0.5, 1.0, 2U}};
+
+    // When calling ShouldTrace 10 times at the same point in time
+    const auto traced_calls = CountTracedCalls(throttle, 10U, TracePointThrottle::Clock::time_point{});
+
+    // Then the first and the third call are traced, consuming the burst
+    EXPECT_EQ(traced_calls, 2U);
+    EXPECT_EQ(throttle.GetNumberOfSampledRecords(), 2U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 8U);
+}
+
+/// \brief Calls ShouldTrace number_of_calls times from each of number_of_threads threads at the same time.
+std::uint32_t CountTracedCallsOfConcurrentThreads(TracePointThrottle& throttle,
+                                                  const std::uint32_t number_of_threads,
+                                                  const std::uint32_t number_of_calls,
+                                                  const TracePointThrottle::Clock::time_point now)
+{
+    std::atomic<std::uint32_t> traced_calls{0U};
+    std::vector<std::thread> threads{};
+    for (std::uint32_t thread_index = 0U; thread_index < number_of_threads; ++thread_index)
+    {
+        threads.emplace_back([&throttle, &traced_calls, number_of_calls, now]() {
+            score::cpp::ignore = traced_calls.fetch_add(CountTracedCalls(throttle, number_of_calls, now));
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return traced_calls.load();
+}
+
+TEST(TracePointThrottleTest, ConcurrentCallsKeepTheSamplingRatio)
+{
+    // Given a throttle, which samples 30% of the calls
+    TracePointThrottle throttle{TracePointThrottlingConfig{0.3, {}, 1U}};
+
+    // When calling ShouldTrace 10000 times from each of 4 threads concurrently
+    const auto traced_calls =
+        CountTracedCallsOfConcurrentThreads(throttle, 4U, 10000U, TracePointThrottle::Clock::time_point{});
+
+    // Then exactly 30% of all calls are traced
+    EXPECT_EQ(traced_calls, 12000U);
+    EXPECT_EQ(throttle.GetNumberOfSampledRecords(), 12000U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 28000U);
+}
+
+TEST(TracePointThrottleTest, ConcurrentCallsShareTheRateLimit)
+{
+    // Given a throttle with a rate limit of 10 records per second and a burst size of 50
+    TracePointThrottle throttle{TracePointThrottlingConfig{1.0, 10.0, 50U}};
+
+    // When calling ShouldTrace 1000 times from each of 4 threads concurrently at the same point in time
+    const auto traced_calls =
+        CountTracedCallsOfConcurrentThreads(throttle, 4U, 1000U, TracePointThrottle::Clock::time_point{});
+
+    // Then only the burst is traced
+    EXPECT_EQ(traced_calls, 50U);
+    EXPECT_EQ(throttle.GetNumberOfDroppedRecords(), 3950U);
+}
+
+TEST(TracePointThrottleDeathTest, CreatingWithInvalidSamplingRatioTerminates)
+{
+    // Given a throttling config with a sampling ratio of 0
+    const TracePointThrottlingConfig throttling_config{0.0, {}, 1U};
+
+    // When creating a throttle from it
+    // Then the program terminates
+    EXPECT_DEATH(TracePointThrottle{throttling_config}, ".*");
+}
+
+TEST(TracePointThrottleDeathTest, CreatingWithZeroBurstSizeTerminates)
+{
+    // Given a throttling config with a burst size of 0
+    const TracePointThrottlingConfig throttling_config{1.0, 10.0, 0U};
+
+    // When creating a throttle from it
+    // Then the program terminates
+    EXPECT_DEATH(TracePointThrottle{throttling_config}, ".*");
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::tracing
@@ -23,6 +23,7 @@
 #include <score/optional.hpp>
 #include <score/overload.hpp>
 
+#include <mutex>
 #include <utility>
 
 namespace score::mw::com::impl::tracing
@@ -234,6 +235,51 @@ TracingRuntimeAtomicState& TracingRuntimeAtomicState::operator=(TracingRuntimeAt
     return *this;
 }
 
+TracePointThrottleRegistry::TracePointThrottleRegistry(TracePointThrottleRegistry&& other) noexcept
+    : mutex_{}, registered_throttles_{}
+{
+    std::lock_guard<std::mutex> other_lock{other.mutex_};
+    registered_throttles_ = std::move(other.registered_throttles_);
+}
+
+TracePointThrottleRegistry& TracePointThrottleRegistry::operator=(TracePointThrottleRegistry&& other) noexcept
+{
+    if (this != &other)
+    {
+        std::scoped_lock lock{mutex_, other.mutex_};
+        registered_throttles_ = std::move(other.registered_throttles_);
+    }
+    return *this;
+}
+
+void TracePointThrottleRegistry::Register(
+    const ServiceElementInstanceIdentifierView service_element_instance_identifier_view,
+    const ITracingRuntime::TracePointType trace_point_type,
+    std::shared_ptr<const TracePointThrottle> trace_point_throttle) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(trace_point_throttle != nullptr,
+                                                      "Registered trace point throttle must not be null");
+    std::lock_guard<std::mutex> lock{mutex_};
+    registered_throttles_.push_back(
+        {service_element_instance_identifier_view, trace_point_type, std::move(trace_point_throttle)});
+}
+
+std::vector<ITracingRuntime::TracePointThrottlingStatistics> TracePointThrottleRegistry::GetStatistics()
+    const noexcept
+{
+    std::vector<ITracingRuntime::TracePointThrottlingStatistics> statistics{};
+    std::lock_guard<std::mutex> lock{mutex_};
+    statistics.reserve(registered_throttles_.size());
+    for (const auto& registered_throttle : registered_throttles_)
+    {
+        statistics.push_back({registered_throttle.service_element_instance_identifier_view,
+                              registered_throttle.trace_point_type,
+                              registered_throttle.trace_point_throttle->GetNumberOfSampledRecords(),
+                              registered_throttle.trace_point_throttle->GetNumberOfDroppedRecords()});
+    }
+    return statistics;
+}
+
 }  // namespace detail_tracing_runtime
 
 void TracingRuntime::DisableTracing() noexcept
@@ -627,4 +673,19 @@ Result<void> TracingRuntime::Trace(const BindingType binding_type,
     return ProcessTraceCallResult(service_element_instance_identifier, trace_result, binding_runtime);
 }
 
+void TracingRuntime::RegisterTracePointThrottle(
+    const ServiceElementInstanceIdentifierView service_element_instance_identifier_view,
+    const TracePointType trace_point_type,
+    std::shared_ptr<const TracePointThrottle> trace_point_throttle) noexcept
+{
+    trace_point_throttle_registry_.Register(
+        service_element_instance_identifier_view, trace_point_type, std::move(trace_point_throttle));
+}
+
+std::vector<ITracingRuntime::TracePointThrottlingStatistics> TracingRuntime::GetTracePointThrottlingStatistics()
+    const noexcept
+{
+    return trace_point_throttle_registry_.GetStatistics();
+}
+
 }  // namespace score::mw::com::impl::tracing
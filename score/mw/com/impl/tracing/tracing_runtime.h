@@ -24,8 +24,11 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace score::mw::com::impl::tracing
 {
@@ -57,6 +60,36 @@ class TracingRuntimeAtomicState
     std::atomic_bool is_tracing_enabled;
 };
 
+/// \brief Keeps the throttles of all throttled trace points of this process to provide their record counters.
+/// \details Registration happens during creation of skeleton events/fields, which may happen from any thread.
+class TracePointThrottleRegistry
+{
+  public:
+    TracePointThrottleRegistry() noexcept = default;
+    TracePointThrottleRegistry(const TracePointThrottleRegistry&) = delete;
+    TracePointThrottleRegistry(TracePointThrottleRegistry&& other) noexcept;
+    ~TracePointThrottleRegistry() noexcept = default;
+    TracePointThrottleRegistry& operator=(const TracePointThrottleRegistry&) = delete;
+    TracePointThrottleRegistry& operator=(TracePointThrottleRegistry&& other) noexcept;
+
+    void Register(const ServiceElementInstanceIdentifierView service_element_instance_identifier_view,
+                  const ITracingRuntime::TracePointType trace_point_type,
+                  std::shared_ptr<const TracePointThrottle> trace_point_throttle) noexcept;
+
+    std::vector<ITracingRuntime::TracePointThrottlingStatistics> GetStatistics() const noexcept;
+
+  private:
+    struct RegisteredThrottle
+    {
+        ServiceElementInstanceIdentifierView service_element_instance_identifier_view;
+        ITracingRuntime::TracePointType trace_point_type;
+        std::shared_ptr<const TracePointThrottle> trace_point_throttle;
+    };
+
+    mutable std::mutex mutex_{};
+    std::vector<RegisteredThrottle> registered_throttles_{};
+};
+
 }  // namespace detail_tracing_runtime
 
 // Suppress "AUTOSAR C++14 M3-2-3" rule finding. This rule states: "A type, object or function that is used in multiple
@@ -160,9 +193,21 @@ class TracingRuntime : public ITracingRuntime
 
     IBindingTracingRuntime& GetBindingTracingRuntime(const BindingType binding_type) const noexcept override;
 
+    /// \brief Registers the throttle of a throttled trace point, so that its record counters are provided by
+    ///        GetTracePointThrottlingStatistics(). The throttle is kept alive by the TracingRuntime, so the counters
+    ///        stay available after the related service element has been destroyed.
+    void RegisterTracePointThrottle(const ServiceElementInstanceIdentifierView service_element_instance_identifier_view,
+                                    const TracePointType trace_point_type,
+                                    std::shared_ptr<const TracePointThrottle> trace_point_throttle) noexcept override;
+
+    /// \brief Returns the number of sampled and dropped records of all registered throttled trace points.
+    std::vector<TracePointThrottlingStatistics> GetTracePointThrottlingStatistics() const noexcept override;
+
   private:
     detail_tracing_runtime::TracingRuntimeAtomicState atomic_state_;
 
+    detail_tracing_runtime::TracePointThrottleRegistry trace_point_throttle_registry_;
+
     /// \brief Updates internal state, whether to e.g. to disable tracing, because of non-recoverable trace error or
     ///        to many consecutive recoverable errors. Will be called after each call to Trace with the given result.
     /// \param trace_call_result result of last call to Generic Trace API trace method.
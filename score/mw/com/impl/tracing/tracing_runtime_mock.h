@@ -54,6 +54,14 @@ class TracingRuntimeMock : public ITracingRuntime
                  std::size_t),
                 (noexcept, override));
     MOCK_METHOD(IBindingTracingRuntime&, GetBindingTracingRuntime, (BindingType), (const, noexcept, override));
+    MOCK_METHOD(void,
+                RegisterTracePointThrottle,
+                (ServiceElementInstanceIdentifierView, TracePointType, std::shared_ptr<const TracePointThrottle>),
+                (noexcept, override));
+    MOCK_METHOD(std::vector<TracePointThrottlingStatistics>,
+                GetTracePointThrottlingStatistics,
+                (),
+                (const, noexcept, override));
 };
 
 }  // namespace score::mw::com::impl::tracing
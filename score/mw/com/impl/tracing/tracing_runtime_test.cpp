@@ -554,5 +554,80 @@ TEST_F(TracingRuntimeRegisterServiceElementFixture, CallignDisableTracingWillDis
     EXPECT_FALSE(unit_under_test_->IsTracingEnabled());
 }
 
+using TracingRuntimeTracePointThrottlingFixture = TracingRuntimeFixture;
+TEST_F(TracingRuntimeTracePointThrottlingFixture, NoStatisticsAreProvidedWithoutRegisteredThrottles)
+{
+    // Given a TracingRuntime without registered trace point throttles
+
+    // When getting the trace point throttling statistics
+    const auto statistics = unit_under_test_->GetTracePointThrottlingStatistics();
+
+    // Then they are empty
+    EXPECT_TRUE(statistics.empty());
+}
+
+TEST_F(TracingRuntimeTracePointThrottlingFixture, StatisticsReflectTheRecordCountersOfTheRegisteredThrottles)
+{
+    // Given a TracingRuntime with a registered throttle, which samples every second call
+    auto trace_point_throttle = std::make_shared<TracePointThrottle>(TracePointThrottlingConfig{0.5, {}, 1U});
+    unit_under_test_->RegisterTracePointThrottle(
+        dummy_service_element_instance_identifier_view_, SkeletonEventTracePointType::SEND, trace_point_throttle);
+
+    // and the throttle having decided on three calls
+    score::cpp::ignore = trace_point_throttle->ShouldTrace();
+    score::cpp::ignore = trace_point_throttle->ShouldTrace();
+    score::cpp::ignore = trace_point_throttle->ShouldTrace();
+
+    // When getting the trace point throttling statistics
+    const auto statistics = unit_under_test_->GetTracePointThrottlingStatistics();
+
+    // Then they contain the record counters of the registered throttle
+    ASSERT_EQ(statistics.size(), 1U);
+    EXPECT_EQ(statistics[0].service_element_instance_identifier_view, dummy_service_element_instance_identifier_view_);
+    EXPECT_EQ(statistics[0].trace_point_type,
+              ITracingRuntime::TracePointType{SkeletonEventTracePointType::SEND});
+    EXPECT_EQ(statistics[0].number_of_sampled_records, 2U);
+    EXPECT_EQ(statistics[0].number_of_dropped_records, 1U);
+}
+
+TEST_F(TracingRuntimeTracePointThrottlingFixture, StatisticsAreKeptWhenTheServiceElementReleasesItsThrottle)
+{
+    // Given a TracingRuntime with a registered throttle, which has dropped a call
+    auto trace_point_throttle = std::make_shared<TracePointThrottle>(TracePointThrottlingConfig{1.0, 1.0, 1U});
+    unit_under_test_->RegisterTracePointThrottle(
+        dummy_service_element_instance_identifier_view_, SkeletonEventTracePointType::SEND, trace_point_throttle);
+    score::cpp::ignore = trace_point_throttle->ShouldTrace(TracePointThrottle::Clock::time_point{});
+    score::cpp::ignore = trace_point_throttle->ShouldTrace(TracePointThrottle::Clock::time_point{});
+
+    // When the service element releases its throttle
+    trace_point_throttle.reset();
+
+    // Then the statistics still contain the record counters of the throttle
+    const auto statistics = unit_under_test_->GetTracePointThrottlingStatistics();
+    ASSERT_EQ(statistics.size(), 1U);
+    EXPECT_EQ(statistics[0].number_of_sampled_records, 1U);
+    EXPECT_EQ(statistics[0].number_of_dropped_records, 1U);
+}
+
+TEST(TracingRuntimeMove, MoveConstructKeepsRegisteredTracePointThrottles)
+{
+    // Given a TracingRuntime with a registered throttle
+    mock_binding::TracingRuntime binding_tracing_runtime_mock;
+    std::unordered_map<BindingType, IBindingTracingRuntime*> binding_tracing_runtime_map;
+    binding_tracing_runtime_map.emplace(BindingType::kLoLa, &binding_tracing_runtime_mock);
+    TracingRuntime runtime_1(std::move(binding_tracing_runtime_map));
+    const ServiceElementIdentifierView service_element_identifier_view{
+        kDummyServiceTypeName, kDummyElementName, ServiceElementType::EVENT};
+    runtime_1.RegisterTracePointThrottle({service_element_identifier_view, kInstanceSpecifier},
+                                         SkeletonEventTracePointType::SEND,
+                                         std::make_shared<TracePointThrottle>(TracePointThrottlingConfig{}));
+
+    // When move constructing another TracingRuntime from it
+    TracingRuntime runtime_2(std::move(runtime_1));
+
+    // Then the moved-to TracingRuntime provides the statistics of the registered throttle
+    EXPECT_EQ(runtime_2.GetTracePointThrottlingStatistics().size(), 1U);
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl::tracing
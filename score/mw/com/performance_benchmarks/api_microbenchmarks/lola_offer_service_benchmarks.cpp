@@ -0,0 +1,210 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/runtime.h"
+#include "score/mw/com/runtime_configuration.h"
+#include "score/mw/com/types.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+constexpr std::string_view kOfferServiceInstanceSpecifier = "test/lola_offer_service_benchmark";
+constexpr auto kShmSizeCacheFilePath = "/tmp/lola_offer_service_benchmark_shm_size_cache.json";
+
+/// \brief Where the shm-object sizes of the offered service come from.
+enum class ShmSizeSource : std::int64_t
+{
+    /// First offer in a fresh process without cache file: sizes are calculated via simulation.
+    kSimulation = 0,
+    /// First offer in a fresh process with a populated cache file: sizes are read from the file.
+    kCacheFile = 1,
+    /// Re-offer within the same process: sizes are taken from the in-process cache.
+    kInProcessCache = 2,
+};
+
+template <std::size_t Size>
+using Payload = std::array<std::uint8_t, Size>;
+
+/// \brief Service with several events of different sizes, whose layout is costly to simulate.
+template <typename T>
+struct OfferServiceBenchmarkInterface : public T::Base
+{
+    using T::Base::Base;
+    typename T::template Event<std::uint64_t> event_0{*this, "event_0"};
+    typename T::template Event<Payload<16U>> event_1{*this, "event_1"};
+    typename T::template Event<Payload<64U>> event_2{*this, "event_2"};
+    typename T::template Event<Payload<256U>> event_3{*this, "event_3"};
+    typename T::template Event<Payload<512U>> event_4{*this, "event_4"};
+    typename T::template Event<Payload<1024U>> event_5{*this, "event_5"};
+    typename T::template Event<Payload<2048U>> event_6{*this, "event_6"};
+    typename T::template Event<Payload<4096U>> event_7{*this, "event_7"};
+};
+
+using OfferServiceBenchmarkSkeleton = score::mw::com::AsSkeleton<OfferServiceBenchmarkInterface>;
+
+struct OfferMeasurement
+{
+    std::int64_t offer_ns;
+    std::int64_t startup_ns;
+};
+
+filesystem::Path GetConfigPath(const ShmSizeSource shm_size_source)
+{
+    if (shm_size_source == ShmSizeSource::kCacheFile)
+    {
+        return filesystem::Path{
+            "score/mw/com/performance_benchmarks/api_microbenchmarks/config/"
+            "mw_com_config_offer_service_shm_size_cache.json"};
+    }
+    return filesystem::Path{
+        "score/mw/com/performance_benchmarks/api_microbenchmarks/config/mw_com_config_offer_service.json"};
+}
+
+/// \brief Body of the forked process: initializes the runtime, creates the skeleton and measures its OfferService().
+///
+/// A fresh process is needed per measurement, as the runtime can only be initialized once per process and the
+/// in-process cache would otherwise serve all but the first offer.
+[[noreturn]] void RunOfferingProcess(const ShmSizeSource shm_size_source,
+                                     const std::chrono::steady_clock::time_point fork_time,
+                                     const int result_fd)
+{
+    runtime::InitializeRuntime(runtime::RuntimeConfiguration{GetConfigPath(shm_size_source)});
+
+    auto skeleton_result = OfferServiceBenchmarkSkeleton::Create(
+        InstanceSpecifier::Create(std::string{kOfferServiceInstanceSpecifier}).value());
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(skeleton_result.has_value());
+    auto& skeleton = skeleton_result.value();
+
+    if (shm_size_source == ShmSizeSource::kInProcessCache)
+    {
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(skeleton.OfferService().has_value());
+        skeleton.StopOfferService();
+    }
+
+    const auto offer_start = std::chrono::steady_clock::now();
+    const auto offer_result = skeleton.OfferService();
+    const auto offer_end = std::chrono::steady_clock::now();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(offer_result.has_value());
+    skeleton.StopOfferService();
+
+    const OfferMeasurement measurement{
+        std::chrono::duration_cast<std::chrono::nanoseconds>(offer_end - offer_start).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(offer_end - fork_time).count()};
+    const auto written = ::write(result_fd, &measurement, sizeof(measurement));
+    ::_exit(written == static_cast<ssize_t>(sizeof(measurement)) ? 0 : 1);
+}
+
+OfferMeasurement MeasureOfferInNewProcess(const ShmSizeSource shm_size_source)
+{
+    int result_pipe[2]{};
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(::pipe(result_pipe) == 0);
+
+    const auto fork_time = std::chrono::steady_clock::now();
+    const pid_t pid = ::fork();
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(pid >= 0);
+    if (pid == 0)
+    {
+        score::cpp::ignore = ::close(result_pipe[0]);
+        RunOfferingProcess(shm_size_source, fork_time, result_pipe[1]);
+    }
+    score::cpp::ignore = ::close(result_pipe[1]);
+
+    OfferMeasurement measurement{};
+    const auto read_bytes = ::read(result_pipe[0], &measurement, sizeof(measurement));
+    score::cpp::ignore = ::close(result_pipe[0]);
+
+    int status{};
+    score::cpp::ignore = ::waitpid(pid, &status, 0);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+        (read_bytes == static_cast<ssize_t>(sizeof(measurement))) && WIFEXITED(status) && (WEXITSTATUS(status) == 0),
+        "Offering process failed");
+    return measurement;
+}
+
+void ReportPercentiles(benchmark::State& state, const std::string& prefix, std::vector<double>& values_ns)
+{
+    if (values_ns.empty())
+    {
+        return;
+    }
+    std::sort(values_ns.begin(), values_ns.end());
+    const auto percentile = [&values_ns](const double fraction) {
+        const auto index = static_cast<std::size_t>(fraction * static_cast<double>(values_ns.size() - 1U));
+        return values_ns[index];
+    };
+    state.counters[prefix + "p50_ns"] = percentile(0.5);
+    state.counters[prefix + "p90_ns"] = percentile(0.9);
+    state.counters[prefix + "max_ns"] = values_ns.back();
+}
+
+/// \brief Measures the OfferService() call of a skeleton (manual time) and the startup time from process creation up to
+///        the completed offer, depending on where the shm-object sizes come from.
+void BM_OfferService(benchmark::State& state)
+{
+    const auto shm_size_source = static_cast<ShmSizeSource>(state.range(0));
+
+    // Start each run with an empty cache file. In case of kCacheFile, populate it with a warm-up process.
+    score::cpp::ignore = std::remove(kShmSizeCacheFilePath);
+    if (shm_size_source == ShmSizeSource::kCacheFile)
+    {
+        score::cpp::ignore = MeasureOfferInNewProcess(shm_size_source);
+    }
+
+    std::vector<double> offer_ns{};
+    std::vector<double> startup_ns{};
+    for (auto _ : state)
+    {
+        const auto measurement = MeasureOfferInNewProcess(shm_size_source);
+        state.SetIterationTime(static_cast<double>(measurement.offer_ns) / 1e9);
+        offer_ns.push_back(static_cast<double>(measurement.offer_ns));
+        startup_ns.push_back(static_cast<double>(measurement.startup_ns));
+    }
+
+    ReportPercentiles(state, "offer_", offer_ns);
+    ReportPercentiles(state, "startup_", startup_ns);
+    score::cpp::ignore = std::remove(kShmSizeCacheFilePath);
+}
+
+}  // namespace
+
+BENCHMARK(BM_OfferService)
+    ->ArgName("shm_size_source")
+    ->Arg(static_cast<std::int64_t>(ShmSizeSource::kSimulation))
+    ->Arg(static_cast<std::int64_t>(ShmSizeSource::kCacheFile))
+    ->Arg(static_cast<std::int64_t>(ShmSizeSource::kInProcessCache))
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace score::mw::com::test
+
+// Run the benchmark (must be at global scope)
+BENCHMARK_MAIN();
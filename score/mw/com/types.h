@@ -75,6 +75,12 @@ using ServiceHandleContainer = ::score::mw::com::impl::ServiceHandleContainer<T>
 template <typename T>
 using FindServiceHandler = ::score::mw::com::impl::FindServiceHandler<T>;
 
+/// \api
+/// \brief Callback that notifies the callee only about the changes of the service availability.
+/// See ProxyBase::StartFindServiceDelta for more information.
+template <typename T>
+using FindServiceDeltaHandler = ::score::mw::com::impl::FindServiceDeltaHandler<T>;
+
 /// \api
 /// \brief Subscription state of a proxy event.
 /// See ProxyEvent::GetSubscriptionStatus for slightly more information.